@@ -0,0 +1,157 @@
+// Copyright 2020-2024, Roberto De Ioris.
+
+#include "glTFRuntimeParser.h"
+#include "Async/ParallelFor.h"
+#include "Misc/AutomationTest.h"
+#include "glTFRuntimeTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace glTFRuntimeAccessorDecodeTests
+{
+	using namespace glTFRuntimeTests;
+
+	struct FComponentType
+	{
+		const TCHAR* Name;
+		int64 ComponentType;
+		int32 ComponentSize;
+		bool bNormalized;
+	};
+
+	const FComponentType ComponentTypes[] = {
+		{ TEXT("FLOAT"), 5126, 4, false },
+		{ TEXT("BYTE"), 5120, 1, false },
+		{ TEXT("BYTE normalized"), 5120, 1, true },
+		{ TEXT("UNSIGNED_BYTE"), 5121, 1, false },
+		{ TEXT("UNSIGNED_BYTE normalized"), 5121, 1, true },
+		{ TEXT("SHORT"), 5122, 2, false },
+		{ TEXT("SHORT normalized"), 5122, 2, true },
+		{ TEXT("UNSIGNED_SHORT"), 5123, 2, false },
+		{ TEXT("UNSIGNED_SHORT normalized"), 5123, 2, true }
+	};
+
+	// vertex attributes elements are 4 bytes aligned
+	int32 GetStride(const FComponentType& ComponentType)
+	{
+		return Align(ComponentType.ComponentSize * 3, 4);
+	}
+
+	// one VEC3 accessor (with its own bufferView) per entry of ComponentTypes, floats are kept finite
+	TArray<uint8> MakeAccessorsGlb(const int32 Count, TArray<uint8>& OutBinary)
+	{
+		FString BufferViews;
+		FString Accessors;
+		OutBinary.Empty();
+		for (int32 Index = 0; Index < UE_ARRAY_COUNT(ComponentTypes); Index++)
+		{
+			const FComponentType& ComponentType = ComponentTypes[Index];
+			const int32 Stride = GetStride(ComponentType);
+			const int32 Offset = OutBinary.Num();
+			TArray64<uint8> Noise = MakeNoise(static_cast<int64>(Count) * Stride, 1000 + Index);
+			if (ComponentType.ComponentType == 5126)
+			{
+				float* Floats = reinterpret_cast<float*>(Noise.GetData());
+				for (int64 FloatIndex = 0; FloatIndex < Noise.Num() / 4; FloatIndex++)
+				{
+					Floats[FloatIndex] = (static_cast<int32>(FloatIndex * 2654435761u) % 100000) / 1000.f;
+				}
+			}
+			OutBinary.Append(Noise.GetData(), Noise.Num());
+
+			const TCHAR* Separator = Index > 0 ? TEXT(",") : TEXT("");
+			BufferViews += FString::Printf(TEXT("%s{\"buffer\":0,\"byteOffset\":%d,\"byteLength\":%d,\"byteStride\":%d}"), Separator, Offset, Count * Stride, Stride);
+			Accessors += FString::Printf(TEXT("%s{\"bufferView\":%d,\"componentType\":%lld,\"normalized\":%s,\"count\":%d,\"type\":\"VEC3\"}"),
+				Separator, Index, ComponentType.ComponentType, ComponentType.bNormalized ? TEXT("true") : TEXT("false"), Count);
+		}
+
+		return MakeGlb(FString::Printf(TEXT("{\"asset\":{\"version\":\"2.0\"},\"buffers\":[{\"byteLength\":%d}],\"bufferViews\":[%s],\"accessors\":[%s]}"), OutBinary.Num(), *BufferViews, *Accessors), OutBinary);
+	}
+
+	// element by element decoding through a TFunction, as done before the batched kernels
+	void DecodeReference(const FComponentType& ComponentType, const uint8* Data, const int32 Count, TArray<FVector>& Output)
+	{
+		TFunction<float(const uint8*)> ReadComponent;
+		switch (ComponentType.ComponentType)
+		{
+		case(5126):
+			ReadComponent = [](const uint8* Ptr) { return *reinterpret_cast<const float*>(Ptr); };
+			break;
+		case(5120):
+			ReadComponent = [&ComponentType](const uint8* Ptr) { const int8 Value = *reinterpret_cast<const int8*>(Ptr); return ComponentType.bNormalized ? FMath::Max(Value / 127.f, -1.f) : static_cast<float>(Value); };
+			break;
+		case(5121):
+			ReadComponent = [&ComponentType](const uint8* Ptr) { return ComponentType.bNormalized ? *Ptr / 255.f : static_cast<float>(*Ptr); };
+			break;
+		case(5122):
+			ReadComponent = [&ComponentType](const uint8* Ptr) { const int16 Value = *reinterpret_cast<const int16*>(Ptr); return ComponentType.bNormalized ? FMath::Max(Value / 32767.f, -1.f) : static_cast<float>(Value); };
+			break;
+		case(5123):
+			ReadComponent = [&ComponentType](const uint8* Ptr) { const uint16 Value = *reinterpret_cast<const uint16*>(Ptr); return ComponentType.bNormalized ? Value / 65535.f : static_cast<float>(Value); };
+			break;
+		}
+
+		const int32 Stride = GetStride(ComponentType);
+		Output.SetNumUninitialized(Count);
+		ParallelFor(Count, [&](const int32 ElementIndex)
+			{
+				const uint8* Element = Data + static_cast<int64>(ElementIndex) * Stride;
+				for (int32 ComponentIndex = 0; ComponentIndex < 3; ComponentIndex++)
+				{
+					Output[ElementIndex][ComponentIndex] = ReadComponent(Element + ComponentIndex * ComponentType.ComponentSize);
+				}
+			});
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeAccessorDecodeBenchmark, "glTFRuntime.AccessorDecode.Benchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FglTFRuntimeAccessorDecodeBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeAccessorDecodeTests;
+
+	constexpr int32 Count = 2 * 1024 * 1024;
+	TArray<uint8> Binary;
+	const TArray<uint8> Glb = MakeAccessorsGlb(Count, Binary);
+
+	TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromData(Glb.GetData(), Glb.Num(), FglTFRuntimeConfig());
+	if (!TestTrue(TEXT("glb is parsed"), Parser.IsValid()))
+	{
+		return false;
+	}
+
+	constexpr int32 Runs = 5;
+	int32 Offset = 0;
+	for (int32 Index = 0; Index < UE_ARRAY_COUNT(ComponentTypes); Index++)
+	{
+		const FComponentType& ComponentType = ComponentTypes[Index];
+		TSharedRef<FJsonObject> Attributes = MakeShared<FJsonObject>();
+		Attributes->SetNumberField(TEXT("ACCESSOR"), Index);
+
+		TArray<FVector> Decoded;
+		const double KernelSeconds = MeasureBestSeconds(Runs, [&]()
+			{
+				Decoded.Reset();
+				Parser->BuildFromAccessorField(Attributes, TEXT("ACCESSOR"), Decoded, { 3 }, { 5126, 5120, 5121, 5122, 5123 }, INDEX_NONE, false, nullptr);
+			});
+
+		TArray<FVector> Reference;
+		const double ReferenceSeconds = MeasureBestSeconds(Runs, [&]()
+			{
+				DecodeReference(ComponentType, Binary.GetData() + Offset, Count, Reference);
+			});
+
+		const int64 Bytes = static_cast<int64>(Count) * GetStride(ComponentType);
+		if (TestTrue(FString::Printf(TEXT("%s matches the element by element decoding"), ComponentType.Name), Decoded == Reference))
+		{
+			AddBenchmarkInfo(*this, FString::Printf(TEXT("%s batched kernel"), ComponentType.Name), KernelSeconds, Bytes);
+			AddBenchmarkInfo(*this, FString::Printf(TEXT("%s element by element"), ComponentType.Name), ReferenceSeconds, Bytes);
+		}
+
+		Offset += Count * GetStride(ComponentType);
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,101 @@
+// Copyright 2020-2023, Roberto De Ioris.
+
+#include "glTFRuntimeParser.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Base64.h"
+#include "glTFRuntimeTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace glTFRuntimeAccessorViewTests
+{
+	using namespace glTFRuntimeTests;
+
+	// 3 float positions, 3 uint16 indices, a sparse index and a sparse float3 value
+	TArray<uint8> MakeBinary()
+	{
+		TArray<uint8> Binary;
+		const float Positions[] = { 0, 0, 0, 1, 0, 0, 0, 1, 0 };
+		Binary.Append(reinterpret_cast<const uint8*>(Positions), sizeof(Positions));
+		const uint16 Indices[] = { 0, 1, 2, 0 };
+		Binary.Append(reinterpret_cast<const uint8*>(Indices), sizeof(Indices));
+		const uint16 SparseIndices[] = { 1, 0 };
+		Binary.Append(reinterpret_cast<const uint8*>(SparseIndices), sizeof(SparseIndices));
+		const float SparseValues[] = { 5, 6, 7 };
+		Binary.Append(reinterpret_cast<const uint8*>(SparseValues), sizeof(SparseValues));
+		return Binary;
+	}
+
+	FString MakeJson(const FString& BufferUri, const int32 BufferNum)
+	{
+		return FString::Printf(TEXT("{\"asset\":{\"version\":\"2.0\"},\"buffers\":[{\"byteLength\":%d%s}],")
+			TEXT("\"bufferViews\":[{\"buffer\":0,\"byteOffset\":0,\"byteLength\":36},{\"buffer\":0,\"byteOffset\":36,\"byteLength\":6},{\"buffer\":0,\"byteOffset\":44,\"byteLength\":2},{\"buffer\":0,\"byteOffset\":48,\"byteLength\":12}],")
+			TEXT("\"accessors\":[{\"bufferView\":0,\"componentType\":5126,\"count\":3,\"type\":\"VEC3\"},{\"bufferView\":1,\"componentType\":5123,\"count\":3,\"type\":\"SCALAR\"},")
+			TEXT("{\"bufferView\":0,\"componentType\":5126,\"count\":3,\"type\":\"VEC3\",\"sparse\":{\"count\":1,\"indices\":{\"bufferView\":2,\"componentType\":5123},\"values\":{\"bufferView\":3}}}]}"),
+			BufferNum, *BufferUri);
+	}
+
+	bool CheckViews(FAutomationTestBase& Test, const FString& What, TSharedPtr<FglTFRuntimeParser>& Parser)
+	{
+		FglTFRuntimeAccessorView Positions;
+		FglTFRuntimeAccessorView Indices;
+		FglTFRuntimeAccessorView Sparse;
+		if (!Test.TestTrue(What + TEXT(" views are created"), Parser->GetAccessorView(0, Positions) && Parser->GetAccessorView(1, Indices) && Parser->GetAccessorView(2, Sparse)))
+		{
+			return false;
+		}
+
+		Test.TestFalse(What + TEXT(" sparse data is owned by the view"), Sparse.Data == Positions.Data);
+
+		// the views co-own (or copy) their data, so the parser caches and buffers can go away
+		Parser->ClearCache();
+		Parser->TrimBuffers();
+		Parser.Reset();
+
+		Test.TestEqual(What + TEXT(" positions count"), Positions.Count, static_cast<int64>(3));
+		Test.TestTrue(What + TEXT(" position 1"), Positions.GetValue<FVector3f>(1) == FVector3f(1, 0, 0));
+		Test.TestTrue(What + TEXT(" position 2"), Positions.GetValue<FVector3f>(2) == FVector3f(0, 1, 0));
+
+		const TArrayView64<const uint16> IndicesView = Indices.GetArrayView<uint16>();
+		if (Test.TestEqual(What + TEXT(" indices count"), IndicesView.Num(), static_cast<int64>(3)))
+		{
+			Test.TestTrue(What + TEXT(" index 0"), IndicesView[0] == 0);
+			Test.TestTrue(What + TEXT(" index 1"), IndicesView[1] == 1);
+			Test.TestTrue(What + TEXT(" index 2"), IndicesView[2] == 2);
+		}
+
+		Test.TestTrue(What + TEXT(" sparse position 0"), Sparse.GetValue<FVector3f>(0) == FVector3f(0, 0, 0));
+		Test.TestTrue(What + TEXT(" sparse position 1"), Sparse.GetValue<FVector3f>(1) == FVector3f(5, 6, 7));
+		Test.TestTrue(What + TEXT(" sparse position 2"), Sparse.GetValue<FVector3f>(2) == FVector3f(0, 1, 0));
+
+		return true;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeAccessorViewLifetimeTest, "glTFRuntime.AccessorView.Lifetime", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeAccessorViewLifetimeTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeAccessorViewTests;
+
+	const TArray<uint8> Binary = MakeBinary();
+
+	// data uri buffer (parser buffers cache)
+	TSharedPtr<FglTFRuntimeParser> GltfParser = FglTFRuntimeParser::FromString(MakeJson(TEXT(",\"uri\":\"data:application/octet-stream;base64,") + FBase64::Encode(Binary) + TEXT("\""), Binary.Num()), FglTFRuntimeConfig());
+	if (TestTrue(TEXT("gltf is parsed"), GltfParser.IsValid()))
+	{
+		CheckViews(*this, TEXT("gltf"), GltfParser);
+	}
+
+	// glb binary chunk
+	const TArray<uint8> Glb = MakeGlb(MakeJson(TEXT(""), Binary.Num()), Binary);
+	TSharedPtr<FglTFRuntimeParser> GlbParser = FglTFRuntimeParser::FromData(Glb.GetData(), Glb.Num(), FglTFRuntimeConfig());
+	if (TestTrue(TEXT("glb is parsed"), GlbParser.IsValid()))
+	{
+		CheckViews(*this, TEXT("glb"), GlbParser);
+	}
+
+	return true;
+}
+
+#endif
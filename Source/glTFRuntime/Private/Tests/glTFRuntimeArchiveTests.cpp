@@ -0,0 +1,807 @@
+// Copyright 2020-2023, Roberto De Ioris.
+
+#include "glTFRuntimeParser.h"
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "glTFRuntimeTestUtils.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "zlib.h"
+THIRD_PARTY_INCLUDES_END
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace glTFRuntimeArchiveTests
+{
+	using namespace glTFRuntimeTests;
+
+	TArray64<uint8> Deflate(const TArray64<uint8>& Data)
+	{
+		z_stream Stream = {};
+		deflateInit2(&Stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+		TArray64<uint8> Compressed;
+		Compressed.AddUninitialized(deflateBound(&Stream, Data.Num()));
+		Stream.next_in = const_cast<uint8*>(Data.GetData());
+		Stream.avail_in = Data.Num();
+		Stream.next_out = Compressed.GetData();
+		Stream.avail_out = Compressed.Num();
+		deflate(&Stream, Z_FINISH);
+		Compressed.SetNum(Stream.total_out);
+		deflateEnd(&Stream);
+		return Compressed;
+	}
+
+	struct FZipEntry
+	{
+		FString Filename;
+		TArray64<uint8> Data;
+		bool bDeflate = false;
+		// forged uncompressed size stored in the headers (0 uses the real size)
+		uint64 UncompressedSizeOverride = 0;
+	};
+
+	/*
+	* Builds a zip64 archive: sizes and offsets are always stored in the zip64 extra fields,
+	* the end of central directory only points to the zip64 record.
+	* BaseOffset is added to every stored offset, for archives placed after some other data.
+	*/
+	TArray64<uint8> BuildZip64(const TArray<FZipEntry>& Entries, const uint64 Zip64TrailerOffsetOverride = 0, const uint64 EntryOffsetOverride = 0, const uint64 BaseOffset = 0)
+	{
+		TArray64<uint8> Zip;
+		TArray64<uint8> CentralDirectory;
+
+		for (const FZipEntry& Entry : Entries)
+		{
+			const FTCHARToUTF8 Filename(*Entry.Filename);
+			const TArray64<uint8> Payload = Entry.bDeflate ? Deflate(Entry.Data) : Entry.Data;
+			const uint32 Crc = crc32(0, Entry.Data.GetData(), Entry.Data.Num());
+			const uint64 EntryOffset = BaseOffset + Zip.Num();
+			const uint64 UncompressedSize = Entry.UncompressedSizeOverride ? Entry.UncompressedSizeOverride : Entry.Data.Num();
+
+			Write32(Zip, 0x04034b50);
+			Write16(Zip, 45);
+			Write16(Zip, 0);
+			Write16(Zip, Entry.bDeflate ? 8 : 0);
+			Write32(Zip, 0);
+			Write32(Zip, Crc);
+			Write32(Zip, 0xFFFFFFFF);
+			Write32(Zip, 0xFFFFFFFF);
+			Write16(Zip, Filename.Length());
+			Write16(Zip, 20);
+			Zip.Append(reinterpret_cast<const uint8*>(Filename.Get()), Filename.Length());
+			Write16(Zip, 0x0001);
+			Write16(Zip, 16);
+			Write64(Zip, UncompressedSize);
+			Write64(Zip, Payload.Num());
+			Zip.Append(Payload);
+
+			Write32(CentralDirectory, 0x02014b50);
+			Write16(CentralDirectory, 45);
+			Write16(CentralDirectory, 45);
+			Write16(CentralDirectory, 0);
+			Write16(CentralDirectory, Entry.bDeflate ? 8 : 0);
+			Write32(CentralDirectory, 0);
+			Write32(CentralDirectory, Crc);
+			Write32(CentralDirectory, 0xFFFFFFFF);
+			Write32(CentralDirectory, 0xFFFFFFFF);
+			Write16(CentralDirectory, Filename.Length());
+			Write16(CentralDirectory, 28);
+			Write16(CentralDirectory, 0);
+			Write16(CentralDirectory, 0);
+			Write16(CentralDirectory, 0);
+			Write32(CentralDirectory, 0);
+			Write32(CentralDirectory, 0xFFFFFFFF);
+			CentralDirectory.Append(reinterpret_cast<const uint8*>(Filename.Get()), Filename.Length());
+			Write16(CentralDirectory, 0x0001);
+			Write16(CentralDirectory, 24);
+			Write64(CentralDirectory, UncompressedSize);
+			Write64(CentralDirectory, Payload.Num());
+			Write64(CentralDirectory, EntryOffsetOverride ? EntryOffsetOverride : EntryOffset);
+		}
+
+		const uint64 CentralDirectoryOffset = BaseOffset + Zip.Num();
+		Zip.Append(CentralDirectory);
+
+		const uint64 Zip64TrailerOffset = BaseOffset + Zip.Num();
+		Write32(Zip, 0x06064b50);
+		Write64(Zip, 44);
+		Write16(Zip, 45);
+		Write16(Zip, 45);
+		Write32(Zip, 0);
+		Write32(Zip, 0);
+		Write64(Zip, Entries.Num());
+		Write64(Zip, Entries.Num());
+		Write64(Zip, CentralDirectory.Num());
+		Write64(Zip, CentralDirectoryOffset);
+
+		Write32(Zip, 0x07064b50);
+		Write32(Zip, 0);
+		Write64(Zip, Zip64TrailerOffsetOverride ? Zip64TrailerOffsetOverride : Zip64TrailerOffset);
+		Write32(Zip, 1);
+
+		Write32(Zip, 0x06054b50);
+		Write16(Zip, 0xFFFF);
+		Write16(Zip, 0xFFFF);
+		Write16(Zip, 0xFFFF);
+		Write16(Zip, 0xFFFF);
+		Write32(Zip, 0xFFFFFFFF);
+		Write32(Zip, 0xFFFFFFFF);
+		Write16(Zip, 0);
+
+		return Zip;
+	}
+
+	/*
+	* Virtual archive bigger than 4GB: only a few segments hold real bytes, everything else reads as zeros.
+	*/
+	class FSparseDataSource : public FglTFRuntimeDataSource
+	{
+	public:
+		FSparseDataSource(const int64 InDataNum) : DataNum(InDataNum)
+		{
+		}
+
+		void AddSegment(const int64 Offset, const TArray64<uint8>& Bytes)
+		{
+			Segments.Add(TPair<int64, TArray64<uint8>>(Offset, Bytes));
+		}
+
+		int64 Num() const override
+		{
+			return DataNum;
+		}
+
+		const uint8* GetRange(const int64 Offset, const int64 Size, TArray64<uint8>& Scratch) const override
+		{
+			if (Offset < 0 || Size < 0 || Offset > DataNum || Size > DataNum - Offset)
+			{
+				return nullptr;
+			}
+
+			for (const TPair<int64, TArray64<uint8>>& Segment : Segments)
+			{
+				if (Offset >= Segment.Key && Offset + Size <= Segment.Key + Segment.Value.Num())
+				{
+					return Segment.Value.GetData() + (Offset - Segment.Key);
+				}
+			}
+
+			Scratch.SetNumZeroed(Size);
+			for (const TPair<int64, TArray64<uint8>>& Segment : Segments)
+			{
+				const int64 Start = FMath::Max(Offset, Segment.Key);
+				const int64 End = FMath::Min(Offset + Size, Segment.Key + Segment.Value.Num());
+				if (Start < End)
+				{
+					FMemory::Memcpy(Scratch.GetData() + (Start - Offset), Segment.Value.GetData() + (Start - Segment.Key), End - Start);
+				}
+			}
+			return Scratch.GetData();
+		}
+
+	protected:
+		int64 DataNum;
+		TArray<TPair<int64, TArray64<uint8>>> Segments;
+	};
+
+	// ustar header (the checksum is not verified by the reader)
+	TArray64<uint8> MakeTarHeader(const FString& Filename, const int64 Size, const uint8 TypeFlag)
+	{
+		TArray64<uint8> Header;
+		Header.AddZeroed(512);
+		const FTCHARToUTF8 UTF8Filename(*Filename);
+		FMemory::Memcpy(Header.GetData(), UTF8Filename.Get(), FMath::Min(UTF8Filename.Length(), 100));
+		// 11 octal digits, NUL terminated
+		for (int32 DigitIndex = 0; DigitIndex < 11; DigitIndex++)
+		{
+			Header[124 + 10 - DigitIndex] = static_cast<uint8>('0' + ((Size >> (DigitIndex * 3)) & 7));
+		}
+		Header[156] = TypeFlag;
+		FMemory::Memcpy(Header.GetData() + 257, "ustar", 6);
+		FMemory::Memcpy(Header.GetData() + 263, "00", 2);
+		return Header;
+	}
+
+	// "<len> <key>=<value>\n", where len includes its own digits
+	FString MakePaxRecord(const FString& Key, const FString& Value)
+	{
+		const FString Body = FString::Printf(TEXT(" %s=%s\n"), *Key, *Value);
+		int32 RecordLen = Body.Len();
+		while (FString::FromInt(RecordLen).Len() + Body.Len() != RecordLen)
+		{
+			RecordLen = FString::FromInt(RecordLen).Len() + Body.Len();
+		}
+		return FString::FromInt(RecordLen) + Body;
+	}
+
+	void AppendTarEntry(TArray64<uint8>& Tar, const FString& Filename, const TArray64<uint8>& Data, const uint8 TypeFlag = '0')
+	{
+		Tar.Append(MakeTarHeader(Filename, Data.Num(), TypeFlag));
+		Tar.Append(Data);
+		Tar.AddZeroed(Align(Tar.Num(), 512) - Tar.Num());
+	}
+
+	// the end of archive blocks, padded to the 10KB tar record
+	void FinishTar(TArray64<uint8>& Tar)
+	{
+		Tar.AddZeroed(1024);
+		Tar.AddZeroed(Align(Tar.Num(), 10240) - Tar.Num());
+	}
+
+	// counts the bytes requested to a memory source
+	class FCountingDataSource : public FglTFRuntimeMemoryDataSource
+	{
+	public:
+		FCountingDataSource(const TArray64<uint8>& InData) : FglTFRuntimeMemoryDataSource(InData.GetData(), InData.Num())
+		{
+		}
+
+		const uint8* GetRange(const int64 Offset, const int64 Size, TArray64<uint8>& Scratch) const override
+		{
+			BytesRead += Size;
+			return FglTFRuntimeMemoryDataSource::GetRange(Offset, Size, Scratch);
+		}
+
+		mutable int64 BytesRead = 0;
+	};
+
+	TArray64<uint8> MakeData(const int64 Num, const uint32 Seed)
+	{
+		// compressible but not trivial
+		TArray64<uint8> Data = MakeNoise(Num, Seed);
+		for (int64 Index = 0; Index < Num; Index++)
+		{
+			Data[Index] = static_cast<uint8>((Data[Index] & 0xF) + (Index % 7));
+		}
+		return Data;
+	}
+
+	// deflated and stored entries, alternating
+	TArray<FZipEntry> MakeZipEntries(const int32 NumEntries, const int64 EntrySize)
+	{
+		TArray<FZipEntry> Entries;
+		for (int32 EntryIndex = 0; EntryIndex < NumEntries; EntryIndex++)
+		{
+			Entries.Add({ FString::Printf(TEXT("textures/texture_%d.png"), EntryIndex), MakeData(EntrySize + EntryIndex, 100 + EntryIndex), EntryIndex % 2 == 0 });
+		}
+		return Entries;
+	}
+
+	bool SaveToTransientFile(const TArray64<uint8>& Data, const FString& Extension, FString& OutFilename)
+	{
+		OutFilename = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("glTFRuntimeArchive"), FGuid::NewGuid().ToString() + Extension);
+		return FFileHelper::SaveArrayToFile(Data, *OutFilename);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeArchiveZip64Test, "glTFRuntime.Archive.Zip64", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeArchiveZip64Test::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeArchiveTests;
+
+	TArray<FZipEntry> Entries;
+	Entries.Add({ TEXT("scene.gltf"), MakeData(1000, 1), false });
+	Entries.Add({ TEXT("textures/base color.png"), MakeData(300000, 2), true });
+	Entries.Add({ TEXT("empty.bin"), TArray64<uint8>(), false });
+
+	const TArray64<uint8> Zip = BuildZip64(Entries);
+
+	FglTFRuntimeArchiveZip Archive;
+	if (!TestTrue(TEXT("zip64 archive is opened"), Archive.FromData(Zip.GetData(), Zip.Num())))
+	{
+		return false;
+	}
+
+	for (const FZipEntry& Entry : Entries)
+	{
+		TestTrue(FString::Printf(TEXT("%s exists"), *Entry.Filename), Archive.FileExists(Entry.Filename));
+		TArray64<uint8> Content;
+		if (TestTrue(FString::Printf(TEXT("%s is read"), *Entry.Filename), Archive.GetFileContent(Entry.Filename, Content)))
+		{
+			TestTrue(FString::Printf(TEXT("%s matches"), *Entry.Filename), Content == Entry.Data);
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeArchiveZip64OverflowTest, "glTFRuntime.Archive.Zip64Overflow", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeArchiveZip64OverflowTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeArchiveTests;
+
+	TArray<FZipEntry> Entries;
+	Entries.Add({ TEXT("scene.gltf"), MakeData(1000, 3), false });
+
+	// offsets near 2^64 wrap the naive Offset + Size checks
+	const TArray64<uint8> BadTrailer = BuildZip64(Entries, 0xFFFFFFFFFFFFFFF0ull);
+	FglTFRuntimeArchiveZip BadTrailerArchive;
+	TestFalse(TEXT("wrapping zip64 trailer offset is rejected"), BadTrailerArchive.FromData(BadTrailer.GetData(), BadTrailer.Num()));
+
+	const TArray64<uint8> BadEntry = BuildZip64(Entries, 0, 0xFFFFFFFFFFFFFFF0ull);
+	FglTFRuntimeArchiveZip BadEntryArchive;
+	if (TestTrue(TEXT("archive with a bad entry offset is indexed"), BadEntryArchive.FromData(BadEntry.GetData(), BadEntry.Num())))
+	{
+		TArray64<uint8> Content;
+		TestFalse(TEXT("wrapping entry offset is rejected"), BadEntryArchive.GetFileContent(TEXT("scene.gltf"), Content));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeArchiveZipInflateBoundsTest, "glTFRuntime.Archive.ZipInflateBounds", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeArchiveZipInflateBoundsTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeArchiveTests;
+
+	TArray<FZipEntry> Entries;
+	// a size deflate can not reach from a few hundred bytes
+	Entries.Add({ TEXT("impossible.bin"), MakeData(4096, 4), true, 1ull << 40 });
+	// plausible ratio, but the stream ends before the claimed size
+	Entries.Add({ TEXT("short.bin"), MakeData(4096, 5), true, 8192 });
+	// the stream produces more than the claimed size
+	Entries.Add({ TEXT("long.bin"), MakeData(4096, 6), true, 1024 });
+	Entries.Add({ TEXT("valid.bin"), MakeData(4096, 7), true });
+
+	const TArray64<uint8> Zip = BuildZip64(Entries);
+
+	FglTFRuntimeArchiveZip Archive;
+	if (!TestTrue(TEXT("zip64 archive is opened"), Archive.FromData(Zip.GetData(), Zip.Num())))
+	{
+		return false;
+	}
+
+	for (int32 EntryIndex = 0; EntryIndex < 3; EntryIndex++)
+	{
+		AddExpectedError(TEXT("ZIP entry"), EAutomationExpectedErrorFlags::Contains, 1);
+		TArray64<uint8> Content;
+		TestFalse(FString::Printf(TEXT("%s is rejected"), *Entries[EntryIndex].Filename), Archive.GetFileContent(Entries[EntryIndex].Filename, Content));
+		TestEqual(FString::Printf(TEXT("%s leaves no data"), *Entries[EntryIndex].Filename), Content.Num(), static_cast<int64>(0));
+	}
+
+	TArray64<uint8> Content;
+	if (TestTrue(TEXT("valid.bin is read"), Archive.GetFileContent(TEXT("valid.bin"), Content)))
+	{
+		TestTrue(TEXT("valid.bin matches"), Content == Entries[3].Data);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeArchiveZip64SparseTest, "glTFRuntime.Archive.Zip64Sparse", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeArchiveZip64SparseTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeArchiveTests;
+
+	TArray<FZipEntry> Entries;
+	Entries.Add({ TEXT("scene.gltf"), MakeData(1000, 8), false });
+	Entries.Add({ TEXT("textures/base color.png"), MakeData(300000, 9), true });
+
+	// every entry, the central directory and the zip64 records live past 5GB
+	constexpr int64 BaseOffset = 5ll * 1024 * 1024 * 1024;
+	const TArray64<uint8> Zip = BuildZip64(Entries, 0, 0, BaseOffset);
+
+	TSharedRef<FSparseDataSource> DataSource = MakeShared<FSparseDataSource>(BaseOffset + Zip.Num());
+	DataSource->AddSegment(BaseOffset, Zip);
+
+	FglTFRuntimeArchiveZip Archive;
+	if (!TestTrue(TEXT("sparse zip64 archive is opened"), Archive.FromDataSource(DataSource)))
+	{
+		return false;
+	}
+
+	for (const FZipEntry& Entry : Entries)
+	{
+		TArray64<uint8> Content;
+		if (TestTrue(FString::Printf(TEXT("%s is read"), *Entry.Filename), Archive.GetFileContent(Entry.Filename, Content)))
+		{
+			TestTrue(FString::Printf(TEXT("%s matches"), *Entry.Filename), Content == Entry.Data);
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeArchiveTarSparseTest, "glTFRuntime.Archive.TarSparse", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeArchiveTarSparseTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeArchiveTests;
+
+	// the pax size of the first big entry does not fit the octal header field, the second one uses the 11 digits octal field
+	constexpr int64 PaxBigSize = 5ll * 1024 * 1024 * 1024 + 123;
+	constexpr int64 OctalBigSize = 4ll * 1024 * 1024 * 1024 + 456;
+	const TArray64<uint8> Scene = MakeData(1000, 10);
+
+	TArray64<uint8> Head;
+	Head.Append(MakeTarHeader(TEXT("asset/"), 0, '5'));
+	const TArray<uint8> PaxRecords = ToUTF8(MakePaxRecord(TEXT("size"), FString::Printf(TEXT("%lld"), PaxBigSize)));
+	Head.Append(MakeTarHeader(TEXT("PaxHeaders/big.bin"), PaxRecords.Num(), 'x'));
+	Head.Append(PaxRecords.GetData(), PaxRecords.Num());
+	Head.AddZeroed(Align(Head.Num(), 512) - Head.Num());
+	Head.Append(MakeTarHeader(TEXT("asset/big.bin"), 0, '0'));
+
+	const int64 OctalBigHeaderOffset = Head.Num() + Align(PaxBigSize, 512);
+	const int64 SceneHeaderOffset = OctalBigHeaderOffset + 512 + Align(OctalBigSize, 512);
+
+	TArray64<uint8> Tail = MakeTarHeader(TEXT("asset/scene.gltf"), Scene.Num(), '0');
+	Tail.Append(Scene);
+	Tail.AddZeroed(Align(Tail.Num(), 512) - Tail.Num() + 1024);
+
+	TSharedRef<FSparseDataSource> DataSource = MakeShared<FSparseDataSource>(SceneHeaderOffset + Tail.Num());
+	DataSource->AddSegment(0, Head);
+	DataSource->AddSegment(OctalBigHeaderOffset, MakeTarHeader(TEXT("asset/big2.bin"), OctalBigSize, '0'));
+	DataSource->AddSegment(SceneHeaderOffset, Tail);
+
+	FglTFRuntimeArchiveTar Archive;
+	if (!TestTrue(TEXT("sparse tar archive is indexed"), Archive.FromDataSource(DataSource)))
+	{
+		return false;
+	}
+
+	TestTrue(TEXT("pax sized entry exists"), Archive.FileExists(TEXT("big.bin")));
+	TestTrue(TEXT("octal sized entry exists"), Archive.FileExists(TEXT("big2.bin")));
+
+	// the entry starts past 9GB
+	TArray64<uint8> Content;
+	if (TestTrue(TEXT("scene.gltf is read"), Archive.GetFileContent(TEXT("scene.gltf"), Content)))
+	{
+		TestTrue(TEXT("scene.gltf matches"), Content == Scene);
+	}
+
+	// a size pointing past the end of the archive
+	TSharedRef<FSparseDataSource> TruncatedDataSource = MakeShared<FSparseDataSource>(SceneHeaderOffset - 512);
+	TruncatedDataSource->AddSegment(0, Head);
+	TruncatedDataSource->AddSegment(OctalBigHeaderOffset, MakeTarHeader(TEXT("asset/big2.bin"), OctalBigSize, '0'));
+	FglTFRuntimeArchiveTar TruncatedArchive;
+	TestFalse(TEXT("truncated sparse tar archive is rejected"), TruncatedArchive.FromDataSource(TruncatedDataSource));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeArchiveZipConcurrentReadsTest, "glTFRuntime.Archive.ZipConcurrentReads", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeArchiveZipConcurrentReadsTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeArchiveTests;
+
+	const TArray<FZipEntry> Entries = MakeZipEntries(16, 64 * 1024);
+	const TArray64<uint8> Zip = BuildZip64(Entries);
+
+	FString Filename;
+	if (!TestTrue(TEXT("zip is written"), SaveToTransientFile(Zip, TEXT(".zip"), Filename)))
+	{
+		return false;
+	}
+
+	// the same archive from memory and from a file handle (released before deleting the file)
+	{
+		FglTFRuntimeArchiveZip MemoryArchive;
+		FglTFRuntimeArchiveZip FileArchive;
+		TSharedPtr<FglTFRuntimeFileDataSource> FileDataSource = FglTFRuntimeFileDataSource::Open(Filename);
+		if (TestTrue(TEXT("memory zip is opened"), MemoryArchive.FromData(Zip.GetData(), Zip.Num())) &&
+			TestTrue(TEXT("zip file is opened"), FileDataSource.IsValid() && FileArchive.FromDataSource(FileDataSource.ToSharedRef())))
+		{
+			for (FglTFRuntimeArchiveZip* Archive : { &MemoryArchive, &FileArchive })
+			{
+				// every entry is read several times, concurrent reads of the same entry included
+				constexpr int32 NumReads = 256;
+				TArray<bool> Matches;
+				Matches.AddZeroed(NumReads);
+				ParallelFor(NumReads, [&](const int32 ReadIndex)
+					{
+						const FZipEntry& Entry = Entries[ReadIndex % Entries.Num()];
+						TArray64<uint8> Content;
+						Matches[ReadIndex] = Archive->GetFileContent(Entry.Filename, Content) && Content == Entry.Data;
+					});
+
+				const TCHAR* Name = Archive == &MemoryArchive ? TEXT("memory") : TEXT("file");
+				TestFalse(FString::Printf(TEXT("concurrent %s reads match"), Name), Matches.Contains(false));
+			}
+		}
+	}
+
+	IFileManager::Get().Delete(*Filename);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeArchiveZipParallelBenchmark, "glTFRuntime.Archive.ZipParallelBenchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FglTFRuntimeArchiveZipParallelBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeArchiveTests;
+
+	constexpr int32 NumEntries = 32;
+	const TArray<FZipEntry> Entries = MakeZipEntries(NumEntries, 4 * 1024 * 1024);
+	const TArray64<uint8> Zip = BuildZip64(Entries);
+	int64 TotalBytes = 0;
+	for (const FZipEntry& Entry : Entries)
+	{
+		TotalBytes += Entry.Data.Num();
+	}
+
+	FString Filename;
+	if (!TestTrue(TEXT("zip is written"), SaveToTransientFile(Zip, TEXT(".zip"), Filename)))
+	{
+		return false;
+	}
+
+	constexpr int32 Runs = 3;
+	{
+		FglTFRuntimeArchiveZip MemoryArchive;
+		FglTFRuntimeArchiveZip FileArchive;
+		TSharedPtr<FglTFRuntimeFileDataSource> FileDataSource = FglTFRuntimeFileDataSource::Open(Filename);
+		if (TestTrue(TEXT("memory zip is opened"), MemoryArchive.FromData(Zip.GetData(), Zip.Num())) &&
+			TestTrue(TEXT("zip file is opened"), FileDataSource.IsValid() && FileArchive.FromDataSource(FileDataSource.ToSharedRef())))
+		{
+			for (FglTFRuntimeArchiveZip* Archive : { &MemoryArchive, &FileArchive })
+			{
+				const TCHAR* Name = Archive == &MemoryArchive ? TEXT("memory") : TEXT("file");
+
+				const double SerialSeconds = MeasureBestSeconds(Runs, [&]()
+					{
+						for (const FZipEntry& Entry : Entries)
+						{
+							TArray64<uint8> Content;
+							Archive->GetFileContent(Entry.Filename, Content);
+						}
+					});
+				AddBenchmarkInfo(*this, FString::Printf(TEXT("%d %s entries, serial"), NumEntries, Name), SerialSeconds, TotalBytes);
+
+				const double ParallelSeconds = MeasureBestSeconds(Runs, [&]()
+					{
+						ParallelFor(Entries.Num(), [&](const int32 EntryIndex)
+							{
+								TArray64<uint8> Content;
+								Archive->GetFileContent(Entries[EntryIndex].Filename, Content);
+							});
+					});
+				AddBenchmarkInfo(*this, FString::Printf(TEXT("%d %s entries, ParallelFor"), NumEntries, Name), ParallelSeconds, TotalBytes);
+			}
+		}
+	}
+
+	IFileManager::Get().Delete(*Filename);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeArchiveTarIndexTest, "glTFRuntime.Archive.TarIndex", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeArchiveTarIndexTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeArchiveTests;
+
+	const TArray64<uint8> Scene = MakeData(1000, 20);
+	const TArray64<uint8> Texture = MakeData(300000, 21);
+	const TArray64<uint8> LongNamed = MakeData(700, 22);
+	const TArray64<uint8> PaxSized = MakeData(5000, 23);
+	const FString LongName = TEXT("textures/") + FString::ChrN(150, 'a') + TEXT(".png");
+
+	TArray64<uint8> Tar;
+	AppendTarEntry(Tar, TEXT("asset/"), TArray64<uint8>(), '5');
+	AppendTarEntry(Tar, TEXT("asset/scene.gltf"), Scene);
+	AppendTarEntry(Tar, TEXT("asset/textures/"), TArray64<uint8>(), '5');
+	AppendTarEntry(Tar, TEXT("asset/textures/base color.png"), Texture);
+	AppendTarEntry(Tar, TEXT("asset/empty.bin"), TArray64<uint8>());
+	// global pax headers are skipped
+	const TArray<uint8> GlobalRecords = ToUTF8(MakePaxRecord(TEXT("comment"), TEXT("glTFRuntime")));
+	AppendTarEntry(Tar, TEXT("pax_global_header"), TArray64<uint8>(GlobalRecords.GetData(), GlobalRecords.Num()), 'g');
+	// GNU long name
+	const TArray<uint8> LongNameBytes = ToUTF8(TEXT("asset/") + LongName);
+	AppendTarEntry(Tar, TEXT("././@LongLink"), TArray64<uint8>(LongNameBytes.GetData(), LongNameBytes.Num()), 'L');
+	AppendTarEntry(Tar, TEXT("asset/truncated"), LongNamed);
+	// pax path and size override the ustar fields of the next entry
+	const TArray<uint8> PaxRecords = ToUTF8(MakePaxRecord(TEXT("path"), TEXT("asset/buffers/pax.bin")) + MakePaxRecord(TEXT("size"), FString::FromInt(PaxSized.Num())));
+	AppendTarEntry(Tar, TEXT("PaxHeaders/pax.bin"), TArray64<uint8>(PaxRecords.GetData(), PaxRecords.Num()), 'x');
+	Tar.Append(MakeTarHeader(TEXT("asset/ignored.bin"), 0, '0'));
+	Tar.Append(PaxSized);
+	Tar.AddZeroed(Align(Tar.Num(), 512) - Tar.Num());
+	FinishTar(Tar);
+
+	TSharedRef<FCountingDataSource> DataSource = MakeShared<FCountingDataSource>(Tar);
+	FglTFRuntimeArchiveTar Archive;
+	if (!TestTrue(TEXT("tar archive is indexed"), Archive.FromDataSource(DataSource)))
+	{
+		return false;
+	}
+
+	// 10 headers plus the end of archive block, the global pax payload is skipped
+	TestEqual(TEXT("indexing reads headers and meta payloads only"), DataSource->BytesRead, static_cast<int64>(11 * 512 + LongNameBytes.Num() + PaxRecords.Num()));
+
+	TArray<FString> Items;
+	Archive.GetItems(Items);
+	Items.Sort();
+	TestTrue(TEXT("only files are indexed, without the prefix"), Items == TArray<FString>({ TEXT("buffers/pax.bin"), TEXT("empty.bin"), TEXT("scene.gltf"), LongName, TEXT("textures/base color.png") }));
+
+	struct FExpectedEntry
+	{
+		FString Filename;
+		const TArray64<uint8>& Data;
+	};
+	for (const FExpectedEntry& Entry : { FExpectedEntry{ TEXT("scene.gltf"), Scene }, FExpectedEntry{ TEXT("textures/base color.png"), Texture }, FExpectedEntry{ LongName, LongNamed }, FExpectedEntry{ TEXT("buffers/pax.bin"), PaxSized } })
+	{
+		TArray64<uint8> Content;
+		if (TestTrue(FString::Printf(TEXT("%s is read"), *Entry.Filename), Archive.GetFileContent(Entry.Filename, Content)))
+		{
+			TestTrue(FString::Printf(TEXT("%s matches"), *Entry.Filename), Content == Entry.Data);
+		}
+	}
+
+	TArray64<uint8> Empty = { 1 };
+	TestTrue(TEXT("empty entry is read"), Archive.GetFileContent(TEXT("empty.bin"), Empty) && Empty.Num() == 0);
+	TArray64<uint8> Missing;
+	TestFalse(TEXT("missing entry is not read"), Archive.GetFileContent(TEXT("missing.bin"), Missing));
+	TestFalse(TEXT("prefixed name is not indexed"), Archive.FileExists(TEXT("asset/scene.gltf")));
+
+	// entry content is read from the source only on request
+	const int64 BytesBeforeRead = DataSource->BytesRead;
+	TArray64<uint8> Content;
+	Archive.GetFileContent(TEXT("textures/base color.png"), Content);
+	TestEqual(TEXT("reading an entry reads only its bytes"), DataSource->BytesRead - BytesBeforeRead, static_cast<int64>(Texture.Num()));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeArchiveTarOverflowTest, "glTFRuntime.Archive.TarOverflow", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeArchiveTarOverflowTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeArchiveTests;
+
+	const TArray64<uint8> Scene = MakeData(1000, 24);
+
+	// a pax size record followed by the entry it describes
+	auto MakePaxTar = [&Scene](const FString& Size)
+		{
+			TArray64<uint8> Tar;
+			AppendTarEntry(Tar, TEXT("asset/"), TArray64<uint8>(), '5');
+			const TArray<uint8> PaxRecords = ToUTF8(MakePaxRecord(TEXT("size"), Size));
+			AppendTarEntry(Tar, TEXT("PaxHeaders/scene.gltf"), TArray64<uint8>(PaxRecords.GetData(), PaxRecords.Num()), 'x');
+			AppendTarEntry(Tar, TEXT("asset/scene.gltf"), Scene);
+			FinishTar(Tar);
+			return Tar;
+		};
+
+	auto IsIndexed = [](const TArray64<uint8>& Tar)
+		{
+			FglTFRuntimeArchiveTar Archive;
+			return Archive.FromDataSource(MakeShared<FglTFRuntimeMemoryDataSource>(Tar.GetData(), Tar.Num()));
+		};
+
+	TestTrue(TEXT("matching pax size is accepted"), IsIndexed(MakePaxTar(FString::FromInt(Scene.Num()))));
+
+	// 18 digits can not overflow, 19 and more are rejected before multiplying
+	TestFalse(TEXT("18 digits pax size past the end is rejected"), IsIndexed(MakePaxTar(TEXT("999999999999999999"))));
+	TestFalse(TEXT("19 digits pax size is rejected"), IsIndexed(MakePaxTar(TEXT("9223372036854775807"))));
+	TestFalse(TEXT("pax size wrapping int64 is rejected"), IsIndexed(MakePaxTar(TEXT("18446744073709551617"))));
+	TestFalse(TEXT("huge pax size is rejected"), IsIndexed(MakePaxTar(FString::ChrN(64, '9'))));
+
+	// the octal size field pointing past the end of the archive
+	TArray64<uint8> OctalTar;
+	AppendTarEntry(OctalTar, TEXT("asset/"), TArray64<uint8>(), '5');
+	OctalTar.Append(MakeTarHeader(TEXT("asset/scene.gltf"), 077777777777, '0'));
+	FinishTar(OctalTar);
+	TestFalse(TEXT("octal size past the end is rejected"), IsIndexed(OctalTar));
+
+	// meta payloads are bounded
+	TArray64<uint8> MetaTar;
+	AppendTarEntry(MetaTar, TEXT("asset/"), TArray64<uint8>(), '5');
+	AppendTarEntry(MetaTar, TEXT("././@LongLink"), MakeData(2 * 1024 * 1024, 25), 'L');
+	AppendTarEntry(MetaTar, TEXT("asset/scene.gltf"), Scene);
+	FinishTar(MetaTar);
+	TestFalse(TEXT("oversized meta payload is rejected"), IsIndexed(MetaTar));
+
+	// headers without the ustar magic
+	TArray64<uint8> BadMagicTar = MakePaxTar(FString::FromInt(Scene.Num()));
+	BadMagicTar[512 + 257] = 'x';
+	TestFalse(TEXT("header without magic is rejected"), IsIndexed(BadMagicTar));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeArchiveTarBenchmark, "glTFRuntime.Archive.TarBenchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FglTFRuntimeArchiveTarBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeArchiveTests;
+
+	// 64 entries of 4MB
+	constexpr int32 NumEntries = 64;
+	FString Filename;
+	{
+		TArray64<uint8> Tar;
+		AppendTarEntry(Tar, TEXT("asset/"), TArray64<uint8>(), '5');
+		for (int32 EntryIndex = 0; EntryIndex < NumEntries; EntryIndex++)
+		{
+			AppendTarEntry(Tar, FString::Printf(TEXT("asset/textures/texture_%d.png"), EntryIndex), MakeNoise(4 * 1024 * 1024, 200 + EntryIndex));
+		}
+		FinishTar(Tar);
+		if (!TestTrue(TEXT("tar is written"), SaveToTransientFile(Tar, TEXT(".tar"), Filename)))
+		{
+			return false;
+		}
+	}
+
+	const int64 FileSize = IFileManager::Get().FileSize(*Filename);
+	constexpr int32 Runs = 3;
+
+	// index only, straight from the file
+	auto OpenIndexFromFile = [&Filename]()
+		{
+			TSharedPtr<FglTFRuntimeFileDataSource> FileDataSource = FglTFRuntimeFileDataSource::Open(Filename);
+			FglTFRuntimeArchiveTar Archive;
+			return FileDataSource && Archive.FromDataSource(FileDataSource.ToSharedRef());
+		};
+
+	// index only, over the loaded file (the FromData path)
+	auto OpenIndexFromMemory = [&Filename]()
+		{
+			TArray64<uint8> Data;
+			FFileHelper::LoadFileToArray(Data, *Filename);
+			FglTFRuntimeArchiveTar Archive;
+			return Archive.FromDataSource(MakeShared<FglTFRuntimeMemoryDataSource>(MoveTemp(Data)));
+		};
+
+	// every entry copied to a map archive, as the tar branch of FromData used to do
+	auto OpenExtracted = [&Filename]()
+		{
+			TArray64<uint8> Data;
+			FFileHelper::LoadFileToArray(Data, *Filename);
+			FglTFRuntimeArchiveTar Archive;
+			if (!Archive.FromDataSource(MakeShared<FglTFRuntimeMemoryDataSource>(Data.GetData(), Data.Num())))
+			{
+				return false;
+			}
+
+			TArray<FString> Items;
+			Archive.GetItems(Items);
+			TMap<FString, TArray64<uint8>> Map;
+			for (const FString& Item : Items)
+			{
+				Archive.GetFileContent(Item, Map.Add(Item));
+			}
+			FglTFRuntimeArchiveMap ArchiveMap;
+			ArchiveMap.FromMap(MoveTemp(Map));
+			return true;
+		};
+
+	struct FOpenMode
+	{
+		const TCHAR* Name;
+		TFunction<bool()> Open;
+	};
+
+	for (const FOpenMode& OpenMode : { FOpenMode{ TEXT("Index from file"), OpenIndexFromFile }, FOpenMode{ TEXT("Index from memory"), OpenIndexFromMemory }, FOpenMode{ TEXT("Extract every entry"), OpenExtracted } })
+	{
+		bool bOpened = false;
+		const int64 PeakMemory = MeasurePeakMemory([&]()
+			{
+				bOpened = OpenMode.Open();
+			});
+		const double Seconds = MeasureBestSeconds(Runs, [&]()
+			{
+				OpenMode.Open();
+			});
+
+		if (TestTrue(FString::Printf(TEXT("%s opens the archive"), OpenMode.Name), bOpened))
+		{
+			AddBenchmarkInfo(*this, FString::Printf(TEXT("%s open time"), OpenMode.Name), Seconds, FileSize);
+			AddInfo(FString::Printf(TEXT("%s peak resident memory growth: %.2f MB (archive %.2f MB)"), OpenMode.Name, PeakMemory / (1024.0 * 1024.0), FileSize / (1024.0 * 1024.0)));
+		}
+	}
+
+	IFileManager::Get().Delete(*Filename);
+
+	return true;
+}
+
+#endif
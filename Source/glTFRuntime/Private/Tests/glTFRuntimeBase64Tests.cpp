@@ -0,0 +1,135 @@
+// Copyright 2020-2024, Roberto De Ioris.
+
+#include "glTFRuntimeParser.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Base64.h"
+#include "glTFRuntimeTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace glTFRuntimeBase64Tests
+{
+	using namespace glTFRuntimeTests;
+
+	bool Decode(const FString& Base64, TArray64<uint8>& Bytes)
+	{
+		return FglTFRuntimeParser::DecodeBase64(*Base64, Base64.Len(), Bytes);
+	}
+
+	bool Matches(const TArray64<uint8>& Bytes, const TArray<uint8>& Expected)
+	{
+		return Bytes.Num() == Expected.Num() && FMemory::Memcmp(Bytes.GetData(), Expected.GetData(), Expected.Num()) == 0;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeBase64DecodeTest, "glTFRuntime.Base64.Decode", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeBase64DecodeTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeBase64Tests;
+
+	// every tail length, then sizes crossing the parallel batches (64k quads each)
+	TArray<int32> Sizes;
+	for (int32 Size = 0; Size <= 64; Size++)
+	{
+		Sizes.Add(Size);
+	}
+	Sizes.Append({ 3 * 64 * 1024, 3 * 64 * 1024 + 1, 3 * 64 * 1024 + 2, 1024 * 1024 + 7 });
+
+	for (const int32 Size : Sizes)
+	{
+		const TArray64<uint8> Noise = MakeNoise(Size, Size + 1);
+		const TArray<uint8> Data(Noise.GetData(), Size);
+		const FString Base64 = FBase64::Encode(Data);
+
+		TArray64<uint8> Bytes;
+		if (TestTrue(FString::Printf(TEXT("%d bytes are decoded"), Size), Decode(Base64, Bytes)))
+		{
+			TestTrue(FString::Printf(TEXT("%d bytes match"), Size), Matches(Bytes, Data));
+		}
+
+		// padding is optional
+		FString Unpadded = Base64;
+		Unpadded.RemoveFromEnd(TEXT("="));
+		Unpadded.RemoveFromEnd(TEXT("="));
+		TArray64<uint8> UnpaddedBytes;
+		if (TestTrue(FString::Printf(TEXT("%d bytes without padding are decoded"), Size), Decode(Unpadded, UnpaddedBytes)))
+		{
+			TestTrue(FString::Printf(TEXT("%d bytes without padding match"), Size), Matches(UnpaddedBytes, Data));
+		}
+	}
+
+	// decoded bytes are appended
+	TArray64<uint8> Appended = { 1, 2 };
+	if (TestTrue(TEXT("appending decode"), Decode(TEXT("TWFu"), Appended)))
+	{
+		TestTrue(TEXT("bytes are appended"), Appended == TArray64<uint8>({ 1, 2, 'M', 'a', 'n' }));
+	}
+
+	// a single char tail can not encode a byte
+	TArray64<uint8> Bytes;
+	TestFalse(TEXT("5 chars are rejected"), Decode(TEXT("TWFuT"), Bytes));
+	TestFalse(TEXT("1 char is rejected"), Decode(TEXT("T"), Bytes));
+	TestFalse(TEXT("1 char with padding is rejected"), Decode(TEXT("TWFuT==="), Bytes));
+
+	// invalid characters anywhere (including the parallel batches and the tail) leave the output untouched
+	const TArray64<uint8> Noise = MakeNoise(1024 * 1024, 99);
+	const FString Big = FBase64::Encode(TArray<uint8>(Noise.GetData(), Noise.Num()));
+	const TArray<FString> Invalid = {
+		TEXT("TW*u"),
+		TEXT("TWFu-w=="),
+		TEXT("TWFu_w=="),
+		TEXT("TWFu\u00e8w=="),
+		TEXT("TW=uTWFu"),
+		TEXT("TWFu TWFu"),
+		TEXT("TWFu\nTWFu"),
+		TEXT("TWFuT*"),
+		Big.Left(300000) + TEXT("!") + Big.Mid(300001),
+		Big.LeftChop(2) + TEXT("#A")
+	};
+
+	for (const FString& Base64 : Invalid)
+	{
+		TArray64<uint8> Untouched = { 7 };
+		TestFalse(FString::Printf(TEXT("%s is rejected"), *Base64.Left(16)), Decode(Base64, Untouched));
+		TestEqual(FString::Printf(TEXT("%s leaves the output untouched"), *Base64.Left(16)), Untouched.Num(), static_cast<int64>(1));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeBase64Benchmark, "glTFRuntime.Base64.Benchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FglTFRuntimeBase64Benchmark::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeBase64Tests;
+
+	const TArray64<uint8> Noise = MakeNoise(128 * 1024 * 1024, 1);
+	const TArray<uint8> Data(Noise.GetData(), Noise.Num());
+	const FString Base64 = FBase64::Encode(Data);
+
+	constexpr int32 Runs = 3;
+
+	TArray64<uint8> Bytes;
+	const double DecodeBase64Seconds = MeasureBestSeconds(Runs, [&]()
+		{
+			Bytes.Reset();
+			Decode(Base64, Bytes);
+		});
+	TestTrue(TEXT("DecodeBase64 matches"), Matches(Bytes, Data));
+
+	TArray<uint8> FBase64Bytes;
+	const double FBase64Seconds = MeasureBestSeconds(Runs, [&]()
+		{
+			FBase64Bytes.Reset();
+			FBase64::Decode(Base64, FBase64Bytes);
+		});
+	TestTrue(TEXT("FBase64::Decode matches"), FBase64Bytes == Data);
+
+	AddBenchmarkInfo(*this, TEXT("DecodeBase64"), DecodeBase64Seconds, Base64.Len());
+	AddBenchmarkInfo(*this, TEXT("FBase64::Decode"), FBase64Seconds, Base64.Len());
+
+	return true;
+}
+
+#endif
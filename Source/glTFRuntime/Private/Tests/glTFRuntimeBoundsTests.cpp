@@ -0,0 +1,151 @@
+// Copyright 2020-2024, Roberto De Ioris.
+
+#include "glTFRuntimeParser.h"
+#include "Misc/AutomationTest.h"
+#include "glTFRuntimeTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace glTFRuntimeBoundsTests
+{
+	using namespace glTFRuntimeTests;
+
+	// patches the json chunk in place (the chunk length can not change)
+	void ReplaceInGlb(TArray<uint8>& Glb, const FString& From, const FString& To)
+	{
+		check(From.Len() == To.Len());
+		const TArray<uint8> FromBytes = ToUTF8(From);
+		const TArray<uint8> ToBytes = ToUTF8(To);
+		for (int32 Index = 0; Index + FromBytes.Num() <= Glb.Num(); Index++)
+		{
+			if (FMemory::Memcmp(Glb.GetData() + Index, FromBytes.GetData(), FromBytes.Num()) == 0)
+			{
+				FMemory::Memcpy(Glb.GetData() + Index, ToBytes.GetData(), ToBytes.Num());
+				return;
+			}
+		}
+	}
+
+	bool LoadGridLOD(const TArray<uint8>& Glb, TSharedPtr<FglTFRuntimeParser>& Parser, FglTFRuntimeMeshLOD& LOD)
+	{
+		Parser = FglTFRuntimeParser::FromData(Glb.GetData(), Glb.Num(), FglTFRuntimeConfig());
+		return Parser && Parser->LoadMeshAsRuntimeLOD(0, LOD, FglTFRuntimeMaterialsConfig()) && LOD.Primitives.Num() == 1;
+	}
+
+	FBox ScanBounds(const TArray<FVector>& Positions)
+	{
+		FBox Bounds(ForceInit);
+		for (const FVector& Position : Positions)
+		{
+			Bounds += Position;
+		}
+		return Bounds;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeBoundsAccessorsTest, "glTFRuntime.Bounds.Accessors", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeBoundsAccessorsTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeBoundsTests;
+
+	constexpr int32 Side = 64;
+	const TArray<uint8> Glb = MakeGridGlb(Side);
+
+	TSharedPtr<FglTFRuntimeParser> Parser;
+	FglTFRuntimeMeshLOD LOD;
+	if (!TestTrue(TEXT("grid is loaded"), LoadGridLOD(Glb, Parser, LOD)))
+	{
+		return false;
+	}
+
+	const FglTFRuntimePrimitive& Primitive = LOD.Primitives[0];
+	const FBox ScannedBounds = ScanBounds(Primitive.Positions);
+	TestTrue(TEXT("accessor bounds are available"), Primitive.PositionsBounds.IsValid != 0);
+	TestTrue(TEXT("accessor bounds match the scanned vertices"), Primitive.PositionsBounds.Min.Equals(ScannedBounds.Min, KINDA_SMALL_NUMBER) && Primitive.PositionsBounds.Max.Equals(ScannedBounds.Max, KINDA_SMALL_NUMBER));
+
+	// chunks of 16k vertices, reduced in parallel
+	const FBox ParallelBounds = FglTFRuntimeParser::GetPositionsBounds(Primitive.Positions.Num(), [&Primitive](const int32 Index) { return Primitive.Positions[Index]; });
+	TestTrue(TEXT("parallel reduction matches the serial scan"), ParallelBounds == ScannedBounds);
+
+	FBox AccessorBounds;
+	if (TestTrue(TEXT("accessor min/max are read"), Parser->GetAccessorBounds(0, AccessorBounds)))
+	{
+		TestTrue(TEXT("primitive keeps the rebased accessor bounds"), AccessorBounds == Primitive.PositionsBounds);
+	}
+	TestTrue(TEXT("matching bounds are validated"), Parser->ValidateAccessorsBounds(TEXT("Bounds.Accessors"), Primitive.PositionsBounds, ScannedBounds));
+
+	// an exporter writing a max smaller than the real one
+	TArray<uint8> ShrunkGlb = Glb;
+	ReplaceInGlb(ShrunkGlb, TEXT("\"max\":[63,0,63]"), TEXT("\"max\":[31,0,31]"));
+	TSharedPtr<FglTFRuntimeParser> ShrunkParser;
+	FglTFRuntimeMeshLOD ShrunkLOD;
+	if (TestTrue(TEXT("grid with wrong max is loaded"), LoadGridLOD(ShrunkGlb, ShrunkParser, ShrunkLOD)))
+	{
+		const FglTFRuntimePrimitive& ShrunkPrimitive = ShrunkLOD.Primitives[0];
+		TestTrue(TEXT("wrong bounds do not contain the vertices"), !ShrunkPrimitive.PositionsBounds.IsInside(ScanBounds(ShrunkPrimitive.Positions)));
+		AddExpectedError(TEXT("do not contain the vertices bounds"), EAutomationExpectedErrorFlags::Contains, 1);
+		TestFalse(TEXT("wrong bounds are reported"), ShrunkParser->ValidateAccessorsBounds(TEXT("Bounds.Accessors"), ShrunkPrimitive.PositionsBounds, ScanBounds(ShrunkPrimitive.Positions)));
+	}
+
+	// min/max are optional
+	TArray<uint8> UnboundedGlb = Glb;
+	ReplaceInGlb(UnboundedGlb, TEXT("\"min\""), TEXT("\"mi_\""));
+	TSharedPtr<FglTFRuntimeParser> UnboundedParser;
+	FglTFRuntimeMeshLOD UnboundedLOD;
+	if (TestTrue(TEXT("grid without min is loaded"), LoadGridLOD(UnboundedGlb, UnboundedParser, UnboundedLOD)))
+	{
+		TestTrue(TEXT("bounds are invalid without min/max"), UnboundedLOD.Primitives[0].PositionsBounds.IsValid == 0);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeBoundsBenchmark, "glTFRuntime.Bounds.Benchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FglTFRuntimeBoundsBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeBoundsTests;
+
+	// about 4M vertices
+	constexpr int32 Side = 2048;
+	TSharedPtr<FglTFRuntimeParser> Parser;
+	FglTFRuntimeMeshLOD LOD;
+	if (!TestTrue(TEXT("grid is loaded"), LoadGridLOD(MakeGridGlb(Side), Parser, LOD)))
+	{
+		return false;
+	}
+
+	const TArray<FVector>& Positions = LOD.Primitives[0].Positions;
+	const int64 Bytes = Positions.Num() * static_cast<int64>(sizeof(FVector));
+	constexpr int32 Runs = 5;
+
+	FBox AccessorBounds;
+	const double AccessorSeconds = MeasureBestSeconds(Runs, [&]()
+		{
+			Parser->GetAccessorBounds(0, AccessorBounds);
+		});
+
+	FBox ParallelBounds;
+	const double ParallelSeconds = MeasureBestSeconds(Runs, [&]()
+		{
+			ParallelBounds = FglTFRuntimeParser::GetPositionsBounds(Positions.Num(), [&Positions](const int32 Index) { return Positions[Index]; });
+		});
+
+	FBox SerialBounds;
+	const double SerialSeconds = MeasureBestSeconds(Runs, [&]()
+		{
+			SerialBounds = ScanBounds(Positions);
+		});
+
+	TestTrue(TEXT("parallel scan matches the serial scan"), ParallelBounds == SerialBounds);
+	TestTrue(TEXT("accessor bounds match the scan"), AccessorBounds.Min.Equals(SerialBounds.Min, KINDA_SMALL_NUMBER) && AccessorBounds.Max.Equals(SerialBounds.Max, KINDA_SMALL_NUMBER));
+
+	AddBenchmarkInfo(*this, TEXT("Accessor min/max"), AccessorSeconds);
+	AddBenchmarkInfo(*this, TEXT("Parallel vertices scan"), ParallelSeconds, Bytes);
+	AddBenchmarkInfo(*this, TEXT("Serial vertices scan"), SerialSeconds, Bytes);
+
+	return true;
+}
+
+#endif
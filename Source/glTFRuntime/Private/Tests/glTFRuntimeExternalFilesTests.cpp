@@ -0,0 +1,124 @@
+// Copyright 2020-2024, Roberto De Ioris.
+
+#include "glTFRuntimeParser.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "glTFRuntimeTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace glTFRuntimeExternalFilesTests
+{
+	using namespace glTFRuntimeTests;
+
+	// a single mesh with a primitive (Side x Side grid) for each external buffer
+	bool WriteScene(const FString& Directory, const int32 NumFiles, const int32 Side, FString& OutFilename)
+	{
+		const int32 NumVertices = Side * Side;
+		const int32 NumIndices = (Side - 1) * (Side - 1) * 6;
+
+		TArray<float> Positions;
+		for (int32 Y = 0; Y < Side; Y++)
+		{
+			for (int32 X = 0; X < Side; X++)
+			{
+				Positions.Append({ static_cast<float>(X), 0, static_cast<float>(Y) });
+			}
+		}
+
+		TArray<uint8> Binary(reinterpret_cast<const uint8*>(Positions.GetData()), NumVertices * 12);
+		for (int32 Y = 0; Y < Side - 1; Y++)
+		{
+			for (int32 X = 0; X < Side - 1; X++)
+			{
+				const uint32 Corner = Y * Side + X;
+				for (const uint32 Index : { Corner, Corner + Side, Corner + 1, Corner + 1, Corner + Side, Corner + Side + 1 })
+				{
+					Write32(Binary, Index);
+				}
+			}
+		}
+
+		TArray<FString> Primitives;
+		TArray<FString> Buffers;
+		TArray<FString> BufferViews;
+		TArray<FString> Accessors;
+		for (int32 FileIndex = 0; FileIndex < NumFiles; FileIndex++)
+		{
+			const FString BinaryFilename = FString::Printf(TEXT("buffer_%d.bin"), FileIndex);
+			if (!FFileHelper::SaveArrayToFile(Binary, *FPaths::Combine(Directory, BinaryFilename)))
+			{
+				return false;
+			}
+
+			Buffers.Add(FString::Printf(TEXT("{\"uri\":\"%s\",\"byteLength\":%d}"), *BinaryFilename, Binary.Num()));
+			BufferViews.Add(FString::Printf(TEXT("{\"buffer\":%d,\"byteLength\":%d}"), FileIndex, NumVertices * 12));
+			BufferViews.Add(FString::Printf(TEXT("{\"buffer\":%d,\"byteOffset\":%d,\"byteLength\":%d}"), FileIndex, NumVertices * 12, NumIndices * 4));
+			Accessors.Add(FString::Printf(TEXT("{\"bufferView\":%d,\"componentType\":5126,\"count\":%d,\"type\":\"VEC3\"}"), FileIndex * 2, NumVertices));
+			Accessors.Add(FString::Printf(TEXT("{\"bufferView\":%d,\"componentType\":5125,\"count\":%d,\"type\":\"SCALAR\"}"), FileIndex * 2 + 1, NumIndices));
+			Primitives.Add(FString::Printf(TEXT("{\"attributes\":{\"POSITION\":%d},\"indices\":%d}"), FileIndex * 2, FileIndex * 2 + 1));
+		}
+
+		const FString Json = FString::Printf(TEXT("{\"asset\":{\"version\":\"2.0\"},\"meshes\":[{\"primitives\":[%s]}],\"buffers\":[%s],\"bufferViews\":[%s],\"accessors\":[%s]}"),
+			*FString::Join(Primitives, TEXT(",")), *FString::Join(Buffers, TEXT(",")), *FString::Join(BufferViews, TEXT(",")), *FString::Join(Accessors, TEXT(",")));
+		OutFilename = FPaths::Combine(Directory, TEXT("scene.gltf"));
+		return FFileHelper::SaveStringToFile(Json, *OutFilename);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeExternalFilesBenchmark, "glTFRuntime.ExternalFiles.Benchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FglTFRuntimeExternalFilesBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeExternalFilesTests;
+
+	// 500 files of about 220KB
+	constexpr int32 NumFiles = 500;
+	constexpr int32 Side = 64;
+	const FString Directory = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("glTFRuntimeExternalFiles"), FGuid::NewGuid().ToString());
+	FString Filename;
+	if (!TestTrue(TEXT("scene is written"), WriteScene(Directory, NumFiles, Side, Filename)))
+	{
+		return false;
+	}
+
+	// the files were just written, so both modes mostly read from the OS cache (cold reads favor the prefetch even more)
+	constexpr int32 Runs = 3;
+	int32 NumVertices[2] = {};
+
+	for (const bool bPrefetchExternalFiles : { false, true })
+	{
+		const TCHAR* Name = bPrefetchExternalFiles ? TEXT("Async prefetch") : TEXT("Synchronous reads");
+		FglTFRuntimeConfig LoaderConfig;
+		LoaderConfig.bPrefetchExternalFiles = bPrefetchExternalFiles;
+
+		bool bLoaded = false;
+		const double Seconds = MeasureBestSeconds(Runs, [&]()
+			{
+				TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromFilename(Filename, LoaderConfig);
+				FglTFRuntimeMeshLOD LOD;
+				bLoaded = Parser && Parser->LoadMeshAsRuntimeLOD(0, LOD, FglTFRuntimeMaterialsConfig());
+				NumVertices[bPrefetchExternalFiles ? 1 : 0] = 0;
+				for (const FglTFRuntimePrimitive& Primitive : LOD.Primitives)
+				{
+					NumVertices[bPrefetchExternalFiles ? 1 : 0] += Primitive.Positions.Num();
+				}
+			});
+
+		if (TestTrue(FString::Printf(TEXT("%s loads the mesh"), Name), bLoaded))
+		{
+			AddBenchmarkInfo(*this, FString::Printf(TEXT("%s, %d files"), Name, NumFiles), Seconds, static_cast<int64>(NumFiles) * IFileManager::Get().FileSize(*FPaths::Combine(Directory, TEXT("buffer_0.bin"))));
+		}
+	}
+
+	TestEqual(TEXT("every primitive is loaded"), NumVertices[0], NumFiles * Side * Side);
+	TestEqual(TEXT("both modes load the same vertices"), NumVertices[1], NumVertices[0]);
+
+	IFileManager::Get().DeleteDirectory(*Directory, false, true);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,183 @@
+// Copyright 2020-2023, Roberto De Ioris.
+
+#include "glTFRuntimeParser.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Base64.h"
+#include "Serialization/MemoryWriter.h"
+#include "glTFRuntimeTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace glTFRuntimeFArchiveTests
+{
+	using namespace glTFRuntimeTests;
+
+	/*
+	* In-memory stand-in for a streamed source (custom pak reader, socket...):
+	* data is copied in small chunks and every byte served is accounted.
+	*/
+	class FChunkedMemoryArchive : public FArchive
+	{
+	public:
+		FChunkedMemoryArchive(const TArray<uint8>& InData, const int64 InChunkSize) : Data(InData), ChunkSize(InChunkSize)
+		{
+			SetIsLoading(true);
+			SetIsPersistent(false);
+		}
+
+		void Serialize(void* V, int64 Length) override
+		{
+			if (Length < 0 || Position + Length > Data.Num())
+			{
+				SetError();
+				return;
+			}
+
+			uint8* Dest = static_cast<uint8*>(V);
+			while (Length > 0)
+			{
+				const int64 Chunk = FMath::Min(Length, ChunkSize);
+				FMemory::Memcpy(Dest, Data.GetData() + Position, Chunk);
+				Dest += Chunk;
+				Position += Chunk;
+				Length -= Chunk;
+				BytesServed += Chunk;
+			}
+		}
+
+		void Seek(int64 InPos) override
+		{
+			Position = FMath::Clamp<int64>(InPos, 0, Data.Num());
+		}
+
+		int64 Tell() override
+		{
+			return Position;
+		}
+
+		int64 TotalSize() override
+		{
+			return Data.Num();
+		}
+
+		FString GetArchiveName() const override
+		{
+			return TEXT("FChunkedMemoryArchive");
+		}
+
+		int64 BytesServed = 0;
+
+	protected:
+		TArray<uint8> Data;
+		int64 ChunkSize;
+		int64 Position = 0;
+	};
+
+	TArray<uint8> MakeBinary(const int32 Num)
+	{
+		TArray<uint8> Binary;
+		Binary.AddUninitialized(Num);
+		for (int32 Index = 0; Index < Num; Index++)
+		{
+			Binary[Index] = static_cast<uint8>(Index * 7 + (Index >> 8));
+		}
+		return Binary;
+	}
+
+	// two small bufferViews at the start and at the end of a big buffer
+	FString MakeJson(const int32 BufferNum, const FString& BufferUri)
+	{
+		return FString::Printf(TEXT("{\"asset\":{\"version\":\"2.0\"},\"buffers\":[{\"byteLength\":%d%s}],")
+			TEXT("\"bufferViews\":[{\"buffer\":0,\"byteOffset\":0,\"byteLength\":64},{\"buffer\":0,\"byteOffset\":%d,\"byteLength\":128}]}"),
+			BufferNum, *BufferUri, BufferNum - 128);
+	}
+
+	bool MatchesRange(const FglTFRuntimeBlob& Blob, const TArray<uint8>& Binary, const int32 Offset, const int32 Num)
+	{
+		return Blob.Num == Num && FMemory::Memcmp(Blob.Data, Binary.GetData() + Offset, Num) == 0;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeFArchiveGlbTest, "glTFRuntime.FArchive.Glb", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeFArchiveGlbTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeFArchiveTests;
+
+	constexpr int32 BinaryNum = 1024 * 1024;
+	const TArray<uint8> Binary = MakeBinary(BinaryNum);
+	const TArray<uint8> Glb = MakeGlb(MakeJson(BinaryNum, TEXT("")), Binary);
+
+	TSharedRef<FChunkedMemoryArchive> Archive = MakeShared<FChunkedMemoryArchive>(Glb, 4096);
+	TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromFArchive(Archive, FglTFRuntimeConfig());
+	if (!TestTrue(TEXT("glb is parsed"), Parser.IsValid()))
+	{
+		return false;
+	}
+
+	// only the chunk headers and the json chunk are read upfront
+	const int64 HeaderBytes = Glb.Num() - BinaryNum;
+	TestTrue(TEXT("binary chunk is not read upfront"), Archive->BytesServed <= HeaderBytes);
+
+	FglTFRuntimeBlob Blob;
+	int64 Stride = 0;
+	const int64 ServedBeforeViews = Archive->BytesServed;
+	if (TestTrue(TEXT("first bufferView is read"), Parser->GetBufferView(0, Blob, Stride)))
+	{
+		TestTrue(TEXT("first bufferView matches"), MatchesRange(Blob, Binary, 0, 64));
+	}
+	if (TestTrue(TEXT("last bufferView is read"), Parser->GetBufferView(1, Blob, Stride)))
+	{
+		TestTrue(TEXT("last bufferView matches"), MatchesRange(Blob, Binary, BinaryNum - 128, 128));
+	}
+	TestEqual(TEXT("only the bufferViews ranges are read"), Archive->BytesServed - ServedBeforeViews, static_cast<int64>(64 + 128));
+
+	// cached ranges do not touch the FArchive again
+	const int64 ServedBeforeCached = Archive->BytesServed;
+	if (TestTrue(TEXT("cached bufferView is read"), Parser->GetBufferView(1, Blob, Stride)))
+	{
+		TestTrue(TEXT("cached bufferView matches"), MatchesRange(Blob, Binary, BinaryNum - 128, 128));
+	}
+	TestEqual(TEXT("cached range is not read again"), Archive->BytesServed, ServedBeforeCached);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeFArchiveFallbackTest, "glTFRuntime.FArchive.Fallback", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeFArchiveFallbackTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeFArchiveTests;
+
+	// json content is fully read and parsed as usual
+	const TArray<uint8> Binary = MakeBinary(256);
+	const FString Json = MakeJson(Binary.Num(), TEXT(",\"uri\":\"data:application/octet-stream;base64,") + FBase64::Encode(Binary) + TEXT("\""));
+	const TArray<uint8> JsonData = ToUTF8(Json);
+
+	TSharedRef<FChunkedMemoryArchive> Archive = MakeShared<FChunkedMemoryArchive>(JsonData, 100);
+	TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromFArchive(Archive, FglTFRuntimeConfig());
+	if (TestTrue(TEXT("gltf is parsed"), Parser.IsValid()))
+	{
+		FglTFRuntimeBlob Blob;
+		int64 Stride = 0;
+		if (TestTrue(TEXT("bufferView is read"), Parser->GetBufferView(1, Blob, Stride)))
+		{
+			TestTrue(TEXT("bufferView matches"), MatchesRange(Blob, Binary, Binary.Num() - 128, 128));
+		}
+	}
+
+	// truncated glb chunks are rejected
+	const TArray<uint8> Glb = MakeGlb(MakeJson(Binary.Num(), TEXT("")), Binary);
+	const TArray<uint8> TruncatedGlb(Glb.GetData(), Glb.Num() - 16);
+	AddExpectedError(TEXT("Invalid binary glTF chunk length"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestFalse(TEXT("truncated glb is rejected"), FglTFRuntimeParser::FromFArchive(MakeShared<FChunkedMemoryArchive>(TruncatedGlb, 100), FglTFRuntimeConfig()).IsValid());
+
+	// saving archives can not be read
+	TArray<uint8> Saved;
+	AddExpectedError(TEXT("FArchive is not a loading archive"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestFalse(TEXT("saving archive is rejected"), FglTFRuntimeParser::FromFArchive(MakeShared<FMemoryWriter>(Saved), FglTFRuntimeConfig()).IsValid());
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,99 @@
+// Copyright 2020-2024, Roberto De Ioris.
+
+#include "glTFRuntimeParser.h"
+#include "Misc/AutomationTest.h"
+#include "glTFRuntimeTestUtils.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "zlib.h"
+THIRD_PARTY_INCLUDES_END
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace glTFRuntimeGzipTests
+{
+	using namespace glTFRuntimeTests;
+
+	// raw deflate (WindowBits -15) or a single gzip member (WindowBits 31)
+	TArray64<uint8> Deflate(const uint8* DataPtr, const int64 DataNum, const int32 WindowBits)
+	{
+		z_stream Stream = {};
+		deflateInit2(&Stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, WindowBits, 8, Z_DEFAULT_STRATEGY);
+		TArray64<uint8> Compressed;
+		Compressed.AddUninitialized(deflateBound(&Stream, DataNum) + 32);
+		Stream.next_in = const_cast<uint8*>(DataPtr);
+		Stream.avail_in = DataNum;
+		Stream.next_out = Compressed.GetData();
+		Stream.avail_out = Compressed.Num();
+		deflate(&Stream, Z_FINISH);
+		Compressed.SetNum(Stream.total_out);
+		deflateEnd(&Stream);
+		return Compressed;
+	}
+
+	// BGZF: independent gzip members of at most 64k, each storing its own size in a 'BC' extra subfield
+	TArray64<uint8> MakeBgzf(const TArray<uint8>& Data)
+	{
+		constexpr int64 MaxBlockInput = 65280;
+
+		TArray64<uint8> Bgzf;
+		for (int64 Offset = 0; Offset < Data.Num(); Offset += MaxBlockInput)
+		{
+			const int64 BlockInput = FMath::Min<int64>(Data.Num() - Offset, MaxBlockInput);
+			const TArray64<uint8> Payload = Deflate(Data.GetData() + Offset, BlockInput, -MAX_WBITS);
+			const int64 BlockSize = 18 + Payload.Num() + 8;
+
+			Bgzf.Append({ 0x1F, 0x8B, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF });
+			Write16(Bgzf, 6);
+			Bgzf.Append({ 'B', 'C' });
+			Write16(Bgzf, 2);
+			Write16(Bgzf, static_cast<uint16>(BlockSize - 1));
+			Bgzf.Append(Payload);
+			Write32(Bgzf, crc32(0, Data.GetData() + Offset, BlockInput));
+			Write32(Bgzf, static_cast<uint32>(BlockInput));
+		}
+		return Bgzf;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeGzipBenchmark, "glTFRuntime.Gzip.Benchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FglTFRuntimeGzipBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeGzipTests;
+
+	// about 1M vertices and 58MB of glb
+	constexpr int32 Side = 1024;
+	const TArray<uint8> Glb = MakeGridGlb(Side);
+	const TArray64<uint8> SingleMember = Deflate(Glb.GetData(), Glb.Num(), 16 + MAX_WBITS);
+	const TArray64<uint8> Bgzf = MakeBgzf(Glb);
+
+	constexpr int32 Runs = 3;
+
+	struct FGzipFile
+	{
+		const TCHAR* Name;
+		const TArray64<uint8>& Data;
+	};
+
+	for (const FGzipFile& GzipFile : { FGzipFile{ TEXT("Single member (serial)"), SingleMember }, FGzipFile{ TEXT("BGZF (ParallelFor)"), Bgzf } })
+	{
+		bool bLoaded = false;
+		const double Seconds = MeasureBestSeconds(Runs, [&]()
+			{
+				TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromData(GzipFile.Data.GetData(), GzipFile.Data.Num(), FglTFRuntimeConfig());
+				// the binary chunk is at the end of the glb
+				FglTFRuntimeBlob Blob;
+				bLoaded = Parser && Parser->GetBuffer(0, Blob) && Blob.Num > 0 && Blob.Num < Glb.Num() && FMemory::Memcmp(Blob.Data, Glb.GetData() + Glb.Num() - Blob.Num, Blob.Num) == 0;
+			});
+
+		if (TestTrue(FString::Printf(TEXT("%s is inflated"), GzipFile.Name), bLoaded))
+		{
+			AddBenchmarkInfo(*this, FString::Printf(TEXT("%s, %.2f MB compressed"), GzipFile.Name, GzipFile.Data.Num() / (1024.0 * 1024.0)), Seconds, Glb.Num());
+		}
+	}
+
+	return true;
+}
+
+#endif
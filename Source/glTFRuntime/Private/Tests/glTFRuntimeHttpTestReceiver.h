@@ -0,0 +1,44 @@
+// Copyright 2020-2024, Roberto De Ioris.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "glTFRuntimeAsset.h"
+#include "glTFRuntimeHttpTestReceiver.generated.h"
+
+/**
+ * Collects the dynamic delegates fired by the http loaders (used by automation tests)
+ */
+UCLASS(Transient, HideDropdown)
+class UglTFRuntimeHttpTestReceiver : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	UFUNCTION()
+	void OnReady(UglTFRuntimeAsset* Asset)
+	{
+		ReadyAsset = Asset;
+		ReadyCount++;
+	}
+
+	UFUNCTION()
+	void OnCompleted(UglTFRuntimeAsset* Asset)
+	{
+		CompletedAsset = Asset;
+		bCompleted = true;
+		bCompletedInGameThread = IsInGameThread();
+	}
+
+	UPROPERTY()
+	TObjectPtr<UglTFRuntimeAsset> ReadyAsset = nullptr;
+
+	UPROPERTY()
+	TObjectPtr<UglTFRuntimeAsset> CompletedAsset = nullptr;
+
+	int32 ReadyCount = 0;
+	bool bCompleted = false;
+	bool bCompletedInGameThread = false;
+};
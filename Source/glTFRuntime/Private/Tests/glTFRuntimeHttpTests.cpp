@@ -0,0 +1,449 @@
+// Copyright 2020-2024, Roberto De Ioris.
+
+#include "glTFRuntimeHttpTestReceiver.h"
+#include "glTFRuntimeDownloadCache.h"
+#include "glTFRuntimeFunctionLibrary.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Base64.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "glTFRuntimeTestUtils.h"
+
+// the loopback server comes from the HTTPServer module, linked only in editor builds
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR && ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 3
+
+#include "HttpPath.h"
+#include "HttpServerModule.h"
+#include "HttpServerRequest.h"
+#include "HttpServerResponse.h"
+#include "IHttpRouter.h"
+
+namespace glTFRuntimeHttpTests
+{
+	using namespace glTFRuntimeTests;
+
+	constexpr uint32 LoopbackPort = 18086;
+
+	TArray<uint8> MakeData(const int32 Num, const uint32 Seed)
+	{
+		return TArray<uint8>(MakeNoise(Num, Seed));
+	}
+
+	// a triangle at the start of the binary chunk, so the mesh can be loaded long before the download is completed
+	constexpr int32 TriangleBytes = 3 * 3 * sizeof(float);
+
+	TArray<uint8> MakeGlbBinary(const int32 Num, const uint32 Seed)
+	{
+		TArray<uint8> Binary = MakeData(Num, Seed);
+		const float Triangle[] = { 0, 0, 0, 1, 0, 0, 0, 1, 0 };
+		FMemory::Memcpy(Binary.GetData(), Triangle, TriangleBytes);
+		return Binary;
+	}
+
+	TArray<uint8> MakeGlb(const TArray<uint8>& Binary)
+	{
+		return glTFRuntimeTests::MakeGlb(FString::Printf(TEXT("{\"asset\":{\"version\":\"2.0\"},\"buffers\":[{\"byteLength\":%d}],")
+			TEXT("\"bufferViews\":[{\"buffer\":0,\"byteLength\":%d}],")
+			TEXT("\"accessors\":[{\"bufferView\":0,\"componentType\":5126,\"count\":3,\"type\":\"VEC3\",\"min\":[0,0,0],\"max\":[1,1,0]}],")
+			TEXT("\"meshes\":[{\"primitives\":[{\"attributes\":{\"POSITION\":0}}]}]}"), Binary.Num(), TriangleBytes), Binary);
+	}
+
+	TArray<uint8> MakeGltf(const TArray<uint8>& Binary)
+	{
+		return ToUTF8(FString::Printf(TEXT("{\"asset\":{\"version\":\"2.0\"},\"buffers\":[{\"byteLength\":%d,\"uri\":\"data:application/octet-stream;base64,%s\"}]}"), Binary.Num(), *FBase64::Encode(Binary)));
+	}
+
+	using FHandler = TFunction<bool(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)>;
+
+	FHttpRouteHandle BindHandler(TSharedPtr<IHttpRouter> Router, const FString& Path, FHandler Handler)
+	{
+#if ENGINE_MINOR_VERSION >= 4
+		return Router->BindRoute(FHttpPath(Path), EHttpServerRequestVerbs::VERB_GET, FHttpRequestHandler::CreateLambda(MoveTemp(Handler)));
+#else
+		return Router->BindRoute(FHttpPath(Path), EHttpServerRequestVerbs::VERB_GET, MoveTemp(Handler));
+#endif
+	}
+
+	FHttpRouteHandle BindBody(TSharedPtr<IHttpRouter> Router, const FString& Path, const TArray<uint8>& Body, const FString& ContentType)
+	{
+		return BindHandler(Router, Path, [Body, ContentType](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+			{
+				TArray<uint8> ResponseBody = Body;
+				OnComplete(FHttpServerResponse::Create(MoveTemp(ResponseBody), ContentType));
+				return true;
+			});
+	}
+
+	// answers 304 when the request carries the matching If-None-Match validator
+	FHttpRouteHandle BindBodyWithETag(TSharedPtr<IHttpRouter> Router, const FString& Path, const TArray<uint8>& Body, const FString& ETag, TSharedRef<FThreadSafeCounter> NotModifiedCounter)
+	{
+		return BindHandler(Router, Path, [Body, ETag, NotModifiedCounter](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+			{
+				for (const TPair<FString, TArray<FString>>& Header : Request.Headers)
+				{
+					if (Header.Key.Equals(TEXT("If-None-Match"), ESearchCase::IgnoreCase) && Header.Value.Contains(ETag))
+					{
+						NotModifiedCounter->Increment();
+						TUniquePtr<FHttpServerResponse> Response = MakeUnique<FHttpServerResponse>();
+						Response->Code = EHttpServerResponseCodes::NotModified;
+						OnComplete(MoveTemp(Response));
+						return true;
+					}
+				}
+
+				TArray<uint8> ResponseBody = Body;
+				TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(MoveTemp(ResponseBody), TEXT("model/gltf-binary"));
+				Response->Headers.Add(TEXT("ETag"), { ETag });
+				OnComplete(MoveTemp(Response));
+				return true;
+			});
+	}
+
+	// same naming of the download cache
+	FString GetContentHash(const TArray<uint8>& Content)
+	{
+		uint8 Digest[FSHA1::DigestSize];
+		FSHA1::HashBuffer(Content.GetData(), Content.Num(), Digest);
+		return BytesToHex(Digest, FSHA1::DigestSize).ToLower();
+	}
+
+	bool MatchesBuffer(UglTFRuntimeAsset* Asset, const TArray<uint8>& Expected)
+	{
+		if (!Asset || !Asset->GetParser())
+		{
+			return false;
+		}
+
+		FglTFRuntimeBlob Blob;
+		if (!Asset->GetParser()->GetBuffer(0, Blob) || Blob.Num != Expected.Num())
+		{
+			return false;
+		}
+
+		return FMemory::Memcmp(Blob.Data, Expected.GetData(), Blob.Num) == 0;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeHttpProgressiveLoopbackTest, "glTFRuntime.Http.ProgressiveLoopback", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeHttpProgressiveLoopbackTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeHttpTests;
+
+	TSharedPtr<IHttpRouter> Router = FHttpServerModule::Get().GetHttpRouter(LoopbackPort);
+	if (!TestTrue(TEXT("loopback router is available"), Router.IsValid()))
+	{
+		return false;
+	}
+
+	// big enough to be received in multiple chunks
+	const TArray<uint8> GlbBinary = MakeGlbBinary(4 * 1024 * 1024, 1);
+	const TArray<uint8> GltfBinary = MakeData(1024, 2);
+
+	const FHttpRouteHandle GlbRoute = BindBody(Router, TEXT("/progressive.glb"), MakeGlb(GlbBinary), TEXT("model/gltf-binary"));
+	const FHttpRouteHandle GltfRoute = BindBody(Router, TEXT("/fallback.gltf"), MakeGltf(GltfBinary), TEXT("model/gltf+json"));
+	FHttpServerModule::Get().StartAllListeners();
+
+	UglTFRuntimeHttpTestReceiver* GlbReceiver = NewObject<UglTFRuntimeHttpTestReceiver>();
+	UglTFRuntimeHttpTestReceiver* GltfReceiver = NewObject<UglTFRuntimeHttpTestReceiver>();
+	GlbReceiver->AddToRoot();
+	GltfReceiver->AddToRoot();
+
+	const double StartTime = FPlatformTime::Seconds();
+	for (UglTFRuntimeHttpTestReceiver* Receiver : { GlbReceiver, GltfReceiver })
+	{
+		FglTFRuntimeHttpResponse Ready;
+		Ready.BindUFunction(Receiver, GET_FUNCTION_NAME_CHECKED(UglTFRuntimeHttpTestReceiver, OnReady));
+		FglTFRuntimeHttpResponse Completed;
+		Completed.BindUFunction(Receiver, GET_FUNCTION_NAME_CHECKED(UglTFRuntimeHttpTestReceiver, OnCompleted));
+
+		const FString Url = FString::Printf(TEXT("http://127.0.0.1:%u/%s"), LoopbackPort, Receiver == GlbReceiver ? TEXT("progressive.glb") : TEXT("fallback.gltf"));
+		UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUrlProgressive(Url, {}, Ready, Completed, FglTFRuntimeHttpProgress(), FglTFRuntimeConfig());
+	}
+
+	// the mesh is loaded as soon as its bytes have been received
+	struct FFirstMesh
+	{
+		double Seconds = -1;
+		bool bBeforeCompletion = false;
+		int32 NumVertices = 0;
+	};
+	TSharedRef<FFirstMesh> FirstMesh = MakeShared<FFirstMesh>();
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([GlbReceiver, GltfReceiver, StartTime, FirstMesh]()
+		{
+			FglTFRuntimeBlob Blob;
+			if (FirstMesh->Seconds < 0 && GlbReceiver->ReadyAsset && GlbReceiver->ReadyAsset->GetParser() &&
+				GlbReceiver->ReadyAsset->GetParser()->GetBuffer(0, Blob) && Blob.Num >= TriangleBytes)
+			{
+				FglTFRuntimeMeshLOD LOD;
+				if (GlbReceiver->ReadyAsset->GetParser()->LoadMeshAsRuntimeLOD(0, LOD, FglTFRuntimeMaterialsConfig()))
+				{
+					FirstMesh->Seconds = FPlatformTime::Seconds() - StartTime;
+					FirstMesh->bBeforeCompletion = !GlbReceiver->bCompleted;
+					FirstMesh->NumVertices = LOD.Primitives.Num() > 0 ? LOD.Primitives[0].Positions.Num() : 0;
+				}
+			}
+			return (GlbReceiver->bCompleted && GltfReceiver->bCompleted && FirstMesh->Seconds >= 0) || FPlatformTime::Seconds() - StartTime > 30.0;
+		}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, Router, GlbRoute, GltfRoute, GlbReceiver, GltfReceiver, GlbBinary, GltfBinary, FirstMesh]()
+		{
+			// the first mesh is usually ready while the binary chunk is still streaming (not asserted, it depends on the chunking)
+			TestTrue(TEXT("glb mesh is loaded"), FirstMesh->Seconds >= 0);
+			TestEqual(TEXT("glb mesh has the triangle vertices"), FirstMesh->NumVertices, 3);
+			AddBenchmarkInfo(*this, FString::Printf(TEXT("time to first mesh (%s the download completion)"), FirstMesh->bBeforeCompletion ? TEXT("before") : TEXT("after")), FirstMesh->Seconds);
+
+			// glb: Ready fires once (before or while the binary chunk streams), Completed with the same asset
+			TestTrue(TEXT("glb download completed"), GlbReceiver->bCompleted);
+			TestEqual(TEXT("glb Ready fired once"), GlbReceiver->ReadyCount, 1);
+			TestTrue(TEXT("glb completed with the ready asset"), GlbReceiver->CompletedAsset != nullptr && GlbReceiver->CompletedAsset == GlbReceiver->ReadyAsset);
+			TestTrue(TEXT("glb binary chunk matches"), MatchesBuffer(GlbReceiver->CompletedAsset, GlbBinary));
+
+			// non glb content is accumulated and loaded at completion only
+			TestTrue(TEXT("gltf download completed"), GltfReceiver->bCompleted);
+			TestEqual(TEXT("gltf Ready never fired"), GltfReceiver->ReadyCount, 0);
+			TestTrue(TEXT("gltf buffer matches"), MatchesBuffer(GltfReceiver->CompletedAsset, GltfBinary));
+
+			Router->UnbindRoute(GlbRoute);
+			Router->UnbindRoute(GltfRoute);
+			GlbReceiver->RemoveFromRoot();
+			GltfReceiver->RemoveFromRoot();
+			return true;
+		}));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeHttpAsyncResponseGameThreadTest, "glTFRuntime.Http.AsyncResponseGameThread", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeHttpAsyncResponseGameThreadTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeHttpTests;
+
+	TSharedPtr<IHttpRouter> Router = FHttpServerModule::Get().GetHttpRouter(LoopbackPort);
+	if (!TestTrue(TEXT("loopback router is available"), Router.IsValid()))
+	{
+		return false;
+	}
+
+	// the base64 data uri makes the parsing expensive enough to show up in the game thread frames
+	const TArray<uint8> Binary = MakeData(16 * 1024 * 1024, 3);
+	const FHttpRouteHandle Route = BindBody(Router, TEXT("/async.gltf"), MakeGltf(Binary), TEXT("model/gltf+json"));
+	FHttpServerModule::Get().StartAllListeners();
+
+	struct FLoadState
+	{
+		UglTFRuntimeHttpTestReceiver* Receiver = nullptr;
+		double StartTime = 0;
+		double LastFrameTime = 0;
+		// longest interval between two game thread frames while the load was running
+		double LongestFrame = 0;
+	};
+
+	// async first, then the synchronous parsing as the reference
+	TSharedRef<TArray<FLoadState>> States = MakeShared<TArray<FLoadState>>();
+	States->AddDefaulted(2);
+
+	for (int32 StateIndex = 0; StateIndex < States->Num(); StateIndex++)
+	{
+		ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([States, StateIndex]()
+			{
+				FLoadState& State = (*States)[StateIndex];
+				State.Receiver = NewObject<UglTFRuntimeHttpTestReceiver>();
+				State.Receiver->AddToRoot();
+
+				FglTFRuntimeHttpResponse Completed;
+				Completed.BindUFunction(State.Receiver, GET_FUNCTION_NAME_CHECKED(UglTFRuntimeHttpTestReceiver, OnCompleted));
+
+				FglTFRuntimeConfig LoaderConfig;
+				LoaderConfig.bParseHttpResponseAsync = StateIndex == 0;
+
+				State.StartTime = FPlatformTime::Seconds();
+				UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUrl(FString::Printf(TEXT("http://127.0.0.1:%u/async.gltf"), LoopbackPort), {}, Completed, LoaderConfig);
+				State.LastFrameTime = FPlatformTime::Seconds();
+				State.LongestFrame = State.LastFrameTime - State.StartTime;
+				return true;
+			}));
+
+		ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([States, StateIndex]()
+			{
+				FLoadState& State = (*States)[StateIndex];
+				const double Now = FPlatformTime::Seconds();
+				State.LongestFrame = FMath::Max(State.LongestFrame, Now - State.LastFrameTime);
+				State.LastFrameTime = Now;
+				return State.Receiver->bCompleted || Now - State.StartTime > 30.0;
+			}));
+	}
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, Router, Route, States, Binary]()
+		{
+			const FLoadState& AsyncState = (*States)[0];
+			const FLoadState& SyncState = (*States)[1];
+
+			TestTrue(TEXT("async download completed"), AsyncState.Receiver->bCompleted);
+			TestTrue(TEXT("async callback runs in the game thread"), AsyncState.Receiver->bCompletedInGameThread);
+			TestTrue(TEXT("async buffer matches"), MatchesBuffer(AsyncState.Receiver->CompletedAsset, Binary));
+			TestTrue(TEXT("sync download completed"), SyncState.Receiver->bCompleted);
+			TestTrue(TEXT("sync buffer matches"), MatchesBuffer(SyncState.Receiver->CompletedAsset, Binary));
+
+			AddBenchmarkInfo(*this, TEXT("longest game thread frame (async parsing)"), AsyncState.LongestFrame);
+			AddBenchmarkInfo(*this, TEXT("longest game thread frame (sync parsing)"), SyncState.LongestFrame);
+			TestTrue(TEXT("async parsing does not stall the game thread as the sync one"), AsyncState.LongestFrame < SyncState.LongestFrame);
+
+			Router->UnbindRoute(Route);
+			for (const FLoadState& State : *States)
+			{
+				State.Receiver->RemoveFromRoot();
+			}
+			return true;
+		}));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeHttpContentCacheTest, "glTFRuntime.Http.ContentCache", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeHttpContentCacheTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeHttpTests;
+
+	TSharedPtr<IHttpRouter> Router = FHttpServerModule::Get().GetHttpRouter(LoopbackPort);
+	if (!TestTrue(TEXT("loopback router is available"), Router.IsValid()))
+	{
+		return false;
+	}
+
+	// two contents that do not fit together in a 1MB cache
+	const TArray<uint8> FirstBinary = MakeData(600 * 1024, 4);
+	const TArray<uint8> SecondBinary = MakeData(600 * 1024, 5);
+	const TArray<uint8> FirstGlb = MakeGlb(FirstBinary);
+	const TArray<uint8> SecondGlb = MakeGlb(SecondBinary);
+
+	TSharedRef<FThreadSafeCounter> NotModifiedCounter = MakeShared<FThreadSafeCounter>();
+	const FHttpRouteHandle FirstRoute = BindBodyWithETag(Router, TEXT("/cached_first.glb"), FirstGlb, TEXT("\"first\""), NotModifiedCounter);
+	const FHttpRouteHandle SecondRoute = BindBodyWithETag(Router, TEXT("/cached_second.glb"), SecondGlb, TEXT("\"second\""), NotModifiedCounter);
+	FHttpServerModule::Get().StartAllListeners();
+
+	// a fresh directory, so the stats start from zero
+	const FString CacheDirectory = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("glTFRuntimeContentCache"), FGuid::NewGuid().ToString());
+	TSharedRef<FglTFRuntimeDownloadCache, ESPMode::ThreadSafe> Cache = FglTFRuntimeDownloadCache::Get(CacheDirectory);
+	const FString FirstContentFilename = FPaths::Combine(FPaths::ConvertRelativePathToFull(CacheDirectory), GetContentHash(FirstGlb) + TEXT(".bin"));
+
+	struct FCacheStep
+	{
+		FString Path;
+		// runs before the request
+		TFunction<void()> Prepare;
+		TFunction<void(UglTFRuntimeAsset* Asset, const FglTFRuntimeDownloadCacheStats& Stats)> Check;
+	};
+
+	TArray<FCacheStep> Steps;
+
+	Steps.Add({ TEXT("cached_first.glb"), nullptr, [this, FirstBinary](UglTFRuntimeAsset* Asset, const FglTFRuntimeDownloadCacheStats& Stats)
+		{
+			TestTrue(TEXT("miss: asset matches"), MatchesBuffer(Asset, FirstBinary));
+			TestEqual(TEXT("miss: counted"), Stats.Misses, static_cast<int64>(1));
+			TestEqual(TEXT("miss: no hits"), Stats.Hits, static_cast<int64>(0));
+		} });
+
+	Steps.Add({ TEXT("cached_first.glb"), nullptr, [this, FirstBinary, NotModifiedCounter](UglTFRuntimeAsset* Asset, const FglTFRuntimeDownloadCacheStats& Stats)
+		{
+			TestEqual(TEXT("revalidation: server answered 304"), NotModifiedCounter->GetValue(), 1);
+			TestTrue(TEXT("revalidation: asset matches"), MatchesBuffer(Asset, FirstBinary));
+			TestEqual(TEXT("revalidation: hit counted"), Stats.Hits, static_cast<int64>(1));
+			TestEqual(TEXT("revalidation: no new misses"), Stats.Misses, static_cast<int64>(1));
+		} });
+
+	// a flipped byte does not match the content hash anymore
+	Steps.Add({ TEXT("cached_first.glb"), [this, FirstContentFilename]()
+		{
+			TArray<uint8> Content;
+			if (TestTrue(TEXT("corrupted: content file exists"), FFileHelper::LoadFileToArray(Content, *FirstContentFilename)) && Content.Num() > 0)
+			{
+				Content[Content.Num() / 2] ^= 0xFF;
+				FFileHelper::SaveArrayToFile(Content, *FirstContentFilename);
+			}
+		},
+		[this, FirstBinary, NotModifiedCounter](UglTFRuntimeAsset* Asset, const FglTFRuntimeDownloadCacheStats& Stats)
+		{
+			// the 304 can not be served, the content is downloaded again without validators
+			TestEqual(TEXT("corrupted: server answered 304"), NotModifiedCounter->GetValue(), 2);
+			TestTrue(TEXT("corrupted: asset matches"), MatchesBuffer(Asset, FirstBinary));
+			TestEqual(TEXT("corrupted: entry dropped"), Stats.CorruptedEntries, static_cast<int64>(1));
+			TestEqual(TEXT("corrupted: downloaded again"), Stats.Misses, static_cast<int64>(2));
+		} });
+
+	Steps.Add({ TEXT("cached_second.glb"), nullptr, [this, SecondBinary, FirstGlb, FirstContentFilename](UglTFRuntimeAsset* Asset, const FglTFRuntimeDownloadCacheStats& Stats)
+		{
+			TestTrue(TEXT("eviction: asset matches"), MatchesBuffer(Asset, SecondBinary));
+			TestTrue(TEXT("eviction: least recently used content evicted"), Stats.EvictedBytes >= FirstGlb.Num());
+			TestFalse(TEXT("eviction: content file deleted"), IFileManager::Get().FileExists(*FirstContentFilename));
+			TestTrue(TEXT("eviction: cache within its size"), Stats.TotalBytes <= 1024 * 1024);
+		} });
+
+	// the server is gone, bUseCacheOnError serves the cached content
+	Steps.Add({ TEXT("cached_second.glb"), [Router, SecondRoute]()
+		{
+			Router->UnbindRoute(SecondRoute);
+		},
+		[this, SecondBinary](UglTFRuntimeAsset* Asset, const FglTFRuntimeDownloadCacheStats& Stats)
+		{
+			TestTrue(TEXT("hit on error: asset matches"), MatchesBuffer(Asset, SecondBinary));
+			TestEqual(TEXT("hit on error: hit counted"), Stats.Hits, static_cast<int64>(2));
+		} });
+
+	TSharedRef<TArray<UglTFRuntimeHttpTestReceiver*>> Receivers = MakeShared<TArray<UglTFRuntimeHttpTestReceiver*>>();
+	TSharedRef<double> StepStartTime = MakeShared<double>(0);
+	for (const FCacheStep& Step : Steps)
+	{
+		ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([Step, Receivers, StepStartTime, CacheDirectory]()
+			{
+				if (Step.Prepare)
+				{
+					Step.Prepare();
+				}
+
+				UglTFRuntimeHttpTestReceiver* Receiver = NewObject<UglTFRuntimeHttpTestReceiver>();
+				Receiver->AddToRoot();
+				Receivers->Add(Receiver);
+
+				FglTFRuntimeHttpResponse Completed;
+				Completed.BindUFunction(Receiver, GET_FUNCTION_NAME_CHECKED(UglTFRuntimeHttpTestReceiver, OnCompleted));
+				const FString Url = FString::Printf(TEXT("http://127.0.0.1:%u/%s"), LoopbackPort, *Step.Path);
+				*StepStartTime = FPlatformTime::Seconds();
+				UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUrlWithContentCache(Url, CacheDirectory, 1, {}, true, Completed, FglTFRuntimeConfig());
+				return true;
+			}));
+
+		ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([Receivers, StepStartTime]()
+			{
+				return Receivers->Last()->bCompleted || FPlatformTime::Seconds() - *StepStartTime > 30.0;
+			}));
+
+		ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([Step, Receivers, Cache]()
+			{
+				Step.Check(Receivers->Last()->CompletedAsset, Cache->GetStats());
+				return true;
+			}));
+	}
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([Router, FirstRoute, Receivers, Cache, CacheDirectory]()
+		{
+			Router->UnbindRoute(FirstRoute);
+			for (UglTFRuntimeHttpTestReceiver* Receiver : *Receivers)
+			{
+				Receiver->RemoveFromRoot();
+			}
+			Cache->Flush();
+			IFileManager::Get().DeleteDirectory(*CacheDirectory, false, true);
+			return true;
+		}));
+
+	return true;
+}
+
+#endif
+
@@ -0,0 +1,162 @@
+// Copyright 2020-2024, Roberto De Ioris.
+
+#include "glTFRuntimeParser.h"
+#include "Misc/AutomationTest.h"
+#include "glTFRuntimeTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace glTFRuntimeInterleavedTests
+{
+	using namespace glTFRuntimeTests;
+
+	enum class EMixedLayout : uint8
+	{
+		Planar,
+		// float VEC3 and normalized UNSIGNED_SHORT VEC2 sharing a 16 bytes stride
+		Interleaved,
+		// same as Interleaved, with 4 bytes of padding after every vertex
+		InterleavedPadded
+	};
+
+	// Count vertices with float positions and quantized uvs, and sequential 32 bit indices
+	TArray<uint8> MakeMixedGlb(const int32 Count, const EMixedLayout Layout)
+	{
+		TArray<float> Positions;
+		TArray<uint16> UVs;
+		for (int32 Index = 0; Index < Count; Index++)
+		{
+			Positions.Append({ static_cast<float>(Index % 97), static_cast<float>(Index % 89) * 0.5f, static_cast<float>(Index / 97) });
+			UVs.Append({ static_cast<uint16>(Index * 31), static_cast<uint16>(65535 - Index * 17) });
+		}
+
+		const int32 Stride = Layout == EMixedLayout::InterleavedPadded ? 20 : 16;
+		TArray<uint8> Binary;
+		FString BufferViewsJson;
+		if (Layout == EMixedLayout::Planar)
+		{
+			Binary.Append(reinterpret_cast<const uint8*>(Positions.GetData()), Count * 12);
+			Binary.Append(reinterpret_cast<const uint8*>(UVs.GetData()), Count * 4);
+			BufferViewsJson = FString::Printf(TEXT("{\"buffer\":0,\"byteLength\":%d},{\"buffer\":0,\"byteOffset\":%d,\"byteLength\":%d},"), Count * 12, Count * 12, Count * 4);
+		}
+		else
+		{
+			Binary.AddZeroed(Count * Stride);
+			for (int32 Index = 0; Index < Count; Index++)
+			{
+				FMemory::Memcpy(Binary.GetData() + Index * Stride, Positions.GetData() + Index * 3, 12);
+				FMemory::Memcpy(Binary.GetData() + Index * Stride + 12, UVs.GetData() + Index * 2, 4);
+			}
+			BufferViewsJson = FString::Printf(TEXT("{\"buffer\":0,\"byteLength\":%d,\"byteStride\":%d},"), Count * Stride, Stride);
+		}
+
+		const int32 IndicesOffset = Binary.Num();
+		for (int32 Index = 0; Index < Count; Index++)
+		{
+			Write32(Binary, Index);
+		}
+		BufferViewsJson += FString::Printf(TEXT("{\"buffer\":0,\"byteOffset\":%d,\"byteLength\":%d}"), IndicesOffset, Count * 4);
+
+		const bool bPlanar = Layout == EMixedLayout::Planar;
+		return MakeGlb(FString::Printf(TEXT("{\"asset\":{\"version\":\"2.0\"},\"meshes\":[{\"primitives\":[{\"attributes\":{\"POSITION\":0,\"TEXCOORD_0\":1},\"indices\":2}]}],")
+			TEXT("\"buffers\":[{\"byteLength\":%d}],\"bufferViews\":[%s],")
+			TEXT("\"accessors\":[{\"bufferView\":0,\"componentType\":5126,\"count\":%d,\"type\":\"VEC3\"},")
+			TEXT("{\"bufferView\":%d,\"byteOffset\":%d,\"componentType\":5123,\"normalized\":true,\"count\":%d,\"type\":\"VEC2\"},")
+			TEXT("{\"bufferView\":%d,\"componentType\":5125,\"count\":%d,\"type\":\"SCALAR\"}]}"),
+			Binary.Num(), *BufferViewsJson, Count, bPlanar ? 1 : 0, bPlanar ? 0 : 12, Count, bPlanar ? 2 : 1, Count), Binary);
+	}
+
+	bool LoadLOD(const TArray<uint8>& Glb, FglTFRuntimeMeshLOD& LOD)
+	{
+		TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromData(Glb.GetData(), Glb.Num(), FglTFRuntimeConfig());
+		return Parser && Parser->LoadMeshAsRuntimeLOD(0, LOD, FglTFRuntimeMaterialsConfig()) && LOD.Primitives.Num() == 1;
+	}
+
+	bool Matches(const FglTFRuntimePrimitive& Primitive, const FglTFRuntimePrimitive& Expected)
+	{
+		return Primitive.Positions == Expected.Positions &&
+			Primitive.Normals == Expected.Normals &&
+			Primitive.UVs == Expected.UVs &&
+			Primitive.Indices == Expected.Indices;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeInterleavedDeinterleaveTest, "glTFRuntime.Interleaved.Deinterleave", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeInterleavedDeinterleaveTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeInterleavedTests;
+
+	// more than a single batch (4096 vertices) of the de-interleaving pass
+	constexpr int32 Side = 65;
+	FglTFRuntimeMeshLOD PlanarLOD;
+	FglTFRuntimeMeshLOD InterleavedLOD;
+	if (TestTrue(TEXT("planar grid is loaded"), LoadLOD(MakeGridGlb(Side), PlanarLOD)) &&
+		TestTrue(TEXT("interleaved grid is loaded"), LoadLOD(MakeGridGlb(Side, true), InterleavedLOD)))
+	{
+		TestEqual(TEXT("grid vertices"), InterleavedLOD.Primitives[0].Positions.Num(), Side * Side);
+		TestTrue(TEXT("interleaved grid matches the planar one"), Matches(InterleavedLOD.Primitives[0], PlanarLOD.Primitives[0]));
+	}
+
+	// different component types in the same stride, with and without padding
+	constexpr int32 Count = 3 * 3000;
+	FglTFRuntimeMeshLOD MixedPlanarLOD;
+	if (!TestTrue(TEXT("planar mixed mesh is loaded"), LoadLOD(MakeMixedGlb(Count, EMixedLayout::Planar), MixedPlanarLOD)))
+	{
+		return false;
+	}
+	TestEqual(TEXT("mixed mesh uvs"), MixedPlanarLOD.Primitives[0].UVs.Num(), 1);
+
+	FglTFRuntimeMeshLOD MixedInterleavedLOD;
+	if (TestTrue(TEXT("interleaved mixed mesh is loaded"), LoadLOD(MakeMixedGlb(Count, EMixedLayout::Interleaved), MixedInterleavedLOD)))
+	{
+		TestTrue(TEXT("interleaved mixed mesh matches the planar one"), Matches(MixedInterleavedLOD.Primitives[0], MixedPlanarLOD.Primitives[0]));
+	}
+
+	FglTFRuntimeMeshLOD MixedPaddedLOD;
+	if (TestTrue(TEXT("padded interleaved mixed mesh is loaded"), LoadLOD(MakeMixedGlb(Count, EMixedLayout::InterleavedPadded), MixedPaddedLOD)))
+	{
+		TestTrue(TEXT("padded interleaved mixed mesh matches the planar one"), Matches(MixedPaddedLOD.Primitives[0], MixedPlanarLOD.Primitives[0]));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeInterleavedBenchmark, "glTFRuntime.Interleaved.Benchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FglTFRuntimeInterleavedBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeInterleavedTests;
+
+	// about 4M vertices
+	constexpr int32 Side = 2048;
+	constexpr int32 Runs = 3;
+
+	for (const bool bInterleaved : { false, true })
+	{
+		const TCHAR* Name = bInterleaved ? TEXT("Interleaved (32 bytes stride)") : TEXT("Planar");
+		const TArray<uint8> Glb = MakeGridGlb(Side, bInterleaved);
+		TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromData(Glb.GetData(), Glb.Num(), FglTFRuntimeConfig());
+		if (!TestTrue(FString::Printf(TEXT("%s grid is parsed"), Name), Parser.IsValid()))
+		{
+			return false;
+		}
+
+		// only the mesh decoding is measured
+		bool bLoaded = false;
+		const double Seconds = MeasureBestSeconds(Runs, [&]()
+			{
+				FglTFRuntimeMeshLOD LOD;
+				bLoaded = Parser->LoadMeshAsRuntimeLOD(0, LOD, FglTFRuntimeMaterialsConfig());
+			});
+
+		if (TestTrue(FString::Printf(TEXT("%s mesh is loaded"), Name), bLoaded))
+		{
+			AddBenchmarkInfo(*this, FString::Printf(TEXT("%s mesh load"), Name), Seconds, static_cast<int64>(Side) * Side * 32);
+		}
+	}
+
+	return true;
+}
+
+#endif
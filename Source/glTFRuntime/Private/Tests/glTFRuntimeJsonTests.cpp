@@ -0,0 +1,530 @@
+// Copyright 2020-2023, Roberto De Ioris.
+
+#include "glTFRuntimeParser.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/JsonSerializer.h"
+#include "glTFRuntimeTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace glTFRuntimeJsonTests
+{
+	using namespace glTFRuntimeTests;
+
+	FString Condense(TSharedPtr<FJsonObject> JsonObject)
+	{
+		FString Output;
+		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Output);
+		FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
+		return Output;
+	}
+
+	TSharedPtr<FJsonObject> ParseWithSerializer(const FString& Json)
+	{
+		TSharedPtr<FJsonObject> JsonObject;
+		TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(Json);
+		if (!FJsonSerializer::Deserialize(JsonReader, JsonObject))
+		{
+			return nullptr;
+		}
+		return JsonObject;
+	}
+
+	TSharedPtr<FJsonObject> ParseWithScanner(const FString& Json)
+	{
+		FTCHARToUTF8 UTF8(*Json);
+		FglTFRuntimeJsonTables JsonTables;
+		return FglTFRuntimeParser::ParseJsonUTF8(reinterpret_cast<const uint8*>(UTF8.Get()), UTF8.Length(), false, JsonTables);
+	}
+
+	// the bytes are copied by the json source, so the temporary conversion can go away
+	TSharedPtr<FJsonObject> ParseWithStreaming(const FString& Json, FglTFRuntimeJsonTables& JsonTables)
+	{
+		FTCHARToUTF8 UTF8(*Json);
+		return FglTFRuntimeParser::ParseJsonUTF8(reinterpret_cast<const uint8*>(UTF8.Get()), UTF8.Length(), true, JsonTables);
+	}
+
+	TSharedPtr<FJsonObject> ParseWithStreaming(const FString& Json)
+	{
+		FglTFRuntimeJsonTables JsonTables;
+		return ParseWithStreaming(Json, JsonTables);
+	}
+
+	// a gltf-like document with NumAccessors accessors, bufferViews and nodes
+	FString MakeSceneJson(const int32 NumAccessors)
+	{
+		FString Accessors;
+		FString BufferViews;
+		FString Nodes;
+		for (int32 Index = 0; Index < NumAccessors; Index++)
+		{
+			const TCHAR* Separator = Index > 0 ? TEXT(",") : TEXT("");
+			Accessors += FString::Printf(TEXT("%s{\"bufferView\":%d,\"componentType\":5126,\"count\":%d,\"type\":\"VEC3\",\"min\":[-1.5,-1.5,-1.5],\"max\":[1.5,1.5,1.5],\"name\":\"accessor_%d\"}"), Separator, Index, 3 + Index % 64, Index);
+			BufferViews += FString::Printf(TEXT("%s{\"buffer\":0,\"byteOffset\":%d,\"byteLength\":%d}"), Separator, Index * 768, 768);
+			Nodes += FString::Printf(TEXT("%s{\"mesh\":0,\"translation\":[%d.25,0,-%d.5],\"name\":\"node_%d\"}"), Separator, Index, Index, Index);
+		}
+
+		return FString::Printf(TEXT("{\"asset\":{\"version\":\"2.0\"},\"buffers\":[{\"byteLength\":%d}],\"accessors\":[%s],\"bufferViews\":[%s],\"nodes\":[%s],")
+			TEXT("\"meshes\":[{\"primitives\":[{\"attributes\":{\"POSITION\":0}}]}],\"materials\":[{\"pbrMetallicRoughness\":{\"baseColorFactor\":[1,1,1,1]}}]}"),
+			NumAccessors * 768, *Accessors, *BufferViews, *Nodes);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeJsonUTF8MatchesSerializerTest, "glTFRuntime.Json.UTF8MatchesSerializer", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeJsonUTF8MatchesSerializerTest::RunTest(const FString& Parameters)
+{
+	const TArray<FString> Documents = {
+		TEXT("{}"),
+		TEXT("{\"asset\":{\"version\":\"2.0\",\"generator\":\"glTFRuntime\"}}"),
+		TEXT(" {\n\t\"a\" : [ 1, -2, 3.5, -0.25, 1e3, 2.5E-2, 12345678901234567890 ] \r\n} "),
+		TEXT("{\"t\":true,\"f\":false,\"n\":null,\"e\":[],\"o\":{}}"),
+		TEXT("{\"escaped\":\"a\\\"b\\\\c\\/d\\b\\f\\n\\r\\t\\u00e8\\u20AC\"}"),
+		TEXT("{\"k\\u0065y\":1,\"key\":2}"),
+		TEXT("{\"utf8\":\"\u00e8\u20ac\u65e5\u672c\"}"),
+		TEXT("{\"long\":0.1000000000000000055511151231257827021181583404541015625000000000000000001}"),
+		TEXT("{\"accessors\":[{\"bufferView\":0,\"componentType\":5126,\"count\":3,\"type\":\"VEC3\",\"min\":[-1,-1,-1],\"max\":[1,1,1]}],\"extras\":{\"a\":{\"b\":{\"c\":[[[1]]]}}}}")
+	};
+
+	for (const FString& Document : Documents)
+	{
+		TSharedPtr<FJsonObject> Expected = glTFRuntimeJsonTests::ParseWithSerializer(Document);
+		TSharedPtr<FJsonObject> Scanned = glTFRuntimeJsonTests::ParseWithScanner(Document);
+		if (!TestTrue(FString::Printf(TEXT("FJsonSerializer parses %s"), *Document), Expected.IsValid()) ||
+			!TestTrue(FString::Printf(TEXT("Scanner parses %s"), *Document), Scanned.IsValid()))
+		{
+			continue;
+		}
+		TestEqual(Document, glTFRuntimeJsonTests::Condense(Scanned), glTFRuntimeJsonTests::Condense(Expected));
+	}
+
+	const TArray<FString> Invalid = {
+		TEXT(""),
+		TEXT("{"),
+		TEXT("{\"a\":}"),
+		TEXT("{\"a\":1,}"),
+		TEXT("{\"a\":tru}"),
+		TEXT("{\"a\":\"\\x\"}"),
+		TEXT("{} {}")
+	};
+
+	for (const FString& Document : Invalid)
+	{
+		AddExpectedError(TEXT("Unable to parse json"), EAutomationExpectedErrorFlags::Contains, 1);
+		TestFalse(FString::Printf(TEXT("Scanner rejects %s"), *Document), glTFRuntimeJsonTests::ParseWithScanner(Document).IsValid());
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeJsonUTF8DepthTest, "glTFRuntime.Json.UTF8Depth", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeJsonUTF8DepthTest::RunTest(const FString& Parameters)
+{
+	// 63 nested arrays (plus the root object) are accepted
+	FString Nested = TEXT("{\"a\":") + FString::ChrN(63, '[') + FString::ChrN(63, ']') + TEXT("}");
+	TestTrue(TEXT("64 levels are parsed"), glTFRuntimeJsonTests::ParseWithScanner(Nested).IsValid());
+
+	// deeper documents are rejected instead of exhausting the stack
+	FString TooDeep = TEXT("{\"a\":") + FString::ChrN(100000, '[') + FString::ChrN(100000, ']') + TEXT("}");
+	AddExpectedError(TEXT("Unable to parse json"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestFalse(TEXT("100001 levels are rejected"), glTFRuntimeJsonTests::ParseWithScanner(TooDeep).IsValid());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeJsonStreamingMatchesSerializerTest, "glTFRuntime.Json.StreamingMatchesSerializer", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeJsonStreamingMatchesSerializerTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeJsonTests;
+
+	// serializing the streamed root expands every lazy section item
+	const TArray<FString> Documents = {
+		TEXT("{}"),
+		TEXT("{\"asset\":{\"version\":\"2.0\",\"generator\":\"glTFRuntime\"}}"),
+		TEXT("{\"accessors\":[],\"nodes\":{},\"meshes\":null,\"materials\":1}"),
+		TEXT("{\"accessors\":[1,\"two\",[3],null,{\"count\":1}]}"),
+		TEXT("{\"acc\\u0065ssors\":[{\"count\":1}],\"nodes\":[{\"n\\u0061me\":\"\\u00e8\"}]}"),
+		TEXT("{\"materials\":[{\"extensions\":{\"KHR_materials_unlit\":{}},\"name\":\"\u00e8\u20ac\u65e5\"}]}"),
+		MakeSceneJson(8)
+	};
+
+	for (const FString& Document : Documents)
+	{
+		TSharedPtr<FJsonObject> Expected = ParseWithSerializer(Document);
+		TSharedPtr<FJsonObject> Streamed = ParseWithStreaming(Document);
+		if (!TestTrue(FString::Printf(TEXT("FJsonSerializer parses %s"), *Document), Expected.IsValid()) ||
+			!TestTrue(FString::Printf(TEXT("Streaming parses %s"), *Document), Streamed.IsValid()))
+		{
+			continue;
+		}
+		TestEqual(Document, Condense(Streamed), Condense(Expected));
+	}
+
+	// structural errors are still caught while the section items are only scanned
+	const TArray<FString> Invalid = {
+		TEXT(""),
+		TEXT("[]"),
+		TEXT("{\"accessors\":[{\"count\":1}"),
+		TEXT("{\"accessors\":[{\"count\":}]}"),
+		TEXT("{\"accessors\":[{\"count\":1,}]}"),
+		TEXT("{\"nodes\":[{\"children\":[0,]}]}"),
+		TEXT("{\"bufferViews\":[{\"name\":\"unterminated}]}"),
+		TEXT("{\"asset\":tru}"),
+		TEXT("{} {}")
+	};
+
+	for (const FString& Document : Invalid)
+	{
+		AddExpectedError(TEXT("Unable to parse json"), EAutomationExpectedErrorFlags::Contains, 1);
+		TestFalse(FString::Printf(TEXT("Streaming rejects %s"), *Document), ParseWithStreaming(Document).IsValid());
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeJsonStreamingTablesTest, "glTFRuntime.Json.StreamingTables", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeJsonStreamingTablesTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeJsonTests;
+
+	const FString Json = TEXT("{")
+		TEXT("\"accessors\":[")
+		TEXT("{\"bufferView\":2,\"byteOffset\":12,\"componentType\":5123,\"count\":36,\"type\":\"SCALAR\"},")
+		TEXT("{\"bufferView\":1,\"componentType\":5121,\"normalized\":true,\"count\":4,\"type\":\"VEC4\",\"sparse\":{\"count\":1}},")
+		TEXT("{\"bufferView\":\"zero\",\"count\":1,\"type\":\"MAT4\"},")
+		TEXT("7],")
+		TEXT("\"bufferViews\":[")
+		TEXT("{\"buffer\":0,\"byteOffset\":4096,\"byteLength\":6000000000,\"byteStride\":12},")
+		TEXT("{\"buffer\":1,\"byteLength\":64,\"extensions\":{\"EXT_meshopt_compression\":{}}}],")
+		TEXT("\"nodes\":[{\"mesh\":0,\"children\":[1,2,3]},{\"skin\":1,\"camera\":2},{\"children\":4}],")
+		TEXT("\"meshes\":[{\"primitives\":[{},{}]}],")
+		TEXT("\"materials\":[{\"extensions\":{}},{}]")
+		TEXT("}");
+
+	FglTFRuntimeJsonTables JsonTables;
+	if (!TestTrue(TEXT("json is streamed"), ParseWithStreaming(Json, JsonTables).IsValid()))
+	{
+		return false;
+	}
+
+	if (TestEqual(TEXT("accessors are indexed"), JsonTables.Accessors.Num(), 4))
+	{
+		const FglTFRuntimeAccessorEntry& Indices = JsonTables.Accessors[0];
+		TestTrue(TEXT("indices accessor is valid"), Indices.bValid);
+		TestEqual(TEXT("indices bufferView"), Indices.BufferView, static_cast<int64>(2));
+		TestEqual(TEXT("indices byteOffset"), Indices.ByteOffset, static_cast<int64>(12));
+		TestEqual(TEXT("indices componentType"), Indices.ComponentType, static_cast<int64>(5123));
+		TestEqual(TEXT("indices count"), Indices.Count, static_cast<int64>(36));
+		TestEqual(TEXT("indices elements"), Indices.Elements, static_cast<int64>(1));
+		TestFalse(TEXT("indices have no normalized field"), Indices.bHasNormalized);
+		TestFalse(TEXT("indices are not sparse"), Indices.bHasSparse);
+
+		const FglTFRuntimeAccessorEntry& Colors = JsonTables.Accessors[1];
+		TestTrue(TEXT("colors accessor is valid"), Colors.bValid);
+		TestEqual(TEXT("colors byteOffset defaults to 0"), Colors.ByteOffset, static_cast<int64>(0));
+		TestEqual(TEXT("colors elements"), Colors.Elements, static_cast<int64>(4));
+		TestTrue(TEXT("colors have a normalized field"), Colors.bHasNormalized);
+		TestTrue(TEXT("colors are normalized"), Colors.bNormalized);
+		TestTrue(TEXT("colors are sparse"), Colors.bHasSparse);
+
+		// entries that can not be trusted fall back to the json object
+		TestFalse(TEXT("string bufferView invalidates the entry"), JsonTables.Accessors[2].bValid);
+		TestEqual(TEXT("mat4 elements"), JsonTables.Accessors[2].Elements, static_cast<int64>(16));
+		TestFalse(TEXT("non-object item is invalid"), JsonTables.Accessors[3].bValid);
+	}
+
+	if (TestEqual(TEXT("bufferViews are indexed"), JsonTables.BufferViews.Num(), 2))
+	{
+		const FglTFRuntimeBufferViewEntry& Large = JsonTables.BufferViews[0];
+		TestEqual(TEXT("large buffer"), Large.Buffer, static_cast<int64>(0));
+		TestEqual(TEXT("large byteOffset"), Large.ByteOffset, static_cast<int64>(4096));
+		TestEqual(TEXT("large byteLength is 64 bit"), Large.ByteLength, static_cast<int64>(6000000000));
+		TestEqual(TEXT("large byteStride"), Large.ByteStride, static_cast<int64>(12));
+		TestFalse(TEXT("large has no extensions"), Large.bHasExtensions);
+
+		const FglTFRuntimeBufferViewEntry& Compressed = JsonTables.BufferViews[1];
+		TestEqual(TEXT("compressed buffer"), Compressed.Buffer, static_cast<int64>(1));
+		TestEqual(TEXT("compressed byteStride defaults to 0"), Compressed.ByteStride, static_cast<int64>(0));
+		TestTrue(TEXT("compressed has extensions"), Compressed.bHasExtensions);
+	}
+
+	if (TestEqual(TEXT("nodes are indexed"), JsonTables.Nodes.Num(), 3))
+	{
+		TestEqual(TEXT("node mesh"), JsonTables.Nodes[0].Mesh, static_cast<int64>(0));
+		TestEqual(TEXT("node children"), JsonTables.Nodes[0].NumChildren, 3);
+		TestEqual(TEXT("node without mesh"), JsonTables.Nodes[1].Mesh, static_cast<int64>(INDEX_NONE));
+		TestEqual(TEXT("node skin"), JsonTables.Nodes[1].Skin, static_cast<int64>(1));
+		TestEqual(TEXT("node camera"), JsonTables.Nodes[1].Camera, static_cast<int64>(2));
+		TestFalse(TEXT("non-array children invalidate the entry"), JsonTables.Nodes[2].bValid);
+	}
+
+	if (TestEqual(TEXT("meshes are indexed"), JsonTables.Meshes.Num(), 1))
+	{
+		TestEqual(TEXT("mesh primitives"), JsonTables.Meshes[0].NumPrimitives, 2);
+	}
+
+	if (TestEqual(TEXT("materials are indexed"), JsonTables.Materials.Num(), 2))
+	{
+		TestTrue(TEXT("material with extensions"), JsonTables.Materials[0].bHasExtensions);
+		TestFalse(TEXT("material without extensions"), JsonTables.Materials[1].bHasExtensions);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeJsonStreamingLazyTest, "glTFRuntime.Json.StreamingLazy", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeJsonStreamingLazyTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeJsonTests;
+
+	// section items are only scanned, so a bad literal inside them is not seen until the item is accessed
+	const FString Json = TEXT("{\"asset\":{\"version\":\"2.0\"},\"accessors\":[{\"count\":3,\"name\":\"first\"},{\"count\":5,\"extras\":tru}]}");
+
+	FglTFRuntimeJsonTables JsonTables;
+	TSharedPtr<FJsonObject> Root = ParseWithStreaming(Json, JsonTables);
+	if (!TestTrue(TEXT("json is streamed"), Root.IsValid()))
+	{
+		return false;
+	}
+
+	if (!TestEqual(TEXT("accessors are indexed without expanding them"), JsonTables.Accessors.Num(), 2))
+	{
+		return false;
+	}
+	TestEqual(TEXT("count of the broken accessor is indexed"), JsonTables.Accessors[1].Count, static_cast<int64>(5));
+
+	const TArray<TSharedPtr<FJsonValue>>* Accessors = nullptr;
+	if (!TestTrue(TEXT("accessors array is available"), Root->TryGetArrayField(TEXT("accessors"), Accessors)) || !TestEqual(TEXT("accessors items"), Accessors->Num(), 2))
+	{
+		return false;
+	}
+
+	// the first access materializes the object, later accesses return the same one
+	TSharedPtr<FJsonObject> First = (*Accessors)[0]->AsObject();
+	if (TestTrue(TEXT("first accessor is expanded"), First.IsValid()))
+	{
+		TestEqual(TEXT("first accessor name"), First->GetStringField(TEXT("name")), FString(TEXT("first")));
+		TestTrue(TEXT("expanded object is cached"), First == (*Accessors)[0]->AsObject());
+	}
+
+	AddExpectedError(TEXT("Unable to parse json object at offset"), EAutomationExpectedErrorFlags::Contains, 1);
+	TSharedPtr<FJsonObject> Broken = (*Accessors)[1]->AsObject();
+	if (TestTrue(TEXT("broken accessor gives an empty object"), Broken.IsValid()))
+	{
+		TestEqual(TEXT("broken accessor has no fields"), Broken->Values.Num(), 0);
+		// the error is reported once
+		TestTrue(TEXT("broken object is cached"), Broken == (*Accessors)[1]->AsObject());
+	}
+
+	// non-section fields are parsed upfront
+	TestEqual(TEXT("asset is parsed"), Root->GetObjectField(TEXT("asset"))->GetStringField(TEXT("version")), FString(TEXT("2.0")));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeJsonStreamingDepthTest, "glTFRuntime.Json.StreamingDepth", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeJsonStreamingDepthTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeJsonTests;
+
+	// 63 nested arrays (plus the root object) are accepted in plain fields
+	FString Nested = TEXT("{\"extras\":") + FString::ChrN(63, '[') + FString::ChrN(63, ']') + TEXT("}");
+	TestTrue(TEXT("64 levels are streamed"), ParseWithStreaming(Nested).IsValid());
+
+	// section items are scanned with the same limit: root object, section array and item object take 3 levels
+	FString NestedItem = TEXT("{\"accessors\":[{\"extras\":") + FString::ChrN(61, '[') + FString::ChrN(61, ']') + TEXT("}]}");
+	TSharedPtr<FJsonObject> Root = ParseWithStreaming(NestedItem);
+	if (TestTrue(TEXT("64 levels in a section item are streamed"), Root.IsValid()))
+	{
+		TestTrue(TEXT("nested section item is expanded"), Root->GetArrayField(TEXT("accessors"))[0]->AsObject()->HasField(TEXT("extras")));
+	}
+
+	FString TooDeepItem = TEXT("{\"accessors\":[{\"extras\":") + FString::ChrN(62, '[') + FString::ChrN(62, ']') + TEXT("}]}");
+	AddExpectedError(TEXT("Unable to parse json"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestFalse(TEXT("65 levels in a section item are rejected"), ParseWithStreaming(TooDeepItem).IsValid());
+
+	// deeper documents are rejected instead of exhausting the stack
+	FString TooDeep = TEXT("{\"nodes\":[") + FString::ChrN(100000, '[') + FString::ChrN(100000, ']') + TEXT("]}");
+	AddExpectedError(TEXT("Unable to parse json"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestFalse(TEXT("100002 levels are rejected"), ParseWithStreaming(TooDeep).IsValid());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeJsonParseBenchmark, "glTFRuntime.Json.ParseBenchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FglTFRuntimeJsonParseBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeJsonTests;
+
+	const FString Json = MakeSceneJson(100000);
+	const TArray<uint8> JsonData = ToUTF8(Json);
+	constexpr int32 Runs = 3;
+
+	const double SerializerSeconds = MeasureBestSeconds(Runs, [&Json]()
+		{
+			ParseWithSerializer(Json);
+		});
+	AddBenchmarkInfo(*this, TEXT("FJsonSerializer"), SerializerSeconds, JsonData.Num());
+
+	const double UTF8Seconds = MeasureBestSeconds(Runs, [&JsonData]()
+		{
+			FglTFRuntimeJsonTables JsonTables;
+			FglTFRuntimeParser::ParseJsonUTF8(JsonData.GetData(), JsonData.Num(), false, JsonTables);
+		});
+	AddBenchmarkInfo(*this, TEXT("UTF-8 DOM"), UTF8Seconds, JsonData.Num());
+
+	const double StreamingSeconds = MeasureBestSeconds(Runs, [&JsonData]()
+		{
+			FglTFRuntimeJsonTables JsonTables;
+			FglTFRuntimeParser::ParseJsonUTF8(JsonData.GetData(), JsonData.Num(), true, JsonTables);
+		});
+	AddBenchmarkInfo(*this, TEXT("UTF-8 streaming"), StreamingSeconds, JsonData.Num());
+
+	// memory held by each resulting root (the lazy items reference a single copy of the bytes)
+	auto MeasureRetained = [this](const TCHAR* Name, TFunction<TSharedPtr<FJsonObject>()> Parse)
+		{
+			const int64 MemoryBefore = GetUsedPhysicalMemory();
+			TSharedPtr<FJsonObject> Root = Parse();
+			const int64 MemoryAfter = GetUsedPhysicalMemory();
+			TestTrue(FString::Printf(TEXT("%s parses the scene"), Name), Root.IsValid());
+			AddInfo(FString::Printf(TEXT("%s retained: %.2f MB"), Name, FMath::Max<int64>(MemoryAfter - MemoryBefore, 0) / (1024.0 * 1024.0)));
+		};
+
+	MeasureRetained(TEXT("FJsonSerializer"), [&Json]() { return ParseWithSerializer(Json); });
+	MeasureRetained(TEXT("UTF-8 DOM"), [&JsonData]()
+		{
+			FglTFRuntimeJsonTables JsonTables;
+			return FglTFRuntimeParser::ParseJsonUTF8(JsonData.GetData(), JsonData.Num(), false, JsonTables);
+		});
+	MeasureRetained(TEXT("UTF-8 streaming"), [&JsonData]()
+		{
+			FglTFRuntimeJsonTables JsonTables;
+			return FglTFRuntimeParser::ParseJsonUTF8(JsonData.GetData(), JsonData.Num(), true, JsonTables);
+		});
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeJsonGlbBenchmark, "glTFRuntime.Json.GlbBenchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FglTFRuntimeJsonGlbBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeJsonTests;
+
+	// the json chunk only, the buffer is never read while parsing
+	const TArray<uint8> Glb = MakeGlb(MakeSceneJson(100000), TArray<uint8>());
+	constexpr int32 Runs = 3;
+
+	struct FJsonParserMode
+	{
+		const TCHAR* Name;
+		bool bUseUTF8JsonParser;
+		bool bUseStreamingJsonParser;
+	};
+
+	// the whole parser setup: the default path widens the json chunk to a FString for FJsonSerializer
+	for (const FJsonParserMode& Mode : { FJsonParserMode{ TEXT("FJsonSerializer"), false, false }, FJsonParserMode{ TEXT("UTF-8 DOM"), true, false }, FJsonParserMode{ TEXT("UTF-8 streaming"), true, true } })
+	{
+		FglTFRuntimeConfig LoaderConfig;
+		LoaderConfig.bUseUTF8JsonParser = Mode.bUseUTF8JsonParser;
+		LoaderConfig.bUseStreamingJsonParser = Mode.bUseStreamingJsonParser;
+
+		const double Seconds = MeasureBestSeconds(Runs, [&]()
+			{
+				FglTFRuntimeParser::FromData(Glb.GetData(), Glb.Num(), LoaderConfig);
+			});
+
+		bool bParsed = false;
+		const int64 PeakMemory = MeasurePeakMemory([&]()
+			{
+				TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromData(Glb.GetData(), Glb.Num(), LoaderConfig);
+				bParsed = Parser.IsValid();
+			});
+
+		if (TestTrue(FString::Printf(TEXT("%s parses the glb"), Mode.Name), bParsed))
+		{
+			AddBenchmarkInfo(*this, FString::Printf(TEXT("%s FromData()"), Mode.Name), Seconds, Glb.Num());
+			AddInfo(FString::Printf(TEXT("%s peak resident memory growth: %.2f MB (json %.2f MB)"), Mode.Name, PeakMemory / (1024.0 * 1024.0), Glb.Num() / (1024.0 * 1024.0)));
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeJsonSectionsBenchmark, "glTFRuntime.Json.SectionsBenchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FglTFRuntimeJsonSectionsBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeJsonTests;
+
+	constexpr int32 NumAccessors = 100000;
+	TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromString(MakeSceneJson(NumAccessors), FglTFRuntimeConfig());
+	if (!TestTrue(TEXT("scene is parsed"), Parser.IsValid()))
+	{
+		return false;
+	}
+	TestEqual(TEXT("accessors section"), Parser->GetJsonSectionNum(EglTFRuntimeJsonSection::Accessors), NumAccessors);
+
+	constexpr int32 Runs = 3;
+
+	// every accessor, as loading all the meshes of the asset would do
+	int32 NumFound = 0;
+	const double EntrySeconds = MeasureBestSeconds(Runs, [&]()
+		{
+			NumFound = 0;
+			for (int32 AccessorIndex = 0; AccessorIndex < NumAccessors; AccessorIndex++)
+			{
+				FglTFRuntimeAccessorEntry AccessorEntry;
+				NumFound += Parser->GetAccessorEntry(AccessorIndex, AccessorEntry) && AccessorEntry.Count == 3 + AccessorIndex % 64 ? 1 : 0;
+			}
+		});
+	TestEqual(TEXT("GetAccessorEntry() finds every accessor"), NumFound, NumAccessors);
+
+	const double SectionSeconds = MeasureBestSeconds(Runs, [&]()
+		{
+			NumFound = 0;
+			for (int32 AccessorIndex = 0; AccessorIndex < NumAccessors; AccessorIndex++)
+			{
+				NumFound += Parser->GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Accessors, AccessorIndex) ? 1 : 0;
+			}
+		});
+	TestEqual(TEXT("section lookup finds every accessor"), NumFound, NumAccessors);
+
+	const double FieldSeconds = MeasureBestSeconds(Runs, [&]()
+		{
+			NumFound = 0;
+			for (int32 AccessorIndex = 0; AccessorIndex < NumAccessors; AccessorIndex++)
+			{
+				NumFound += Parser->GetJsonObjectFromRootIndex(TEXT("accessors"), AccessorIndex) ? 1 : 0;
+			}
+		});
+	TestEqual(TEXT("root field lookup finds every accessor"), NumFound, NumAccessors);
+
+	// copying the whole root array for every lookup (as GetJsonObjectFromIndex() used to do) is quadratic, so only a sample is measured
+	constexpr int32 NumCopyingLookups = 1000;
+	const double CopyingSeconds = MeasureBestSeconds(Runs, [&]()
+		{
+			NumFound = 0;
+			for (int32 AccessorIndex = 0; AccessorIndex < NumCopyingLookups; AccessorIndex++)
+			{
+				TArray<TSharedRef<FJsonValue>> JsonItems;
+				NumFound += Parser->CheckJsonRootIndex(TEXT("accessors"), AccessorIndex, JsonItems) && JsonItems[AccessorIndex]->AsObject() ? 1 : 0;
+			}
+		});
+	TestEqual(TEXT("copying lookup finds the sampled accessors"), NumFound, NumCopyingLookups);
+
+	AddBenchmarkInfo(*this, FString::Printf(TEXT("GetAccessorEntry() x %d"), NumAccessors), EntrySeconds);
+	AddBenchmarkInfo(*this, FString::Printf(TEXT("Section lookup x %d"), NumAccessors), SectionSeconds);
+	AddBenchmarkInfo(*this, FString::Printf(TEXT("Root field lookup x %d"), NumAccessors), FieldSeconds);
+	AddBenchmarkInfo(*this, FString::Printf(TEXT("Copying lookup x %d (extrapolated to %d)"), NumCopyingLookups, NumAccessors), CopyingSeconds * NumAccessors / NumCopyingLookups);
+
+	return true;
+}
+
+#endif
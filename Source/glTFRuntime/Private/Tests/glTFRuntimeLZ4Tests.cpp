@@ -0,0 +1,296 @@
+// Copyright 2020-2023, Roberto De Ioris.
+
+#include "glTFRuntimeParser.h"
+#include "Misc/AutomationTest.h"
+#include "glTFRuntimeTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace glTFRuntimeLZ4Tests
+{
+	using namespace glTFRuntimeTests;
+
+	// 251 bytes noise repeated, with a marker every 16k, the reference frames below have been generated with the lz4 1.9.4 cli
+	TArray64<uint8> MakePeriodic(const int32 Num)
+	{
+		constexpr int32 PeriodNum = 251;
+		const TArray64<uint8> Period = MakeNoise(PeriodNum, 11);
+
+		TArray64<uint8> Data;
+		Data.AddUninitialized(Num);
+		for (int32 Index = 0; Index < Num; Index++)
+		{
+			Data[Index] = (Index % 16384) == 0 ? static_cast<uint8>(Index / 16384) : Period[Index % PeriodNum];
+		}
+		return Data;
+	}
+
+	// lz4 -9 -B4 -BD: 64k linked blocks, matches cross the blocks boundaries
+	const uint8 LinkedFrame[] = {
+		0x04, 0x22, 0x4d, 0x18, 0x44, 0x40, 0x5e, 0x1e, 0x02, 0x00, 0x00, 0xff, 0xed, 0x00, 0xd8, 0x6b, 0xac, 0x98, 0x96, 0xf7, 0xa6, 0x19, 0x12, 0x2d,
+		0xdf, 0x40, 0x0b, 0xf5, 0x15, 0xae, 0x80, 0xe1, 0xa7, 0x15, 0xee, 0xb1, 0x3b, 0xa7, 0x46, 0xa2, 0x12, 0x40, 0xb0, 0x7b, 0x26, 0x52, 0x02, 0x55,
+		0x09, 0x94, 0xff, 0x2d, 0x7c, 0x6a, 0x50, 0x2b, 0xd2, 0x13, 0x42, 0xaf, 0x03, 0x94, 0x45, 0x21, 0x8f, 0x68, 0x20, 0x75, 0x18, 0xe4, 0xf5, 0x81,
+		0xbe, 0x6c, 0xf9, 0xfe, 0x3a, 0x58, 0xef, 0x60, 0xb9, 0xa4, 0x69, 0x56, 0x7e, 0x59, 0xbe, 0x1f, 0x36, 0xbf, 0xca, 0x93, 0x1a, 0x40, 0x68, 0xec,
+		0xc7, 0x1a, 0xb0, 0x59, 0xdd, 0xcc, 0xf1, 0x41, 0x59, 0x3e, 0x6d, 0x57, 0xb3, 0xae, 0xd7, 0x62, 0xb7, 0x5f, 0x8d, 0xca, 0x24, 0x00, 0x96, 0xe1,
+		0x06, 0xdd, 0x5a, 0xf7, 0xd3, 0xc7, 0x23, 0x1c, 0x48, 0xc4, 0x57, 0xb3, 0x01, 0x77, 0x72, 0xbb, 0xdb, 0x4e, 0xc6, 0xdd, 0x0a, 0x6d, 0xf2, 0x35,
+		0xf9, 0x5e, 0x24, 0xe1, 0xe4, 0x75, 0x0e, 0x4a, 0x37, 0x04, 0xa9, 0x35, 0xa6, 0x44, 0xac, 0x88, 0x09, 0xfe, 0xcb, 0xdd, 0xfd, 0xfc, 0xb0, 0xc8,
+		0x3b, 0x33, 0xba, 0xe8, 0xb6, 0xad, 0x78, 0xb0, 0x77, 0x38, 0xe4, 0xf3, 0x39, 0xd1, 0x5f, 0x31, 0xc3, 0xce, 0x70, 0xa3, 0x09, 0xcd, 0x3c, 0x08,
+		0x02, 0x5f, 0xc5, 0x2e, 0x48, 0x75, 0xe3, 0x3f, 0x71, 0x86, 0x02, 0xd1, 0x2f, 0x86, 0xa1, 0xab, 0x2a, 0x87, 0x86, 0x58, 0x98, 0x2b, 0xc1, 0x6e,
+		0xa2, 0xd1, 0x68, 0x9b, 0x77, 0x7b, 0x0c, 0x74, 0x2c, 0x81, 0xfd, 0xfe, 0x5a, 0xf7, 0x42, 0xf8, 0x76, 0xdf, 0x57, 0xee, 0xee, 0x0f, 0xa4, 0xff,
+		0x09, 0xe1, 0xc2, 0x69, 0x7b, 0x9c, 0x6d, 0xd9, 0xcb, 0xa5, 0x47, 0x75, 0x65, 0x65, 0x52, 0xa5, 0x7e, 0xf9, 0x2b, 0xa5, 0xac, 0x9d, 0x07, 0xcc,
+		0x85, 0xfb, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x1f, 0x01, 0xbb, 0x3f, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x0f, 0xfb, 0x00, 0x32, 0x1f, 0x02, 0xbb, 0x3f, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x0f, 0xfb, 0x00, 0x32, 0x1f, 0x03, 0xbb, 0x3f, 0x19,
+		0x0f, 0x2c, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x50, 0x15, 0xee, 0xb1, 0x3b,
+		0xa7, 0x29, 0x01, 0x00, 0x00, 0x1f, 0x04, 0xbb, 0x3f, 0x19, 0x0f, 0x2c, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0x05, 0xbb, 0x3f, 0x19, 0x0f, 0x2c, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0x06, 0xbb, 0x3f, 0x19, 0x0f, 0x2c, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0x07, 0xbb, 0x3f, 0x19, 0x0f, 0x2c, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x50, 0x42, 0xaf, 0x03, 0x94, 0x45, 0x2d, 0x00, 0x00, 0x00, 0x1f, 0x08, 0x4c, 0x23, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x50, 0x86, 0x02, 0xd1, 0x2f, 0x86, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xcd, 0x08, 0xaa
+	};
+
+	// lz4 -9 -B4 -BD --content-size -BX: linked blocks with content size and block checksums
+	const uint8 LinkedChecksumsFrame[] = {
+		0x04, 0x22, 0x4d, 0x18, 0x54, 0x40, 0xae, 0x1e, 0x02, 0x00, 0x00, 0xff, 0xed, 0x00, 0xd8, 0x6b, 0xac, 0x98, 0x96, 0xf7, 0xa6, 0x19, 0x12, 0x2d,
+		0xdf, 0x40, 0x0b, 0xf5, 0x15, 0xae, 0x80, 0xe1, 0xa7, 0x15, 0xee, 0xb1, 0x3b, 0xa7, 0x46, 0xa2, 0x12, 0x40, 0xb0, 0x7b, 0x26, 0x52, 0x02, 0x55,
+		0x09, 0x94, 0xff, 0x2d, 0x7c, 0x6a, 0x50, 0x2b, 0xd2, 0x13, 0x42, 0xaf, 0x03, 0x94, 0x45, 0x21, 0x8f, 0x68, 0x20, 0x75, 0x18, 0xe4, 0xf5, 0x81,
+		0xbe, 0x6c, 0xf9, 0xfe, 0x3a, 0x58, 0xef, 0x60, 0xb9, 0xa4, 0x69, 0x56, 0x7e, 0x59, 0xbe, 0x1f, 0x36, 0xbf, 0xca, 0x93, 0x1a, 0x40, 0x68, 0xec,
+		0xc7, 0x1a, 0xb0, 0x59, 0xdd, 0xcc, 0xf1, 0x41, 0x59, 0x3e, 0x6d, 0x57, 0xb3, 0xae, 0xd7, 0x62, 0xb7, 0x5f, 0x8d, 0xca, 0x24, 0x00, 0x96, 0xe1,
+		0x06, 0xdd, 0x5a, 0xf7, 0xd3, 0xc7, 0x23, 0x1c, 0x48, 0xc4, 0x57, 0xb3, 0x01, 0x77, 0x72, 0xbb, 0xdb, 0x4e, 0xc6, 0xdd, 0x0a, 0x6d, 0xf2, 0x35,
+		0xf9, 0x5e, 0x24, 0xe1, 0xe4, 0x75, 0x0e, 0x4a, 0x37, 0x04, 0xa9, 0x35, 0xa6, 0x44, 0xac, 0x88, 0x09, 0xfe, 0xcb, 0xdd, 0xfd, 0xfc, 0xb0, 0xc8,
+		0x3b, 0x33, 0xba, 0xe8, 0xb6, 0xad, 0x78, 0xb0, 0x77, 0x38, 0xe4, 0xf3, 0x39, 0xd1, 0x5f, 0x31, 0xc3, 0xce, 0x70, 0xa3, 0x09, 0xcd, 0x3c, 0x08,
+		0x02, 0x5f, 0xc5, 0x2e, 0x48, 0x75, 0xe3, 0x3f, 0x71, 0x86, 0x02, 0xd1, 0x2f, 0x86, 0xa1, 0xab, 0x2a, 0x87, 0x86, 0x58, 0x98, 0x2b, 0xc1, 0x6e,
+		0xa2, 0xd1, 0x68, 0x9b, 0x77, 0x7b, 0x0c, 0x74, 0x2c, 0x81, 0xfd, 0xfe, 0x5a, 0xf7, 0x42, 0xf8, 0x76, 0xdf, 0x57, 0xee, 0xee, 0x0f, 0xa4, 0xff,
+		0x09, 0xe1, 0xc2, 0x69, 0x7b, 0x9c, 0x6d, 0xd9, 0xcb, 0xa5, 0x47, 0x75, 0x65, 0x65, 0x52, 0xa5, 0x7e, 0xf9, 0x2b, 0xa5, 0xac, 0x9d, 0x07, 0xcc,
+		0x85, 0xfb, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x1f, 0x01, 0xbb, 0x3f, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x0f, 0xfb, 0x00, 0x32, 0x1f, 0x02, 0xbb, 0x3f, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x0f, 0xfb, 0x00, 0x32, 0x1f, 0x03, 0xbb, 0x3f, 0x19,
+		0x0f, 0x2c, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x50, 0x15, 0xee, 0xb1, 0x3b,
+		0xa7, 0x4e, 0x31, 0xd7, 0x34, 0x29, 0x01, 0x00, 0x00, 0x1f, 0x04, 0xbb, 0x3f, 0x19, 0x0f, 0x2c, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0x05, 0xbb, 0x3f, 0x19, 0x0f, 0x2c, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0x06, 0xbb, 0x3f, 0x19, 0x0f, 0x2c, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0x07, 0xbb, 0x3f, 0x19, 0x0f, 0x2c, 0xc0, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x50, 0x42, 0xaf, 0x03, 0x94, 0x45, 0x80, 0x56, 0xd7, 0xfe, 0x2d, 0x00,
+		0x00, 0x00, 0x1f, 0x08, 0x4c, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x50, 0x86, 0x02, 0xd1, 0x2f, 0x86, 0x7d,
+		0x5e, 0xc4, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xcd, 0x08, 0xaa
+	};
+
+	// lz4 -9 -B4 -BI: independent blocks (decoded in parallel)
+	const uint8 IndependentFrame[] = {
+		0x04, 0x22, 0x4d, 0x18, 0x64, 0x40, 0xa7, 0x1e, 0x02, 0x00, 0x00, 0xff, 0xed, 0x00, 0xd8, 0x6b, 0xac, 0x98, 0x96, 0xf7, 0xa6, 0x19, 0x12, 0x2d,
+		0xdf, 0x40, 0x0b, 0xf5, 0x15, 0xae, 0x80, 0xe1, 0xa7, 0x15, 0xee, 0xb1, 0x3b, 0xa7, 0x46, 0xa2, 0x12, 0x40, 0xb0, 0x7b, 0x26, 0x52, 0x02, 0x55,
+		0x09, 0x94, 0xff, 0x2d, 0x7c, 0x6a, 0x50, 0x2b, 0xd2, 0x13, 0x42, 0xaf, 0x03, 0x94, 0x45, 0x21, 0x8f, 0x68, 0x20, 0x75, 0x18, 0xe4, 0xf5, 0x81,
+		0xbe, 0x6c, 0xf9, 0xfe, 0x3a, 0x58, 0xef, 0x60, 0xb9, 0xa4, 0x69, 0x56, 0x7e, 0x59, 0xbe, 0x1f, 0x36, 0xbf, 0xca, 0x93, 0x1a, 0x40, 0x68, 0xec,
+		0xc7, 0x1a, 0xb0, 0x59, 0xdd, 0xcc, 0xf1, 0x41, 0x59, 0x3e, 0x6d, 0x57, 0xb3, 0xae, 0xd7, 0x62, 0xb7, 0x5f, 0x8d, 0xca, 0x24, 0x00, 0x96, 0xe1,
+		0x06, 0xdd, 0x5a, 0xf7, 0xd3, 0xc7, 0x23, 0x1c, 0x48, 0xc4, 0x57, 0xb3, 0x01, 0x77, 0x72, 0xbb, 0xdb, 0x4e, 0xc6, 0xdd, 0x0a, 0x6d, 0xf2, 0x35,
+		0xf9, 0x5e, 0x24, 0xe1, 0xe4, 0x75, 0x0e, 0x4a, 0x37, 0x04, 0xa9, 0x35, 0xa6, 0x44, 0xac, 0x88, 0x09, 0xfe, 0xcb, 0xdd, 0xfd, 0xfc, 0xb0, 0xc8,
+		0x3b, 0x33, 0xba, 0xe8, 0xb6, 0xad, 0x78, 0xb0, 0x77, 0x38, 0xe4, 0xf3, 0x39, 0xd1, 0x5f, 0x31, 0xc3, 0xce, 0x70, 0xa3, 0x09, 0xcd, 0x3c, 0x08,
+		0x02, 0x5f, 0xc5, 0x2e, 0x48, 0x75, 0xe3, 0x3f, 0x71, 0x86, 0x02, 0xd1, 0x2f, 0x86, 0xa1, 0xab, 0x2a, 0x87, 0x86, 0x58, 0x98, 0x2b, 0xc1, 0x6e,
+		0xa2, 0xd1, 0x68, 0x9b, 0x77, 0x7b, 0x0c, 0x74, 0x2c, 0x81, 0xfd, 0xfe, 0x5a, 0xf7, 0x42, 0xf8, 0x76, 0xdf, 0x57, 0xee, 0xee, 0x0f, 0xa4, 0xff,
+		0x09, 0xe1, 0xc2, 0x69, 0x7b, 0x9c, 0x6d, 0xd9, 0xcb, 0xa5, 0x47, 0x75, 0x65, 0x65, 0x52, 0xa5, 0x7e, 0xf9, 0x2b, 0xa5, 0xac, 0x9d, 0x07, 0xcc,
+		0x85, 0xfb, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x1f, 0x01, 0xbb, 0x3f, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x0f, 0xfb, 0x00, 0x32, 0x1f, 0x02, 0xbb, 0x3f, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x0f, 0xfb, 0x00, 0x32, 0x1f, 0x03, 0xbb, 0x3f, 0x19,
+		0x0f, 0x2c, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x50, 0x15, 0xee, 0xb1, 0x3b,
+		0xa7, 0x1e, 0x02, 0x00, 0x00, 0xff, 0xed, 0x04, 0xa2, 0x12, 0x40, 0xb0, 0x7b, 0x26, 0x52, 0x02, 0x55, 0x09, 0x94, 0xff, 0x2d, 0x7c, 0x6a, 0x50,
+		0x2b, 0xd2, 0x13, 0x42, 0xaf, 0x03, 0x94, 0x45, 0x21, 0x8f, 0x68, 0x20, 0x75, 0x18, 0xe4, 0xf5, 0x81, 0xbe, 0x6c, 0xf9, 0xfe, 0x3a, 0x58, 0xef,
+		0x60, 0xb9, 0xa4, 0x69, 0x56, 0x7e, 0x59, 0xbe, 0x1f, 0x36, 0xbf, 0xca, 0x93, 0x1a, 0x40, 0x68, 0xec, 0xc7, 0x1a, 0xb0, 0x59, 0xdd, 0xcc, 0xf1,
+		0x41, 0x59, 0x3e, 0x6d, 0x57, 0xb3, 0xae, 0xd7, 0x62, 0xb7, 0x5f, 0x8d, 0xca, 0x24, 0x00, 0x96, 0xe1, 0x06, 0xdd, 0x5a, 0xf7, 0xd3, 0xc7, 0x23,
+		0x1c, 0x48, 0xc4, 0x57, 0xb3, 0x01, 0x77, 0x72, 0xbb, 0xdb, 0x4e, 0xc6, 0xdd, 0x0a, 0x6d, 0xf2, 0x35, 0xf9, 0x5e, 0x24, 0xe1, 0xe4, 0x75, 0x0e,
+		0x4a, 0x37, 0x04, 0xa9, 0x35, 0xa6, 0x44, 0xac, 0x88, 0x09, 0xfe, 0xcb, 0xdd, 0xfd, 0xfc, 0xb0, 0xc8, 0x3b, 0x33, 0xba, 0xe8, 0xb6, 0xad, 0x78,
+		0xb0, 0x77, 0x38, 0xe4, 0xf3, 0x39, 0xd1, 0x5f, 0x31, 0xc3, 0xce, 0x70, 0xa3, 0x09, 0xcd, 0x3c, 0x08, 0x02, 0x5f, 0xc5, 0x2e, 0x48, 0x75, 0xe3,
+		0x3f, 0x71, 0x86, 0x02, 0xd1, 0x2f, 0x86, 0xa1, 0xab, 0x2a, 0x87, 0x86, 0x58, 0x98, 0x2b, 0xc1, 0x6e, 0xa2, 0xd1, 0x68, 0x9b, 0x77, 0x7b, 0x0c,
+		0x74, 0x2c, 0x81, 0xfd, 0xfe, 0x5a, 0xf7, 0x42, 0xf8, 0x76, 0xdf, 0x57, 0xee, 0xee, 0x0f, 0xa4, 0xff, 0x09, 0xe1, 0xc2, 0x69, 0x7b, 0x9c, 0x6d,
+		0xd9, 0xcb, 0xa5, 0x47, 0x75, 0x65, 0x65, 0x52, 0xa5, 0x7e, 0xf9, 0x2b, 0xa5, 0xac, 0x9d, 0x07, 0xcc, 0x85, 0xd8, 0x6b, 0xac, 0x98, 0x96, 0xf7,
+		0xa6, 0x19, 0x12, 0x2d, 0xdf, 0x40, 0x0b, 0xf5, 0x15, 0xae, 0x80, 0xe1, 0xa7, 0x15, 0xee, 0xb1, 0x3b, 0xa7, 0x46, 0xfb, 0x00, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x1f, 0x05, 0xbb, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x0f, 0xfb, 0x00, 0x32, 0x1f, 0x06, 0xbb, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x0f, 0xfb, 0x00, 0x32, 0x1f, 0x07, 0xbb, 0x3f, 0x19, 0x0f, 0x2c, 0xc0, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x50, 0x42, 0xaf, 0x03, 0x94, 0x45, 0x28, 0x01, 0x00, 0x00, 0xff,
+		0xed, 0x08, 0x8f, 0x68, 0x20, 0x75, 0x18, 0xe4, 0xf5, 0x81, 0xbe, 0x6c, 0xf9, 0xfe, 0x3a, 0x58, 0xef, 0x60, 0xb9, 0xa4, 0x69, 0x56, 0x7e, 0x59,
+		0xbe, 0x1f, 0x36, 0xbf, 0xca, 0x93, 0x1a, 0x40, 0x68, 0xec, 0xc7, 0x1a, 0xb0, 0x59, 0xdd, 0xcc, 0xf1, 0x41, 0x59, 0x3e, 0x6d, 0x57, 0xb3, 0xae,
+		0xd7, 0x62, 0xb7, 0x5f, 0x8d, 0xca, 0x24, 0x00, 0x96, 0xe1, 0x06, 0xdd, 0x5a, 0xf7, 0xd3, 0xc7, 0x23, 0x1c, 0x48, 0xc4, 0x57, 0xb3, 0x01, 0x77,
+		0x72, 0xbb, 0xdb, 0x4e, 0xc6, 0xdd, 0x0a, 0x6d, 0xf2, 0x35, 0xf9, 0x5e, 0x24, 0xe1, 0xe4, 0x75, 0x0e, 0x4a, 0x37, 0x04, 0xa9, 0x35, 0xa6, 0x44,
+		0xac, 0x88, 0x09, 0xfe, 0xcb, 0xdd, 0xfd, 0xfc, 0xb0, 0xc8, 0x3b, 0x33, 0xba, 0xe8, 0xb6, 0xad, 0x78, 0xb0, 0x77, 0x38, 0xe4, 0xf3, 0x39, 0xd1,
+		0x5f, 0x31, 0xc3, 0xce, 0x70, 0xa3, 0x09, 0xcd, 0x3c, 0x08, 0x02, 0x5f, 0xc5, 0x2e, 0x48, 0x75, 0xe3, 0x3f, 0x71, 0x86, 0x02, 0xd1, 0x2f, 0x86,
+		0xa1, 0xab, 0x2a, 0x87, 0x86, 0x58, 0x98, 0x2b, 0xc1, 0x6e, 0xa2, 0xd1, 0x68, 0x9b, 0x77, 0x7b, 0x0c, 0x74, 0x2c, 0x81, 0xfd, 0xfe, 0x5a, 0xf7,
+		0x42, 0xf8, 0x76, 0xdf, 0x57, 0xee, 0xee, 0x0f, 0xa4, 0xff, 0x09, 0xe1, 0xc2, 0x69, 0x7b, 0x9c, 0x6d, 0xd9, 0xcb, 0xa5, 0x47, 0x75, 0x65, 0x65,
+		0x52, 0xa5, 0x7e, 0xf9, 0x2b, 0xa5, 0xac, 0x9d, 0x07, 0xcc, 0x85, 0xd8, 0x6b, 0xac, 0x98, 0x96, 0xf7, 0xa6, 0x19, 0x12, 0x2d, 0xdf, 0x40, 0x0b,
+		0xf5, 0x15, 0xae, 0x80, 0xe1, 0xa7, 0x15, 0xee, 0xb1, 0x3b, 0xa7, 0x46, 0xa2, 0x12, 0x40, 0xb0, 0x7b, 0x26, 0x52, 0x02, 0x55, 0x09, 0x94, 0xff,
+		0x2d, 0x7c, 0x6a, 0x50, 0x2b, 0xd2, 0x13, 0x42, 0xaf, 0x03, 0x94, 0x45, 0x21, 0xfb, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xed, 0x50, 0x86, 0x02, 0xd1, 0x2f, 0x86, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xcd, 0x08, 0xaa
+	};
+
+	// lz4 -9 -B4 -BD of a glb whose binary chunk is MakePeriodic(140000)
+	const uint8 LinkedGlbFrame[] = {
+		0x04, 0x22, 0x4d, 0x18, 0x44, 0x40, 0x5e, 0x77, 0x02, 0x00, 0x00, 0xff, 0xff, 0x4a, 0x67, 0x6c, 0x54, 0x46, 0x02, 0x00, 0x00, 0x00, 0x3c, 0x23,
+		0x02, 0x00, 0x40, 0x00, 0x00, 0x00, 0x4a, 0x53, 0x4f, 0x4e, 0x7b, 0x22, 0x61, 0x73, 0x73, 0x65, 0x74, 0x22, 0x3a, 0x7b, 0x22, 0x76, 0x65, 0x72,
+		0x73, 0x69, 0x6f, 0x6e, 0x22, 0x3a, 0x22, 0x32, 0x2e, 0x30, 0x22, 0x7d, 0x2c, 0x22, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x73, 0x22, 0x3a, 0x5b,
+		0x7b, 0x22, 0x62, 0x79, 0x74, 0x65, 0x4c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x22, 0x3a, 0x31, 0x34, 0x30, 0x30, 0x30, 0x30, 0x7d, 0x5d, 0x7d, 0x20,
+		0x20, 0x20, 0xe0, 0x22, 0x02, 0x00, 0x42, 0x49, 0x4e, 0x00, 0x00, 0xd8, 0x6b, 0xac, 0x98, 0x96, 0xf7, 0xa6, 0x19, 0x12, 0x2d, 0xdf, 0x40, 0x0b,
+		0xf5, 0x15, 0xae, 0x80, 0xe1, 0xa7, 0x15, 0xee, 0xb1, 0x3b, 0xa7, 0x46, 0xa2, 0x12, 0x40, 0xb0, 0x7b, 0x26, 0x52, 0x02, 0x55, 0x09, 0x94, 0xff,
+		0x2d, 0x7c, 0x6a, 0x50, 0x2b, 0xd2, 0x13, 0x42, 0xaf, 0x03, 0x94, 0x45, 0x21, 0x8f, 0x68, 0x20, 0x75, 0x18, 0xe4, 0xf5, 0x81, 0xbe, 0x6c, 0xf9,
+		0xfe, 0x3a, 0x58, 0xef, 0x60, 0xb9, 0xa4, 0x69, 0x56, 0x7e, 0x59, 0xbe, 0x1f, 0x36, 0xbf, 0xca, 0x93, 0x1a, 0x40, 0x68, 0xec, 0xc7, 0x1a, 0xb0,
+		0x59, 0xdd, 0xcc, 0xf1, 0x41, 0x59, 0x3e, 0x6d, 0x57, 0xb3, 0xae, 0xd7, 0x62, 0xb7, 0x5f, 0x8d, 0xca, 0x24, 0x00, 0x96, 0xe1, 0x06, 0xdd, 0x5a,
+		0xf7, 0xd3, 0xc7, 0x23, 0x1c, 0x48, 0xc4, 0x57, 0xb3, 0x01, 0x77, 0x72, 0xbb, 0xdb, 0x4e, 0xc6, 0xdd, 0x0a, 0x6d, 0xf2, 0x35, 0xf9, 0x5e, 0x24,
+		0xe1, 0xe4, 0x75, 0x0e, 0x4a, 0x37, 0x04, 0xa9, 0x35, 0xa6, 0x44, 0xac, 0x88, 0x09, 0xfe, 0xcb, 0xdd, 0xfd, 0xfc, 0xb0, 0xc8, 0x3b, 0x33, 0xba,
+		0xe8, 0xb6, 0xad, 0x78, 0xb0, 0x77, 0x38, 0xe4, 0xf3, 0x39, 0xd1, 0x5f, 0x31, 0xc3, 0xce, 0x70, 0xa3, 0x09, 0xcd, 0x3c, 0x08, 0x02, 0x5f, 0xc5,
+		0x2e, 0x48, 0x75, 0xe3, 0x3f, 0x71, 0x86, 0x02, 0xd1, 0x2f, 0x86, 0xa1, 0xab, 0x2a, 0x87, 0x86, 0x58, 0x98, 0x2b, 0xc1, 0x6e, 0xa2, 0xd1, 0x68,
+		0x9b, 0x77, 0x7b, 0x0c, 0x74, 0x2c, 0x81, 0xfd, 0xfe, 0x5a, 0xf7, 0x42, 0xf8, 0x76, 0xdf, 0x57, 0xee, 0xee, 0x0f, 0xa4, 0xff, 0x09, 0xe1, 0xc2,
+		0x69, 0x7b, 0x9c, 0x6d, 0xd9, 0xcb, 0xa5, 0x47, 0x75, 0x65, 0x65, 0x52, 0xa5, 0x7e, 0xf9, 0x2b, 0xa5, 0xac, 0x9d, 0x07, 0xcc, 0x85, 0xfb, 0x00,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x1f, 0x01, 0xbb, 0x3f, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x0f, 0xfb, 0x00, 0x32, 0x1f, 0x02, 0xbb, 0x3f, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x0f, 0xfb, 0x00, 0x32, 0x1f, 0x03, 0xbb, 0x3f, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0x50, 0x02, 0x5f, 0xc5, 0x2e, 0x48, 0x29, 0x01, 0x00, 0x00, 0x0f, 0xfb,
+		0x00, 0x49, 0x1f, 0x04, 0xbb, 0x3f, 0x19, 0x0f, 0x2c, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0x00, 0x1f, 0x05, 0xbb, 0x3f, 0x19, 0x0f, 0x2c, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0x00, 0x1f, 0x06, 0xbb, 0x3f, 0x19, 0x0f, 0x2c, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0x07, 0xbb, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xca, 0x50, 0xd1, 0x68, 0x9b, 0x77, 0x7b, 0x31, 0x00, 0x00, 0x00, 0x0f, 0xfb, 0x00, 0x49, 0x1f, 0x08, 0x4c, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x50, 0x86, 0x02, 0xd1, 0x2f, 0x86, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xc2, 0xe4, 0x79
+	};
+
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeLZ4FramesTest, "glTFRuntime.LZ4.Frames", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeLZ4FramesTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeLZ4Tests;
+
+	// the previous (serial) decoder reproduced the original data, so the output must match it byte for byte
+	const TArray64<uint8> Expected = MakePeriodic(140000);
+
+	const TArray<TPair<const TCHAR*, TArrayView<const uint8>>> Frames = {
+		{ TEXT("linked blocks"), LinkedFrame },
+		{ TEXT("linked blocks with checksums"), LinkedChecksumsFrame },
+		{ TEXT("independent blocks"), IndependentFrame }
+	};
+
+	FglTFRuntimeConfig LoaderConfig;
+	LoaderConfig.bAsBlob = true;
+
+	for (const TPair<const TCHAR*, TArrayView<const uint8>>& Frame : Frames)
+	{
+		TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromData(Frame.Value.GetData(), Frame.Value.Num(), LoaderConfig);
+		if (TestTrue(FString::Printf(TEXT("%s are decoded"), Frame.Key), Parser.IsValid()))
+		{
+			TestTrue(FString::Printf(TEXT("%s match"), Frame.Key), Parser->GetBlob() == Expected);
+		}
+	}
+
+	// a block reaching before the start of the output must fail instead of reading out of bounds
+	TArray64<uint8> Corrupted(LinkedFrame, UE_ARRAY_COUNT(LinkedFrame));
+	// first sequence of the first block (after the 7 bytes frame header and the block size): token, literals, then the match offset
+	int64 FirstOffset = 7 + 4;
+	int64 Literals = Corrupted[FirstOffset++] >> 4;
+	if (Literals == 15)
+	{
+		uint8 ExtraLength = 0;
+		do
+		{
+			ExtraLength = Corrupted[FirstOffset++];
+			Literals += ExtraLength;
+		} while (ExtraLength == 255);
+	}
+	FirstOffset += Literals;
+	Corrupted[FirstOffset] = 0xFF;
+	Corrupted[FirstOffset + 1] = 0xFF;
+	AddExpectedError(TEXT("LZ4 decompression error"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestFalse(TEXT("corrupted match offset is rejected"), FglTFRuntimeParser::FromData(Corrupted.GetData(), Corrupted.Num(), LoaderConfig).IsValid());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeLZ4PipelinedGlbTest, "glTFRuntime.LZ4.PipelinedGlb", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeLZ4PipelinedGlbTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeLZ4Tests;
+
+	// the json chunk is parsed while the remaining linked blocks are still being decoded
+	TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromData(LinkedGlbFrame, UE_ARRAY_COUNT(LinkedGlbFrame), FglTFRuntimeConfig());
+	if (!TestTrue(TEXT("glb is loaded"), Parser.IsValid()))
+	{
+		return false;
+	}
+
+	FglTFRuntimeBlob Blob;
+	if (TestTrue(TEXT("binary chunk is available"), Parser->GetBuffer(0, Blob)))
+	{
+		TestTrue(TEXT("binary chunk matches"), TArray64<uint8>(Blob.Data, Blob.Num) == MakePeriodic(140000));
+	}
+
+	return true;
+}
+
+#endif
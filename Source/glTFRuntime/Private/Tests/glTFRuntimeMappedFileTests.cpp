@@ -0,0 +1,79 @@
+// Copyright 2020-2024, Roberto De Ioris.
+
+#include "glTFRuntimeParser.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "glTFRuntimeTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeMappedFileBenchmark, "glTFRuntime.MappedFile.Benchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FglTFRuntimeMappedFileBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeTests;
+
+	// about 4M vertices and 200MB of binary chunk
+	constexpr int32 Side = 2048;
+	const FString Filename = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("glTFRuntimeMappedFile"), FGuid::NewGuid().ToString() + TEXT(".glb"));
+	int64 FileSize = 0;
+	{
+		const TArray<uint8> Glb = MakeGridGlb(Side);
+		FileSize = Glb.Num();
+		if (!TestTrue(TEXT("glb is written"), FFileHelper::SaveArrayToFile(Glb, *Filename)))
+		{
+			return false;
+		}
+	}
+
+	constexpr int32 Runs = 3;
+	TArray<FVector> Positions[2];
+
+	for (const bool bUseMappedFile : { false, true })
+	{
+		const TCHAR* Name = bUseMappedFile ? TEXT("Mapped file") : TEXT("LoadFileToArray");
+		FglTFRuntimeConfig LoaderConfig;
+		LoaderConfig.bUseMappedFile = bUseMappedFile;
+
+		// parsing plus the first mesh, the parser is released before the next run
+		auto LoadFirstMesh = [&LoaderConfig, &Filename](FglTFRuntimeMeshLOD& LOD)
+			{
+				TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromFilename(Filename, LoaderConfig);
+				return Parser && Parser->LoadMeshAsRuntimeLOD(0, LOD, FglTFRuntimeMaterialsConfig());
+			};
+
+		const double Seconds = MeasureBestSeconds(Runs, [&LoadFirstMesh]()
+			{
+				FglTFRuntimeMeshLOD LOD;
+				LoadFirstMesh(LOD);
+			});
+
+		bool bLoaded = false;
+		const int64 PeakMemory = MeasurePeakMemory([&]()
+			{
+				FglTFRuntimeMeshLOD LOD;
+				bLoaded = LoadFirstMesh(LOD);
+				if (bLoaded && LOD.Primitives.Num() > 0)
+				{
+					Positions[bUseMappedFile ? 1 : 0] = MoveTemp(LOD.Primitives[0].Positions);
+				}
+			});
+
+		if (TestTrue(FString::Printf(TEXT("%s loads the mesh"), Name), bLoaded))
+		{
+			AddBenchmarkInfo(*this, FString::Printf(TEXT("%s time to first mesh"), Name), Seconds, FileSize);
+			AddInfo(FString::Printf(TEXT("%s peak resident memory growth: %.2f MB (file %.2f MB)"), Name, PeakMemory / (1024.0 * 1024.0), FileSize / (1024.0 * 1024.0)));
+		}
+	}
+
+	TestEqual(TEXT("mapped file vertices"), Positions[1].Num(), Side * Side);
+	TestTrue(TEXT("both paths load the same positions"), Positions[0] == Positions[1]);
+
+	IFileManager::Get().Delete(*Filename);
+
+	return true;
+}
+
+#endif
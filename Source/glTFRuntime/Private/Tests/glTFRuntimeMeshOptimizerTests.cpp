@@ -0,0 +1,212 @@
+// Copyright 2020-2023, Roberto De Ioris.
+
+#include "glTFRuntimeParser.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Base64.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace glTFRuntimeMeshOptimizerTests
+{
+	// streams encoded following the EXT_meshopt_compression specification, expected outputs (filters included) are computed with the reference decoder arithmetic
+	// 300 int32 triplets (two blocks, all the group encodings)
+	const uint8 PositionsStream[] = {
+		0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0x06, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+		0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+		0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+		0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+		0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+		0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x04, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0e, 0x2a, 0x46, 0x62, 0x7e, 0x9a, 0xb6, 0xd2, 0xee, 0xf5,
+		0xd9, 0x8d, 0xa1, 0x85, 0x69, 0x4d, 0x01, 0x15, 0x06, 0x22, 0x6e, 0x5a, 0x76, 0xc2, 0xae, 0xca, 0xe9, 0xfd, 0xe1, 0x95, 0xa9, 0x5d, 0x71, 0x25,
+		0x39, 0x12, 0x01, 0x4a, 0x36, 0x82, 0x6e, 0xba, 0xa6, 0xf2, 0xf1, 0xfa, 0xb9, 0x9d, 0xb1, 0x65, 0x49, 0x5d, 0x11, 0x0a, 0x26, 0x12, 0x5e, 0x7a,
+		0x96, 0xb2, 0xce, 0xba, 0xf9, 0xdd, 0xc1, 0xa5, 0x89, 0x6d, 0x51, 0x35, 0x19, 0x02, 0x1e, 0x3a, 0x56, 0x72, 0x8e, 0xaa, 0xc6, 0xe2, 0xfe, 0xb5,
+		0xc9, 0xad, 0x91, 0x75, 0x59, 0x0d, 0x21, 0x05, 0x16, 0x62, 0x4e, 0x6a, 0xb6, 0xa2, 0xbe, 0xf5, 0xf6, 0xbd, 0xd1, 0xb5, 0x69, 0x7d, 0x31, 0x45,
+		0x06, 0x0d, 0x3e, 0x2a, 0x76, 0x62, 0xae, 0x9a, 0xe6, 0xfd, 0xee, 0xc5, 0xa9, 0xbd, 0x71, 0x55, 0x69, 0x1d, 0x01, 0x1a, 0x06, 0x52, 0x6e, 0x8a,
+		0xa6, 0x92, 0xde, 0xfa, 0xe9, 0xcd, 0xb1, 0x95, 0x79, 0x5d, 0x41, 0x25, 0x09, 0x12, 0x2e, 0x4a, 0x66, 0x82, 0x9e, 0xba, 0xd6, 0xf2, 0xf1, 0xa5,
+		0xb9, 0x9d, 0x81, 0x65, 0x49, 0x02, 0x11, 0x0a, 0x26, 0x72, 0x5e, 0x7a, 0xc6, 0xb2, 0xce, 0xe5, 0xf9, 0xad, 0xc1, 0xa5, 0x59, 0x6d, 0x21, 0x35,
+		0x16, 0x02, 0x4e, 0x3a, 0x86, 0x72, 0xbe, 0xda, 0xc6, 0xed, 0xd1, 0xe5, 0x99, 0x7d, 0x91, 0x45, 0x29, 0x3d, 0x0e, 0x2a, 0x46, 0x62, 0x4e, 0x9a,
+		0xb6, 0xd2, 0xee, 0xf5, 0xf6, 0xbd, 0xa1, 0x85, 0x69, 0x4d, 0x31, 0x15, 0x06, 0x22, 0x3e, 0x5a, 0x76, 0x92, 0xae, 0xca, 0xe9, 0xfd, 0xe1, 0xc5,
+		0xa9, 0x8d, 0x41, 0x55, 0x39, 0x1d, 0x2e, 0x1a, 0x36, 0x52, 0x9e, 0x8a, 0xa6, 0xf2, 0xde, 0xfa, 0xb9, 0xcd, 0x81, 0x95, 0x49, 0x5d, 0x11, 0x25,
+		0x26, 0x12, 0x5e, 0x4a, 0x96, 0xa9, 0xa5, 0xa5, 0x95, 0x00, 0x08, 0x22, 0xca, 0x05, 0x25, 0x22, 0x25, 0x22, 0x32, 0x23, 0x24, 0x32, 0x34, 0x34,
+		0x34, 0x34, 0x36, 0x34, 0x13, 0x63, 0x16, 0x13, 0x61, 0x11, 0x61, 0x01, 0x10, 0x60, 0x44, 0x00, 0x00, 0x20, 0x8c, 0xa8, 0xea, 0xeb, 0x05, 0x05,
+		0x03, 0x05, 0x42, 0x54, 0x32, 0x43, 0x23, 0x43, 0x43, 0x41, 0x43, 0x41, 0x36, 0x31, 0x63, 0x16, 0x11, 0x16, 0x51, 0xc4, 0x40, 0x40, 0x06, 0x02,
+		0x08, 0x2c, 0xa2, 0x05, 0x52, 0x22, 0x32, 0x25, 0x42, 0x32, 0x34, 0x23, 0x43, 0x43, 0x43, 0x43, 0x41, 0x36, 0x31, 0x41, 0x75, 0xd5, 0x35, 0x13,
+		0x04, 0x06, 0x06, 0x06, 0x04, 0x00, 0x00, 0x83, 0x05, 0x28, 0xba, 0xba, 0xbe, 0x05, 0x05, 0x05, 0x04, 0x54, 0x23, 0x23, 0x43, 0x43, 0x43, 0x43,
+		0x43, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x20, 0x42, 0x12, 0x12, 0x49, 0x26, 0x66, 0x66, 0x66, 0x19, 0x21, 0x84, 0x81, 0x08, 0x04, 0x00, 0x00,
+		0x20, 0x04, 0x20, 0x48, 0x61, 0x86, 0x49, 0x99, 0x99, 0x98, 0x64, 0x92, 0x12, 0x10, 0x80, 0x40, 0x00, 0x00, 0x08, 0x04, 0x20, 0x48, 0x61, 0x86,
+		0x61, 0x99, 0x99, 0x86, 0x49, 0x24, 0x84, 0x21, 0x02, 0x00, 0x00, 0x00, 0x01, 0x08, 0x12, 0x12, 0x18, 0x61, 0x99, 0x99, 0x99, 0x55, 0x55, 0x55,
+		0x55, 0x00, 0x00, 0x20, 0x42, 0x12, 0x12, 0x49, 0x26, 0x66, 0x66, 0x66, 0x19, 0x21, 0x84, 0x81, 0x08, 0x04, 0x00, 0x00, 0x20, 0x04, 0x20, 0x48,
+		0x61, 0x86, 0x49, 0x99, 0x99, 0x98, 0x64, 0x92, 0x12, 0x10, 0x80, 0x40, 0x00, 0x00, 0x08, 0x04, 0x20, 0x48, 0x61, 0x86, 0x61, 0x99, 0x99, 0x86,
+		0x49, 0x24, 0x84, 0x21, 0x02, 0x00, 0x00, 0x00, 0x01, 0x08, 0x12, 0x12, 0x18, 0x61, 0x99, 0x99, 0x99, 0x54, 0x54, 0x51, 0x45, 0x00, 0x80, 0x00,
+		0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+		0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x82, 0xce, 0xba, 0xf9, 0xdd, 0xf1,
+		0xa5, 0x89, 0x9d, 0x51, 0x35, 0x19, 0x2d, 0x1e, 0x3a, 0x56, 0x42, 0x8e, 0xaa, 0xc6, 0xe2, 0xfe, 0xea, 0xc9, 0xad, 0x91, 0x75, 0x59, 0x3d, 0x21,
+		0x05, 0x16, 0xff, 0xff, 0xff, 0x00, 0x32, 0x4e, 0x6a, 0x86, 0xa2, 0xbe, 0xf5, 0xf6, 0xed, 0xd1, 0xb5, 0x99, 0x16, 0x41, 0x41, 0x36, 0x13, 0x61,
+		0x11, 0x61, 0x11, 0xd1, 0x4c, 0x10, 0x00, 0x06, 0x06, 0x02, 0x0c, 0x8a, 0x00, 0x05, 0x15, 0x98, 0x61, 0x84, 0x84, 0x81, 0x08, 0x00, 0x00, 0x00,
+		0x04, 0x08, 0x00, 0x15, 0x98, 0x61, 0x84, 0x84, 0x81, 0x08, 0x00, 0x00, 0x00, 0x04, 0x08, 0x00, 0x05, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x0c, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00
+	};
+
+	const uint8 Octahedral8Stream[] = {
+		0xa0, 0x01, 0x3f, 0xfd, 0x00, 0x00, 0xfd, 0x50, 0xc7, 0xbf, 0x84, 0xb6, 0x01, 0x3f, 0xfe, 0x00, 0x00, 0xfd, 0xb1, 0x27, 0xa0, 0x84, 0xb2, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x7f, 0x00
+	};
+
+	const int8 Octahedral8Expected[] = {
+		127, 0, 0, 0, 0, -127, 0, 0, 69, 69, 81, 0, -97, 32, 76, 0,
+		42, 42, -113, 0, -63, -63, -90, 0, 1, -1, 127, 0, 0, 0, 127, 0
+	};
+
+	const uint8 Octahedral16Stream[] = {
+		0xa0, 0x01, 0x33, 0xf0, 0x00, 0x00, 0x42, 0x9f, 0xd7, 0xc7, 0x01, 0x3f, 0xc0, 0x00, 0x00, 0xa4, 0xfa, 0x78, 0xec, 0x01, 0x3f, 0xf0, 0x00, 0x00,
+		0x80, 0x3f, 0x5f, 0xa7, 0xc8, 0x01, 0x3f, 0xe0, 0x00, 0x00, 0x3e, 0x5e, 0xeb, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x00, 0xff, 0x7f,
+		0x00, 0x00
+	};
+
+	const int16 Octahedral16Expected[] = {
+		32767, 0, 0, 0, -20414, 13609, 21719, 0, 21508, 21508, -12185, 0, -31021, -3770, -9855, 0,
+		101, -101, 32767, 0, 0, 0, 32767, 0
+	};
+
+	const uint8 QuaternionStream[] = {
+		0xa0, 0x01, 0x3f, 0xf0, 0x00, 0x00, 0x2f, 0x6d, 0x6b, 0xf5, 0x5f, 0x01, 0x3f, 0x30, 0x00, 0x00, 0x06, 0x1d, 0x18, 0x0e, 0x01, 0x3f, 0xf0, 0x00,
+		0x00, 0x60, 0x3e, 0xf2, 0x70, 0x2f, 0x01, 0x3f, 0x70, 0x00, 0x00, 0x0f, 0x26, 0x13, 0x06, 0x01, 0x3f, 0xf0, 0x00, 0x00, 0x17, 0x18, 0x29, 0x2a,
+		0x30, 0x01, 0x27, 0xf0, 0x00, 0x00, 0x07, 0x08, 0x07, 0x01, 0x2a, 0xf0, 0x00, 0x00, 0x1d, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc,
+		0x0f
+	};
+
+	const int16 QuaternionExpected[] = {
+		32767, 0, 0, 0, 2829, 30093, 5658, -11316, 16380, 0, 23175, -16380, 696, 2580, -4464, 32351,
+		32767, 0, 0, 0, 5675, -5675, 29673, 11349
+	};
+
+	const uint8 ExponentialStream[] = {
+		0xa0, 0x01, 0x3e, 0x00, 0x00, 0x00, 0x72, 0x71, 0x01, 0x3c, 0x00, 0x00, 0x00, 0x60, 0x5f, 0x01, 0x30, 0x00, 0x00, 0x00, 0x7f, 0x01, 0x3f, 0x00,
+		0x00, 0x00, 0x18, 0x14, 0x28, 0x01, 0x3f, 0x00, 0x00, 0x00, 0x0d, 0x0e, 0x40, 0x01, 0x1f, 0x00, 0x00, 0x00, 0x14, 0xc6, 0x01, 0x3f, 0x00, 0x00,
+		0x00, 0x7e, 0x7c, 0x83, 0x01, 0x3f, 0x00, 0x00, 0x00, 0x32, 0x41, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xea, 0x00, 0x00, 0xc0, 0xea
+	};
+
+	const uint32 ExponentialExpected[] = {
+		0x3f800000, 0xbf800000, 0x4140e400, 0xc2600000, 0x00000000, 0x3b742400, 0x49800000, 0xc6127c00
+	};
+
+	// every triangle code family, indices are the same for 16 and 32 bit outputs
+	const uint8 TrianglesStream[] = {
+		0xe1, 0xf0, 0x10, 0x03, 0x0f, 0x0e, 0x0d, 0xff, 0xfe, 0xf5, 0x20, 0x11, 0xfd, 0x30, 0xf1, 0x0f, 0xff, 0x0a, 0x1f, 0x0a, 0x05, 0x00, 0xd8, 0x04,
+		0x2f, 0xd0, 0x0f, 0xf7, 0x0a, 0x00, 0x76, 0x87, 0x56, 0x67, 0x78, 0xa9, 0x86, 0x65, 0x89, 0x68, 0x98, 0x01, 0x69, 0x00, 0x00
+	};
+
+	const uint32 TrianglesExpected[] = {
+		0, 1, 2, 2, 1, 3, 2, 3, 0, 2, 0, 5, 2, 5, 6, 2, 6, 5, 10, 5, 7, 0, 1, 2,
+		3, 6, 5, 6, 3, 4, 4, 3, 3, 5, 7, 6, 4, 3, 6, 7, 0, 1, 7, 1, 307, 1307, 7, 607
+	};
+
+	TArray64<uint8> MakePositions()
+	{
+		TArray64<uint8> Data;
+		for (int32 Index = 0; Index < 300; Index++)
+		{
+			const int32 Position[3] = { Index * 3, (Index * Index * 7) % 1000 - 500, Index / 20 };
+			Data.Append(reinterpret_cast<const uint8*>(Position), sizeof(Position));
+		}
+		return Data;
+	}
+
+	template<typename T>
+	TArray64<uint8> MakeBytes(TArrayView<const T> Values)
+	{
+		return TArray64<uint8>(reinterpret_cast<const uint8*>(Values.GetData()), Values.Num() * sizeof(T));
+	}
+
+	TArray64<uint8> MakeIndices(const int32 IndexSize)
+	{
+		TArray64<uint8> Data;
+		for (const uint32 Index : TrianglesExpected)
+		{
+			if (IndexSize == 2)
+			{
+				const uint16 Index16 = static_cast<uint16>(Index);
+				Data.Append(reinterpret_cast<const uint8*>(&Index16), sizeof(uint16));
+			}
+			else
+			{
+				Data.Append(reinterpret_cast<const uint8*>(&Index), sizeof(uint32));
+			}
+		}
+		return Data;
+	}
+
+	struct FStream
+	{
+		const TCHAR* Name;
+		TArrayView<const uint8> Compressed;
+		int32 Stride;
+		int32 Count;
+		const TCHAR* Mode;
+		const TCHAR* Filter;
+		TArray64<uint8> Expected;
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeMeshOptimizerKnownBuffersTest, "glTFRuntime.MeshOptimizer.KnownBuffers", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeMeshOptimizerKnownBuffersTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeMeshOptimizerTests;
+
+	const TArray<FStream> Streams = {
+		{ TEXT("positions"), PositionsStream, 12, 300, TEXT("ATTRIBUTES"), TEXT("NONE"), MakePositions() },
+		{ TEXT("octahedral 8 bit"), Octahedral8Stream, 4, UE_ARRAY_COUNT(Octahedral8Expected) / 4, TEXT("ATTRIBUTES"), TEXT("OCTAHEDRAL"), MakeBytes<int8>(Octahedral8Expected) },
+		{ TEXT("octahedral 16 bit"), Octahedral16Stream, 8, UE_ARRAY_COUNT(Octahedral16Expected) / 4, TEXT("ATTRIBUTES"), TEXT("OCTAHEDRAL"), MakeBytes<int16>(Octahedral16Expected) },
+		{ TEXT("quaternion"), QuaternionStream, 8, UE_ARRAY_COUNT(QuaternionExpected) / 4, TEXT("ATTRIBUTES"), TEXT("QUATERNION"), MakeBytes<int16>(QuaternionExpected) },
+		{ TEXT("exponential"), ExponentialStream, 8, UE_ARRAY_COUNT(ExponentialExpected) / 2, TEXT("ATTRIBUTES"), TEXT("EXPONENTIAL"), MakeBytes<uint32>(ExponentialExpected) },
+		{ TEXT("triangles 16 bit"), TrianglesStream, 2, UE_ARRAY_COUNT(TrianglesExpected), TEXT("TRIANGLES"), TEXT("NONE"), MakeIndices(2) },
+		{ TEXT("triangles 32 bit"), TrianglesStream, 4, UE_ARRAY_COUNT(TrianglesExpected), TEXT("TRIANGLES"), TEXT("NONE"), MakeIndices(4) }
+	};
+
+	// all the streams live in a single data uri buffer, each one with its own compressed bufferView
+	TArray<uint8> Buffer;
+	FString BufferViews;
+	for (const FStream& Stream : Streams)
+	{
+		if (!BufferViews.IsEmpty())
+		{
+			BufferViews += TEXT(",");
+		}
+		BufferViews += FString::Printf(TEXT("{\"buffer\":0,\"byteLength\":%d,\"extensions\":{\"EXT_meshopt_compression\":{\"buffer\":0,\"byteOffset\":%d,\"byteLength\":%d,\"byteStride\":%d,\"count\":%d,\"mode\":\"%s\",\"filter\":\"%s\"}}}"),
+			Stream.Compressed.Num(), Buffer.Num(), Stream.Compressed.Num(), Stream.Stride, Stream.Count, Stream.Mode, Stream.Filter);
+		Buffer.Append(Stream.Compressed.GetData(), Stream.Compressed.Num());
+	}
+
+	const FString Json = FString::Printf(TEXT("{\"asset\":{\"version\":\"2.0\"},\"extensionsUsed\":[\"EXT_meshopt_compression\"],\"buffers\":[{\"byteLength\":%d,\"uri\":\"data:application/octet-stream;base64,%s\"}],\"bufferViews\":[%s]}"),
+		Buffer.Num(), *FBase64::Encode(Buffer), *BufferViews);
+
+	TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromString(Json, FglTFRuntimeConfig());
+	if (!TestTrue(TEXT("asset is parsed"), Parser.IsValid()))
+	{
+		return false;
+	}
+
+	for (int32 StreamIndex = 0; StreamIndex < Streams.Num(); StreamIndex++)
+	{
+		const FStream& Stream = Streams[StreamIndex];
+		FglTFRuntimeBlob Blob;
+		int64 Stride = 0;
+		if (TestTrue(FString::Printf(TEXT("%s is decoded"), Stream.Name), Parser->GetBufferView(StreamIndex, Blob, Stride)))
+		{
+			TestTrue(FString::Printf(TEXT("%s matches"), Stream.Name), TArray64<uint8>(Blob.Data, Blob.Num) == Stream.Expected);
+		}
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,66 @@
+// Copyright 2020-2024, Roberto De Ioris.
+
+#include "glTFRuntimeParser.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "glTFRuntimeTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeProbeBenchmark, "glTFRuntime.Probe.Benchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FglTFRuntimeProbeBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeTests;
+
+	// about 4M vertices and 200MB of binary chunk
+	constexpr int32 Side = 2048;
+	const TArray<uint8> Glb = MakeGridGlb(Side);
+	const FString Filename = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("glTFRuntimeProbe"), FGuid::NewGuid().ToString() + TEXT(".glb"));
+	if (!TestTrue(TEXT("glb is written"), FFileHelper::SaveArrayToFile(Glb, *Filename)))
+	{
+		return false;
+	}
+
+	constexpr int32 Runs = 3;
+	const FglTFRuntimeConfig LoaderConfig;
+
+	FglTFRuntimeProbeInfo ProbeInfo;
+	const int64 ProbeMemoryBefore = GetUsedPhysicalMemory();
+	const double ProbeSeconds = MeasureBestSeconds(Runs, [&]()
+		{
+			ProbeInfo = FglTFRuntimeProbeInfo();
+			FglTFRuntimeParser::ProbeFromFilename(Filename, LoaderConfig, ProbeInfo);
+		});
+	const int64 ProbeMemory = GetUsedPhysicalMemory() - ProbeMemoryBefore;
+	TestEqual(TEXT("probe counts the vertices"), ProbeInfo.NumVertices, static_cast<int64>(Side * Side));
+	TestEqual(TEXT("probe counts the triangles"), ProbeInfo.NumTriangles, static_cast<int64>((Side - 1) * (Side - 1) * 2));
+	TestTrue(TEXT("probe bounds come from min/max"), ProbeInfo.Bounds.IsValid != 0);
+
+	bool bLoaded = false;
+	const int64 LoadMemoryBefore = GetUsedPhysicalMemory();
+	const double LoadSeconds = MeasureBestSeconds(Runs, [&]()
+		{
+			TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromFilename(Filename, LoaderConfig);
+			FglTFRuntimeMeshLOD LOD;
+			bLoaded = Parser && Parser->LoadMeshAsRuntimeLOD(0, LOD, FglTFRuntimeMaterialsConfig());
+		});
+	const int64 LoadMemory = GetUsedPhysicalMemory() - LoadMemoryBefore;
+	TestTrue(TEXT("mesh is fully loaded"), bLoaded);
+
+	AddBenchmarkInfo(*this, TEXT("Probe"), ProbeSeconds, Glb.Num());
+	AddBenchmarkInfo(*this, TEXT("Full load"), LoadSeconds, Glb.Num());
+	AddInfo(FString::Printf(TEXT("Resident memory growth: probe %.2f MB, full load %.2f MB"), ProbeMemory / (1024.0 * 1024.0), LoadMemory / (1024.0 * 1024.0)));
+	if (ProbeSeconds > 0)
+	{
+		AddInfo(FString::Printf(TEXT("Probe is %.1fx faster than a full load"), LoadSeconds / ProbeSeconds));
+	}
+
+	IFileManager::Get().Delete(*Filename);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,212 @@
+// Copyright 2020-2024, Roberto De Ioris.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Async.h"
+#include "HAL/ThreadSafeBool.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/*
+* Data generators shared by the automation tests.
+*/
+namespace glTFRuntimeTests
+{
+	template<typename ArrayType>
+	void Write16(ArrayType& Bytes, const uint16 Value)
+	{
+		Bytes.Add(Value & 0xFF);
+		Bytes.Add(Value >> 8);
+	}
+
+	template<typename ArrayType>
+	void Write32(ArrayType& Bytes, const uint32 Value)
+	{
+		Write16(Bytes, Value & 0xFFFF);
+		Write16(Bytes, Value >> 16);
+	}
+
+	template<typename ArrayType>
+	void Write64(ArrayType& Bytes, const uint64 Value)
+	{
+		Write32(Bytes, Value & 0xFFFFFFFF);
+		Write32(Bytes, Value >> 32);
+	}
+
+	// deterministic noise (the reference frames of the Zstd and LZ4 tests depend on this exact sequence)
+	inline TArray64<uint8> MakeNoise(const int64 Num, uint32 Seed)
+	{
+		TArray64<uint8> Data;
+		Data.AddUninitialized(Num);
+		for (int64 Index = 0; Index < Num; Index++)
+		{
+			Seed = Seed * 1103515245 + 12345;
+			Data[Index] = static_cast<uint8>(Seed >> 16);
+		}
+		return Data;
+	}
+
+	inline TArray<uint8> ToUTF8(const FString& String)
+	{
+		const FTCHARToUTF8 UTF8(*String);
+		return TArray<uint8>(reinterpret_cast<const uint8*>(UTF8.Get()), UTF8.Length());
+	}
+
+	// binary glTF with a json chunk (padded with spaces) and an optional binary chunk
+	template<typename ArrayType>
+	TArray<uint8> MakeGlb(const FString& Json, const ArrayType& Binary)
+	{
+		FString PaddedJson = Json;
+		while (PaddedJson.Len() % 4)
+		{
+			PaddedJson += TEXT(" ");
+		}
+		const TArray<uint8> JsonChunk = ToUTF8(PaddedJson);
+		const uint32 BinaryChunkNum = static_cast<uint32>(Binary.Num());
+
+		TArray<uint8> Glb;
+		Write32(Glb, 0x46546C67);
+		Write32(Glb, 2);
+		Write32(Glb, 12 + 8 + JsonChunk.Num() + (BinaryChunkNum > 0 ? 8 + BinaryChunkNum : 0));
+		Write32(Glb, JsonChunk.Num());
+		Write32(Glb, 0x4E4F534A);
+		Glb.Append(JsonChunk);
+		if (BinaryChunkNum > 0)
+		{
+			Write32(Glb, BinaryChunkNum);
+			Write32(Glb, 0x004E4942);
+			Glb.Append(Binary.GetData(), BinaryChunkNum);
+		}
+		return Glb;
+	}
+
+	// Side x Side grid with positions (and their min/max), normals, uvs and 32 bit indices in a single primitive,
+	// the attributes are either in their own bufferViews or interleaved in a single strided one
+	inline TArray<uint8> MakeGridGlb(const int32 Side, const bool bInterleaved = false)
+	{
+		const int32 NumVertices = Side * Side;
+		const int32 NumIndices = (Side - 1) * (Side - 1) * 6;
+		constexpr int32 VertexSize = (3 + 3 + 2) * sizeof(float);
+
+		TArray<uint8> Binary;
+		Binary.AddZeroed(NumVertices * VertexSize + NumIndices * static_cast<int32>(sizeof(uint32)));
+
+		float* Attributes = reinterpret_cast<float*>(Binary.GetData());
+		for (int32 Y = 0; Y < Side; Y++)
+		{
+			for (int32 X = 0; X < Side; X++)
+			{
+				const int32 Index = Y * Side + X;
+				float* Position = bInterleaved ? Attributes + Index * 8 : Attributes + Index * 3;
+				float* Normal = bInterleaved ? Position + 3 : Attributes + NumVertices * 3 + Index * 3;
+				float* UV = bInterleaved ? Position + 6 : Attributes + NumVertices * 6 + Index * 2;
+				Position[0] = static_cast<float>(X);
+				Position[2] = static_cast<float>(Y);
+				Normal[1] = 1;
+				UV[0] = static_cast<float>(X) / (Side - 1);
+				UV[1] = static_cast<float>(Y) / (Side - 1);
+			}
+		}
+
+		uint32* Indices = reinterpret_cast<uint32*>(Binary.GetData() + NumVertices * VertexSize);
+		for (int32 Y = 0; Y < Side - 1; Y++)
+		{
+			for (int32 X = 0; X < Side - 1; X++)
+			{
+				const uint32 Corner = Y * Side + X;
+				*Indices++ = Corner;
+				*Indices++ = Corner + Side;
+				*Indices++ = Corner + 1;
+				*Indices++ = Corner + 1;
+				*Indices++ = Corner + Side;
+				*Indices++ = Corner + Side + 1;
+			}
+		}
+
+		const int32 IndicesOffset = NumVertices * VertexSize;
+		const int32 IndicesLength = NumIndices * static_cast<int32>(sizeof(uint32));
+		FString BufferViewsJson;
+		FString AccessorsJson;
+		if (bInterleaved)
+		{
+			BufferViewsJson = FString::Printf(TEXT("{\"buffer\":0,\"byteLength\":%d,\"byteStride\":%d},{\"buffer\":0,\"byteOffset\":%d,\"byteLength\":%d}"),
+				IndicesOffset, VertexSize, IndicesOffset, IndicesLength);
+			AccessorsJson = FString::Printf(TEXT("{\"bufferView\":0,\"byteOffset\":12,\"componentType\":5126,\"count\":%d,\"type\":\"VEC3\"},")
+				TEXT("{\"bufferView\":0,\"byteOffset\":24,\"componentType\":5126,\"count\":%d,\"type\":\"VEC2\"},")
+				TEXT("{\"bufferView\":1,\"componentType\":5125,\"count\":%d,\"type\":\"SCALAR\"}"), NumVertices, NumVertices, NumIndices);
+		}
+		else
+		{
+			BufferViewsJson = FString::Printf(TEXT("{\"buffer\":0,\"byteLength\":%d},{\"buffer\":0,\"byteOffset\":%d,\"byteLength\":%d},{\"buffer\":0,\"byteOffset\":%d,\"byteLength\":%d},{\"buffer\":0,\"byteOffset\":%d,\"byteLength\":%d}"),
+				NumVertices * 12, NumVertices * 12, NumVertices * 12, NumVertices * 24, NumVertices * 8, IndicesOffset, IndicesLength);
+			AccessorsJson = FString::Printf(TEXT("{\"bufferView\":1,\"componentType\":5126,\"count\":%d,\"type\":\"VEC3\"},")
+				TEXT("{\"bufferView\":2,\"componentType\":5126,\"count\":%d,\"type\":\"VEC2\"},")
+				TEXT("{\"bufferView\":3,\"componentType\":5125,\"count\":%d,\"type\":\"SCALAR\"}"), NumVertices, NumVertices, NumIndices);
+		}
+
+		return MakeGlb(FString::Printf(TEXT("{\"asset\":{\"version\":\"2.0\"},\"scene\":0,\"scenes\":[{\"nodes\":[0]}],\"nodes\":[{\"mesh\":0}],")
+			TEXT("\"meshes\":[{\"primitives\":[{\"attributes\":{\"POSITION\":0,\"NORMAL\":1,\"TEXCOORD_0\":2},\"indices\":3}]}],")
+			TEXT("\"buffers\":[{\"byteLength\":%d}],\"bufferViews\":[%s],")
+			TEXT("\"accessors\":[{\"bufferView\":0,\"componentType\":5126,\"count\":%d,\"type\":\"VEC3\",\"min\":[0,0,0],\"max\":[%d,0,%d]},%s]}"),
+			Binary.Num(), *BufferViewsJson, NumVertices, Side - 1, Side - 1, *AccessorsJson), Binary);
+	}
+
+	// best time of a few runs (the first run usually pays for cold caches and allocations)
+	template<typename FunctionType>
+	double MeasureBestSeconds(const int32 Runs, FunctionType&& Function)
+	{
+		double BestSeconds = TNumericLimits<double>::Max();
+		for (int32 Run = 0; Run < Runs; Run++)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			Function();
+			BestSeconds = FMath::Min(BestSeconds, FPlatformTime::Seconds() - StartTime);
+		}
+		return BestSeconds;
+	}
+
+	inline void AddBenchmarkInfo(FAutomationTestBase& Test, const FString& Name, const double Seconds, const int64 Bytes = 0)
+	{
+		if (Bytes > 0 && Seconds > 0)
+		{
+			Test.AddInfo(FString::Printf(TEXT("%s: %.3f ms (%.2f MB/s)"), *Name, Seconds * 1000.0, Bytes / Seconds / (1024.0 * 1024.0)));
+		}
+		else
+		{
+			Test.AddInfo(FString::Printf(TEXT("%s: %.3f ms"), *Name, Seconds * 1000.0));
+		}
+	}
+
+	// resident memory of the process, used to compare the footprint of two loading paths
+	inline int64 GetUsedPhysicalMemory()
+	{
+		return static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical);
+	}
+
+	// highest resident memory growth while the function runs, sampled every millisecond from another thread
+	template<typename FunctionType>
+	int64 MeasurePeakMemory(FunctionType&& Function)
+	{
+		const int64 Baseline = GetUsedPhysicalMemory();
+		int64 Peak = Baseline;
+		FThreadSafeBool bDone = false;
+		TFuture<void> Sampler = Async(EAsyncExecution::Thread, [&Peak, &bDone]()
+			{
+				while (!bDone)
+				{
+					Peak = FMath::Max(Peak, GetUsedPhysicalMemory());
+					FPlatformProcess::Sleep(0.001f);
+				}
+			});
+
+		Function();
+
+		bDone = true;
+		Sampler.Wait();
+		return FMath::Max(Peak, GetUsedPhysicalMemory()) - Baseline;
+	}
+}
+
+#endif
@@ -0,0 +1,165 @@
+// Copyright 2020-2024, Roberto De Ioris.
+
+#include "glTFRuntimeParser.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "glTFRuntimeTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace glTFRuntimeTrimBuffersTests
+{
+	using namespace glTFRuntimeTests;
+
+	bool LoadPositions(TSharedPtr<FglTFRuntimeParser> Parser, TArray<FVector>& Positions)
+	{
+		FglTFRuntimeMeshLOD LOD;
+		if (!Parser || !Parser->LoadMeshAsRuntimeLOD(0, LOD, FglTFRuntimeMaterialsConfig()) || LOD.Primitives.Num() != 1)
+		{
+			return false;
+		}
+		Positions = MoveTemp(LOD.Primitives[0].Positions);
+		return true;
+	}
+
+	// the grid glb json chunk with the binary chunk moved to an external .bin file
+	bool WriteGltf(const TArray<uint8>& Glb, const FString& Directory, FString& OutFilename)
+	{
+		const uint32 JsonChunkNum = Glb[12] | (Glb[13] << 8) | (Glb[14] << 16) | (Glb[15] << 24);
+		FString Json;
+		FFileHelper::BufferToString(Json, Glb.GetData() + 20, JsonChunkNum);
+		const int64 BinaryChunkOffset = 20 + JsonChunkNum + 8;
+		if (!Json.ReplaceInline(TEXT("\"buffers\":[{"), TEXT("\"buffers\":[{\"uri\":\"grid.bin\",")))
+		{
+			return false;
+		}
+
+		OutFilename = FPaths::Combine(Directory, TEXT("grid.gltf"));
+		return FFileHelper::SaveArrayToFile(TArrayView<const uint8>(Glb.GetData() + BinaryChunkOffset, Glb.Num() - BinaryChunkOffset), *FPaths::Combine(Directory, TEXT("grid.bin"))) &&
+			FFileHelper::SaveStringToFile(Json, *OutFilename);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTrimBuffersReloadTest, "glTFRuntime.TrimBuffers.Reload", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeTrimBuffersReloadTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeTrimBuffersTests;
+
+	constexpr int32 Side = 32;
+	const TArray<uint8> Glb = MakeGridGlb(Side);
+	const FString Directory = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("glTFRuntimeTrimBuffers"), FGuid::NewGuid().ToString());
+	const FString GlbFilename = FPaths::Combine(Directory, TEXT("grid.glb"));
+	FString GltfFilename;
+	if (!TestTrue(TEXT("glb is written"), FFileHelper::SaveArrayToFile(Glb, *GlbFilename)) ||
+		!TestTrue(TEXT("gltf is written"), WriteGltf(Glb, Directory, GltfFilename)))
+	{
+		return false;
+	}
+
+	TArray<FVector> Expected;
+	if (!TestTrue(TEXT("reference mesh is loaded"), LoadPositions(FglTFRuntimeParser::FromData(Glb.GetData(), Glb.Num(), FglTFRuntimeConfig()), Expected)))
+	{
+		return false;
+	}
+
+	struct FTrimCase
+	{
+		const TCHAR* Name;
+		TSharedPtr<FglTFRuntimeParser> Parser;
+		// only the binary data that can be read again is released
+		int64 MinReleasedBytes;
+	};
+
+	// glb binary chunk (reloaded from the file), external buffer (cached by GetBuffer()), binary chunk from memory (kept)
+	const int64 BinaryNum = Side * Side * 32 + (Side - 1) * (Side - 1) * 24;
+	for (const FTrimCase& TrimCase : {
+		FTrimCase{ TEXT("glb file"), FglTFRuntimeParser::FromFilename(GlbFilename, FglTFRuntimeConfig()), BinaryNum },
+		FTrimCase{ TEXT("gltf with external buffer"), FglTFRuntimeParser::FromFilename(GltfFilename, FglTFRuntimeConfig()), BinaryNum },
+		FTrimCase{ TEXT("glb from memory"), FglTFRuntimeParser::FromData(Glb.GetData(), Glb.Num(), FglTFRuntimeConfig()), 0 } })
+	{
+		TArray<FVector> Positions;
+		if (!TestTrue(FString::Printf(TEXT("%s mesh is loaded"), TrimCase.Name), LoadPositions(TrimCase.Parser, Positions)))
+		{
+			continue;
+		}
+		TestTrue(FString::Printf(TEXT("%s mesh matches"), TrimCase.Name), Positions == Expected);
+
+		const int64 ReleasedBytes = TrimCase.Parser->TrimBuffers();
+		TestTrue(FString::Printf(TEXT("%s releases at least %lld bytes (%lld)"), TrimCase.Name, TrimCase.MinReleasedBytes, ReleasedBytes), ReleasedBytes >= TrimCase.MinReleasedBytes);
+
+		// twice, to reload from the trimmed state and from the caches rebuilt by the first reload
+		for (int32 Reload = 0; Reload < 2; Reload++)
+		{
+			TArray<FVector> ReloadedPositions;
+			if (TestTrue(FString::Printf(TEXT("%s mesh is reloaded after trimming"), TrimCase.Name), LoadPositions(TrimCase.Parser, ReloadedPositions)))
+			{
+				TestTrue(FString::Printf(TEXT("%s reloaded mesh matches"), TrimCase.Name), ReloadedPositions == Expected);
+			}
+		}
+		TrimCase.Parser->TrimBuffers();
+	}
+
+	IFileManager::Get().DeleteDirectory(*Directory, false, true);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeTrimBuffersBenchmark, "glTFRuntime.TrimBuffers.Benchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FglTFRuntimeTrimBuffersBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeTrimBuffersTests;
+
+	// about 4M vertices and 200MB of binary chunk
+	constexpr int32 Side = 2048;
+	const FString Filename = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("glTFRuntimeTrimBuffers"), FGuid::NewGuid().ToString() + TEXT(".glb"));
+	if (!TestTrue(TEXT("glb is written"), FFileHelper::SaveArrayToFile(MakeGridGlb(Side), *Filename)))
+	{
+		return false;
+	}
+
+	constexpr int32 Runs = 3;
+	TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromFilename(Filename, FglTFRuntimeConfig());
+	TArray<FVector> Positions;
+	if (!TestTrue(TEXT("mesh is loaded"), LoadPositions(Parser, Positions)))
+	{
+		return false;
+	}
+	Positions.Empty();
+
+	// loading the mesh again with the binary chunk in memory
+	const double CachedSeconds = MeasureBestSeconds(Runs, [&]()
+		{
+			LoadPositions(Parser, Positions);
+		});
+
+	const int64 MemoryBeforeTrim = GetUsedPhysicalMemory();
+	const double TrimStartTime = FPlatformTime::Seconds();
+	const int64 ReleasedBytes = Parser->TrimBuffers();
+	const double TrimSeconds = FPlatformTime::Seconds() - TrimStartTime;
+	const int64 MemoryAfterTrim = GetUsedPhysicalMemory();
+
+	// every run reads the used ranges from the file again
+	bool bReloaded = false;
+	const double TrimmedSeconds = MeasureBestSeconds(Runs, [&]()
+		{
+			bReloaded = LoadPositions(Parser, Positions);
+			Parser->TrimBuffers();
+		});
+	TestTrue(TEXT("mesh is reloaded after trimming"), bReloaded);
+
+	AddBenchmarkInfo(*this, TEXT("TrimBuffers()"), TrimSeconds);
+	AddInfo(FString::Printf(TEXT("Released %.2f MB, resident memory %.2f MB -> %.2f MB"), ReleasedBytes / (1024.0 * 1024.0), MemoryBeforeTrim / (1024.0 * 1024.0), MemoryAfterTrim / (1024.0 * 1024.0)));
+	AddBenchmarkInfo(*this, TEXT("Mesh load with the binary chunk in memory"), CachedSeconds);
+	AddBenchmarkInfo(*this, TEXT("Mesh load after trimming"), TrimmedSeconds);
+
+	Parser.Reset();
+	IFileManager::Get().Delete(*Filename);
+
+	return true;
+}
+
+#endif
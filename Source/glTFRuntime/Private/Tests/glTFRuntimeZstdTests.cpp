@@ -0,0 +1,347 @@
+// Copyright 2020-2024, Roberto De Ioris.
+
+#include "glTFRuntimeParser.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Compression.h"
+#include "glTFRuntimeTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace glTFRuntimeZstdTests
+{
+	using namespace glTFRuntimeTests;
+
+	// the reference frames below have been generated with the zstd 1.5.6 cli from these inputs
+	TArray64<uint8> MakeText(const int32 Num)
+	{
+		TArray64<uint8> Data;
+		for (int32 Index = 0; Index < Num; Index++)
+		{
+			const FString Line = FString::Printf(TEXT("{\"node\":%d,\"mesh\":%d,\"name\":\"mesh_%d\"},"), Index, Index % 5, Index % 5);
+			const FTCHARToUTF8 UTF8(*Line);
+			Data.Append(reinterpret_cast<const uint8*>(UTF8.Get()), UTF8.Length());
+		}
+		return Data;
+	}
+
+	TArray64<uint8> MakeRun(const int32 Num, const uint8 Value)
+	{
+		TArray64<uint8> Data;
+		Data.Init(Value, Num);
+		return Data;
+	}
+
+	// zstd -19: several compressed blocks sharing entropy tables and repeat offsets, with checksum
+	const uint8 TextFrame[] = {
+		0x28, 0xb5, 0x2f, 0xfd, 0x04, 0x68, 0x3c, 0x0a, 0x00, 0x36, 0x15, 0x2f, 0x14, 0xb0, 0x69, 0x39, 0x05, 0x93, 0x4e, 0xb1, 0xd5, 0xc3, 0x24, 0x88,
+		0x94, 0x52, 0xa6, 0x94, 0x92, 0x0f, 0x9d, 0xe1, 0x78, 0x2f, 0x00, 0x27, 0x00, 0x23, 0x00, 0xbf, 0x6d, 0xdb, 0xb6, 0xdd, 0xb6, 0x6d, 0xdb, 0x92,
+		0x24, 0x49, 0x92, 0xdb, 0xb6, 0x6d, 0x5b, 0xd1, 0xc8, 0x6d, 0xb7, 0x25, 0xb9, 0x0d, 0x60, 0xc1, 0x10, 0x02, 0x01, 0x86, 0x83, 0xc1, 0xc0, 0x41,
+		0x41, 0xc2, 0xc1, 0xc0, 0x00, 0x10, 0x01, 0x86, 0x03, 0x01, 0xc2, 0x81, 0x41, 0x21, 0x9b, 0xc9, 0x3e, 0xaf, 0xe3, 0xb6, 0x58, 0x05, 0xc5, 0x84,
+		0xc4, 0x1d, 0x8b, 0xc5, 0x62, 0xb1, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x22, 0x22, 0x22, 0x22, 0xa2, 0x99, 0x99, 0x99, 0x99, 0x19, 0x11, 0x11, 0x11,
+		0x11, 0x91, 0xff, 0xff, 0xff, 0x21, 0x75, 0xfa, 0x5c, 0xfe, 0xfb, 0x3d, 0xbf, 0xc7, 0xcb, 0xe4, 0xb1, 0xf8, 0xb6, 0x6b, 0x7a, 0x0e, 0x57, 0xa9,
+		0x53, 0xe9, 0xeb, 0xb6, 0xec, 0x1a, 0x2d, 0x12, 0x87, 0xc2, 0xd3, 0x2c, 0xc9, 0x31, 0x58, 0xa3, 0x0b, 0x46, 0xb0, 0x8a, 0x6a, 0x4a, 0xea, 0xe5,
+		0x6a, 0xb1, 0x56, 0x51, 0x45, 0x44, 0x43, 0x42, 0x27, 0x53, 0x89, 0x34, 0x0a, 0xaa, 0xa1, 0x99, 0x91, 0xf9, 0x78, 0x3a, 0x9c, 0x4d, 0x4c, 0x09,
+		0xc9, 0x88, 0xc8, 0xc5, 0x52, 0xa1, 0x4c, 0x02, 0x80, 0xd4, 0xa8, 0x10, 0x78, 0x4f, 0xa1, 0x7d, 0x03, 0xb0, 0x93, 0xa4, 0x70, 0x12, 0x48, 0x10,
+		0x88, 0x10, 0x34, 0x08, 0x1a, 0x82, 0xff, 0xcf, 0x3f, 0x08, 0xb4, 0xaf, 0x45, 0x2d, 0x75, 0x25, 0xab, 0xac, 0x55, 0xa9, 0xa5, 0x2e, 0x65, 0x95,
+		0xb5, 0x2c, 0xb5, 0xd4, 0xaa, 0xac, 0xb2, 0xa6, 0xa5, 0x96, 0x72, 0x95, 0x55, 0x96, 0xb5, 0xd4, 0x92, 0xe6, 0xc5, 0x15, 0x5c, 0xf3, 0x44, 0x3c,
+		0xf9, 0x4e, 0x6c, 0x37, 0x3e, 0xf9, 0x9d, 0xf8, 0x5d, 0xfc, 0x5a, 0x7e, 0x2d, 0x6e, 0x2f, 0xb7, 0x17, 0xbf, 0x8b, 0x5e, 0xcb, 0xaf, 0xcb, 0xed,
+		0xe5, 0xec, 0xe2, 0x77, 0xe5, 0x83, 0x75, 0x32, 0x9d, 0x38, 0x27, 0x94, 0x93, 0xe3, 0x64, 0x38, 0xe1, 0x9b, 0xec, 0x26, 0xc9, 0xad, 0x05, 0x6c,
+		0x89, 0x34, 0xb7, 0x3a, 0x4c, 0x79, 0xd3, 0xb7, 0x60, 0xe2, 0x5b, 0x34, 0xfd, 0x16, 0x94, 0xe1, 0x87, 0xe4, 0xf7, 0x34, 0x80, 0x24, 0xc0, 0xa6,
+		0x5c, 0x04, 0x00, 0x62, 0x4e, 0x11, 0x0b, 0xa0, 0xa9, 0xd0, 0x01, 0xed, 0xff, 0x3b, 0x32, 0x54, 0xd5, 0x9b, 0x49, 0x92, 0x24, 0x49, 0x92, 0xe4,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x02, 0x20, 0x40, 0x20, 0x00, 0x00, 0x06, 0x50, 0x0c, 0x62, 0x0c, 0x43, 0x18, 0xc1, 0xc8,
+		0xe8, 0xa8, 0x51, 0x80, 0xd5, 0xa8, 0x10, 0xf0, 0x36, 0xe0, 0xf7, 0x33, 0x12, 0xf8, 0xff, 0xff, 0x12, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x10, 0x00, 0x04, 0x00, 0x01, 0x40, 0x00, 0x10, 0x00, 0x04, 0x00, 0x02, 0x40, 0x00, 0x10, 0x00, 0x04, 0x00, 0x01, 0x40, 0x00, 0x10,
+		0x00, 0xe8, 0xb6, 0x7d, 0x0a, 0x24, 0x6c, 0xd8, 0xb0, 0x61, 0xc3, 0x86, 0x0d, 0x1b, 0x36, 0xec, 0xb0, 0x43, 0x02, 0x09, 0x40, 0xa4, 0x94, 0x02,
+		0x00, 0x52, 0x8d, 0x0b, 0x04, 0xf0, 0x39, 0x32, 0x8b, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x40, 0x80, 0xd5, 0x54, 0x01, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x94, 0x02, 0x00, 0x52, 0x8d, 0x0b, 0x04, 0xf0, 0x39, 0xb2, 0x93, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x80, 0xd5, 0x54, 0x01, 0x00, 0x21, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+		0x0c, 0x06, 0x00, 0x56, 0xd0, 0x19, 0x0a, 0xb0, 0x55, 0x63, 0xc9, 0x8c, 0x6c, 0x2b, 0x93, 0x80, 0x1c, 0x10, 0x00, 0x09, 0x00, 0x19, 0x00, 0xff,
+		0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07,
+		0x41, 0xcc, 0x88, 0x59, 0x00, 0x14, 0x12, 0x66, 0x84, 0x11, 0x61, 0x42, 0x98, 0x09, 0xb3, 0x00, 0x28, 0x64, 0x66, 0x66, 0x26, 0xfc, 0xff, 0xff,
+		0x3f, 0xa2, 0x4c, 0x28, 0x33, 0x65, 0x16, 0x00, 0x85, 0x90, 0x19, 0x64, 0x04, 0x99, 0x40, 0x66, 0xc8, 0x2c, 0x00, 0x0a, 0x19, 0x33, 0xc6, 0x88,
+		0x31, 0x61, 0xcc, 0x8c, 0x59, 0x00, 0x14, 0x22, 0x66, 0x88, 0x11, 0x62, 0x02, 0x80, 0xd4, 0xa8, 0x10, 0xe8, 0x3a, 0xf0, 0xb5, 0xf6, 0x0c, 0x12,
+		0xf8, 0xff, 0xff, 0x1c, 0x7f, 0x91, 0xdf, 0x6d, 0xe3, 0x77, 0x66, 0xec, 0xa6, 0xfc, 0xb4, 0xf2, 0xbb, 0x59, 0x36, 0xce, 0x98, 0x3d, 0x89, 0xfd,
+		0xdc, 0xbd, 0x7e, 0xe6, 0x46, 0x76, 0xcb, 0xdb, 0x40, 0xa3, 0xfc, 0xb3, 0x90, 0x7a, 0x16, 0xd2, 0xce, 0x42, 0x62, 0x39, 0x0b, 0x20, 0x29, 0x00,
+		0x40, 0x40, 0x00, 0x41, 0x00, 0x48, 0x00, 0xc0, 0x00, 0x40, 0x02, 0x40, 0x10, 0x20, 0x40, 0x20, 0x00, 0x42, 0x00, 0x50, 0x00, 0xa0, 0x00, 0x20,
+		0x04, 0x20, 0xd1, 0x79, 0x5c, 0x08, 0x00, 0x56, 0x1a, 0x2c, 0x0a, 0xc0, 0x35, 0x07, 0xdd, 0x44, 0x84, 0x24, 0xae, 0x3a, 0x33, 0x30, 0x00, 0x23,
+		0x00, 0x29, 0x00, 0x73, 0xce, 0x39, 0xe7, 0xac, 0xd5, 0x6a, 0xb5, 0x5a, 0xad, 0x56, 0xab, 0xd5, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2, 0xc2,
+		0xc2, 0xc2, 0xc0, 0x06, 0x68, 0x04, 0x2c, 0xc0, 0x06, 0x13, 0x6c, 0x60, 0x15, 0x00, 0x8d, 0xd0, 0x82, 0x36, 0x4d, 0xda, 0x68, 0x15, 0x00, 0x8d,
+		0xcc, 0x62, 0x16, 0xe3, 0x38, 0x8e, 0xe3, 0x38, 0x8e, 0xe3, 0x28, 0x8a, 0xa2, 0x28, 0x8a, 0xa2, 0x28, 0x8a, 0x61, 0x18, 0x86, 0x61, 0x18, 0x86,
+		0x61, 0xb8, 0xbb, 0xbb, 0xbb, 0xbb, 0xab, 0xaa, 0xaa, 0xaa, 0xaa, 0x3a, 0xe7, 0x0c, 0xbb, 0xfb, 0xde, 0x7b, 0xef, 0xbd, 0xf7, 0xde, 0x65, 0x59,
+		0x96, 0x65, 0x59, 0x96, 0x65, 0x19, 0x0c, 0x06, 0x83, 0xc1, 0x08, 0x06, 0x83, 0x41, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0x40, 0x20, 0x90, 0x24,
+		0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x03, 0x34, 0x4d, 0xd3, 0xf4, 0x3c, 0xcf, 0xf3, 0x3c, 0xcf, 0xf3, 0x3c, 0xcb, 0xb2, 0x2c, 0xcb, 0xb2, 0x2c,
+		0xcb, 0x72, 0x1c, 0xc7, 0x71, 0x1c, 0xc7, 0x71, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xbb, 0xbb, 0x1b, 0x80, 0xd5, 0xa8, 0x20, 0x46, 0x1f,
+		0xe0, 0x35, 0x96, 0xed, 0x12, 0xf8, 0x13, 0x04, 0x5e, 0x41, 0xe0, 0x07, 0xf1, 0x07, 0x10, 0x20, 0x01, 0x14, 0x84, 0x42, 0x88, 0x84, 0x40, 0x08,
+		0x0a, 0x21, 0x11, 0x82, 0xe1, 0x9b, 0x37, 0x50, 0x01, 0x00, 0x10, 0x00, 0xa1, 0x10, 0x22, 0x21, 0x18, 0x84, 0x42, 0x08, 0x84, 0x60, 0x08, 0x8a,
+		0x20, 0x0a, 0xc2, 0x20, 0xaa, 0x44, 0xf9, 0xd5, 0x0b, 0xee, 0xde, 0x7b, 0xb9, 0x64, 0x29, 0x25, 0x4a, 0x93, 0xf7, 0xde, 0xee, 0x7d, 0xf9, 0xd2,
+		0x64, 0x49, 0x29, 0xdd, 0x7b, 0xef, 0x6d, 0x99, 0x9f, 0x32, 0xe4, 0x06, 0x00, 0x66, 0x95, 0x22, 0x0a, 0xc0, 0x35, 0x07, 0x44, 0x48, 0x4b, 0x29,
+		0xf9, 0xbf, 0xb8, 0x26, 0x00, 0x1b, 0x00, 0x22, 0x00, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x81, 0xb5, 0x5a, 0xad, 0x56, 0xab, 0xd5, 0x6a, 0xb5,
+		0x5a, 0x04, 0x8d, 0x46, 0xa3, 0xd1, 0x68, 0x34, 0x1a, 0x6d, 0x36, 0x9b, 0xcd, 0x66, 0xb3, 0xd9, 0x6c, 0x36, 0x93, 0xc9, 0x64, 0x32, 0x59, 0xc1,
+		0xdd, 0xdd, 0xdd, 0xdd, 0x5d, 0x55, 0x55, 0x55, 0x55, 0xd5, 0x39, 0xe7, 0x9c, 0x73, 0xce, 0x39, 0xc3, 0x30, 0x0c, 0xc3, 0x30, 0x0c, 0xc3, 0x10,
+		0x08, 0x0c, 0x65, 0x59, 0x96, 0x24, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x39, 0x8e, 0xe3, 0x38, 0x8e, 0xe3, 0x38, 0x8e, 0xa2, 0x28, 0x8a, 0xa2,
+		0x28, 0x8a, 0xa2, 0x18, 0x0c, 0x06, 0x83, 0xc1, 0x60, 0x30, 0x18, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xaa, 0x01, 0x80, 0xd5, 0xac, 0x10, 0x68, 0x7e, 0xe0, 0xd9, 0x6b, 0x0e, 0x95, 0x5f, 0xdd, 0xf2,
+		0xcb, 0x6b, 0x7e, 0x79, 0xe5, 0x57, 0xaf, 0x7c, 0xeb, 0x95, 0xbb, 0xbc, 0x72, 0xd7, 0x57, 0xfa, 0x7a, 0x4b, 0x5f, 0xaf, 0xf8, 0xeb, 0xd5, 0xf3,
+		0xe7, 0xb6, 0x02, 0x14, 0x20, 0x80, 0x02, 0x02, 0x18, 0x40, 0x80, 0x01, 0x04, 0x24, 0x40, 0x00, 0x02, 0x08, 0x21, 0x80, 0x04, 0x04, 0x88, 0x40,
+		0x00, 0x05, 0x04, 0x20, 0xc6, 0x76, 0x65, 0x25, 0x26, 0x28, 0x01, 0x06, 0x12, 0x40, 0xb4, 0x4e, 0x07, 0x94, 0x03, 0x00, 0x62, 0xcd, 0x0d, 0x09,
+		0xd0, 0xa5, 0x03, 0x00, 0xc8, 0x4f, 0x01, 0x0f, 0x01, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x54, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x48, 0x92, 0x24,
+		0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x80, 0xd5, 0xb8, 0x20, 0xbe, 0x01, 0x12, 0xf8, 0xff, 0x7f, 0xfd, 0x07, 0xff, 0xfe, 0xed, 0xf7, 0xef, 0xbd,
+		0x7f, 0xbf, 0xfd, 0xfd, 0xe7, 0xef, 0xbf, 0x02, 0xb7, 0x47, 0x5b, 0xb8, 0xff, 0xff, 0xed, 0xf7, 0xef, 0xbd, 0x7f, 0xbf, 0xfd, 0xfd, 0xe7, 0xef,
+		0x5f, 0xfb, 0xfe, 0x9b, 0x42, 0x12, 0x60, 0x4b, 0xf9, 0xfe, 0xff, 0xf7, 0x75, 0xe0, 0x04, 0x19, 0x00, 0xea, 0x4f, 0xfc, 0x07, 0x0a, 0xb0, 0xb5,
+		0x0d, 0x52, 0x9a, 0xb5, 0x4d, 0x35, 0x8c, 0x9e, 0x82, 0x00, 0x78, 0x00, 0x7a, 0x00, 0x95, 0x4a, 0xa5, 0xd1, 0x68, 0x34, 0x1a, 0x8d, 0x46, 0xa3,
+		0xd1, 0x68, 0x59, 0x96, 0x65, 0x59, 0x96, 0x65, 0x59, 0x92, 0x24, 0x49, 0x92, 0x24, 0x49, 0x92, 0xe4, 0x38, 0x8e, 0xe3, 0x38, 0x8e, 0xe3, 0x38,
+		0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0e, 0x87, 0xc3, 0xe1,
+		0x70, 0x38, 0x1c, 0x0e, 0x87, 0xa2, 0x28, 0x8a, 0xa2, 0x28, 0x8a, 0xa2, 0x38, 0xe7, 0x9c, 0x73, 0xce, 0x39, 0xa7, 0x50, 0x28, 0x14, 0x21, 0x49,
+		0x92, 0x24, 0x49, 0x92, 0xdc, 0xb6, 0x6d, 0xdb, 0xb6, 0x6d, 0xdb, 0xb6, 0x6d, 0xdb, 0xb6, 0x6d, 0xdb, 0xb6, 0x6d, 0xdb, 0xb6, 0x6d, 0xdb, 0xb6,
+		0x6d, 0xdb, 0xb6, 0x6d, 0xdb, 0xb6, 0x6d, 0xdb, 0xb6, 0x6d, 0xdb, 0xb6, 0x6d, 0xdb, 0xb6, 0x6d, 0xdb, 0xb6, 0x10, 0x42, 0x08, 0x21, 0x84, 0x10,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x1c, 0xc7,
+		0x71, 0x1c, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x11, 0x47, 0x1c, 0x71, 0xc4, 0x11, 0x47, 0x1c, 0x71, 0xc4, 0x11, 0x47,
+		0xdc, 0xb6, 0x6d, 0xdb, 0xb6, 0x6d, 0xdb, 0xb6, 0x2c, 0xcb, 0xb2, 0x2c, 0xcb, 0xb2, 0x2c, 0xbb, 0xae, 0xeb, 0xba, 0xae, 0xeb, 0xba, 0xae, 0xa1,
+		0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa1, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0xd3, 0xe9, 0x74, 0x3a, 0x9d,
+		0x4e, 0xa7, 0xd3, 0xa9, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xde, 0x7b, 0xef, 0xbd, 0xf7, 0xc6, 0x95, 0x4a, 0xa5, 0x52, 0xa9, 0x54, 0x02,
+		0x92, 0x24, 0x49, 0x6b, 0xad, 0xb5, 0xd6, 0x5a, 0x6b, 0x89, 0x44, 0x22, 0x91, 0x48, 0x24, 0x12, 0x89, 0x44, 0xa1, 0x50, 0x28, 0x14, 0x0a, 0x85,
+		0x42, 0xa1, 0x50, 0xef, 0xbd, 0xf7, 0xde, 0x7b, 0xef, 0x9c, 0x73, 0xce, 0x39, 0xe7, 0x9c, 0xef, 0xbd, 0xf7, 0xde, 0x7b, 0xef, 0x1d, 0x0e, 0x87,
+		0xc3, 0xe1, 0x70, 0x38, 0x1c, 0x0e, 0x83, 0xc1, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x83, 0xc1, 0xf3, 0x3c, 0xcf, 0xf3, 0x3c, 0xcf, 0xf3, 0xac, 0xb5,
+		0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+		0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xfc, 0xff, 0xff, 0xff,
+		0xff, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xcf, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x68, 0x34, 0x1a, 0x8d, 0x46, 0xa3, 0xd1, 0x68, 0x34, 0xcf, 0xf3, 0x3c, 0xcf, 0xf3, 0x3c, 0xcf,
+		0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x53, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x14, 0x45, 0x51, 0x14, 0x45, 0x51, 0x14, 0x35, 0x4d, 0xd3, 0x34, 0x4d, 0xd3, 0x34, 0x4d, 0x41, 0x41, 0x41, 0x41, 0x41,
+		0x41, 0x41, 0x41, 0x41, 0x41, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xa3, 0xd1, 0x68, 0x34, 0x1a, 0x8d, 0x64, 0x34, 0x92,
+		0x24, 0x49, 0x92, 0xa4, 0x83, 0x53, 0xa8, 0x22, 0x08, 0xfa, 0x03, 0xc2, 0x57, 0xaa, 0x2c, 0x73, 0x12, 0xf8, 0x13, 0x04, 0x5e, 0x41, 0xe0, 0x67,
+		0xf0, 0x07, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xfb, 0xff, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfb, 0xdf, 0xff, 0xff, 0xff, 0xbf,
+		0xfd, 0xff, 0xa3, 0xb7, 0x30, 0xea, 0x10, 0x04, 0x0a, 0x5a, 0xa2, 0x82, 0x60, 0x41, 0x25, 0x54, 0x10, 0x2c, 0xa8, 0x44, 0x05, 0x82, 0x05, 0x95,
+		0xa8, 0x20, 0xa8, 0xa0, 0x12, 0x15, 0x04, 0x0b, 0x54, 0xa2, 0x07, 0x23, 0x88, 0x02, 0x80, 0x20, 0xa4, 0xa0, 0x12, 0x15, 0x04, 0x2a, 0x54, 0xa2,
+		0x82, 0x40, 0x41, 0x49, 0x54, 0x10, 0x28, 0xa8, 0x44, 0x0a, 0x02, 0x05, 0x95, 0xa8, 0x40, 0xa0, 0xa0, 0x12, 0xb5, 0xfc, 0xde, 0xb5, 0xfe, 0xff,
+		0xff, 0xfe, 0x7f, 0xff, 0xff, 0xef, 0xff, 0xff, 0xf7, 0xff, 0xfe, 0xff, 0xff, 0x7f, 0xef, 0xff, 0xff, 0xff, 0x7f, 0xef, 0xff, 0xff, 0xff, 0xe9,
+		0xff, 0xfc, 0xa5, 0x73, 0xd7, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0xff,
+		0xbf, 0xf7, 0xff, 0xff, 0xff, 0xec, 0xb7, 0x30, 0xd1, 0x81, 0x15, 0x80, 0xa0, 0x0c, 0x95, 0x36, 0xd7, 0xe6, 0xda, 0x5c, 0x9b, 0x6b, 0x73, 0x6d,
+		0xae, 0xcd, 0xb5, 0xb9, 0x76, 0xee, 0x12, 0x15, 0x04, 0x05, 0x2b, 0xa1, 0x82, 0xa0, 0x60, 0x25, 0x2a, 0x10, 0x14, 0xac, 0x44, 0x05, 0x81, 0x82,
+		0x95, 0xa8, 0x60, 0xc4, 0xe8, 0xa4, 0x00, 0x20, 0x08, 0x29, 0xa8, 0x44, 0x05, 0x81, 0x0a, 0x95, 0xa8, 0x20, 0x50, 0x50, 0x12, 0x15, 0x04, 0x0a,
+		0x2a, 0x91, 0x82, 0x40, 0x41, 0x25, 0x2a, 0x10, 0x28, 0xa8, 0x44, 0x2d, 0x4f, 0xdc, 0x5d, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff,
+		0xff, 0x7f, 0xfb, 0xff, 0xff, 0xff, 0xdf, 0xef, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xdf, 0xff, 0xff, 0xef, 0xff, 0xfd, 0xff, 0xc5, 0x51,
+		0x2a, 0xcc, 0x05, 0x00, 0x96, 0x9a, 0x15, 0x07, 0xf0, 0x19, 0x03, 0x40, 0x4b, 0x51, 0x03, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xf9,
+		0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24, 0xff, 0x01, 0x81, 0xa9, 0xa8,
+		0x21, 0xfc, 0x06, 0xd1, 0xab, 0x33, 0x6d, 0x06, 0x22, 0x08, 0xfc, 0xff, 0x3f, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
+		0xff, 0xfd, 0xff, 0xff, 0x7f, 0x84, 0xfa, 0xf3, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff,
+		0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xbf, 0xc6, 0x14, 0xa4, 0x1a, 0x7f, 0xff, 0xf7, 0xfb, 0xfd,
+		0x3f, 0xff, 0xef, 0xdf, 0xfb, 0x7f, 0xfe, 0xd7, 0xff, 0xf7, 0x7f, 0x79, 0x85, 0x1f, 0xc0, 0xb7, 0xf5, 0xfb, 0xbb, 0x31, 0x22, 0x24, 0x06, 0x00,
+		0x66, 0x5c, 0x16, 0x07, 0xe0, 0x69, 0x0c, 0x41, 0x4f, 0xcc, 0x12, 0x1a, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f,
+		0x55, 0x55, 0x55, 0x55, 0x95, 0x52, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x14, 0x45, 0x51, 0x14, 0x51, 0x55, 0x55, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0x07, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x3f, 0x81, 0xaa, 0xac, 0x21,
+		0xec, 0x1e, 0xd1, 0xab, 0xd3, 0x1a, 0xff, 0xff, 0x7f, 0xfe, 0xbd, 0xfb, 0xdb, 0xf7, 0xd7, 0xdf, 0xbb, 0xbf, 0xfe, 0x7e, 0xfd, 0x5d, 0x97, 0x3f,
+		0xef, 0xf7, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x4a, 0xd3, 0xdc, 0xc6, 0xd9, 0xef, 0xdb, 0xff, 0xfd, 0x7f, 0xff, 0xbf, 0x7f, 0xdf,
+		0xff, 0xf7, 0x7f, 0x76, 0x7f, 0x4c, 0x4a, 0x29, 0x55, 0xa9, 0x4a, 0x29, 0xa5, 0x94, 0x52, 0x4a, 0x51, 0x4a, 0x29, 0xa5, 0x94, 0xb2, 0x26, 0xde,
+		0x67, 0x03, 0xd7, 0x04, 0x65, 0x02, 0x00, 0x33, 0xcd, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x17, 0x80, 0xd3, 0x68, 0x01, 0xe0, 0x0f, 0x12, 0xf8, 0xff, 0x57, 0x10,
+		0x18, 0xc1, 0x1f, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xfd, 0xff, 0xbf, 0xff, 0xff, 0xed, 0xff, 0xff, 0xfd, 0xff, 0x7b, 0xff, 0xff, 0xef, 0xff, 0xef,
+		0xfb, 0xff, 0x7f, 0xff, 0xdf, 0xdf, 0x7f, 0x74, 0xcc, 0x74, 0x05, 0x1b, 0xc0, 0x20, 0x11
+	};
+
+	// zstd -3: incompressible data stored as a raw block
+	const uint8 NoiseFrame[] = {
+		0x28, 0xb5, 0x2f, 0xfd, 0x04, 0x58, 0xc1, 0x12, 0x00, 0x6c, 0x4e, 0x74, 0x92, 0x13, 0x25, 0x22, 0x2e, 0x31, 0xa1, 0xcd, 0x13, 0xbe, 0x12, 0xed,
+		0x42, 0x69, 0x66, 0xce, 0x24, 0xfc, 0x23, 0xd7, 0xda, 0x8d, 0x20, 0x97, 0x61, 0x6a, 0x06, 0x95, 0x6e, 0xc2, 0x8a, 0xd4, 0x03, 0x13, 0x68, 0x28,
+		0xd4, 0x57, 0x1e, 0x3c, 0x5d, 0xee, 0x6e, 0x5e, 0xc0, 0x4a, 0x91, 0x11, 0x5f, 0x5d, 0x3b, 0x51, 0x3e, 0xc2, 0x53, 0xa4, 0x16, 0xad, 0x6e, 0xe5,
+		0x38, 0x94, 0x11, 0xd0, 0x28, 0x9a, 0xa3, 0x4c, 0xf5, 0xc0, 0x34, 0x7c, 0x59, 0xca, 0xf0, 0x84, 0x95, 0xf3, 0x61, 0x1b, 0x0b, 0x50, 0x68, 0xd5,
+		0x98, 0x04, 0xf9, 0x2e, 0xb7, 0x29, 0x99, 0x55, 0x57, 0x79, 0x99, 0xbe, 0x78, 0xc0, 0x10, 0x66, 0x87, 0x02, 0x99, 0xe5, 0x7f, 0x6c, 0xd2, 0x35,
+		0xbc, 0xfb, 0x8f, 0x44, 0x9d, 0xee, 0xe2, 0x3b, 0xe1, 0xec, 0xcc, 0x8c, 0xbf, 0xf5, 0xbf, 0xbe, 0xc2, 0x0b, 0xdb, 0xf8, 0x6b, 0x9c, 0xe5, 0x4f,
+		0x85, 0xb6, 0x07, 0xcf, 0x46, 0xe9, 0x4a, 0x4b, 0x2a, 0xfb, 0xd4, 0xe5, 0x8f, 0x4f, 0xe1, 0x5c, 0x11, 0x12, 0x82, 0x18, 0xa3, 0x2b, 0x18, 0xf7,
+		0x72, 0xdf, 0x8f, 0xd5, 0x7a, 0x47, 0x5b, 0xde, 0xe4, 0x74, 0x34, 0x93, 0x26, 0x5c, 0x91, 0x9d, 0xd9, 0x8b, 0xe6, 0x54, 0x59, 0x8a, 0x9d, 0x0f,
+		0x1f, 0x0e, 0xd4, 0x2a, 0xdd, 0xe0, 0xdc, 0xd8, 0x5e, 0x90, 0x6e, 0xad, 0x1c, 0xd9, 0xab, 0xea, 0x9e, 0xd3, 0xda, 0x88, 0x98, 0xdb, 0xe0, 0x03,
+		0xc1, 0x42, 0x7e, 0xeb, 0x72, 0xb8, 0x4d, 0x2c, 0x03, 0x77, 0x7b, 0x18, 0xe5, 0x2f, 0x43, 0x39, 0x7f, 0xb4, 0x2e, 0xd9, 0xca, 0x6a, 0x0b, 0x4d,
+		0xab, 0x6c, 0xaf, 0x06, 0x13, 0x7f, 0x6d, 0x55, 0xd9, 0xb9, 0x54, 0x01, 0x52, 0xf1, 0x2b, 0x8b, 0xb6, 0xe5, 0x2d, 0x3c, 0x32, 0x2e, 0x85, 0xf3,
+		0xcc, 0xe4, 0x88, 0xb0, 0xfb, 0x11, 0xb4, 0xdf, 0x02, 0xd6, 0x6c, 0x65, 0x10, 0x5f, 0x71, 0x6c, 0x19, 0x88, 0x20, 0xef, 0x72, 0x4c, 0x6e, 0x04,
+		0x2f, 0xf2, 0xa3, 0xec, 0x3c, 0xf6, 0xd9, 0xdc, 0x3e, 0xb8, 0x34, 0x89, 0x27, 0xe7, 0xde, 0x76, 0x9b, 0xab, 0xc9, 0xfd, 0x06, 0x95, 0x24, 0x1f,
+		0x7a, 0x47, 0x9a, 0x0b, 0x49, 0xe2, 0x4d, 0x6f, 0x67, 0x34, 0x95, 0x82, 0x7c, 0x9f, 0x79, 0xce, 0xcc, 0xc7, 0xe9, 0xbe, 0xc7, 0x03, 0xc1, 0xec,
+		0x6f, 0x81, 0x7e, 0x27, 0x6e, 0x37, 0xbe, 0x45, 0xf3, 0x8d, 0x7a, 0xaf, 0x50, 0xcb, 0x02, 0xa5, 0x55, 0x44, 0xbc, 0x55, 0x6a, 0x40, 0x9b, 0xa0,
+		0x6e, 0xaa, 0x61, 0xa7, 0x53, 0x7e, 0x95, 0x17, 0x76, 0xf1, 0x44, 0x39, 0xbf, 0x5d, 0x77, 0xb9, 0x7d, 0xf3, 0x77, 0x31, 0xfe, 0x1f, 0xc3, 0x7d,
+		0xf1, 0xba, 0xce, 0xbe, 0x7c, 0xf2, 0x79, 0x2a, 0x1d, 0xf9, 0x53, 0x9a, 0x42, 0x70, 0x92, 0xd1, 0xa6, 0x92, 0xd1, 0x8d, 0x71, 0x20, 0x87, 0x50,
+		0x0f, 0x10, 0x4b, 0xeb, 0xcc, 0xf5, 0xca, 0xcf, 0x34, 0x2d, 0x84, 0x13, 0x2d, 0xcc, 0x49, 0x45, 0xd0, 0x4c, 0x77, 0xf0, 0x0c, 0xf1, 0xf0, 0xf1,
+		0xf9, 0xfd, 0xdd, 0x7a, 0xfd, 0x98, 0x26, 0xe3, 0xa1, 0x7e, 0xad, 0x34, 0x31, 0x66, 0x4d, 0x73, 0x15, 0x36, 0x95, 0xae, 0xf2, 0xe8, 0x44, 0xc7,
+		0x80, 0x3a, 0x84, 0x02, 0x2a, 0x18, 0xe7, 0x50, 0x67, 0xca, 0x22, 0x59, 0xdb, 0xdd, 0x8c, 0x4b, 0x2c, 0xd3, 0x54, 0x65, 0xa5, 0x8a, 0x85, 0x42,
+		0x8d, 0x6c, 0xbb, 0xe6, 0x45, 0x5c, 0xa3, 0x8a, 0x24, 0x5b, 0x34, 0x27, 0x13, 0xfe, 0xaf, 0xc4, 0xe7, 0x90, 0x57, 0x80, 0x81, 0x06, 0xf0, 0x5f,
+		0xa8, 0xa7, 0xfa, 0xd4, 0xa1, 0x78, 0xaa, 0x12, 0x93, 0x69, 0xad, 0x13, 0x9e, 0x40, 0x9c, 0x65, 0xb5, 0x49, 0x3d, 0xb7, 0x3f, 0xba, 0x7f, 0x27,
+		0x72, 0xe8, 0x34, 0x49, 0x6a, 0x2c, 0x8c, 0xf7, 0x0b, 0x93, 0x55, 0xdb, 0x9c, 0x49, 0xf5, 0xbd, 0x20, 0xc3, 0x23, 0x8d, 0x74, 0xae, 0x68, 0x30,
+		0x2a, 0x9a, 0x59, 0x0b, 0x27, 0x66, 0x91, 0x50, 0xfe, 0x6a, 0x71, 0x0b, 0x0b, 0x67, 0x97, 0xeb, 0x50, 0x2f, 0x1f, 0xd1, 0x0f, 0x14, 0x9c, 0x1a,
+		0x2b, 0x12, 0xd4, 0xad, 0x3f, 0xbc, 0x3f, 0xc3, 0x7b, 0xe7, 0x3e, 0x79, 0x43, 0x18, 0x1c, 0x17, 0x86, 0xae, 0xc5, 0x1e, 0xde, 0xcf, 0x48, 0x13,
+		0x6c, 0x13, 0x0e, 0x0e, 0x71, 0xf3, 0xd8, 0x01, 0xad, 0x9b, 0x31, 0x6b, 0xc9
+	};
+
+	// zstd -1: a compressed block followed by rle blocks
+	const uint8 RunFrame[] = {
+		0x28, 0xb5, 0x2f, 0xfd, 0x04, 0x48, 0x54, 0x00, 0x00, 0x10, 0x41, 0x41, 0x01, 0x00, 0xfb, 0xff, 0x39, 0xc0, 0x02, 0x02, 0x00, 0x10, 0x41, 0x03,
+		0x9f, 0x04, 0x41, 0x78, 0xa4, 0xf1, 0x2f
+	};
+
+	// zstd -1 --no-check: single compressed block without checksum
+	const uint8 NoChecksumFrame[] = {
+		0x28, 0xb5, 0x2f, 0xfd, 0x00, 0x48, 0xf5, 0x05, 0x00, 0x62, 0x06, 0x12, 0x15, 0xb0, 0x27, 0x1d, 0x28, 0xce, 0xed, 0x5d, 0xc7, 0x19, 0x0d, 0x9d,
+		0x6c, 0x5b, 0xb3, 0x24, 0xa5, 0xe4, 0x17, 0xcc, 0xe8, 0x54, 0xff, 0xff, 0xff, 0xbf, 0x6d, 0xdb, 0xb6, 0xdd, 0xb6, 0x6d, 0xdb, 0x92, 0x24, 0x49,
+		0xf2, 0x1f, 0xd8, 0x82, 0x36, 0x40, 0x02, 0x88, 0x8a, 0xff, 0xb6, 0xdb, 0x92, 0x24, 0x89, 0x11, 0xc1, 0x1c, 0x75, 0x56, 0x56, 0xa7, 0x60, 0x8c,
+		0x50, 0x99, 0x39, 0xea, 0x8c, 0x50, 0x59, 0x19, 0x0e, 0xc6, 0x10, 0x01, 0x44, 0x20, 0xb0, 0x33, 0x4a, 0x07, 0x8c, 0x24, 0x2f, 0xc9, 0x22, 0x25,
+		0x79, 0x49, 0x36, 0x29, 0xc9, 0x4b, 0xb2, 0x48, 0x49, 0x5e, 0x92, 0x25, 0x25, 0xf2, 0x92, 0x2c, 0x29, 0x93, 0x97, 0x64, 0x49, 0x89, 0xbc, 0x24,
+		0x4b, 0x4a, 0xf2, 0x22, 0x59, 0x52, 0x92, 0x37, 0xc9, 0x92, 0x92, 0xbc, 0x24, 0xd9, 0xba, 0x90, 0x92, 0x0e, 0xf2, 0xce, 0x8d, 0x64, 0xe5, 0x4a,
+		0xca, 0x38, 0xc8, 0x0b, 0x37, 0x92, 0x7d, 0x2b, 0x29, 0xdd, 0x20, 0x6f, 0xdb, 0xc8, 0xc0, 0xf6, 0x8e, 0xc1, 0xa4, 0xbc, 0x13, 0x33, 0x29, 0xef,
+		0x62, 0x46, 0xca, 0xbb, 0x98, 0x95, 0xf2, 0x2e, 0x66, 0xa4, 0xbc, 0x8b, 0x99, 0x14, 0xef, 0x62, 0x26, 0xe5, 0xbb, 0x98, 0x49, 0xf1, 0x2e, 0x66,
+		0x52, 0xe0, 0xbb, 0x3c, 0xaf, 0x7d, 0x02
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeZstdReferenceFramesTest, "glTFRuntime.Zstd.ReferenceFrames", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeZstdReferenceFramesTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeZstdTests;
+
+	struct FReferenceFrame
+	{
+		const TCHAR* Name;
+		TArrayView<const uint8> Frame;
+		TArray64<uint8> Expected;
+	};
+
+	const TArray<FReferenceFrame> ReferenceFrames = {
+		{ TEXT("compressed blocks"), TextFrame, MakeText(3600) },
+		{ TEXT("raw block"), NoiseFrame, MakeNoise(600, 7) },
+		{ TEXT("rle blocks"), RunFrame, MakeRun(300000, 0x41) },
+		{ TEXT("no checksum"), NoChecksumFrame, MakeText(50) }
+	};
+
+	TArray64<uint8> AllFrames;
+	TArray64<uint8> AllExpected;
+
+	for (const FReferenceFrame& ReferenceFrame : ReferenceFrames)
+	{
+		TArray64<uint8> Uncompressed;
+		if (TestTrue(FString::Printf(TEXT("%s frame is decoded"), ReferenceFrame.Name), FglTFRuntimeParser::DecompressZstd(ReferenceFrame.Frame.GetData(), ReferenceFrame.Frame.Num(), Uncompressed)))
+		{
+			TestTrue(FString::Printf(TEXT("%s frame matches"), ReferenceFrame.Name), Uncompressed == ReferenceFrame.Expected);
+		}
+
+		AllFrames.Append(ReferenceFrame.Frame.GetData(), ReferenceFrame.Frame.Num());
+		AllExpected.Append(ReferenceFrame.Expected);
+	}
+
+	// concatenated frames are decoded in parallel
+	TArray64<uint8> Uncompressed;
+	if (TestTrue(TEXT("multiple frames are decoded"), FglTFRuntimeParser::DecompressZstd(AllFrames.GetData(), AllFrames.Num(), Uncompressed)))
+	{
+		TestTrue(TEXT("multiple frames match"), Uncompressed == AllExpected);
+	}
+
+	// a 1TB content size (that would have been reserved upfront) can not come from a few rle blocks
+	TArray64<uint8> ForgedFrame;
+	ForgedFrame.Append(RunFrame, 4);
+	// 8 bytes frame content size + checksum flag
+	ForgedFrame.Add(0xC4);
+	ForgedFrame.Add(RunFrame[5]);
+	for (int32 ByteIndex = 0; ByteIndex < 8; ByteIndex++)
+	{
+		ForgedFrame.Add(static_cast<uint8>((1ULL << 40) >> (ByteIndex * 8)));
+	}
+	ForgedFrame.Append(RunFrame + 6, UE_ARRAY_COUNT(RunFrame) - 6);
+	AddExpectedError(TEXT("Zstd decompression error"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestFalse(TEXT("forged content size is rejected"), FglTFRuntimeParser::DecompressZstd(ForgedFrame.GetData(), ForgedFrame.Num(), Uncompressed));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeZstdMaxUncompressedSizeTest, "glTFRuntime.Zstd.MaxUncompressedSize", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeZstdMaxUncompressedSizeTest::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeZstdTests;
+
+	// the rle frame has no content size: only the limit stops it
+	const TArray64<uint8> Run = MakeRun(300000, 0x41);
+	TArray64<uint8> Uncompressed;
+	if (TestTrue(TEXT("frame within the limit is decoded"), FglTFRuntimeParser::DecompressZstd(RunFrame, UE_ARRAY_COUNT(RunFrame), Uncompressed, Run.Num())))
+	{
+		TestTrue(TEXT("frame within the limit matches"), Uncompressed == Run);
+	}
+
+	AddExpectedError(TEXT("exceeds the limit"), EAutomationExpectedErrorFlags::Contains, 1);
+	AddExpectedError(TEXT("Zstd decompression error"), EAutomationExpectedErrorFlags::Contains, 1);
+	Uncompressed.Empty();
+	TestFalse(TEXT("frame over the limit is rejected"), FglTFRuntimeParser::DecompressZstd(RunFrame, UE_ARRAY_COUNT(RunFrame), Uncompressed, Run.Num() - 1));
+
+	// frames decoded in parallel are bounded as a whole
+	TArray64<uint8> Frames;
+	Frames.Append(RunFrame, UE_ARRAY_COUNT(RunFrame));
+	Frames.Append(RunFrame, UE_ARRAY_COUNT(RunFrame));
+	AddExpectedError(TEXT("Zstd frames exceed the limit"), EAutomationExpectedErrorFlags::Contains, 1);
+	Uncompressed.Empty();
+	TestFalse(TEXT("frames over the limit are rejected"), FglTFRuntimeParser::DecompressZstd(Frames.GetData(), Frames.Num(), Uncompressed, Run.Num() * 2 - 1));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeZstdDecodeBenchmark, "glTFRuntime.Zstd.DecodeBenchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FglTFRuntimeZstdDecodeBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeZstdTests;
+
+	// a single frame goes through the serial path, concatenated frames through the parallel one
+	TArray64<uint8> Frames;
+	TArray64<uint8> Expected;
+	for (int32 Copy = 0; Copy < 256; Copy++)
+	{
+		Frames.Append(TextFrame, UE_ARRAY_COUNT(TextFrame));
+		Frames.Append(RunFrame, UE_ARRAY_COUNT(RunFrame));
+	}
+	const TArray64<uint8> Text = MakeText(3600);
+	const TArray64<uint8> Run = MakeRun(300000, 0x41);
+	for (int32 Copy = 0; Copy < 256; Copy++)
+	{
+		Expected.Append(Text);
+		Expected.Append(Run);
+	}
+
+	TArray64<uint8> Uncompressed;
+	const double SingleFrameSeconds = MeasureBestSeconds(5, [&]()
+		{
+			Uncompressed.Reset();
+			FglTFRuntimeParser::DecompressZstd(TextFrame, UE_ARRAY_COUNT(TextFrame), Uncompressed);
+		});
+	TestTrue(TEXT("single frame matches"), Uncompressed == Text);
+	AddBenchmarkInfo(*this, TEXT("zstd single frame"), SingleFrameSeconds, Text.Num());
+
+	const double FramesSeconds = MeasureBestSeconds(5, [&]()
+		{
+			Uncompressed.Reset();
+			FglTFRuntimeParser::DecompressZstd(Frames.GetData(), Frames.Num(), Uncompressed);
+		});
+	TestTrue(TEXT("parallel frames match"), Uncompressed == Expected);
+	AddBenchmarkInfo(*this, TEXT("zstd parallel frames"), FramesSeconds, Expected.Num());
+
+	// the same content through zlib, as used by the gzip path
+	TArray<uint8> Compressed;
+	int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, Expected.Num());
+	Compressed.AddUninitialized(CompressedSize);
+	if (TestTrue(TEXT("zlib reference is compressed"), FCompression::CompressMemory(NAME_Zlib, Compressed.GetData(), CompressedSize, Expected.GetData(), Expected.Num())))
+	{
+		const double ZlibSeconds = MeasureBestSeconds(5, [&]()
+			{
+				FCompression::UncompressMemory(NAME_Zlib, Uncompressed.GetData(), Expected.Num(), Compressed.GetData(), CompressedSize);
+			});
+		TestTrue(TEXT("zlib reference matches"), Uncompressed == Expected);
+		AddBenchmarkInfo(*this, TEXT("zlib reference"), ZlibSeconds, Expected.Num());
+	}
+
+	return true;
+}
+
+#endif
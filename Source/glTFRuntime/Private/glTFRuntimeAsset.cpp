@@ -350,6 +350,23 @@ bool UglTFRuntimeAsset::LoadFromData(const uint8* DataPtr, int64 DataNum, const
 	return Parser != nullptr;
 }
 
+bool UglTFRuntimeAsset::LoadFromFArchive(TSharedRef<FArchive> Archive, const FglTFRuntimeConfig& LoaderConfig)
+{
+	// asset already loaded ?
+	if (Parser)
+	{
+		return false;
+	}
+
+	TSharedPtr<FglTFRuntimeParser> NewParser = FglTFRuntimeParser::FromFArchive(Archive, LoaderConfig);
+	if (!NewParser)
+	{
+		return false;
+	}
+
+	return SetParser(NewParser.ToSharedRef());
+}
+
 void UglTFRuntimeAsset::OnErrorProxy(const FString& ErrorContext, const FString& ErrorMessage)
 {
 	if (OnError.IsBound())
@@ -1666,6 +1683,13 @@ void UglTFRuntimeAsset::ClearCache()
 	}
 }
 
+int64 UglTFRuntimeAsset::TrimBuffers()
+{
+	GLTF_CHECK_PARSER(0);
+
+	return Parser->TrimBuffers();
+}
+
 bool UglTFRuntimeAsset::IsArchive() const
 {
 	GLTF_CHECK_PARSER(false);
@@ -1722,6 +1746,27 @@ TArray<FString> UglTFRuntimeAsset::GetErrors() const
 	return Parser->GetErrors();
 }
 
+FglTFRuntimeBuffersIOStats UglTFRuntimeAsset::GetBuffersIOStats() const
+{
+	GLTF_CHECK_PARSER(FglTFRuntimeBuffersIOStats());
+
+	return Parser->GetBuffersIOStats();
+}
+
+bool UglTFRuntimeAsset::GetAccessorView(const int32 AccessorIndex, FglTFRuntimeAccessorView& AccessorView)
+{
+	GLTF_CHECK_PARSER(false);
+
+	return Parser->GetAccessorView(AccessorIndex, AccessorView);
+}
+
+bool UglTFRuntimeAsset::GetMeshPrimitiveAccessorView(const int32 MeshIndex, const int32 PrimitiveIndex, const FString& AttributeName, FglTFRuntimeAccessorView& AccessorView)
+{
+	GLTF_CHECK_PARSER(false);
+
+	return Parser->GetMeshPrimitiveAccessorView(MeshIndex, PrimitiveIndex, AttributeName, AccessorView);
+}
+
 bool UglTFRuntimeAsset::MeshHasMorphTargets(const int32 MeshIndex) const
 {
 	GLTF_CHECK_PARSER(false);
@@ -0,0 +1,244 @@
+// Copyright 2020-2024, Roberto De Ioris.
+
+#include "glTFRuntimeAsyncFileReader.h"
+#include "Async/Async.h"
+#include "Async/AsyncFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/ScopeLock.h"
+
+FglTFRuntimeAsyncFileReader::FglTFRuntimeAsyncFileReader(const int32 InMaxInFlight, const int64 InMaxResidentBytes)
+{
+	MaxInFlight = FMath::Max(InMaxInFlight, 1);
+	InFlight = 0;
+	MaxResidentBytes = FMath::Max<int64>(InMaxResidentBytes, 0);
+	ResidentBytes = 0;
+	BytesRead = 0;
+}
+
+FglTFRuntimeAsyncFileReader::~FglTFRuntimeAsyncFileReader()
+{
+	TArray<TSharedRef<FFileRead, ESPMode::ThreadSafe>> PendingReads;
+	{
+		FScopeLock ScopeLock(&Lock);
+		Reads.GenerateValueArray(PendingReads);
+		Reads.Empty();
+		Queue.Empty();
+	}
+
+	// requests must be completed before being deleted
+	for (TSharedRef<FFileRead, ESPMode::ThreadSafe>& FileRead : PendingReads)
+	{
+		ReleaseRead(*FileRead);
+	}
+}
+
+void FglTFRuntimeAsyncFileReader::Enqueue(const FString& Filename)
+{
+	FScopeLock ScopeLock(&Lock);
+	if (Reads.Contains(Filename))
+	{
+		return;
+	}
+
+	TSharedRef<FFileRead, ESPMode::ThreadSafe> FileRead = MakeShared<FFileRead, ESPMode::ThreadSafe>();
+	FileRead->Filename = Filename;
+	Reads.Add(Filename, FileRead);
+	Queue.Add(FileRead);
+}
+
+void FglTFRuntimeAsyncFileReader::StartPending()
+{
+	FScopeLock ScopeLock(&Lock);
+	while (InFlight < MaxInFlight && Queue.Num() > 0)
+	{
+		TSharedRef<FFileRead, ESPMode::ThreadSafe> FileRead = Queue[0];
+		if (FileRead->FileSize < 0)
+		{
+			FileRead->FileSize = IFileManager::Get().FileSize(*FileRead->Filename);
+		}
+
+		// the next read waits for the consumers (a single file bigger than the limit is still read when nothing else is resident)
+		if (ResidentBytes > 0 && ResidentBytes + FileRead->FileSize > MaxResidentBytes)
+		{
+			break;
+		}
+
+		Queue.RemoveAt(0);
+		StartRead(FileRead);
+	}
+}
+
+void FglTFRuntimeAsyncFileReader::Reset()
+{
+	TArray<TSharedRef<FFileRead, ESPMode::ThreadSafe>> DroppedReads;
+	{
+		FScopeLock ScopeLock(&Lock);
+		Reads.GenerateValueArray(DroppedReads);
+		Reads.Empty();
+		Queue.Empty();
+	}
+
+	for (TSharedRef<FFileRead, ESPMode::ThreadSafe>& FileRead : DroppedReads)
+	{
+		ReleaseRead(*FileRead);
+
+		FScopeLock ScopeLock(&Lock);
+		if (FileRead->bStarted)
+		{
+			ResidentBytes -= FileRead->Data.Num();
+		}
+		FileRead->Data.Empty();
+	}
+}
+
+bool FglTFRuntimeAsyncFileReader::Consume(const FString& Filename, TArray64<uint8>& OutData)
+{
+	TSharedPtr<FFileRead, ESPMode::ThreadSafe> FileRead;
+	{
+		FScopeLock ScopeLock(&Lock);
+		TSharedRef<FFileRead, ESPMode::ThreadSafe>* FoundFileRead = Reads.Find(Filename);
+		if (!FoundFileRead)
+		{
+			return false;
+		}
+
+		FileRead = *FoundFileRead;
+		Reads.Remove(Filename);
+
+		// the caller is going to wait for this file, so it is started even if it exceeds the limit
+		if (!FileRead->bStarted)
+		{
+			Queue.Remove(FileRead.ToSharedRef());
+			StartRead(FileRead.ToSharedRef());
+		}
+	}
+
+	ReleaseRead(*FileRead);
+
+	bool bSuccess = false;
+	{
+		FScopeLock ScopeLock(&Lock);
+		bSuccess = FileRead->bSuccess;
+	}
+
+	{
+		FScopeLock ScopeLock(&Lock);
+		ResidentBytes -= FileRead->Data.Num();
+	}
+
+	if (bSuccess)
+	{
+		OutData = MoveTemp(FileRead->Data);
+	}
+	else
+	{
+		FileRead->Data.Empty();
+	}
+
+	StartPending();
+
+	return bSuccess;
+}
+
+int64 FglTFRuntimeAsyncFileReader::GetBytesRead() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return BytesRead;
+}
+
+int64 FglTFRuntimeAsyncFileReader::GetResidentBytes() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return ResidentBytes;
+}
+
+void FglTFRuntimeAsyncFileReader::StartRead(TSharedRef<FFileRead, ESPMode::ThreadSafe> FileRead)
+{
+	FileRead->bStarted = true;
+
+	if (FileRead->FileSize < 0)
+	{
+		FileRead->FileSize = IFileManager::Get().FileSize(*FileRead->Filename);
+	}
+
+	const int64 FileSize = FileRead->FileSize;
+	if (FileSize < 0)
+	{
+		return;
+	}
+
+	if (FileSize == 0)
+	{
+		FileRead->bSuccess = true;
+		return;
+	}
+
+	FileRead->Handle = FPlatformFileManager::Get().GetPlatformFile().OpenAsyncRead(*FileRead->Filename);
+	if (!FileRead->Handle)
+	{
+		return;
+	}
+
+	FileRead->Data.SetNumUninitialized(FileSize);
+	ResidentBytes += FileSize;
+	InFlight++;
+
+	TWeakPtr<FglTFRuntimeAsyncFileReader, ESPMode::ThreadSafe> WeakThis = AsShared();
+	FAsyncFileCallBack Callback = [WeakThis, FileRead](bool bWasCancelled, IAsyncReadRequest* Request)
+		{
+			const bool bSuccess = !bWasCancelled && Request->GetReadResults() != nullptr;
+			TSharedPtr<FglTFRuntimeAsyncFileReader, ESPMode::ThreadSafe> This = WeakThis.Pin();
+			if (This)
+			{
+				This->OnReadCompleted(FileRead, bSuccess);
+			}
+			else
+			{
+				FileRead->bSuccess = bSuccess;
+			}
+		};
+
+	// the data is read directly in the final array
+	FileRead->Request = FileRead->Handle->ReadRequest(0, FileSize, AIOP_Normal, &Callback, FileRead->Data.GetData());
+}
+
+void FglTFRuntimeAsyncFileReader::OnReadCompleted(TSharedRef<FFileRead, ESPMode::ThreadSafe> FileRead, const bool bSuccess)
+{
+	{
+		FScopeLock ScopeLock(&Lock);
+		FileRead->bSuccess = bSuccess;
+		InFlight--;
+		if (bSuccess)
+		{
+			BytesRead += FileRead->Data.Num();
+		}
+	}
+
+	// new requests are not issued from the I/O callback
+	TWeakPtr<FglTFRuntimeAsyncFileReader, ESPMode::ThreadSafe> WeakThis = AsShared();
+	Async(EAsyncExecution::TaskGraph, [WeakThis]()
+		{
+			TSharedPtr<FglTFRuntimeAsyncFileReader, ESPMode::ThreadSafe> This = WeakThis.Pin();
+			if (This)
+			{
+				This->StartPending();
+			}
+		});
+}
+
+void FglTFRuntimeAsyncFileReader::ReleaseRead(FFileRead& FileRead)
+{
+	if (FileRead.Request)
+	{
+		FileRead.Request->WaitCompletion();
+		delete FileRead.Request;
+		FileRead.Request = nullptr;
+	}
+
+	if (FileRead.Handle)
+	{
+		delete FileRead.Handle;
+		FileRead.Handle = nullptr;
+	}
+}
@@ -0,0 +1,386 @@
+// Copyright 2020-2024, Roberto De Ioris.
+
+#include "glTFRuntimeDownloadCache.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "glTFRuntimeParser.h"
+#include "Misc/SecureHash.h"
+
+namespace glTFRuntimeDownloadCache
+{
+	FCriticalSection CachesLock;
+	TMap<FString, TSharedRef<FglTFRuntimeDownloadCache, ESPMode::ThreadSafe>> Caches;
+}
+
+TSharedRef<FglTFRuntimeDownloadCache, ESPMode::ThreadSafe> FglTFRuntimeDownloadCache::Get(const FString& CacheDirectory)
+{
+	using namespace glTFRuntimeDownloadCache;
+
+	const FString FullCacheDirectory = FPaths::ConvertRelativePathToFull(CacheDirectory);
+
+	FScopeLock ScopeLock(&CachesLock);
+	if (const TSharedRef<FglTFRuntimeDownloadCache, ESPMode::ThreadSafe>* Cache = Caches.Find(FullCacheDirectory))
+	{
+		return *Cache;
+	}
+
+	TSharedRef<FglTFRuntimeDownloadCache, ESPMode::ThreadSafe> Cache = MakeShared<FglTFRuntimeDownloadCache, ESPMode::ThreadSafe>(FullCacheDirectory);
+	Caches.Add(FullCacheDirectory, Cache);
+	return Cache;
+}
+
+void FglTFRuntimeDownloadCache::FlushAll()
+{
+	using namespace glTFRuntimeDownloadCache;
+
+	FScopeLock ScopeLock(&CachesLock);
+	for (const TPair<FString, TSharedRef<FglTFRuntimeDownloadCache, ESPMode::ThreadSafe>>& Pair : Caches)
+	{
+		Pair.Value->Flush();
+	}
+}
+
+FglTFRuntimeDownloadCache::FglTFRuntimeDownloadCache(const FString& InCacheDirectory) : CacheDirectory(InCacheDirectory)
+{
+	MaxSize = 256 * 1024 * 1024;
+	AccessTick = 0;
+	bIndexDirty = false;
+	LastIndexSaveTime = 0;
+	LoadIndex();
+}
+
+void FglTFRuntimeDownloadCache::SetMaxSize(const int64 InMaxSize)
+{
+	FScopeLock ScopeLock(&Lock);
+	MaxSize = InMaxSize;
+	if (Evict(""))
+	{
+		SaveIndex(true);
+	}
+}
+
+bool FglTFRuntimeDownloadCache::GetValidators(const FString& Url, FString& ETag, FString& LastModified) const
+{
+	FScopeLock ScopeLock(&Lock);
+	const FUrlEntry* UrlEntry = Urls.Find(Url);
+	if (!UrlEntry)
+	{
+		return false;
+	}
+
+	ETag = UrlEntry->ETag;
+	LastModified = UrlEntry->LastModified;
+	return true;
+}
+
+bool FglTFRuntimeDownloadCache::Load(const FString& Url, TArray64<uint8>& OutData)
+{
+	FString Hash;
+	int64 ExpectedSize = 0;
+	{
+		FScopeLock ScopeLock(&Lock);
+		const FUrlEntry* UrlEntry = Urls.Find(Url);
+		const FContentEntry* ContentEntry = UrlEntry ? Contents.Find(UrlEntry->Hash) : nullptr;
+		if (!ContentEntry)
+		{
+			return false;
+		}
+		Hash = UrlEntry->Hash;
+		ExpectedSize = ContentEntry->Size;
+	}
+
+	// reading and hashing happen without holding the lock
+	const bool bValid = FFileHelper::LoadFileToArray(OutData, *GetContentFilename(Hash), FILEREAD_Silent) && OutData.Num() == ExpectedSize && HashContent(OutData.GetData(), OutData.Num()) == Hash;
+
+	FScopeLock ScopeLock(&Lock);
+	if (!bValid)
+	{
+		UE_LOG(LogGLTFRuntime, Warning, TEXT("Discarding corrupted cache entry %s for %s"), *Hash, *Url);
+		Stats.CorruptedEntries++;
+		RemoveContent(Hash);
+		SaveIndex(true);
+		OutData.Empty();
+		return false;
+	}
+
+	Stats.Hits++;
+	if (FContentEntry* ContentEntry = Contents.Find(Hash))
+	{
+		ContentEntry->LastAccess = ++AccessTick;
+	}
+	// only the access order changed, losing it on a crash just affects the eviction order
+	SaveIndex(false);
+	return true;
+}
+
+void FglTFRuntimeDownloadCache::Store(const FString& Url, const uint8* DataPtr, const int64 DataNum, const FString& ETag, const FString& LastModified)
+{
+	const FString Hash = HashContent(DataPtr, DataNum);
+
+	bool bAlreadyStored = false;
+	{
+		FScopeLock ScopeLock(&Lock);
+		Stats.Misses++;
+		bAlreadyStored = Contents.Contains(Hash) && IFileManager::Get().FileSize(*GetContentFilename(Hash)) == DataNum;
+	}
+
+	// the content is written to a temporary file and then renamed, so a crash never leaves a truncated entry
+	if (!bAlreadyStored)
+	{
+		const FString ContentFilename = GetContentFilename(Hash);
+		const FString TempFilename = ContentFilename + FString::Printf(TEXT(".%u.tmp"), FPlatformTLS::GetCurrentThreadId());
+		if (!FFileHelper::SaveArrayToFile(TArrayView64<const uint8>(DataPtr, DataNum), *TempFilename) || !IFileManager::Get().Move(*ContentFilename, *TempFilename, true, true))
+		{
+			IFileManager::Get().Delete(*TempFilename, false, true, true);
+			UE_LOG(LogGLTFRuntime, Warning, TEXT("Unable to store %s in cache %s"), *Url, *CacheDirectory);
+			return;
+		}
+	}
+
+	FScopeLock ScopeLock(&Lock);
+
+	// the url could have been pointing to a different content
+	if (const FUrlEntry* OldUrlEntry = Urls.Find(Url))
+	{
+		const FString OldHash = OldUrlEntry->Hash;
+		Urls.Remove(Url);
+		if (OldHash != Hash)
+		{
+			bool bOldHashReferenced = false;
+			for (const TPair<FString, FUrlEntry>& Pair : Urls)
+			{
+				if (Pair.Value.Hash == OldHash)
+				{
+					bOldHashReferenced = true;
+					break;
+				}
+			}
+			if (!bOldHashReferenced)
+			{
+				RemoveContent(OldHash);
+			}
+		}
+	}
+
+	FUrlEntry& UrlEntry = Urls.Add(Url);
+	UrlEntry.Hash = Hash;
+	UrlEntry.ETag = ETag;
+	UrlEntry.LastModified = LastModified;
+
+	FContentEntry* ContentEntry = Contents.Find(Hash);
+	if (!ContentEntry)
+	{
+		ContentEntry = &Contents.Add(Hash);
+		ContentEntry->Size = DataNum;
+		Stats.TotalBytes += DataNum;
+	}
+	ContentEntry->LastAccess = ++AccessTick;
+
+	Evict(Hash);
+	SaveIndex(true);
+}
+
+void FglTFRuntimeDownloadCache::Flush()
+{
+	FScopeLock ScopeLock(&Lock);
+	if (bIndexDirty)
+	{
+		SaveIndex(true);
+	}
+}
+
+FglTFRuntimeDownloadCacheStats FglTFRuntimeDownloadCache::GetStats() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return Stats;
+}
+
+FString FglTFRuntimeDownloadCache::HashContent(const uint8* DataPtr, const int64 DataNum)
+{
+	// contents are shared by different urls, so the key must be collision resistant (not just a checksum)
+	FSHA1 SHA1;
+	SHA1.Update(DataPtr, DataNum);
+	SHA1.Final();
+	uint8 Digest[FSHA1::DigestSize];
+	SHA1.GetHash(Digest);
+	return BytesToHex(Digest, FSHA1::DigestSize).ToLower();
+}
+
+FString FglTFRuntimeDownloadCache::GetContentFilename(const FString& Hash) const
+{
+	return FPaths::Combine(CacheDirectory, Hash + TEXT(".bin"));
+}
+
+void FglTFRuntimeDownloadCache::LoadIndex()
+{
+	FString IndexData;
+	if (!FFileHelper::LoadFileToString(IndexData, *FPaths::Combine(CacheDirectory, TEXT("index.json")), FFileHelper::EHashOptions::None, FILEREAD_Silent))
+	{
+		return;
+	}
+
+	TSharedPtr<FJsonObject> JsonIndex;
+	TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(IndexData);
+	if (!FJsonSerializer::Deserialize(JsonReader, JsonIndex) || !JsonIndex.IsValid())
+	{
+		UE_LOG(LogGLTFRuntime, Warning, TEXT("Invalid cache index in %s, starting from scratch"), *CacheDirectory);
+		return;
+	}
+
+	const TSharedPtr<FJsonObject>* JsonContents;
+	if (JsonIndex->TryGetObjectField(TEXT("contents"), JsonContents))
+	{
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*JsonContents)->Values)
+		{
+			// entries hashed by older versions (xxHash64) can not be verified anymore
+			if (Pair.Key.Len() != FSHA1::DigestSize * 2)
+			{
+				IFileManager::Get().Delete(*GetContentFilename(Pair.Key), false, true, true);
+				continue;
+			}
+
+			const TSharedPtr<FJsonObject> JsonContent = Pair.Value->AsObject();
+			int64 Size = 0;
+			int64 LastAccess = 0;
+			// entries without a file (or with a different size) are ignored
+			if (!JsonContent || !JsonContent->TryGetNumberField(TEXT("size"), Size) || IFileManager::Get().FileSize(*GetContentFilename(Pair.Key)) != Size)
+			{
+				continue;
+			}
+			JsonContent->TryGetNumberField(TEXT("last_access"), LastAccess);
+
+			FContentEntry& ContentEntry = Contents.Add(Pair.Key);
+			ContentEntry.Size = Size;
+			ContentEntry.LastAccess = LastAccess;
+			AccessTick = FMath::Max(AccessTick, LastAccess);
+			Stats.TotalBytes += Size;
+		}
+	}
+
+	const TSharedPtr<FJsonObject>* JsonUrls;
+	if (JsonIndex->TryGetObjectField(TEXT("urls"), JsonUrls))
+	{
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*JsonUrls)->Values)
+		{
+			const TSharedPtr<FJsonObject> JsonUrl = Pair.Value->AsObject();
+			FString Hash;
+			if (!JsonUrl || !JsonUrl->TryGetStringField(TEXT("hash"), Hash) || !Contents.Contains(Hash))
+			{
+				continue;
+			}
+
+			FUrlEntry& UrlEntry = Urls.Add(Pair.Key);
+			UrlEntry.Hash = Hash;
+			JsonUrl->TryGetStringField(TEXT("etag"), UrlEntry.ETag);
+			JsonUrl->TryGetStringField(TEXT("last_modified"), UrlEntry.LastModified);
+		}
+	}
+}
+
+void FglTFRuntimeDownloadCache::SaveIndex(const bool bForce)
+{
+	bIndexDirty = true;
+
+	const double Now = FPlatformTime::Seconds();
+	if (!bForce && Now - LastIndexSaveTime < IndexSaveInterval)
+	{
+		return;
+	}
+
+	bIndexDirty = false;
+	LastIndexSaveTime = Now;
+
+	TSharedRef<FJsonObject> JsonContents = MakeShared<FJsonObject>();
+	for (const TPair<FString, FContentEntry>& Pair : Contents)
+	{
+		TSharedRef<FJsonObject> JsonContent = MakeShared<FJsonObject>();
+		JsonContent->SetNumberField(TEXT("size"), Pair.Value.Size);
+		JsonContent->SetNumberField(TEXT("last_access"), Pair.Value.LastAccess);
+		JsonContents->SetObjectField(Pair.Key, JsonContent);
+	}
+
+	TSharedRef<FJsonObject> JsonUrls = MakeShared<FJsonObject>();
+	for (const TPair<FString, FUrlEntry>& Pair : Urls)
+	{
+		TSharedRef<FJsonObject> JsonUrl = MakeShared<FJsonObject>();
+		JsonUrl->SetStringField(TEXT("hash"), Pair.Value.Hash);
+		JsonUrl->SetStringField(TEXT("etag"), Pair.Value.ETag);
+		JsonUrl->SetStringField(TEXT("last_modified"), Pair.Value.LastModified);
+		JsonUrls->SetObjectField(Pair.Key, JsonUrl);
+	}
+
+	TSharedRef<FJsonObject> JsonIndex = MakeShared<FJsonObject>();
+	JsonIndex->SetObjectField(TEXT("contents"), JsonContents);
+	JsonIndex->SetObjectField(TEXT("urls"), JsonUrls);
+
+	FString IndexData;
+	TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&IndexData);
+	FJsonSerializer::Serialize(JsonIndex, JsonWriter);
+
+	const FString IndexFilename = FPaths::Combine(CacheDirectory, TEXT("index.json"));
+	const FString TempFilename = IndexFilename + TEXT(".tmp");
+	if (!FFileHelper::SaveStringToFile(IndexData, *TempFilename) || !IFileManager::Get().Move(*IndexFilename, *TempFilename, true, true))
+	{
+		UE_LOG(LogGLTFRuntime, Warning, TEXT("Unable to save cache index in %s"), *CacheDirectory);
+	}
+}
+
+void FglTFRuntimeDownloadCache::RemoveContent(const FString& Hash)
+{
+	if (const FContentEntry* ContentEntry = Contents.Find(Hash))
+	{
+		Stats.TotalBytes -= ContentEntry->Size;
+		Contents.Remove(Hash);
+	}
+
+	for (auto It = Urls.CreateIterator(); It; ++It)
+	{
+		if (It.Value().Hash == Hash)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	IFileManager::Get().Delete(*GetContentFilename(Hash), false, true, true);
+}
+
+bool FglTFRuntimeDownloadCache::Evict(const FString& KeepHash)
+{
+	if (Stats.TotalBytes <= MaxSize)
+	{
+		return false;
+	}
+
+	Contents.ValueSort([](const FContentEntry& A, const FContentEntry& B) { return A.LastAccess < B.LastAccess; });
+
+	TArray<FString> EvictedHashes;
+	int64 TotalBytes = Stats.TotalBytes;
+	for (const TPair<FString, FContentEntry>& Pair : Contents)
+	{
+		if (TotalBytes <= MaxSize)
+		{
+			break;
+		}
+
+		if (Pair.Key != KeepHash)
+		{
+			EvictedHashes.Add(Pair.Key);
+			TotalBytes -= Pair.Value.Size;
+		}
+	}
+
+	for (const FString& Hash : EvictedHashes)
+	{
+		Stats.EvictedBytes += Contents[Hash].Size;
+		RemoveContent(Hash);
+	}
+
+	return EvictedHashes.Num() > 0;
+}
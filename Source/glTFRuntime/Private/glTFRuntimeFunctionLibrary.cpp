@@ -11,6 +11,7 @@
 #include "Misc/Base64.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
 #include "GenericPlatform/GenericPlatformProcess.h"
 #include "Runtime/Launch/Resources/Version.h"
 
@@ -335,6 +336,59 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromFileMapAsync(const TMap<FStri
 		});
 }
 
+namespace glTFRuntime
+{
+	// the response (or the cache file) is decoded and parsed in a background thread, only the asset setup and the callback run in the game thread
+	void LoadAssetFromHttpResponseAsync(FHttpResponsePtr ResponsePtr, const FString& CacheFilename, const bool bLoadFromCache, const FglTFRuntimeConfig& LoaderConfig, const FglTFRuntimeHttpResponse& Completed, const double StartTime)
+	{
+		UglTFRuntimeAsset* Asset = NewObject<UglTFRuntimeAsset>();
+		if (!Asset)
+		{
+			Completed.ExecuteIfBound(nullptr);
+			return;
+		}
+
+		Asset->RuntimeContextObject = LoaderConfig.RuntimeContextObject;
+		Asset->RuntimeContextString = LoaderConfig.RuntimeContextString;
+
+		// nobody references the asset until the callback is triggered
+		Asset->AddToRoot();
+
+		Async(EAsyncExecution::ThreadPool, [ResponsePtr, CacheFilename, bLoadFromCache, Asset, Completed, LoaderConfig, StartTime]()
+			{
+				TSharedPtr<FglTFRuntimeParser> Parser = nullptr;
+				if (bLoadFromCache)
+				{
+					Parser = FglTFRuntimeParser::FromFilename(CacheFilename, LoaderConfig);
+				}
+				else
+				{
+					const TArray<uint8>& Content = ResponsePtr->GetContent();
+					if (!CacheFilename.IsEmpty())
+					{
+						FFileHelper::SaveArrayToFile(Content, *CacheFilename);
+					}
+					Parser = FglTFRuntimeParser::FromData(Content.GetData(), Content.Num(), LoaderConfig);
+				}
+
+				// the pool worker is released right away instead of waiting for the game thread
+				AsyncTask(ENamedThreads::GameThread, [Parser, Asset, Completed, StartTime]()
+					{
+						Asset->RemoveFromRoot();
+						if (Parser.IsValid() && Asset->SetParser(Parser.ToSharedRef()))
+						{
+							Parser->SetDownloadTime(FPlatformTime::Seconds() - StartTime);
+							Completed.ExecuteIfBound(Asset);
+						}
+						else
+						{
+							Completed.ExecuteIfBound(nullptr);
+						}
+					});
+			});
+	}
+}
+
 void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUrl(const FString& Url, const TMap<FString, FString>& Headers, FglTFRuntimeHttpResponse Completed, const FglTFRuntimeConfig& LoaderConfig)
 {
 #if ENGINE_MAJOR_VERSION > 4 || ENGINE_MINOR_VERSION > 25
@@ -352,6 +406,19 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUrl(const FString& Url, const
 
 	HttpRequest->OnProcessRequestComplete().BindLambda([StartTime](FHttpRequestPtr RequestPtr, FHttpResponsePtr ResponsePtr, bool bSuccess, FglTFRuntimeHttpResponse Completed, const FglTFRuntimeConfig& LoaderConfig)
 		{
+			if (LoaderConfig.bParseHttpResponseAsync)
+			{
+				if (bSuccess && !IsGarbageCollecting())
+				{
+					glTFRuntime::LoadAssetFromHttpResponseAsync(ResponsePtr, "", false, LoaderConfig, Completed, StartTime);
+				}
+				else
+				{
+					Completed.ExecuteIfBound(nullptr);
+				}
+				return;
+			}
+
 			UglTFRuntimeAsset* Asset = nullptr;
 			if (bSuccess && !IsGarbageCollecting())
 			{
@@ -395,6 +462,23 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUrlWithCache(const FString& U
 
 	HttpRequest->OnProcessRequestComplete().BindLambda([StartTime, bCacheFileValid, bUseCacheOnError](FHttpRequestPtr RequestPtr, FHttpResponsePtr ResponsePtr, bool bSuccess, FglTFRuntimeHttpResponse Completed, const FglTFRuntimeConfig& LoaderConfig, const FString& CacheFilename)
 		{
+			if (LoaderConfig.bParseHttpResponseAsync)
+			{
+				if (!IsGarbageCollecting() && bSuccess)
+				{
+					glTFRuntime::LoadAssetFromHttpResponseAsync(ResponsePtr, CacheFilename, ResponsePtr->GetResponseCode() == 304 && bCacheFileValid, LoaderConfig, Completed, StartTime);
+				}
+				else if (!IsGarbageCollecting() && bCacheFileValid && bUseCacheOnError)
+				{
+					glTFRuntime::LoadAssetFromHttpResponseAsync(ResponsePtr, CacheFilename, true, LoaderConfig, Completed, StartTime);
+				}
+				else
+				{
+					Completed.ExecuteIfBound(nullptr);
+				}
+				return;
+			}
+
 			UglTFRuntimeAsset* Asset = nullptr;
 			if (!IsGarbageCollecting())
 			{
@@ -429,6 +513,155 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUrlWithCache(const FString& U
 	HttpRequest->ProcessRequest();
 }
 
+namespace glTFRuntime
+{
+	// runs in a worker thread when bParseHttpResponseAsync is set, bRetry is set when a 304 points to a corrupted entry
+	TSharedPtr<FglTFRuntimeParser> ParseContentCacheResponse(TSharedRef<FglTFRuntimeDownloadCache, ESPMode::ThreadSafe> Cache, const FString& Url, FHttpResponsePtr ResponsePtr, const bool bSuccess, const bool bUseCacheOnError, const FglTFRuntimeConfig& LoaderConfig, bool& bRetry)
+	{
+		bRetry = false;
+		TArray64<uint8> CachedData;
+
+		if (bSuccess && ResponsePtr.IsValid())
+		{
+			const int32 ResponseCode = ResponsePtr->GetResponseCode();
+			if (ResponseCode == EHttpResponseCodes::NotModified)
+			{
+				if (Cache->Load(Url, CachedData))
+				{
+					return FglTFRuntimeParser::FromData(CachedData.GetData(), CachedData.Num(), LoaderConfig);
+				}
+				bRetry = true;
+				return nullptr;
+			}
+
+			if (EHttpResponseCodes::IsOk(ResponseCode))
+			{
+				const TArray<uint8>& Content = ResponsePtr->GetContent();
+				Cache->Store(Url, Content.GetData(), Content.Num(), ResponsePtr->GetHeader("ETag"), ResponsePtr->GetHeader("Last-Modified"));
+				return FglTFRuntimeParser::FromData(Content.GetData(), Content.Num(), LoaderConfig);
+			}
+		}
+
+		if (bUseCacheOnError && Cache->Load(Url, CachedData))
+		{
+			return FglTFRuntimeParser::FromData(CachedData.GetData(), CachedData.Num(), LoaderConfig);
+		}
+
+		return nullptr;
+	}
+
+	void LoadAssetFromUrlWithContentCache(const FString& Url, TSharedRef<FglTFRuntimeDownloadCache, ESPMode::ThreadSafe> Cache, const TMap<FString, FString>& Headers, const bool bRevalidate, const bool bUseCacheOnError, const FglTFRuntimeHttpResponse& Completed, const FglTFRuntimeConfig& LoaderConfig)
+	{
+#if ENGINE_MAJOR_VERSION > 4 || ENGINE_MINOR_VERSION > 25
+		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
+#else
+		TSharedRef<IHttpRequest> HttpRequest = FHttpModule::Get().CreateRequest();
+#endif
+
+		HttpRequest->SetURL(Url);
+
+		FString ETag;
+		FString LastModified;
+		if (bRevalidate && Cache->GetValidators(Url, ETag, LastModified))
+		{
+			if (!ETag.IsEmpty())
+			{
+				HttpRequest->AppendToHeader("If-None-Match", ETag);
+			}
+			if (!LastModified.IsEmpty())
+			{
+				HttpRequest->AppendToHeader("If-Modified-Since", LastModified);
+			}
+		}
+
+		for (TPair<FString, FString> Header : Headers)
+		{
+			HttpRequest->AppendToHeader(Header.Key, Header.Value);
+		}
+
+		float StartTime = FPlatformTime::Seconds();
+
+		HttpRequest->OnProcessRequestComplete().BindLambda([Url, Cache, Headers, bRevalidate, bUseCacheOnError, StartTime](FHttpRequestPtr RequestPtr, FHttpResponsePtr ResponsePtr, bool bSuccess, FglTFRuntimeHttpResponse Completed, const FglTFRuntimeConfig& LoaderConfig)
+			{
+				if (IsGarbageCollecting())
+				{
+					Completed.ExecuteIfBound(nullptr);
+					return;
+				}
+
+				UglTFRuntimeAsset* Asset = NewObject<UglTFRuntimeAsset>();
+				if (!Asset)
+				{
+					Completed.ExecuteIfBound(nullptr);
+					return;
+				}
+
+				Asset->RuntimeContextObject = LoaderConfig.RuntimeContextObject;
+				Asset->RuntimeContextString = LoaderConfig.RuntimeContextString;
+
+				// game thread only
+				auto Finalize = [Url, Cache, Headers, bRevalidate, bUseCacheOnError, Completed, LoaderConfig, StartTime, Asset](TSharedPtr<FglTFRuntimeParser> Parser, const bool bRetry)
+					{
+						// the cached content is gone, download it again without validators (only once)
+						if (bRetry && bRevalidate)
+						{
+							LoadAssetFromUrlWithContentCache(Url, Cache, Headers, false, bUseCacheOnError, Completed, LoaderConfig);
+							return;
+						}
+
+						if (Parser.IsValid() && Asset->SetParser(Parser.ToSharedRef()))
+						{
+							Parser->SetDownloadTime(FPlatformTime::Seconds() - StartTime);
+							Completed.ExecuteIfBound(Asset);
+						}
+						else
+						{
+							Completed.ExecuteIfBound(nullptr);
+						}
+					};
+
+				if (LoaderConfig.bParseHttpResponseAsync)
+				{
+					Asset->AddToRoot();
+					Async(EAsyncExecution::ThreadPool, [Url, Cache, ResponsePtr, bSuccess, bUseCacheOnError, LoaderConfig, Asset, Finalize]()
+						{
+							bool bRetry = false;
+							TSharedPtr<FglTFRuntimeParser> Parser = ParseContentCacheResponse(Cache, Url, ResponsePtr, bSuccess, bUseCacheOnError, LoaderConfig, bRetry);
+
+							AsyncTask(ENamedThreads::GameThread, [Parser, bRetry, Asset, Finalize]()
+								{
+									Asset->RemoveFromRoot();
+									Finalize(Parser, bRetry);
+								});
+						});
+					return;
+				}
+
+				bool bRetry = false;
+				TSharedPtr<FglTFRuntimeParser> Parser = ParseContentCacheResponse(Cache, Url, ResponsePtr, bSuccess, bUseCacheOnError, LoaderConfig, bRetry);
+				Finalize(Parser, bRetry);
+			}, Completed, LoaderConfig);
+
+		HttpRequest->ProcessRequest();
+	}
+}
+
+void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUrlWithContentCache(const FString& Url, const FString& CacheDirectory, const int32 CacheSizeMB, const TMap<FString, FString>& Headers, const bool bUseCacheOnError, const FglTFRuntimeHttpResponse& Completed, const FglTFRuntimeConfig& LoaderConfig)
+{
+	TSharedRef<FglTFRuntimeDownloadCache, ESPMode::ThreadSafe> Cache = FglTFRuntimeDownloadCache::Get(CacheDirectory);
+	if (CacheSizeMB > 0)
+	{
+		Cache->SetMaxSize(static_cast<int64>(CacheSizeMB) * 1024 * 1024);
+	}
+
+	glTFRuntime::LoadAssetFromUrlWithContentCache(Url, Cache, Headers, true, bUseCacheOnError, Completed, LoaderConfig);
+}
+
+FglTFRuntimeDownloadCacheStats UglTFRuntimeFunctionLibrary::glTFGetContentCacheStats(const FString& CacheDirectory)
+{
+	return FglTFRuntimeDownloadCache::Get(CacheDirectory)->GetStats();
+}
+
 void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUrlWithProgress(const FString& Url, const TMap<FString, FString>& Headers, FglTFRuntimeHttpResponse Completed, FglTFRuntimeHttpProgress Progress, const FglTFRuntimeConfig& LoaderConfig)
 {
 #if ENGINE_MAJOR_VERSION > 4 || ENGINE_MINOR_VERSION > 25
@@ -446,6 +679,19 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUrlWithProgress(const FString
 
 	HttpRequest->OnProcessRequestComplete().BindLambda([StartTime](FHttpRequestPtr RequestPtr, FHttpResponsePtr ResponsePtr, bool bSuccess, FglTFRuntimeHttpResponse Completed, const FglTFRuntimeConfig& LoaderConfig)
 		{
+			if (LoaderConfig.bParseHttpResponseAsync)
+			{
+				if (bSuccess && !IsGarbageCollecting())
+				{
+					glTFRuntime::LoadAssetFromHttpResponseAsync(ResponsePtr, "", false, LoaderConfig, Completed, StartTime);
+				}
+				else
+				{
+					Completed.ExecuteIfBound(nullptr);
+				}
+				return;
+			}
+
 			UglTFRuntimeAsset* Asset = nullptr;
 			if (bSuccess && !IsGarbageCollecting())
 			{
@@ -475,6 +721,306 @@ void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUrlWithProgress(const FString
 	HttpRequest->ProcessRequest();
 }
 
+namespace glTFRuntime
+{
+	// glb received progressively: header and json chunk are accumulated, the binary chunk goes straight into a streaming buffer
+	class FHttpProgressiveState
+	{
+	public:
+		FHttpProgressiveState(UglTFRuntimeAsset* InAsset) : Asset(InAsset)
+		{
+			// the asset must survive until the download is completed
+			Asset->AddToRoot();
+			bParsed = false;
+			bDownloadCompleted = false;
+			bDownloadSuccess = false;
+			HeadNum = 20;
+			GlbNum = 0;
+			JsonNum = 0;
+			bIsGlb = true;
+			bHeadCompleted = false;
+		}
+
+		// called by the http thread, returns true when the glb header and json chunk have just been completed
+		bool Receive(const uint8* DataPtr, int64 DataNum)
+		{
+			FScopeLock ScopeLock(&Lock);
+
+			while (DataNum > 0)
+			{
+				// non glb data (or unsupported layout) is simply accumulated
+				if (!bIsGlb)
+				{
+					Head.Append(DataPtr, DataNum);
+					return false;
+				}
+
+				if (bHeadCompleted)
+				{
+					// anything after the binary chunk is ignored
+					if (BinaryBuffer)
+					{
+						BinaryBuffer->Append(DataPtr, DataNum);
+					}
+					return false;
+				}
+
+				const int64 HeadBytes = FMath::Min<int64>(DataNum, HeadNum - Head.Num());
+				Head.Append(DataPtr, HeadBytes);
+				DataPtr += HeadBytes;
+				DataNum -= HeadBytes;
+
+				if (Head.Num() < HeadNum)
+				{
+					return false;
+				}
+
+				// glb header and json chunk header ?
+				if (JsonNum == 0)
+				{
+					const uint8* HeadPtr = Head.GetData();
+					GlbNum = ReadUInt32(HeadPtr + 8);
+					JsonNum = ReadUInt32(HeadPtr + 12);
+					if (HeadPtr[0] != 0x67 || HeadPtr[1] != 0x6C || HeadPtr[2] != 0x54 || HeadPtr[3] != 0x46 ||
+						ReadUInt32(HeadPtr + 16) != 0x4E4F534A || JsonNum == 0 || JsonNum > MAX_int32 || 20 + JsonNum > GlbNum)
+					{
+						bIsGlb = false;
+						continue;
+					}
+
+					// include the binary chunk header (if any)
+					HeadNum = 20 + JsonNum + (GlbNum >= 20 + JsonNum + 8 ? 8 : 0);
+					continue;
+				}
+
+				if (HeadNum > 20 + JsonNum)
+				{
+					const uint8* ChunkPtr = Head.GetData() + 20 + JsonNum;
+					const int64 BinaryNum = ReadUInt32(ChunkPtr);
+					if (ReadUInt32(ChunkPtr + 4) != 0x004E4942 || HeadNum + BinaryNum > GlbNum)
+					{
+						bIsGlb = false;
+						continue;
+					}
+					BinaryBuffer = MakeShared<FglTFRuntimeStreamingBuffer>(BinaryNum);
+				}
+
+				bHeadCompleted = true;
+				if (DataNum > 0 && BinaryBuffer)
+				{
+					BinaryBuffer->Append(DataPtr, DataNum);
+				}
+				return true;
+			}
+
+			return false;
+		}
+
+		bool IsProgressive() const
+		{
+			FScopeLock ScopeLock(&Lock);
+			return bIsGlb && bHeadCompleted;
+		}
+
+		bool IsBinaryBufferComplete() const
+		{
+			FScopeLock ScopeLock(&Lock);
+			return !BinaryBuffer || BinaryBuffer->IsComplete();
+		}
+
+		TSharedPtr<FglTFRuntimeParser> CreateParser(const FglTFRuntimeConfig& LoaderConfig) const
+		{
+			// the json chunk is parsed from its UTF-8 bytes (honoring bUseUTF8JsonParser and bUseStreamingJsonParser)
+			TArray64<uint8> JsonData;
+			TSharedPtr<FglTFRuntimeStreamingBuffer> ParserBinaryBuffer;
+			{
+				FScopeLock ScopeLock(&Lock);
+				JsonData.Append(Head.GetData() + 20, JsonNum);
+				ParserBinaryBuffer = BinaryBuffer;
+			}
+
+			TSharedPtr<FglTFRuntimeParser> Parser = FglTFRuntimeParser::FromUTF8(JsonData.GetData(), JsonData.Num(), LoaderConfig);
+			if (Parser && ParserBinaryBuffer)
+			{
+				Parser->SetStreamingBinaryBuffer(ParserBinaryBuffer.ToSharedRef());
+			}
+			return Parser;
+		}
+
+		// valid only for non progressive loads after the download is completed
+		const TArray64<uint8>& GetContent() const
+		{
+			return Head;
+		}
+
+		// game thread only
+		void ReleaseAsset()
+		{
+			if (Asset)
+			{
+				Asset->RemoveFromRoot();
+				Asset = nullptr;
+			}
+		}
+
+		UglTFRuntimeAsset* Asset;
+		bool bParsed;
+		bool bDownloadCompleted;
+		bool bDownloadSuccess;
+
+	protected:
+		// the head is not guaranteed to be aligned at the chunk offsets
+		static uint32 ReadUInt32(const uint8* Ptr)
+		{
+			uint32 Value;
+			FMemory::Memcpy(&Value, Ptr, sizeof(uint32));
+			return Value;
+		}
+
+		mutable FCriticalSection Lock;
+		// non glb content is fully accumulated here, so it can exceed 2GB
+		TArray64<uint8> Head;
+		int64 HeadNum;
+		int64 GlbNum;
+		int64 JsonNum;
+		bool bIsGlb;
+		bool bHeadCompleted;
+		TSharedPtr<FglTFRuntimeStreamingBuffer> BinaryBuffer;
+	};
+
+	// game thread only, called once both the json has been parsed and the download is completed
+	void CompleteHttpProgressive(TSharedRef<FHttpProgressiveState, ESPMode::ThreadSafe> State, const FglTFRuntimeHttpResponse& Completed, const double DownloadTime)
+	{
+		UglTFRuntimeAsset* Asset = nullptr;
+		if (State->bDownloadSuccess && State->Asset && State->Asset->GetParser())
+		{
+			if (State->IsBinaryBufferComplete())
+			{
+				Asset = State->Asset;
+				Asset->GetParser()->SetDownloadTime(DownloadTime);
+			}
+			else
+			{
+				UE_LOG(LogGLTFRuntime, Error, TEXT("Incomplete glb binary chunk"));
+			}
+		}
+		State->ReleaseAsset();
+		Completed.ExecuteIfBound(Asset);
+	}
+}
+
+void UglTFRuntimeFunctionLibrary::glTFLoadAssetFromUrlProgressive(const FString& Url, const TMap<FString, FString>& Headers, FglTFRuntimeHttpResponse Ready, FglTFRuntimeHttpResponse Completed, FglTFRuntimeHttpProgress Progress, const FglTFRuntimeConfig& LoaderConfig)
+{
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 3
+	UglTFRuntimeAsset* Asset = NewObject<UglTFRuntimeAsset>();
+	if (!Asset)
+	{
+		Completed.ExecuteIfBound(nullptr);
+		return;
+	}
+
+	Asset->RuntimeContextObject = LoaderConfig.RuntimeContextObject;
+	Asset->RuntimeContextString = LoaderConfig.RuntimeContextString;
+
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
+	HttpRequest->SetURL(Url);
+	for (TPair<FString, FString> Header : Headers)
+	{
+		HttpRequest->AppendToHeader(Header.Key, Header.Value);
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	TSharedRef<glTFRuntime::FHttpProgressiveState, ESPMode::ThreadSafe> State = MakeShared<glTFRuntime::FHttpProgressiveState, ESPMode::ThreadSafe>(Asset);
+
+	// as soon as the json chunk is received, it is parsed in the background while the binary chunk is still downloading
+	auto OnReceived = [State, Ready, Completed, LoaderConfig, StartTime](const uint8* DataPtr, const int64 DataNum)
+		{
+			if (!State->Receive(DataPtr, DataNum))
+			{
+				return;
+			}
+
+			Async(EAsyncExecution::ThreadPool, [State, Ready, Completed, LoaderConfig, StartTime]()
+				{
+					TSharedPtr<FglTFRuntimeParser> Parser = State->CreateParser(LoaderConfig);
+
+					FFunctionGraphTask::CreateAndDispatchWhenReady([State, Parser, Ready, Completed, StartTime]()
+						{
+							State->bParsed = true;
+							if (Parser.IsValid() && State->Asset && State->Asset->SetParser(Parser.ToSharedRef()))
+							{
+								Ready.ExecuteIfBound(State->Asset);
+							}
+							else
+							{
+								State->ReleaseAsset();
+							}
+
+							if (State->bDownloadCompleted)
+							{
+								glTFRuntime::CompleteHttpProgressive(State, Completed, FPlatformTime::Seconds() - StartTime);
+							}
+						}, TStatId(), nullptr, ENamedThreads::GameThread);
+				});
+		};
+
+#if ENGINE_MINOR_VERSION >= 4
+	HttpRequest->SetResponseBodyReceiveStreamDelegateV2(FHttpRequestStreamDelegateV2::CreateLambda([OnReceived](void* Ptr, int64& Length)
+		{
+			OnReceived(static_cast<const uint8*>(Ptr), Length);
+		}));
+#else
+	HttpRequest->SetResponseBodyReceiveStreamDelegate(FHttpRequestStreamDelegate::CreateLambda([OnReceived](void* Ptr, int64 Length) -> bool
+		{
+			OnReceived(static_cast<const uint8*>(Ptr), Length);
+			return true;
+		}));
+#endif
+
+	HttpRequest->OnProcessRequestComplete().BindLambda([State, StartTime](FHttpRequestPtr RequestPtr, FHttpResponsePtr ResponsePtr, bool bSuccess, FglTFRuntimeHttpResponse Completed, const FglTFRuntimeConfig& LoaderConfig)
+		{
+			State->bDownloadCompleted = true;
+			State->bDownloadSuccess = bSuccess && !IsGarbageCollecting();
+
+			if (State->IsProgressive())
+			{
+				// the json could still be parsing, in such a case the completion is triggered by the parser task
+				if (State->bParsed)
+				{
+					glTFRuntime::CompleteHttpProgressive(State, Completed, FPlatformTime::Seconds() - StartTime);
+				}
+				return;
+			}
+
+			// non glb data is loaded as usual
+			UglTFRuntimeAsset* Asset = nullptr;
+			if (State->bDownloadSuccess && State->Asset && State->Asset->LoadFromData(State->GetContent(), LoaderConfig))
+			{
+				Asset = State->Asset;
+				Asset->GetParser()->SetDownloadTime(FPlatformTime::Seconds() - StartTime);
+			}
+			State->ReleaseAsset();
+			Completed.ExecuteIfBound(Asset);
+		}, Completed, LoaderConfig);
+
+	HttpRequest->OnRequestProgress64().BindLambda([](FHttpRequestPtr RequestPtr, uint64 BytesSent, uint64 BytesReceived, FglTFRuntimeHttpProgress Progress, const FglTFRuntimeConfig& LoaderConfig)
+		{
+			int32 ContentLength = 0;
+			if (RequestPtr->GetResponse().IsValid())
+			{
+				ContentLength = RequestPtr->GetResponse()->GetContentLength();
+			}
+			Progress.ExecuteIfBound(LoaderConfig, BytesReceived, ContentLength);
+		}, Progress, LoaderConfig);
+
+	HttpRequest->ProcessRequest();
+#else
+	UE_LOG(LogGLTFRuntime, Warning, TEXT("Progressive loading requires http body streaming (Unreal Engine 5.3), falling back to standard loading"));
+	glTFLoadAssetFromUrlWithProgress(Url, Headers, Completed, Progress, LoaderConfig);
+#endif
+}
+
 UglTFRuntimeAsset* UglTFRuntimeFunctionLibrary::glTFLoadAssetFromData(const TArray<uint8>& Data, const FglTFRuntimeConfig& LoaderConfig)
 {
 	UglTFRuntimeAsset* Asset = NewObject<UglTFRuntimeAsset>();
@@ -494,6 +1040,23 @@ UglTFRuntimeAsset* UglTFRuntimeFunctionLibrary::glTFLoadAssetFromData(const TArr
 	return Asset;
 }
 
+bool UglTFRuntimeFunctionLibrary::glTFProbeAssetFromFilename(const FString& Filename, const bool bPathRelativeToContent, const FglTFRuntimeConfig& LoaderConfig, FglTFRuntimeProbeInfo& ProbeInfo)
+{
+	FglTFRuntimeConfig OverrideConfig = LoaderConfig;
+
+	if (bPathRelativeToContent)
+	{
+		OverrideConfig.bSearchContentDir = true;
+	}
+
+	return FglTFRuntimeParser::ProbeFromFilename(Filename, OverrideConfig, ProbeInfo);
+}
+
+bool UglTFRuntimeFunctionLibrary::glTFProbeAssetFromData(const TArray<uint8>& Data, const FglTFRuntimeConfig& LoaderConfig, FglTFRuntimeProbeInfo& ProbeInfo)
+{
+	return FglTFRuntimeParser::ProbeFromData(Data.GetData(), Data.Num(), LoaderConfig, ProbeInfo);
+}
+
 bool UglTFRuntimeFunctionLibrary::glTFLoadAssetFromClipboard(FglTFRuntimeHttpResponse Completed, FString& ClipboardContent, const FglTFRuntimeConfig& LoaderConfig)
 {
 
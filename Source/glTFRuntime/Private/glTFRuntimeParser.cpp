@@ -5,6 +5,9 @@
 #include "Runtime/Launch/Resources/Version.h"
 #include "Engine/Texture2D.h"
 #include "GenericPlatform/GenericPlatformHttp.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/ThreadSafeCounter64.h"
 #include "Misc/FileHelper.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
@@ -19,7 +22,12 @@
 #include "Misc/Compression.h"
 #include "Misc/Crc.h"
 #include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
 #include "Interfaces/IPluginManager.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "zlib.h"
+THIRD_PARTY_INCLUDES_END
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 2
 #include "RenderMath.h"
 #else
@@ -44,6 +52,51 @@ FglTFRuntimeOnPreCreatedStaticMesh FglTFRuntimeParser::OnPreCreatedStaticMesh;
 FglTFRuntimeOnPostCreatedStaticMesh FglTFRuntimeParser::OnPostCreatedStaticMesh;
 FglTFRuntimeOnPreCreatedSkeletalMesh FglTFRuntimeParser::OnPreCreatedSkeletalMesh;
 
+namespace glTFRuntime
+{
+	bool GetBinaryChunks(const uint8* DataPtr, const int64 DataNum, const uint8*& JsonChunkPtr, int64& JsonChunkNum, const uint8*& BinaryChunkPtr, int64& BinaryChunkNum);
+
+	/*
+	* Exposes the de-interleaved accessors owned by a LoadPrimitives() call to the GetAccessor() calls of the same thread.
+	* Concurrent loads (even on the same parser) never see (or free) each other copies.
+	*/
+	class FDeinterleavedAccessorsScope
+	{
+	public:
+		FDeinterleavedAccessorsScope(const FglTFRuntimeParser* InParser, const TMap<int32, TArray64<uint8>>& InAccessors) : Parser(InParser), Accessors(InAccessors)
+		{
+			Previous = Current;
+			Current = this;
+		}
+
+		~FDeinterleavedAccessorsScope()
+		{
+			Current = Previous;
+		}
+
+		static const TArray64<uint8>* Find(const FglTFRuntimeParser* InParser, const int32 AccessorIndex)
+		{
+			for (const FDeinterleavedAccessorsScope* Scope = Current; Scope; Scope = Scope->Previous)
+			{
+				if (Scope->Parser == InParser)
+				{
+					return Scope->Accessors.Find(AccessorIndex);
+				}
+			}
+			return nullptr;
+		}
+
+	protected:
+		const FglTFRuntimeParser* Parser;
+		const TMap<int32, TArray64<uint8>>& Accessors;
+		FDeinterleavedAccessorsScope* Previous;
+
+		static thread_local FDeinterleavedAccessorsScope* Current;
+	};
+
+	thread_local FDeinterleavedAccessorsScope* FDeinterleavedAccessorsScope::Current = nullptr;
+}
+
 TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromFilename(const FString& Filename, const FglTFRuntimeConfig& LoaderConfig)
 {
 	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromFilename, FColor::Magenta);
@@ -79,14 +132,95 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromFilename(const FString& F
 		}
 	}
 
-	TArray64<uint8> Content;
-	if (!FFileHelper::LoadFileToArray(Content, *TruePath))
+	TSharedPtr<FglTFRuntimeParser> Parser = nullptr;
+
+	TSharedPtr<FglTFRuntimeMappedFile> MappedFile = LoaderConfig.bUseMappedFile ? FglTFRuntimeMappedFile::Open(TruePath) : nullptr;
+	if (MappedFile)
 	{
-		UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to load file %s"), *Filename);
-		return nullptr;
+		const uint8* DataPtr = MappedFile->GetData();
+		const int64 DataNum = MappedFile->Num();
+		// binary glTF can reference the mapping directly, everything else is decoded from it
+		if (!LoaderConfig.bAsBlob && DataNum > 20 && DataPtr[0] == 0x67 && DataPtr[1] == 0x6C && DataPtr[2] == 0x54 && DataPtr[3] == 0x46)
+		{
+			Parser = FromBinary(DataPtr, DataNum, LoaderConfig, nullptr, MappedFile);
+		}
+		else
+		{
+			Parser = FromData(DataPtr, DataNum, LoaderConfig, MappedFile);
+		}
 	}
+	else
+	{
+		bool bLoaded = false;
+		if (LoaderConfig.bUseMappedFile)
+		{
+			UE_LOG(LogGLTFRuntime, Warning, TEXT("Unable to map file %s, falling back to standard loading"), *Filename);
+
+			// zip and tar archives can still be accessed without loading the whole file
+			TSharedPtr<FglTFRuntimeFileDataSource> FileDataSource = LoaderConfig.bNoArchive ? nullptr : FglTFRuntimeFileDataSource::Open(TruePath);
+			if (FileDataSource)
+			{
+				bool bIsArchive = false;
+				TSharedPtr<FglTFRuntimeArchive> FileArchive = CreateArchive(FileDataSource.ToSharedRef(), LoaderConfig, bIsArchive);
+				if (bIsArchive)
+				{
+					if (!FileArchive)
+					{
+						return nullptr;
+					}
+					Parser = FromRawDataAndArchive(nullptr, 0, FileArchive, LoaderConfig);
+					bLoaded = true;
+				}
+			}
+		}
+
+		if (!bLoaded)
+		{
+			TArray64<uint8> Content;
+			if (!FFileHelper::LoadFileToArray(Content, *TruePath))
+			{
+				UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to load file %s"), *Filename);
+				return nullptr;
+			}
+
+			// archives take ownership of the loaded content instead of copying it
+			TSharedRef<FglTFRuntimeDataSource> ContentDataSource = MakeShared<FglTFRuntimeMemoryDataSource>(MoveTemp(Content));
+			bool bIsArchive = false;
+			TSharedPtr<FglTFRuntimeArchive> ContentArchive = CreateArchive(ContentDataSource, LoaderConfig, bIsArchive);
+			if (bIsArchive)
+			{
+				if (!ContentArchive)
+				{
+					return nullptr;
+				}
+				Parser = FromRawDataAndArchive(nullptr, 0, ContentArchive, LoaderConfig);
+				// TrimBuffers() can release the archive content
+				if (Parser)
+				{
+					Parser->ArchiveReloadSource = FglTFRuntimeFileDataSource::Open(TruePath);
+				}
+			}
+			else
+			{
+				TArray64<uint8> Scratch;
+				const uint8* ContentPtr = ContentDataSource->GetRange(0, ContentDataSource->Num(), Scratch);
+				Parser = FromData(ContentPtr, ContentDataSource->Num(), LoaderConfig);
 
-	TSharedPtr<FglTFRuntimeParser> Parser = FromData(Content.GetData(), Content.Num(), LoaderConfig);
+				// TrimBuffers() can release the binary chunk of a plain glb
+				if (Parser && Parser->BinaryBuffer && Parser->BinaryBuffer->Num() > 0 && ContentDataSource->Num() > 20 && ContentPtr[0] == 0x67 && ContentPtr[1] == 0x6C && ContentPtr[2] == 0x54 && ContentPtr[3] == 0x46)
+				{
+					const uint8* JsonChunkPtr = nullptr;
+					int64 JsonChunkNum = 0;
+					const uint8* BinaryChunkPtr = nullptr;
+					int64 BinaryChunkNum = 0;
+					if (glTFRuntime::GetBinaryChunks(ContentPtr, ContentDataSource->Num(), JsonChunkPtr, JsonChunkNum, BinaryChunkPtr, BinaryChunkNum) && BinaryChunkPtr)
+					{
+						Parser->BinaryChunkReloadSource = FglTFRuntimeFileDataSource::Open(TruePath, BinaryChunkPtr - ContentPtr, BinaryChunkNum);
+					}
+				}
+			}
+		}
+	}
 
 	if (Parser)
 	{
@@ -96,6 +230,11 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromFilename(const FString& F
 			Parser->BaseDirectory = FPaths::GetPath(TruePath);
 		}
 		Parser->BaseFilename = FPaths::GetBaseFilename(TruePath);
+
+		if (LoaderConfig.bPrefetchExternalFiles)
+		{
+			Parser->PrefetchExternalFiles(LoaderConfig.MaxExternalFilesReadsInFlight, static_cast<int64>(LoaderConfig.MaxExternalFilesResidentMB) * 1024 * 1024);
+		}
 	}
 
 	return Parser;
@@ -172,6 +311,13 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromRawDataAndArchive(const u
 		}
 	}
 
+	// UTF-16 json is still converted to a string
+	const bool bUTF16 = DataNum >= 2 && ((DataPtr[0] == 0xFF && DataPtr[1] == 0xFE) || (DataPtr[0] == 0xFE && DataPtr[1] == 0xFF));
+	if (DataNum > 0 && !bUTF16)
+	{
+		return FromUTF8(DataPtr, DataNum, LoaderConfig, InArchive);
+	}
+
 	if (DataNum > 0 && DataNum <= INT32_MAX)
 	{
 		FString JsonData;
@@ -182,32 +328,53 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromRawDataAndArchive(const u
 	return nullptr;
 }
 
-TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromData(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig)
+namespace glTFRuntime
 {
-	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromData, FColor::Magenta);
-
-	// required for Gzip and LZ4;
-	TArray64<uint8> UncompressedData;
+	struct FGzipMember
+	{
+		int64 CompressedOffset;
+		int64 CompressedSize;
+		int64 UncompressedOffset;
+		int64 UncompressedSize;
+	};
 
-	// Gzip Compressed ? 10 bytes header and 8 bytes footer
-	if (DataNum > 18 && DataPtr[0] == 0x1F && DataPtr[1] == 0x8B && DataPtr[2] == 0x08)
+	// validates a gzip member header, OutBlockSize is set to the whole member size when a BGZF 'BC' subfield is found
+	static bool ParseGzipHeader(const uint8* DataPtr, const int64 DataNum, int64& OutHeaderSize, int64& OutBlockSize)
 	{
-		uint32* GzipOriginalSize = (uint32*)(&DataPtr[DataNum - 4]);
+		OutBlockSize = 0;
+
+		// 10 bytes header and 8 bytes footer
+		if (DataNum <= 18 || DataPtr[0] != 0x1F || DataPtr[1] != 0x8B || DataPtr[2] != 0x08)
+		{
+			return false;
+		}
+
 		int64 StartOfBuffer = 10;
 		// FEXTRA
 		if (DataPtr[3] & 0x04)
 		{
-			uint16* FExtraXLen = (uint16*)(&DataPtr[StartOfBuffer]);
 			if (StartOfBuffer + 2 >= DataNum)
 			{
 				UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid Gzip FEXTRA header."));
-				return nullptr;
+				return false;
 			}
-			StartOfBuffer += 2 + *FExtraXLen;
+			const int64 FExtraXLen = DataPtr[StartOfBuffer] | (DataPtr[StartOfBuffer + 1] << 8);
+			int64 SubFieldOffset = StartOfBuffer + 2;
+			StartOfBuffer += 2 + FExtraXLen;
 			if (StartOfBuffer >= DataNum)
 			{
 				UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid Gzip FEXTRA XLEN."));
-				return nullptr;
+				return false;
+			}
+
+			while (SubFieldOffset + 4 <= StartOfBuffer)
+			{
+				const int64 SubFieldLen = DataPtr[SubFieldOffset + 2] | (DataPtr[SubFieldOffset + 3] << 8);
+				if (DataPtr[SubFieldOffset] == 'B' && DataPtr[SubFieldOffset + 1] == 'C' && SubFieldLen == 2 && SubFieldOffset + 6 <= StartOfBuffer)
+				{
+					OutBlockSize = (DataPtr[SubFieldOffset + 4] | (DataPtr[SubFieldOffset + 5] << 8)) + 1;
+				}
+				SubFieldOffset += 4 + SubFieldLen;
 			}
 		}
 
@@ -220,13 +387,13 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromData(const uint8* DataPtr
 				if (StartOfBuffer >= DataNum)
 				{
 					UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid Gzip FNAME header."));
-					return nullptr;
+					return false;
 				}
 			}
 			if (++StartOfBuffer >= DataNum)
 			{
 				UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid Gzip FNAME header."));
-				return nullptr;
+				return false;
 			}
 		}
 
@@ -239,13 +406,13 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromData(const uint8* DataPtr
 				if (StartOfBuffer >= DataNum)
 				{
 					UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid Gzip FCOMMENT header."));
-					return nullptr;
+					return false;
 				}
 			}
 			if (++StartOfBuffer >= DataNum)
 			{
 				UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid Gzip FCOMMENT header."));
-				return nullptr;
+				return false;
 			}
 		}
 
@@ -255,361 +422,758 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromData(const uint8* DataPtr
 			if (StartOfBuffer + 2 >= DataNum)
 			{
 				UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid Gzip FHCRC header."));
-				return nullptr;
+				return false;
 			}
 			StartOfBuffer += 2;
 		}
 
-		UncompressedData.AddUninitialized(*GzipOriginalSize);
-		if (!FCompression::UncompressMemory(NAME_Zlib, UncompressedData.GetData(), *GzipOriginalSize, &DataPtr[StartOfBuffer], DataNum - StartOfBuffer - 8, COMPRESS_NoFlags, -15))
-		{
-			UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to uncompress Gzip data."));
-			return nullptr;
-		}
-
-		DataPtr = UncompressedData.GetData();
-		DataNum = *GzipOriginalSize;
+		OutHeaderSize = StartOfBuffer;
+		return true;
 	}
-	// LZ4 ? magic number(4) + 3 (Note: Unreal includes the classic LZ4 c library, unfortunately it is exposed in a pretty annoying way, so I have reimplemented the decoding process as it is way more fun than messing around with the build system)
-	else if (DataNum > 7 && DataPtr[0] == 0x04 && DataPtr[1] == 0x22 && DataPtr[2] == 0x4D && DataPtr[3] == 0x18)
+
+	// BGZF (and compatible) streams store the size of each member in the header, so members can be located without inflating
+	static bool GetGzipBlocks(const uint8* DataPtr, const int64 DataNum, TArray<FGzipMember>& OutMembers, int64& OutUncompressedSize)
 	{
-		const uint8* LZ4FLG = DataPtr + 4;
-		const uint8* LZ4BD = DataPtr + 5;
+		OutUncompressedSize = 0;
+		int64 Offset = 0;
+		while (Offset < DataNum)
+		{
+			int64 HeaderSize = 0;
+			int64 BlockSize = 0;
+			if (!ParseGzipHeader(DataPtr + Offset, DataNum - Offset, HeaderSize, BlockSize) || BlockSize < HeaderSize + 8 || BlockSize > DataNum - Offset)
+			{
+				return false;
+			}
 
-		const bool bLZ4ThreadSafe = ((*LZ4FLG >> 5) & 0x01) == 1;
-		const bool bLZ4BlockHasChecksum = ((*LZ4FLG >> 4) & 0x01) == 1;
-		const bool bLZ4BlockHasContentSize = ((*LZ4FLG >> 3) & 0x01) == 1;
-		const bool bLZ4BlockHasDictID = (*LZ4FLG & 0x01) == 1;
+			const uint8* Footer = DataPtr + Offset + BlockSize - 8;
 
-		int64 ReserveBlockSize = 0;
-		if (((*LZ4BD >> 7) & 0x01) == 1)
-		{
-			ReserveBlockSize = 4 * 1024 * 1024;
-		}
-		else if (((*LZ4BD >> 6) & 0x01) == 1)
-		{
-			ReserveBlockSize = 1024 * 1024;
-		}
-		else if (((*LZ4BD >> 5) & 0x01) == 1)
-		{
-			ReserveBlockSize = 256 * 1024;
-		}
-		else if (((*LZ4BD >> 4) & 0x01) == 1)
-		{
-			ReserveBlockSize = 64 * 1024;
-		}
+			FGzipMember Member;
+			Member.CompressedOffset = Offset + HeaderSize;
+			Member.CompressedSize = BlockSize - HeaderSize - 8;
+			Member.UncompressedOffset = OutUncompressedSize;
+			// a block is at most 64k, so ISIZE cannot wrap
+			Member.UncompressedSize = static_cast<uint32>(Footer[4]) | (static_cast<uint32>(Footer[5]) << 8) | (static_cast<uint32>(Footer[6]) << 16) | (static_cast<uint32>(Footer[7]) << 24);
+			OutMembers.Add(Member);
 
-		int64 LZ4Offset = 7 + (bLZ4BlockHasContentSize ? 8 : 0) + (bLZ4BlockHasDictID ? 4 : 0);
+			OutUncompressedSize += Member.UncompressedSize;
+			Offset += BlockSize;
+		}
 
-		TArray<TPair<const uint8*, int64>> LZ4Blocks;
+		return OutMembers.Num() > 1;
+	}
 
-		while (LZ4Offset < DataNum)
+	// ISIZE is the size modulo 4GB and only describes the last member, so it is used just as an allocation hint
+	static bool InflateGzipStream(const uint8* DataPtr, const int64 DataNum, TArray64<uint8>& OutData)
+	{
+		z_stream Stream;
+		FMemory::Memzero(Stream);
+		// 16 enables gzip headers decoding
+		if (inflateInit2(&Stream, 16 + MAX_WBITS) != Z_OK)
 		{
-			if (LZ4Offset + 4 >= DataNum)
-			{
-				UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid LZ4 Block at index %d."), LZ4Blocks.Num());
-				return nullptr;
-			}
-
-			const uint32* BlockSize = reinterpret_cast<const uint32*>(DataPtr + LZ4Offset);
+			return false;
+		}
 
-			const uint32 TrueBlockSize = *BlockSize & 0x7FFFFFFF;
+		// the hint is clamped as trailing padding or a forged footer could request up to 4GB
+		const int64 SizeHint = static_cast<uint32>(DataPtr[DataNum - 4]) | (static_cast<uint32>(DataPtr[DataNum - 3]) << 8) | (static_cast<uint32>(DataPtr[DataNum - 2]) << 16) | (static_cast<uint32>(DataPtr[DataNum - 1]) << 24);
+		OutData.SetNumUninitialized(FMath::Max<int64>(FMath::Min<int64>(SizeHint, DataNum * 16), 64 * 1024));
 
-			if (TrueBlockSize == 0)
-			{
-				break;
-			}
+		int64 InputOffset = 0;
+		int64 OutputSize = 0;
+		bool bSuccess = false;
 
-			if (LZ4Offset + 4 + TrueBlockSize >= DataNum)
+		for (;;)
+		{
+			if (OutputSize == OutData.Num())
 			{
-				UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid LZ4 Block at index %d."), LZ4Blocks.Num());
-				return nullptr;
+				OutData.SetNumUninitialized(OutData.Num() * 2);
 			}
 
-			LZ4Blocks.Add(TPair<const uint8*, int64>(DataPtr + LZ4Offset + 4, *BlockSize));
-
-			LZ4Offset += 4 + TrueBlockSize + (bLZ4BlockHasChecksum ? 4 : 0);
+			// zlib counters are 32bit
+			const int64 InputChunk = FMath::Min<int64>(DataNum - InputOffset, MAX_uint32);
+			const int64 OutputChunk = FMath::Min<int64>(OutData.Num() - OutputSize, MAX_uint32);
+			Stream.next_in = const_cast<Bytef*>(DataPtr + InputOffset);
+			Stream.avail_in = static_cast<uInt>(InputChunk);
+			Stream.next_out = OutData.GetData() + OutputSize;
+			Stream.avail_out = static_cast<uInt>(OutputChunk);
 
-		}
+			const int Result = inflate(&Stream, Z_NO_FLUSH);
 
-		if (bLZ4BlockHasContentSize)
-		{
-			const uint64* LZ4ContentSize = reinterpret_cast<const uint64*>(DataPtr + 4 + 2);
-			// 64GB seems a pretty reasonable limit...
-			UncompressedData.Reserve(FMath::Min<int64>(*LZ4ContentSize, 64LLU * 1024 * 1024 * 1024));
-		}
-		else
-		{
-			// let's reserve double of the "theoretical" compressed size
-			UncompressedData.Reserve(ReserveBlockSize * LZ4Blocks.Num() * 2);
-		}
+			InputOffset += InputChunk - Stream.avail_in;
+			OutputSize += OutputChunk - Stream.avail_out;
 
-		auto LZ4Decompress = [](const uint8* BlockData, const int64 BlockSize, TArray64<uint8>& Output) -> bool
+			if (Result == Z_STREAM_END)
 			{
-				const uint32 TrueBlockSize = BlockSize & 0x7FFFFFFF;
-				// uncompressed block?
-				if (((BlockSize >> 31) & 0x01) == 1)
+				// multiple members are just concatenated, anything else after a member (like zero padding) is ignored
+				if (DataNum - InputOffset < 2 || DataPtr[InputOffset] != 0x1f || DataPtr[InputOffset + 1] != 0x8b)
 				{
-					Output.Append(BlockData, TrueBlockSize);
-					return true;
+					bSuccess = true;
+					break;
 				}
 
-				int64 Offset = 0;
-				while (Offset < TrueBlockSize)
+				if (inflateReset(&Stream) != Z_OK)
 				{
-					const uint8 Token = BlockData[Offset++];
-					int64 Length = Token >> 4;
-
-					if (Length > 0)
-					{
-						int64 TempLength = Length + 240;
-						while (TempLength == 255)
-						{
-							if (Offset + 1 >= TrueBlockSize)
-							{
-								return false;
-							}
-							TempLength = BlockData[Offset++];
-							Length += TempLength;
-						}
-
-						if (Offset + Length > TrueBlockSize)
-						{
-							return false;
-						}
-
-						while (Length > 0)
-						{
-							Output.Add(BlockData[Offset++]);
-							Length--;
-						}
-
-						if (Offset == TrueBlockSize)
-						{
-							return true;
-						}
-					}
-
-					if (Offset + 2 >= TrueBlockSize)
-					{
-						return false;
-					}
-
-					uint16 CopyOffset = static_cast<uint16>(BlockData[Offset++]);
-					CopyOffset |= (static_cast<uint16>(BlockData[Offset++]) << 8);
-
-					if (CopyOffset == 0)
-					{
-						return false;
-					}
-
-					int64 MatchOffset = Output.Num() - CopyOffset;
-					if (MatchOffset < 0)
-					{
-						return false;
-					}
-
-					int64 MatchLength = Token & 0x0F;
-					int64 TempMatchLength = MatchLength + 240;
-					while (TempMatchLength == 255)
-					{
-						if (Offset + 1 > TrueBlockSize)
-						{
-							return false;
-						}
-						TempMatchLength = BlockData[Offset++];
-						MatchLength += TempMatchLength;
-					}
-
-					MatchLength += 4;
-
-					while (MatchLength > 0)
-					{
-						if (!Output.IsValidIndex(MatchOffset))
-						{
-							return false;
-						}
-						const uint8 Byte = Output[MatchOffset++];
-						Output.Add(Byte);
-						MatchLength--;
-					}
+					break;
 				}
-
-				return true;
-			};
-
-		// can we decompress the blocks in parallel?
-		if (bLZ4ThreadSafe)
-		{
-			TArray<TPair<TArray64<uint8>, bool>> BlocksStates;
-			BlocksStates.AddDefaulted(LZ4Blocks.Num());
-
-			ParallelFor(LZ4Blocks.Num(), [&](const int32 BlockIndex)
-				{
-					TPair<TArray64<uint8>, bool>& BlockState = BlocksStates[BlockIndex];
-					BlockState.Key.Reserve(ReserveBlockSize);
-					BlockState.Value = LZ4Decompress(LZ4Blocks[BlockIndex].Key, LZ4Blocks[BlockIndex].Value, BlockState.Key);
-				});
-
-			for (int32 BlockIndex = 0; BlockIndex < LZ4Blocks.Num(); BlockIndex++)
+			}
+			else if (Result == Z_BUF_ERROR)
 			{
-				const TPair<TArray64<uint8>, bool>& BlockState = BlocksStates[BlockIndex];
-				if (!BlockState.Value)
+				// truncated stream
+				if (InputOffset >= DataNum)
 				{
-					UE_LOG(LogGLTFRuntime, Error, TEXT("LZ4 parallel decompression error @Block %d"), BlockIndex);
-					return nullptr;
+					break;
 				}
-
-				UncompressedData.Append(BlockState.Key);
 			}
-		}
-		else
-		{
-			for (int32 BlockIndex = 0; BlockIndex < LZ4Blocks.Num(); BlockIndex++)
+			else if (Result != Z_OK)
 			{
-				if (!LZ4Decompress(LZ4Blocks[BlockIndex].Key, LZ4Blocks[BlockIndex].Value, UncompressedData))
-				{
-					UE_LOG(LogGLTFRuntime, Error, TEXT("LZ4 decompression error @Block %d"), BlockIndex);
-					return nullptr;
-				}
+				break;
 			}
 		}
 
-		DataPtr = UncompressedData.GetData();
-		DataNum = UncompressedData.Num();
+		inflateEnd(&Stream);
+
+		OutData.SetNumUninitialized(OutputSize);
+		return bSuccess;
 	}
 
-	TSharedPtr<FglTFRuntimeArchive> Archive = nullptr;
+	// deflate can not expand data more than 1032:1
+	static constexpr uint64 MaxDeflateRatio = 1032;
 
-	// Zip archive ?
-	if (!LoaderConfig.bNoArchive && DataNum > 4 && DataPtr[0] == 0x50 && DataPtr[1] == 0x4b && DataPtr[2] == 0x03 && DataPtr[3] == 0x04)
+	// raw deflate (zip entries) with an expected output size, zlib is used directly to avoid 32bit sizes.
+	// The output grows while inflating, so a forged header size is never allocated upfront.
+	static bool InflateRawDeflate(const uint8* DataPtr, const int64 DataNum, TArray64<uint8>& OutData, const int64 ExpectedNum)
 	{
-		TSharedPtr<FglTFRuntimeArchiveZip> ZipFile = MakeShared<FglTFRuntimeArchiveZip>();
-		if (!LoaderConfig.EncryptionKey.IsEmpty())
+		z_stream Stream;
+		FMemory::Memzero(Stream);
+		if (inflateInit2(&Stream, -MAX_WBITS) != Z_OK)
 		{
-			ZipFile->SetPassword(LoaderConfig.EncryptionKey);
+			return false;
 		}
 
-		if (LoaderConfig.PasswordPromptHook.IsBound())
-		{
-			ZipFile->PromptHook = LoaderConfig.PasswordPromptHook;
-		}
+		OutData.SetNumUninitialized(FMath::Min<int64>(ExpectedNum, FMath::Max<int64>(DataNum * 4, 64 * 1024)));
 
-		if (LoaderConfig.AESDecrypterHook.IsBound())
-		{
-			ZipFile->AESDecrypterHook = LoaderConfig.AESDecrypterHook;
-		}
+		int64 InputOffset = 0;
+		int64 OutputSize = 0;
+		bool bSuccess = false;
 
-		if (!ZipFile->FromData(DataPtr, DataNum))
+		for (;;)
 		{
-			UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to parse Zip archive."));
-			return nullptr;
-		}
-
-		Archive = ZipFile;
-	}
-	// tar ?
-	else if (!LoaderConfig.bNoArchive && DataNum % 512 == 0 && DataNum >= 10240 && DataPtr[257] == 'u' && DataPtr[258] == 's' && DataPtr[259] == 't' && DataPtr[260] == 'a' && DataPtr[261] == 'r')
-	{
-		TMap<FString, TArray64<uint8>> TarMap;
-
-		auto GetTarString = [](const uint8* StringDataPtr, const int32 StringLen) -> FString
+			if (OutputSize == OutData.Num())
 			{
-				TArray<uint8> StringData;
-				StringData.Reserve(StringLen + 1);
-				for (int32 StringByteIndex = 0; StringByteIndex < StringLen; StringByteIndex++)
+				// one byte over the expected size is enough to detect a lying header
+				if (OutData.Num() > ExpectedNum)
 				{
-					if (StringDataPtr[StringByteIndex] == 0)
-					{
-						break;
-					}
-
-					StringData.Add(StringDataPtr[StringByteIndex]);
+					break;
 				}
+				OutData.SetNumUninitialized(FMath::Min<int64>(FMath::Max<int64>(OutData.Num() * 2, 64 * 1024), ExpectedNum + 1));
+			}
 
-				StringData.Add(0);
-
-				return FString(UTF8_TO_TCHAR(StringData.GetData()));
-			};
+			const int64 InputChunk = FMath::Min<int64>(DataNum - InputOffset, MAX_uint32);
+			const int64 OutputChunk = FMath::Min<int64>(OutData.Num() - OutputSize, MAX_uint32);
+			Stream.next_in = const_cast<Bytef*>(DataPtr + InputOffset);
+			Stream.avail_in = static_cast<uInt>(InputChunk);
+			Stream.next_out = OutData.GetData() + OutputSize;
+			Stream.avail_out = static_cast<uInt>(OutputChunk);
 
-		TSharedPtr<FglTFRuntimeArchiveMap> TarArchive = MakeShared<FglTFRuntimeArchiveMap>();
+			const int Result = inflate(&Stream, Z_NO_FLUSH);
 
-		// given the block nature of tar files, it is more memory efficient to extract the files directly
-		int64 ByteIndex = 0;
-		bool bTarParsingFailed = false;
-		int64 TarPrefixLen = 0;
-		while (ByteIndex < DataNum)
-		{
-			const uint8* Block = DataPtr + ByteIndex;
-			ByteIndex += 512;
+			InputOffset += InputChunk - Stream.avail_in;
+			OutputSize += OutputChunk - Stream.avail_out;
 
-			// end of archive ?
-			if (Block[0] == 0)
+			if (Result == Z_STREAM_END)
 			{
-				// no entry ? assume error
-				if (TarMap.Num() < 1)
-				{
-					bTarParsingFailed = true;
-				}
+				bSuccess = OutputSize == ExpectedNum;
 				break;
 			}
 
-			if (Block[257] != 'u' || Block[258] != 's' || Block[259] != 't' || Block[260] != 'a' || Block[261] != 'r')
+			// Z_BUF_ERROR means no progress is possible (truncated input)
+			if (Result != Z_OK)
 			{
-				bTarParsingFailed = true;
 				break;
 			}
+		}
+
+		inflateEnd(&Stream);
+
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 5
+		OutData.SetNum(bSuccess ? OutputSize : 0, EAllowShrinking::No);
+#else
+		OutData.SetNum(bSuccess ? OutputSize : 0, false);
+#endif
+		return bSuccess;
+	}
+}
+
+namespace glTFRuntime
+{
+	// little endian values in headers are at arbitrary offsets (after chunks and blocks of any length)
+	uint32 ReadUInt32(const uint8* Ptr)
+	{
+		uint32 Value;
+		FMemory::Memcpy(&Value, Ptr, sizeof(uint32));
+		return Value;
+	}
+
+	bool GetBinaryChunks(const uint8* DataPtr, const int64 DataNum, const uint8*& JsonChunkPtr, int64& JsonChunkNum, const uint8*& BinaryChunkPtr, int64& BinaryChunkNum)
+	{
+		JsonChunkPtr = nullptr;
+		JsonChunkNum = 0;
+		BinaryChunkPtr = nullptr;
+		BinaryChunkNum = 0;
 
-			const FString BlockSizeString = GetTarString(Block + 124, 12);
-			int64 FileSize = 0;
-			for (const TCHAR& BlockSizeChar : BlockSizeString)
+		int64 BlobIndex = 12;
+
+		while (BlobIndex < DataNum)
+		{
+			if (BlobIndex + 8 > DataNum)
 			{
-				FileSize *= 8;
-				FileSize += static_cast<char>(BlockSizeChar) - '0';
+				return false;
 			}
 
-			const int64 BlockSize = Align(FileSize, 512);
+			const uint32 ChunkLength = ReadUInt32(&DataPtr[BlobIndex]);
+			const uint32 ChunkType = ReadUInt32(&DataPtr[BlobIndex + 4]);
+
+			BlobIndex += 8;
 
-			if (ByteIndex + BlockSize > DataNum)
+			if ((BlobIndex + ChunkLength) > DataNum)
 			{
-				bTarParsingFailed = true;
-				break;
+				return false;
 			}
 
-			// first entry ?
-			if (ByteIndex == 512)
+			if (ChunkType == 0x4E4F534A && !JsonChunkPtr)
 			{
-				const FString TarPrefix = GetTarString(Block, 100);
-				TarPrefixLen = TarPrefix.Len();
+				JsonChunkPtr = &DataPtr[BlobIndex];
+				JsonChunkNum = ChunkLength;
 			}
 
-			if (Block[156] == 0 || Block[156] == '0' || Block[156] == '7')
+			else if (ChunkType == 0x004E4942 && !BinaryChunkPtr)
 			{
-				const FString TarFilename = GetTarString(Block, 100);
-				if (TarFilename.Len() <= TarPrefixLen)
+				BinaryChunkPtr = &DataPtr[BlobIndex];
+				BinaryChunkNum = ChunkLength;
+			}
+
+			BlobIndex += ChunkLength;
+		}
+
+		return JsonChunkPtr != nullptr;
+	}
+
+	// decodes a LZ4 block at OutputOffset, returns the new output offset or -1 on error.
+	// matches can reach back to WindowStart (the start of the output for linked blocks)
+	int64 DecodeLZ4Block(const uint8* BlockData, const int64 BlockSize, uint8* Output, const int64 WindowStart, int64 OutputOffset, const int64 OutputEnd)
+	{
+		const int64 TrueBlockSize = BlockSize & 0x7FFFFFFF;
+		// uncompressed block?
+		if (((BlockSize >> 31) & 0x01) == 1)
+		{
+			if (TrueBlockSize > OutputEnd - OutputOffset)
+			{
+				return -1;
+			}
+			FMemory::Memcpy(Output + OutputOffset, BlockData, TrueBlockSize);
+			return OutputOffset + TrueBlockSize;
+		}
+
+		int64 Offset = 0;
+		while (Offset < TrueBlockSize)
+		{
+			const uint8 Token = BlockData[Offset++];
+			int64 Length = Token >> 4;
+
+			if (Length > 0)
+			{
+				if (Length == 15)
+				{
+					uint8 ExtraLength = 0;
+					do
+					{
+						if (Offset >= TrueBlockSize)
+						{
+							return -1;
+						}
+						ExtraLength = BlockData[Offset++];
+						Length += ExtraLength;
+					} while (ExtraLength == 255);
+				}
+
+				if (Length > TrueBlockSize - Offset || Length > OutputEnd - OutputOffset)
+				{
+					return -1;
+				}
+
+				FMemory::Memcpy(Output + OutputOffset, BlockData + Offset, Length);
+				Offset += Length;
+				OutputOffset += Length;
+
+				if (Offset == TrueBlockSize)
+				{
+					return OutputOffset;
+				}
+			}
+
+			if (TrueBlockSize - Offset < 2)
+			{
+				return -1;
+			}
+
+			const int64 CopyOffset = static_cast<int64>(BlockData[Offset]) | (static_cast<int64>(BlockData[Offset + 1]) << 8);
+			Offset += 2;
+
+			if (CopyOffset == 0 || CopyOffset > OutputOffset - WindowStart)
+			{
+				return -1;
+			}
+
+			int64 MatchLength = Token & 0x0F;
+			if (MatchLength == 15)
+			{
+				uint8 ExtraLength = 0;
+				do
+				{
+					if (Offset >= TrueBlockSize)
+					{
+						return -1;
+					}
+					ExtraLength = BlockData[Offset++];
+					MatchLength += ExtraLength;
+				} while (ExtraLength == 255);
+			}
+
+			MatchLength += 4;
+
+			if (MatchLength > OutputEnd - OutputOffset)
+			{
+				return -1;
+			}
+
+			// overlapping matches repeat the last CopyOffset bytes, the copyable span doubles at every step
+			const uint8* MatchSource = Output + OutputOffset - CopyOffset;
+			uint8* MatchDestination = Output + OutputOffset;
+			int64 MatchRemaining = MatchLength;
+			while (MatchRemaining > 0)
+			{
+				const int64 MatchChunk = FMath::Min<int64>(MatchDestination - MatchSource, MatchRemaining);
+				FMemory::Memcpy(MatchDestination, MatchSource, MatchChunk);
+				MatchDestination += MatchChunk;
+				MatchRemaining -= MatchChunk;
+			}
+
+			OutputOffset += MatchLength;
+		}
+
+		return OutputOffset;
+	}
+
+	// linked blocks can only be decoded in order, the amount of decoded bytes is published after each block
+	class FLZ4LinkedDecoder
+	{
+	public:
+		FLZ4LinkedDecoder(const TArray<TPair<const uint8*, int64>>& InBlocks, TArray64<uint8>& InOutput) : Blocks(InBlocks), Output(InOutput)
+		{
+			ProgressEvent = FPlatformProcess::GetSynchEventFromPool(false);
+			bFinished = false;
+			FailedBlock = INDEX_NONE;
+		}
+
+		~FLZ4LinkedDecoder()
+		{
+			FPlatformProcess::ReturnSynchEventToPool(ProgressEvent);
+		}
+
+		void Run()
+		{
+			SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromData_LZ4Linked, FColor::Magenta);
+
+			int64 OutputOffset = 0;
+			for (int32 BlockIndex = 0; BlockIndex < Blocks.Num(); BlockIndex++)
+			{
+				OutputOffset = DecodeLZ4Block(Blocks[BlockIndex].Key, Blocks[BlockIndex].Value, Output.GetData(), 0, OutputOffset, Output.Num());
+				if (OutputOffset < 0)
 				{
-					bTarParsingFailed = true;
+					FailedBlock = BlockIndex;
 					break;
 				}
-				TArray64<uint8>& TarFileContent = TarMap.Add(TarFilename.RightChop(TarPrefixLen));
-				TarFileContent.AddUninitialized(FileSize);
-				FMemory::Memcpy(TarFileContent.GetData(), DataPtr + ByteIndex, FileSize);
+				DecodedBytes.Set(OutputOffset);
+				ProgressEvent->Trigger();
+			}
+
+			bFinished = true;
+			ProgressEvent->Trigger();
+		}
+
+		// returns false if the decoding ended before reaching the requested amount of bytes
+		bool WaitForBytes(const int64 Bytes)
+		{
+			while (DecodedBytes.GetValue() < Bytes)
+			{
+				if (bFinished)
+				{
+					return DecodedBytes.GetValue() >= Bytes;
+				}
+				ProgressEvent->Wait();
+			}
+			return true;
+		}
+
+		int64 GetDecodedBytes() const
+		{
+			return DecodedBytes.GetValue();
+		}
+
+		// valid only after Run() is completed
+		int32 GetFailedBlock() const
+		{
+			return FailedBlock;
+		}
+
+	protected:
+		const TArray<TPair<const uint8*, int64>>& Blocks;
+		TArray64<uint8>& Output;
+		FThreadSafeCounter64 DecodedBytes;
+		FThreadSafeBool bFinished;
+		int32 FailedBlock;
+		FEvent* ProgressEvent;
+	};
+}
+
+TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromData(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeMappedFile> InMappedFile)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromData, FColor::Magenta);
+
+	// required for Gzip and LZ4;
+	TArray64<uint8> UncompressedData;
+
+	// Gzip Compressed ? 10 bytes header and 8 bytes footer
+	if (DataNum > 18 && DataPtr[0] == 0x1F && DataPtr[1] == 0x8B && DataPtr[2] == 0x08)
+	{
+		TArray<glTFRuntime::FGzipMember> GzipMembers;
+		int64 GzipUncompressedSize = 0;
+		if (glTFRuntime::GetGzipBlocks(DataPtr, DataNum, GzipMembers, GzipUncompressedSize))
+		{
+			SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromData_GzipBlocks, FColor::Magenta);
+
+			UncompressedData.AddUninitialized(GzipUncompressedSize);
+
+			FThreadSafeBool bGzipSuccess = true;
+			ParallelFor(GzipMembers.Num(), [&](const int32 MemberIndex)
+				{
+					const glTFRuntime::FGzipMember& GzipMember = GzipMembers[MemberIndex];
+					if (GzipMember.UncompressedSize > 0 && !FCompression::UncompressMemory(NAME_Zlib, UncompressedData.GetData() + GzipMember.UncompressedOffset, GzipMember.UncompressedSize, DataPtr + GzipMember.CompressedOffset, GzipMember.CompressedSize, COMPRESS_NoFlags, -15))
+					{
+						bGzipSuccess = false;
+					}
+				});
+
+			if (!bGzipSuccess)
+			{
+				UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to uncompress Gzip data."));
+				return nullptr;
+			}
+		}
+		else
+		{
+			SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromData_GzipStream, FColor::Magenta);
+
+			int64 GzipHeaderSize = 0;
+			int64 GzipBlockSize = 0;
+			if (!glTFRuntime::ParseGzipHeader(DataPtr, DataNum, GzipHeaderSize, GzipBlockSize))
+			{
+				return nullptr;
+			}
+
+			if (!glTFRuntime::InflateGzipStream(DataPtr, DataNum, UncompressedData))
+			{
+				UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to uncompress Gzip data."));
+				return nullptr;
+			}
+		}
+
+		DataPtr = UncompressedData.GetData();
+		DataNum = UncompressedData.Num();
+	}
+	// LZ4 ? magic number(4) + 3 (Note: Unreal includes the classic LZ4 c library, unfortunately it is exposed in a pretty annoying way, so I have reimplemented the decoding process as it is way more fun than messing around with the build system)
+	else if (DataNum > 7 && DataPtr[0] == 0x04 && DataPtr[1] == 0x22 && DataPtr[2] == 0x4D && DataPtr[3] == 0x18)
+	{
+		const uint8* LZ4FLG = DataPtr + 4;
+		const uint8* LZ4BD = DataPtr + 5;
+
+		const bool bLZ4ThreadSafe = ((*LZ4FLG >> 5) & 0x01) == 1;
+		const bool bLZ4BlockHasChecksum = ((*LZ4FLG >> 4) & 0x01) == 1;
+		const bool bLZ4BlockHasContentSize = ((*LZ4FLG >> 3) & 0x01) == 1;
+		const bool bLZ4BlockHasDictID = (*LZ4FLG & 0x01) == 1;
+
+		// block maximum size id: 4 (64KB), 5 (256KB), 6 (1MB), 7 (4MB)
+		const int32 LZ4BlockMaxSizeId = (*LZ4BD >> 4) & 0x07;
+		const int64 LZ4BlockMaxSize = LZ4BlockMaxSizeId >= 4 ? (1LL << (8 + LZ4BlockMaxSizeId * 2)) : 4 * 1024 * 1024;
+
+		int64 LZ4Offset = 7 + (bLZ4BlockHasContentSize ? 8 : 0) + (bLZ4BlockHasDictID ? 4 : 0);
+
+		TArray<TPair<const uint8*, int64>> LZ4Blocks;
+
+		while (LZ4Offset < DataNum)
+		{
+			if (LZ4Offset + 4 >= DataNum)
+			{
+				UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid LZ4 Block at index %d."), LZ4Blocks.Num());
+				return nullptr;
+			}
+
+			const uint32 BlockSize = glTFRuntime::ReadUInt32(DataPtr + LZ4Offset);
+
+			const uint32 TrueBlockSize = BlockSize & 0x7FFFFFFF;
+
+			if (TrueBlockSize == 0)
+			{
+				break;
+			}
+
+			if (LZ4Offset + 4 + TrueBlockSize >= DataNum)
+			{
+				UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid LZ4 Block at index %d."), LZ4Blocks.Num());
+				return nullptr;
+			}
+
+			LZ4Blocks.Add(TPair<const uint8*, int64>(DataPtr + LZ4Offset + 4, BlockSize));
+
+			LZ4Offset += 4 + TrueBlockSize + (bLZ4BlockHasChecksum ? 4 : 0);
+
+		}
+
+		// blocks are decoded directly in the final buffer, so it must be big enough for the worst case
+		int64 LZ4MaxUncompressedSize = 0;
+		for (const TPair<const uint8*, int64>& LZ4Block : LZ4Blocks)
+		{
+			LZ4MaxUncompressedSize += (((LZ4Block.Value >> 31) & 0x01) == 1) ? (LZ4Block.Value & 0x7FFFFFFF) : LZ4BlockMaxSize;
+		}
+
+		// can we decompress the blocks in parallel?
+		if (bLZ4ThreadSafe)
+		{
+			// each block gets a slot of the maximum block size, slots are compacted later
+			UncompressedData.SetNumUninitialized(LZ4BlockMaxSize * LZ4Blocks.Num());
+
+			TArray<int64> BlocksEnds;
+			BlocksEnds.AddUninitialized(LZ4Blocks.Num());
+
+			ParallelFor(LZ4Blocks.Num(), [&](const int32 BlockIndex)
+				{
+					const int64 SlotOffset = LZ4BlockMaxSize * BlockIndex;
+					BlocksEnds[BlockIndex] = glTFRuntime::DecodeLZ4Block(LZ4Blocks[BlockIndex].Key, LZ4Blocks[BlockIndex].Value, UncompressedData.GetData(), SlotOffset, SlotOffset, SlotOffset + LZ4BlockMaxSize);
+				});
+
+			int64 UncompressedSize = 0;
+			for (int32 BlockIndex = 0; BlockIndex < LZ4Blocks.Num(); BlockIndex++)
+			{
+				if (BlocksEnds[BlockIndex] < 0)
+				{
+					UE_LOG(LogGLTFRuntime, Error, TEXT("LZ4 parallel decompression error @Block %d"), BlockIndex);
+					return nullptr;
+				}
+
+				const int64 SlotOffset = LZ4BlockMaxSize * BlockIndex;
+				const int64 BlockUncompressedSize = BlocksEnds[BlockIndex] - SlotOffset;
+				if (SlotOffset != UncompressedSize)
+				{
+					FMemory::Memmove(UncompressedData.GetData() + UncompressedSize, UncompressedData.GetData() + SlotOffset, BlockUncompressedSize);
+				}
+				UncompressedSize += BlockUncompressedSize;
+			}
+
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 5
+			UncompressedData.SetNum(UncompressedSize, EAllowShrinking::No);
+#else
+			UncompressedData.SetNum(UncompressedSize, false);
+#endif
+		}
+		else
+		{
+			UncompressedData.SetNumUninitialized(bLZ4BlockHasContentSize ? FMath::Min<int64>(*reinterpret_cast<const uint64*>(DataPtr + 4 + 2), LZ4MaxUncompressedSize) : LZ4MaxUncompressedSize);
+
+			glTFRuntime::FLZ4LinkedDecoder LZ4Decoder(LZ4Blocks, UncompressedData);
+
+			TSharedPtr<FglTFRuntimeParser> PipelinedParser = nullptr;
+			bool bPipelined = false;
+
+			// decoding runs in the background, while the glb header and json chunk are parsed as soon as they are available
+			if (!LoaderConfig.bAsBlob && LZ4Blocks.Num() > 1)
+			{
+				TFuture<void> LZ4DecoderFuture = Async(EAsyncExecution::ThreadPool, [&LZ4Decoder]()
+					{
+						LZ4Decoder.Run();
+					});
+
+				const uint8* GlbPtr = UncompressedData.GetData();
+				if (LZ4Decoder.WaitForBytes(20) && GlbPtr[0] == 0x67 && GlbPtr[1] == 0x6C && GlbPtr[2] == 0x54 && GlbPtr[3] == 0x46 &&
+					glTFRuntime::ReadUInt32(GlbPtr + 16) == 0x4E4F534A)
+				{
+					const uint32 JsonChunkLength = glTFRuntime::ReadUInt32(GlbPtr + 12);
+					if (JsonChunkLength <= MAX_int32 && LZ4Decoder.WaitForBytes(20 + static_cast<int64>(JsonChunkLength)))
+					{
+						PipelinedParser = FromUTF8(GlbPtr + 20, JsonChunkLength, LoaderConfig);
+						bPipelined = true;
+					}
+				}
+
+				LZ4DecoderFuture.Wait();
+			}
+			else
+			{
+				LZ4Decoder.Run();
+			}
+
+			if (LZ4Decoder.GetFailedBlock() != INDEX_NONE)
+			{
+				UE_LOG(LogGLTFRuntime, Error, TEXT("LZ4 decompression error @Block %d"), LZ4Decoder.GetFailedBlock());
+				return nullptr;
+			}
+
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 5
+			UncompressedData.SetNum(LZ4Decoder.GetDecodedBytes(), EAllowShrinking::No);
+#else
+			UncompressedData.SetNum(LZ4Decoder.GetDecodedBytes(), false);
+#endif
+
+			if (bPipelined)
+			{
+				if (!PipelinedParser)
+				{
+					return nullptr;
+				}
+
+				// the json chunk has already been parsed, but the whole glb still needs to be validated
+				const uint8* JsonChunkPtr = nullptr;
+				int64 JsonChunkNum = 0;
+				const uint8* BinaryChunkPtr = nullptr;
+				int64 BinaryChunkNum = 0;
+				if (!glTFRuntime::GetBinaryChunks(UncompressedData.GetData(), UncompressedData.Num(), JsonChunkPtr, JsonChunkNum, BinaryChunkPtr, BinaryChunkNum))
+				{
+					return nullptr;
+				}
+
+				if (BinaryChunkPtr)
+				{
+					PipelinedParser->SetBinaryBuffer(BinaryChunkPtr, BinaryChunkNum);
+				}
+
+				return PipelinedParser;
 			}
+		}
+
+		DataPtr = UncompressedData.GetData();
+		DataNum = UncompressedData.Num();
+	}
+
+	// Zstandard ? frame magic number or skippable frame magic number
+	else if (DataNum > 8 && ((DataPtr[0] == 0x28 && DataPtr[1] == 0xB5 && DataPtr[2] == 0x2F && DataPtr[3] == 0xFD) || ((DataPtr[0] & 0xF0) == 0x50 && DataPtr[1] == 0x2A && DataPtr[2] == 0x4D && DataPtr[3] == 0x18)))
+	{
+		const int64 MaxZstdUncompressedSize = LoaderConfig.MaxZstdUncompressedSizeMB > 0 ? static_cast<int64>(LoaderConfig.MaxZstdUncompressedSizeMB) * 1024 * 1024 : MAX_int64;
+		if (!DecompressZstd(DataPtr, DataNum, UncompressedData, MaxZstdUncompressedSize))
+		{
+			return nullptr;
+		}
+
+		DataPtr = UncompressedData.GetData();
+		DataNum = UncompressedData.Num();
+	}
 
-			ByteIndex += BlockSize;
+	TSharedPtr<FglTFRuntimeArchive> Archive = nullptr;
+	// must outlive the archive detection, it could own the data
+	TSharedPtr<FglTFRuntimeDataSource> ArchiveDataSource = nullptr;
+
+	// Zip archive or tar ?
+	if (!LoaderConfig.bNoArchive && DataNum > 4 &&
+		((DataPtr[0] == 0x50 && DataPtr[1] == 0x4b && DataPtr[2] == 0x03 && DataPtr[3] == 0x04) || (DataNum % 512 == 0 && DataNum >= 10240 && FglTFRuntimeArchiveTar::IsTarHeader(DataPtr))))
+	{
+		// if the data comes from a mapped file, just reference it (decompressed data is adopted)
+		if (InMappedFile && InMappedFile->Contains(DataPtr, DataNum))
+		{
+			ArchiveDataSource = MakeShared<FglTFRuntimeMemoryDataSource>(InMappedFile.ToSharedRef(), DataPtr, DataNum);
+		}
+		else if (UncompressedData.Num() > 0 && DataPtr == UncompressedData.GetData())
+		{
+			ArchiveDataSource = MakeShared<FglTFRuntimeMemoryDataSource>(MoveTemp(UncompressedData));
+		}
+		else
+		{
+			ArchiveDataSource = MakeShared<FglTFRuntimeMemoryDataSource>(DataPtr, DataNum);
 		}
 
-		if (!bTarParsingFailed)
+		bool bIsArchive = false;
+		Archive = CreateArchive(ArchiveDataSource.ToSharedRef(), LoaderConfig, bIsArchive);
+		if (bIsArchive && !Archive)
 		{
-			TarArchive->FromMap(TarMap);
-			Archive = TarArchive;
+			return nullptr;
 		}
 	}
 
 	return FromRawDataAndArchive(DataPtr, DataNum, Archive, LoaderConfig);
 }
 
-TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromMap(const TMap<FString, TArray64<uint8>> Map, const FglTFRuntimeConfig& LoaderConfig)
+TSharedPtr<FglTFRuntimeArchiveZip> FglTFRuntimeParser::CreateZipArchive(TSharedRef<FglTFRuntimeDataSource> DataSource, const FglTFRuntimeConfig& LoaderConfig)
+{
+	TSharedPtr<FglTFRuntimeArchiveZip> ZipFile = MakeShared<FglTFRuntimeArchiveZip>();
+	if (!LoaderConfig.EncryptionKey.IsEmpty())
+	{
+		ZipFile->SetPassword(LoaderConfig.EncryptionKey);
+	}
+
+	if (LoaderConfig.PasswordPromptHook.IsBound())
+	{
+		ZipFile->PromptHook = LoaderConfig.PasswordPromptHook;
+	}
+
+	if (LoaderConfig.AESDecrypterHook.IsBound())
+	{
+		ZipFile->AESDecrypterHook = LoaderConfig.AESDecrypterHook;
+	}
+
+	if (!ZipFile->FromDataSource(DataSource))
+	{
+		UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to parse Zip archive."));
+		return nullptr;
+	}
+
+	return ZipFile;
+}
+
+TSharedPtr<FglTFRuntimeArchive> FglTFRuntimeParser::CreateArchive(TSharedRef<FglTFRuntimeDataSource> DataSource, const FglTFRuntimeConfig& LoaderConfig, bool& bIsArchive)
+{
+	bIsArchive = false;
+
+	if (LoaderConfig.bNoArchive)
+	{
+		return nullptr;
+	}
+
+	const int64 DataNum = DataSource->Num();
+	TArray64<uint8> Header;
+	const uint8* HeaderPtr = DataSource->GetRange(0, FMath::Min<int64>(DataNum, 512), Header);
+	if (!HeaderPtr || DataNum <= 4)
+	{
+		return nullptr;
+	}
+
+	// Zip archive ?
+	if (HeaderPtr[0] == 0x50 && HeaderPtr[1] == 0x4b && HeaderPtr[2] == 0x03 && HeaderPtr[3] == 0x04)
+	{
+		bIsArchive = true;
+		return CreateZipArchive(DataSource, LoaderConfig);
+	}
+
+	// tar ? (on parsing errors the data is not considered an archive)
+	if (DataNum % 512 == 0 && DataNum >= 10240 && FglTFRuntimeArchiveTar::IsTarHeader(HeaderPtr))
+	{
+		TSharedPtr<FglTFRuntimeArchiveTar> TarFile = MakeShared<FglTFRuntimeArchiveTar>();
+		if (TarFile->FromDataSource(DataSource))
+		{
+			bIsArchive = true;
+			return TarFile;
+		}
+	}
+
+	return nullptr;
+}
+
+TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromMap(const TMap<FString, TArray64<uint8>>& Map, const FglTFRuntimeConfig& LoaderConfig)
 {
 	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromMap, FColor::Magenta);
 
@@ -624,22 +1188,68 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromString(const FString& Jso
 {
 	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromString, FColor::Magenta);
 
-	TSharedPtr<FJsonValue> RootValue;
+	TSharedPtr<FJsonObject> JsonObject;
+	FglTFRuntimeJsonTables JsonTables;
 
-	TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(JsonData);
-	if (!FJsonSerializer::Deserialize(JsonReader, RootValue))
+	if (LoaderConfig.bUseStreamingJsonParser)
 	{
-		return nullptr;
+		JsonObject = ParseJsonStreaming(JsonData, JsonTables);
+		if (!JsonObject)
+			return nullptr;
 	}
+	else
+	{
+		TSharedPtr<FJsonValue> RootValue;
 
-	TSharedPtr<FJsonObject> JsonObject = RootValue->AsObject();
+		TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(JsonData);
+		if (!FJsonSerializer::Deserialize(JsonReader, RootValue))
+		{
+			return nullptr;
+		}
+
+		JsonObject = RootValue->AsObject();
+		if (!JsonObject)
+			return nullptr;
+	}
+
+	return FromJsonObject(JsonObject.ToSharedRef(), MoveTemp(JsonTables), LoaderConfig, InArchive);
+}
+
+TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromUTF8(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive, TSharedPtr<FglTFRuntimeMappedFile> InMappedFile)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromUTF8, FColor::Magenta);
+
+	// FJsonSerializer is still the default, the plugin scanner is opt-in
+	if (!LoaderConfig.bUseStreamingJsonParser && !LoaderConfig.bUseUTF8JsonParser)
+	{
+		if (DataNum > MAX_int32)
+		{
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Json text is too big (%lld bytes), enable bUseUTF8JsonParser or bUseStreamingJsonParser"), DataNum);
+			return nullptr;
+		}
+
+		FString JsonData;
+		FFileHelper::BufferToString(JsonData, DataPtr, static_cast<int32>(DataNum));
+		return FromString(JsonData, LoaderConfig, InArchive);
+	}
+
+	FglTFRuntimeJsonTables JsonTables;
+	TSharedPtr<FJsonObject> JsonObject = ParseJsonUTF8(DataPtr, DataNum, LoaderConfig.bUseStreamingJsonParser, JsonTables, InMappedFile);
 	if (!JsonObject)
+	{
 		return nullptr;
+	}
+
+	return FromJsonObject(JsonObject.ToSharedRef(), MoveTemp(JsonTables), LoaderConfig, InArchive);
+}
 
-	TSharedPtr<FglTFRuntimeParser> Parser = MakeShared<FglTFRuntimeParser>(JsonObject.ToSharedRef(), LoaderConfig.GetMatrix(), LoaderConfig.SceneScale);
+TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromJsonObject(TSharedRef<FJsonObject> JsonObject, FglTFRuntimeJsonTables&& JsonTables, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive)
+{
+	TSharedPtr<FglTFRuntimeParser> Parser = MakeShared<FglTFRuntimeParser>(JsonObject, LoaderConfig.GetMatrix(), LoaderConfig.SceneScale);
 
 	if (Parser)
 	{
+		Parser->SetJsonTables(MoveTemp(JsonTables));
 		if (LoaderConfig.bAllowExternalFiles && !LoaderConfig.OverrideBaseDirectory.IsEmpty())
 		{
 			if (LoaderConfig.bOverrideBaseDirectoryFromContentDir)
@@ -652,6 +1262,8 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromString(const FString& Jso
 			}
 		}
 		Parser->DefaultPrefixForUnnamedNodes = LoaderConfig.PrefixForUnnamedNodes;
+		Parser->bLoadExternalBuffersLazily = LoaderConfig.bLoadExternalBuffersLazily;
+		Parser->BufferRangesCacheMaxSize = static_cast<int64>(FMath::Max(LoaderConfig.ExternalBuffersCacheSizeMB, 0)) * 1024 * 1024;
 		Parser->Archive = InArchive;
 		Parser->AssetUserDataClasses = LoaderConfig.AssetUserDataClasses;
 	}
@@ -659,65 +1271,144 @@ TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromString(const FString& Jso
 	return Parser;
 }
 
-TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromBinary(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive)
+TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromBinary(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive, TSharedPtr<FglTFRuntimeMappedFile> InMappedFile)
 {
 	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromBinary, FColor::Magenta);
 
-	FString JsonData;
-	TArray64<uint8> BinaryBuffer;
+	const uint8* JsonChunkPtr = nullptr;
+	int64 JsonChunkNum = 0;
+	const uint8* BinaryChunkPtr = nullptr;
+	int64 BinaryChunkNum = 0;
+
+	if (!glTFRuntime::GetBinaryChunks(DataPtr, DataNum, JsonChunkPtr, JsonChunkNum, BinaryChunkPtr, BinaryChunkNum))
+	{
+		return nullptr;
+	}
 
-	bool bJsonFound = false;
-	bool bBinaryFound = false;
-	int64 BlobIndex = 12;
+	// the json chunk is parsed directly from the (mapped) bytes
+	TSharedPtr<FglTFRuntimeParser> Parser = FromUTF8(JsonChunkPtr, JsonChunkNum, LoaderConfig, InArchive, InMappedFile);
 
-	while (BlobIndex < DataNum)
+	if (Parser)
 	{
-		if (BlobIndex + 8 > DataNum)
+		if (BinaryChunkPtr)
 		{
-			return nullptr;
+			if (InMappedFile && InMappedFile->Contains(BinaryChunkPtr, BinaryChunkNum))
+			{
+				Parser->SetMappedBinaryBuffer(InMappedFile.ToSharedRef(), BinaryChunkPtr, BinaryChunkNum);
+			}
+			else
+			{
+				Parser->SetBinaryBuffer(BinaryChunkPtr, BinaryChunkNum);
+			}
 		}
+	}
+
+	return Parser;
+}
 
-		uint32* ChunkLength = (uint32*)&DataPtr[BlobIndex];
-		uint32* ChunkType = (uint32*)&DataPtr[BlobIndex + 4];
+TSharedPtr<FglTFRuntimeParser> FglTFRuntimeParser::FromFArchive(TSharedRef<FArchive> InArchive, const FglTFRuntimeConfig& LoaderConfig)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FromFArchive, FColor::Magenta);
 
-		BlobIndex += 8;
+	if (!InArchive->IsLoading())
+	{
+		UE_LOG(LogGLTFRuntime, Error, TEXT("FArchive is not a loading archive"));
+		return nullptr;
+	}
 
-		if ((BlobIndex + *ChunkLength) > DataNum)
+	TSharedRef<FglTFRuntimeFArchiveDataSource> DataSource = MakeShared<FglTFRuntimeFArchiveDataSource>(InArchive);
+	const int64 DataNum = DataSource->Num();
+	if (DataNum <= 0)
+	{
+		UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to get the size of the FArchive"));
+		return nullptr;
+	}
+
+	// binary glTF: only the chunks headers and the json chunk are read upfront
+	TArray64<uint8> HeaderScratch;
+	const uint8* HeaderPtr = DataNum > 20 ? DataSource->GetRange(0, 12, HeaderScratch) : nullptr;
+	if (!LoaderConfig.bAsBlob && HeaderPtr && HeaderPtr[0] == 0x67 && HeaderPtr[1] == 0x6C && HeaderPtr[2] == 0x54 && HeaderPtr[3] == 0x46)
+	{
+		int64 JsonChunkOffset = INDEX_NONE;
+		int64 JsonChunkNum = 0;
+		int64 BinaryChunkOffset = INDEX_NONE;
+		int64 BinaryChunkNum = 0;
+
+		int64 ChunkOffset = 12;
+		while (ChunkOffset < DataNum)
 		{
-			return nullptr;
+			TArray64<uint8> ChunkHeaderScratch;
+			const uint8* ChunkHeaderPtr = ChunkOffset + 8 <= DataNum ? DataSource->GetRange(ChunkOffset, 8, ChunkHeaderScratch) : nullptr;
+			if (!ChunkHeaderPtr)
+			{
+				UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to read binary glTF chunk header at offset %lld"), ChunkOffset);
+				return nullptr;
+			}
+
+			const uint32 ChunkLength = glTFRuntime::ReadUInt32(ChunkHeaderPtr);
+			const uint32 ChunkType = glTFRuntime::ReadUInt32(ChunkHeaderPtr + 4);
+
+			ChunkOffset += 8;
+
+			if (ChunkOffset + ChunkLength > DataNum)
+			{
+				UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid binary glTF chunk length %u at offset %lld"), ChunkLength, ChunkOffset);
+				return nullptr;
+			}
+
+			if (ChunkType == 0x4E4F534A && JsonChunkOffset == INDEX_NONE)
+			{
+				JsonChunkOffset = ChunkOffset;
+				JsonChunkNum = ChunkLength;
+			}
+			else if (ChunkType == 0x004E4942 && BinaryChunkOffset == INDEX_NONE)
+			{
+				BinaryChunkOffset = ChunkOffset;
+				BinaryChunkNum = ChunkLength;
+			}
+
+			ChunkOffset += ChunkLength;
 		}
 
-		if (*ChunkType == 0x4E4F534A && !bJsonFound)
+		TArray64<uint8> JsonScratch;
+		const uint8* JsonChunkPtr = JsonChunkOffset > INDEX_NONE ? DataSource->GetRange(JsonChunkOffset, JsonChunkNum, JsonScratch) : nullptr;
+		if (!JsonChunkPtr)
 		{
-			bJsonFound = true;
-			FFileHelper::BufferToString(JsonData, &DataPtr[BlobIndex], *ChunkLength);
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to read binary glTF json chunk"));
+			return nullptr;
 		}
 
-		else if (*ChunkType == 0x004E4942 && !bBinaryFound)
+		TSharedPtr<FglTFRuntimeParser> Parser = FromUTF8(JsonChunkPtr, JsonChunkNum, LoaderConfig);
+		if (Parser && BinaryChunkOffset > INDEX_NONE)
 		{
-			bBinaryFound = true;
-			BinaryBuffer.Append(&DataPtr[BlobIndex], *ChunkLength);
+			Parser->SetBinaryChunkSource(MakeShared<FglTFRuntimeFArchiveDataSource>(DataSource.Get(), BinaryChunkOffset, BinaryChunkNum));
 		}
 
-		BlobIndex += *ChunkLength;
+		return Parser;
 	}
 
-	if (!bJsonFound)
+	// zip and tar archives only read the required entries
+	bool bIsArchive = false;
+	TSharedPtr<FglTFRuntimeArchive> DataArchive = CreateArchive(DataSource, LoaderConfig, bIsArchive);
+	if (bIsArchive)
 	{
-		return nullptr;
+		if (!DataArchive)
+		{
+			return nullptr;
+		}
+		return FromRawDataAndArchive(nullptr, 0, DataArchive, LoaderConfig);
 	}
 
-	TSharedPtr<FglTFRuntimeParser> Parser = FromString(JsonData, LoaderConfig, InArchive);
-
-	if (Parser)
+	// json and compressed data are fully read
+	TArray64<uint8> Content;
+	const uint8* ContentPtr = DataSource->GetRange(0, DataNum, Content);
+	if (!ContentPtr)
 	{
-		if (bBinaryFound)
-		{
-			Parser->SetBinaryBuffer(BinaryBuffer);
-		}
+		UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to read %lld bytes from the FArchive"), DataNum);
+		return nullptr;
 	}
 
-	return Parser;
+	return FromData(ContentPtr, DataNum, LoaderConfig);
 }
 
 void FglTFRuntimeParser::LoadAndFillBaseMaterials()
@@ -871,6 +1562,12 @@ FglTFRuntimeParser::FglTFRuntimeParser(TSharedRef<FJsonObject> JsonObject, const
 {
 	bAllNodesCached = false;
 	DownloadTime = 0;
+	bLoadExternalBuffersLazily = false;
+	BufferRangesCacheMaxSize = 0;
+	BufferRangesCacheSize = 0;
+	BufferRangesCacheTick = 0;
+
+	BuildJsonSections();
 
 	if (IsInGameThread())
 	{
@@ -1058,23 +1755,57 @@ bool FglTFRuntimeParser::CheckJsonIndex(TSharedRef<FJsonObject> JsonObject, cons
 		return false;
 	}
 
-	for (const TSharedPtr<FJsonValue>& JsonItem : (*JsonArray))
+	for (const TSharedPtr<FJsonValue>& JsonItem : (*JsonArray))
+	{
+		JsonItems.Add(JsonItem.ToSharedRef());
+	}
+
+	return true;
+}
+
+TSharedPtr<FJsonObject> FglTFRuntimeParser::GetJsonObjectFromIndex(TSharedRef<FJsonObject> JsonObject, const FString& FieldName, const int32 Index) const
+{
+	if (Index < 0)
+	{
+		return nullptr;
+	}
+
+	// do not copy the array, this is called for every lookup
+	const TArray<TSharedPtr<FJsonValue>>* JsonArray;
+	if (!JsonObject->TryGetArrayField(FieldName, JsonArray) || Index >= JsonArray->Num() || !(*JsonArray)[Index])
+	{
+		return nullptr;
+	}
+
+	return (*JsonArray)[Index]->AsObject();
+}
+
+void FglTFRuntimeParser::BuildJsonSections()
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_BuildJsonSections, FColor::Magenta);
+
+	static const TCHAR* SectionsNames[] = { TEXT("accessors"), TEXT("bufferViews"), TEXT("nodes"), TEXT("meshes"), TEXT("materials"), TEXT("textures"), TEXT("images"), TEXT("skins") };
+	static_assert(UE_ARRAY_COUNT(SectionsNames) == static_cast<int32>(EglTFRuntimeJsonSection::Num), "json sections names mismatch");
+
+	for (int32 SectionIndex = 0; SectionIndex < static_cast<int32>(EglTFRuntimeJsonSection::Num); SectionIndex++)
 	{
-		JsonItems.Add(JsonItem.ToSharedRef());
+		const TArray<TSharedPtr<FJsonValue>>* JsonArray;
+		if (Root->TryGetArrayField(SectionsNames[SectionIndex], JsonArray))
+		{
+			JsonSections[SectionIndex] = *JsonArray;
+		}
 	}
-
-	return true;
 }
 
-TSharedPtr<FJsonObject> FglTFRuntimeParser::GetJsonObjectFromIndex(TSharedRef<FJsonObject> JsonObject, const FString& FieldName, const int32 Index) const
+TSharedPtr<FJsonObject> FglTFRuntimeParser::GetJsonObjectFromRootIndex(const EglTFRuntimeJsonSection Section, const int32 Index) const
 {
-	TArray<TSharedRef<FJsonValue>> JsonArray;
-	if (!CheckJsonIndex(JsonObject, FieldName, Index, JsonArray))
+	const TArray<TSharedPtr<FJsonValue>>& JsonItems = JsonSections[static_cast<int32>(Section)];
+	if (!JsonItems.IsValidIndex(Index) || !JsonItems[Index])
 	{
 		return nullptr;
 	}
 
-	return JsonArray[Index]->AsObject();
+	return JsonItems[Index]->AsObject();
 }
 
 TSharedPtr<FJsonObject> FglTFRuntimeParser::GetJsonObjectFromExtensionIndex(TSharedRef<FJsonObject> JsonObject, const FString& ExtensionName, const FString& FieldName, const int32 Index)
@@ -2171,7 +2902,7 @@ bool FglTFRuntimeParser::LoadCameraIntoCameraComponent(const int32 CameraIndex,
 
 USkeleton* FglTFRuntimeParser::LoadSkeleton(const int32 SkinIndex, const FglTFRuntimeSkeletonConfig& SkeletonConfig)
 {
-	TSharedPtr<FJsonObject> JsonSkinObject = GetJsonObjectFromRootIndex("skins", SkinIndex);
+	TSharedPtr<FJsonObject> JsonSkinObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Skins, SkinIndex);
 	if (!JsonSkinObject)
 	{
 		return nullptr;
@@ -2914,6 +3645,22 @@ bool FglTFRuntimeParser::LoadPrimitives(TSharedRef<FJsonObject> JsonMeshObject,
 
 	int32 FirstPrimitive = Primitives.Num();
 
+	// blobs of the previous meshes of this load are gone, but concurrent async loads may still hold ranges
+	if (AsyncLoadsCounter.GetValue() == 0)
+	{
+		TrimBufferRangesCache();
+	}
+
+	TArray<int32> AccessorIndices;
+	GetPrimitivesAccessors(*JsonPrimitives, AccessorIndices);
+	PrefetchPrimitivesExternalFiles(*JsonPrimitives, AccessorIndices);
+	PrefetchBufferRanges(AccessorIndices);
+	DecompressMeshOptimizerBufferViews(AccessorIndices);
+	// the copies are owned by this call, GetAccessor() finds them through the scope
+	TMap<int32, TArray64<uint8>> DeinterleavedAccessors;
+	DeinterleaveAccessors(AccessorIndices, DeinterleavedAccessors);
+	glTFRuntime::FDeinterleavedAccessorsScope DeinterleavedAccessorsScope(this, DeinterleavedAccessors);
+
 	for (TSharedPtr<FJsonValue> JsonPrimitive : *JsonPrimitives)
 	{
 		TSharedPtr<FJsonObject> JsonPrimitiveObject = JsonPrimitive->AsObject();
@@ -3094,6 +3841,8 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 		return false;
 	}
 
+	GetAccessorBounds(GetJsonObjectIndex(JsonAttributesObject->ToSharedRef(), "POSITION", INDEX_NONE), Primitive.PositionsBounds);
+
 	if ((*JsonAttributesObject)->HasField(TEXT("NORMAL")))
 	{
 		if (!BuildFromAccessorField(JsonAttributesObject->ToSharedRef(), "NORMAL", Primitive.Normals,
@@ -3485,6 +4234,12 @@ bool FglTFRuntimeParser::LoadPrimitive(TSharedRef<FJsonObject> JsonPrimitiveObje
 		}
 	}
 
+	// listeners can rewrite the positions, so the accessor bounds are no more reliable
+	if (OnLoadedPrimitive.IsBound())
+	{
+		Primitive.PositionsBounds.Init();
+	}
+
 	OnLoadedPrimitive.Broadcast(AsShared(), JsonPrimitiveObject, Primitive);
 
 	return true;
@@ -4103,6 +4858,7 @@ UMaterialInterface* FglTFRuntimeParser::TriangulatePoints(FglTFRuntimePrimitive&
 		Primitive.bDisableShadows = true;
 		Primitive.Indices = PointsIndices;
 		Primitive.Positions = PointsPositions;
+		Primitive.PositionsBounds.Init();
 		if (bHasNormals)
 		{
 			Primitive.Normals = PointsNormals;
@@ -4354,6 +5110,7 @@ UMaterialInterface* FglTFRuntimeParser::TriangulateLines(FglTFRuntimePrimitive&
 		Primitive.bDisableShadows = true;
 		Primitive.Indices = LinesIndices;
 		Primitive.Positions = LinesPositions;
+		Primitive.PositionsBounds.Init();
 		Primitive.UVs = { LinesUV };
 		if (bUVXY)
 		{
@@ -4398,18 +5155,32 @@ bool FglTFRuntimeParser::GetBuffer(const int32 Index, FglTFRuntimeBlob& Blob)
 		return false;
 	}
 
-	if (Index == 0 && BinaryBuffer.Num() > 0)
+	if (Index == 0 && MappedBinaryBuffer.Num > 0)
 	{
-		Blob.Data = BinaryBuffer.GetData();
-		Blob.Num = BinaryBuffer.Num();
+		Blob = MappedBinaryBuffer;
+		return true;
+	}
+
+	if (Index == 0 && BinaryBuffer && BinaryBuffer->Num() > 0)
+	{
+		Blob.Data = BinaryBuffer->GetData();
+		Blob.Num = BinaryBuffer->Num();
+		return true;
+	}
+
+	// while streaming, only the already received part of the binary chunk is exposed
+	if (Index == 0 && StreamingBinaryBuffer)
+	{
+		Blob.Data = const_cast<uint8*>(StreamingBinaryBuffer->GetData());
+		Blob.Num = StreamingBinaryBuffer->NumAvailable();
 		return true;
 	}
 
 	// first check cache
 	if (BuffersCache.Contains(Index))
 	{
-		Blob.Data = BuffersCache[Index].GetData();
-		Blob.Num = BuffersCache[Index].Num();
+		Blob.Data = BuffersCache[Index]->GetData();
+		Blob.Num = BuffersCache[Index]->Num();
 		return true;
 	}
 
@@ -4421,96 +5192,632 @@ bool FglTFRuntimeParser::GetBuffer(const int32 Index, FglTFRuntimeBlob& Blob)
 		return false;
 	}
 
-	if (Index >= JsonBuffers->Num())
+	if (Index >= JsonBuffers->Num())
+	{
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> JsonBufferObject = (*JsonBuffers)[Index]->AsObject();
+	if (!JsonBufferObject)
+	{
+		return false;
+	}
+
+	int64 ByteLength;
+	if (!JsonBufferObject->TryGetNumberField(TEXT("byteLength"), ByteLength))
+	{
+		return false;
+	}
+
+	FString Uri;
+	if (!JsonBufferObject->TryGetStringField(TEXT("uri"), Uri))
+	{
+		return false;
+	}
+
+	// check it is a valid base64 data uri
+	if (Uri.StartsWith("data:"))
+	{
+		TArray64<uint8> Base64Data;
+		if (ParseBase64Uri(Uri, Base64Data))
+		{
+			BuffersCache.Add(Index, MakeShared<TArray64<uint8>, ESPMode::ThreadSafe>(MoveTemp(Base64Data)));
+			Blob.Data = BuffersCache[Index]->GetData();
+			Blob.Num = BuffersCache[Index]->Num();
+			return true;
+		}
+		return false;
+	}
+
+	if (Archive)
+	{
+		TArray64<uint8> ArchiveItemData;
+		if (Archive->GetFileContent(Uri, ArchiveItemData))
+		{
+			{
+				FScopeLock Lock(&BufferRangesLock);
+				BuffersIOStats.BytesRead += ArchiveItemData.Num();
+			}
+			BuffersCache.Add(Index, MakeShared<TArray64<uint8>, ESPMode::ThreadSafe>(MoveTemp(ArchiveItemData)));
+			Blob.Data = BuffersCache[Index]->GetData();
+			Blob.Num = BuffersCache[Index]->Num();
+			return true;
+		}
+	}
+
+	// fallback
+	if (!BaseDirectory.IsEmpty())
+	{
+		TArray64<uint8> FileData;
+		const FString FilePath = FPaths::Combine(BaseDirectory, Uri);
+		if ((AsyncFileReader && AsyncFileReader->Consume(FilePath, FileData)) || FFileHelper::LoadFileToArray(FileData, *FilePath))
+		{
+			{
+				FScopeLock Lock(&BufferRangesLock);
+				BuffersIOStats.BytesRead += FileData.Num();
+			}
+			BuffersCache.Add(Index, MakeShared<TArray64<uint8>, ESPMode::ThreadSafe>(MoveTemp(FileData)));
+			Blob.Data = BuffersCache[Index]->GetData();
+			Blob.Num = BuffersCache[Index]->Num();
+			return true;
+		}
+	}
+
+	AddError("GetBuffer()", FString::Printf(TEXT("Unable to load buffer %d from Uri %s (you may want to enable external files loading...)"), Index, *Uri));
+	return false;
+}
+
+namespace glTFRuntime
+{
+	struct FBase64DecodingTable
+	{
+		// 0xff marks invalid characters (including padding)
+		uint8 Values[256];
+
+		FBase64DecodingTable()
+		{
+			FMemory::Memset(Values, 0xff, sizeof(Values));
+			const ANSICHAR* Alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+			for (int32 Index = 0; Index < 64; Index++)
+			{
+				Values[static_cast<uint8>(Alphabet[Index])] = static_cast<uint8>(Index);
+			}
+		}
+
+		template<typename CharType>
+		FORCEINLINE uint32 Get(const CharType Char) const
+		{
+			const uint32 Code = static_cast<uint32>(Char);
+			return Code < 256 ? Values[Code] : 0xff;
+		}
+	};
+
+	template<typename CharType>
+	bool DecodeBase64Quads(const FBase64DecodingTable& Table, const CharType* Chars, const int64 NumQuads, uint8* Bytes)
+	{
+		for (int64 Quad = 0; Quad < NumQuads; Quad++)
+		{
+			const uint32 A = Table.Get(Chars[0]);
+			const uint32 B = Table.Get(Chars[1]);
+			const uint32 C = Table.Get(Chars[2]);
+			const uint32 D = Table.Get(Chars[3]);
+			if ((A | B | C | D) & 0x80)
+			{
+				return false;
+			}
+
+			const uint32 Value = (A << 18) | (B << 12) | (C << 6) | D;
+			Bytes[0] = static_cast<uint8>(Value >> 16);
+			Bytes[1] = static_cast<uint8>(Value >> 8);
+			Bytes[2] = static_cast<uint8>(Value);
+
+			Chars += 4;
+			Bytes += 3;
+		}
+		return true;
+	}
+}
+
+bool FglTFRuntimeParser::DecodeBase64(const TCHAR* Chars, int64 Len, TArray64<uint8>& Bytes)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_DecodeBase64, FColor::Magenta);
+
+	static const glTFRuntime::FBase64DecodingTable Table;
+
+	// padding is optional
+	for (int32 PaddingIndex = 0; PaddingIndex < 2 && Len > 0 && Chars[Len - 1] == '='; PaddingIndex++)
+	{
+		Len--;
+	}
+
+	const int64 NumQuads = Len / 4;
+	const int64 Remaining = Len % 4;
+	if (Remaining == 1)
+	{
+		return false;
+	}
+
+	const int64 Offset = Bytes.Num();
+	Bytes.AddUninitialized(NumQuads * 3 + (Remaining > 0 ? Remaining - 1 : 0));
+	uint8* Output = Bytes.GetData() + Offset;
+
+	// big data uris (embedded buffers) are split in independent batches
+	constexpr int64 BatchQuads = 64 * 1024;
+	const int64 NumBatches = (NumQuads + BatchQuads - 1) / BatchQuads;
+	FThreadSafeBool bBase64Success = true;
+	ParallelFor(NumBatches, [&](const int32 BatchIndex)
+		{
+			const int64 FirstQuad = BatchIndex * BatchQuads;
+			if (!glTFRuntime::DecodeBase64Quads(Table, Chars + FirstQuad * 4, FMath::Min(BatchQuads, NumQuads - FirstQuad), Output + FirstQuad * 3))
+			{
+				bBase64Success = false;
+			}
+		}, NumBatches < 2);
+
+	if (!bBase64Success)
+	{
+		Bytes.SetNum(Offset);
+		return false;
+	}
+
+	if (Remaining > 0)
+	{
+		const TCHAR* Tail = Chars + NumQuads * 4;
+		uint32 Value = 0;
+		for (int64 Index = 0; Index < Remaining; Index++)
+		{
+			const uint32 Bits = Table.Get(Tail[Index]);
+			if (Bits & 0x80)
+			{
+				Bytes.SetNum(Offset);
+				return false;
+			}
+			Value |= Bits << (18 - Index * 6);
+		}
+
+		uint8* TailOutput = Output + NumQuads * 3;
+		TailOutput[0] = static_cast<uint8>(Value >> 16);
+		if (Remaining == 3)
+		{
+			TailOutput[1] = static_cast<uint8>(Value >> 8);
+		}
+	}
+
+	return true;
+}
+
+bool FglTFRuntimeParser::ParseBase64Uri(const FString& Uri, TArray64<uint8>& Bytes)
+{
+	const FString Base64Signature = ";base64,";
+
+	int32 StringIndex = Uri.Find(Base64Signature, ESearchCase::IgnoreCase, ESearchDir::FromStart, 5);
+
+	if (StringIndex < 5)
+		return false;
+
+	StringIndex += Base64Signature.Len();
+
+	// decode straight from the uri memory
+	return DecodeBase64(*Uri + StringIndex, Uri.Len() - StringIndex, Bytes);
+}
+
+bool FglTFRuntimeParser::GetBufferRange(const int32 BufferIndex, const int64 ByteOffset, const int64 ByteLength, FglTFRuntimeBlob& Blob)
+{
+	if (ByteOffset < 0 || ByteLength < 0)
+	{
+		return false;
+	}
+
+	const FglTFRuntimeBufferRangeKey RangeKey(BufferIndex, ByteOffset, ByteLength);
+	TSharedPtr<FglTFRuntimeDataSource> LazySource = nullptr;
+	{
+		FScopeLock Lock(&BufferRangesLock);
+		bool bAlreadyReferenced = false;
+		ReferencedBufferRanges.Add(RangeKey, &bAlreadyReferenced);
+		if (!bAlreadyReferenced)
+		{
+			BuffersIOStats.BytesReferenced += ByteLength;
+		}
+
+		if (IsLazyBuffer(BufferIndex))
+		{
+			LazySource = GetLazyBufferSource(BufferIndex);
+		}
+	}
+
+	if (!LazySource)
+	{
+		FglTFRuntimeBlob BufferBlob;
+		if (!GetBuffer(BufferIndex, BufferBlob))
+		{
+			return false;
+		}
+
+		if (ByteOffset + ByteLength > BufferBlob.Num)
+		{
+			if (BufferIndex == 0 && StreamingBinaryBuffer && ByteOffset + ByteLength <= StreamingBinaryBuffer->Num())
+			{
+				AddError("GetBufferRange()", FString::Printf(TEXT("Range %lld/%lld of the binary chunk has not been received yet"), ByteOffset, ByteLength));
+			}
+			return false;
+		}
+
+		Blob.Data = BufferBlob.Data + ByteOffset;
+		Blob.Num = ByteLength;
+		return true;
+	}
+
+	if (ByteLength == 0)
+	{
+		Blob.Data = nullptr;
+		Blob.Num = 0;
+		return true;
+	}
+
+	{
+		FScopeLock Lock(&BufferRangesLock);
+		if (FglTFRuntimeBufferRange* BufferRange = BufferRangesCache.Find(RangeKey))
+		{
+			BuffersIOStats.RangesCacheHits++;
+			BufferRange->LastUse = ++BufferRangesCacheTick;
+			Blob.Data = BufferRange->Data.GetData();
+			Blob.Num = BufferRange->Data.Num();
+			return true;
+		}
+	}
+
+	// the read happens outside of the lock, so concurrent loads are not serialized on IO
+	FglTFRuntimeBufferRange NewBufferRange;
+	if (!LazySource->CopyRange(ByteOffset, ByteLength, NewBufferRange.Data))
+	{
+		AddError("GetBufferRange()", FString::Printf(TEXT("Unable to read range %lld/%lld from buffer %d"), ByteOffset, ByteLength, BufferIndex));
+		return false;
+	}
+
+	FScopeLock Lock(&BufferRangesLock);
+
+	// another load may have read the same range in the meantime: its blobs must stay valid
+	if (FglTFRuntimeBufferRange* BufferRange = BufferRangesCache.Find(RangeKey))
+	{
+		BuffersIOStats.RangesCacheHits++;
+		BufferRange->LastUse = ++BufferRangesCacheTick;
+		Blob.Data = BufferRange->Data.GetData();
+		Blob.Num = BufferRange->Data.Num();
+		return true;
+	}
+
+	BuffersIOStats.RangesCacheMisses++;
+	BuffersIOStats.BytesRead += ByteLength;
+	BufferRangesCacheSize += ByteLength;
+	NewBufferRange.LastUse = ++BufferRangesCacheTick;
+
+	// the range data is heap allocated, so blobs survive the map growing
+	FglTFRuntimeBufferRange& BufferRange = BufferRangesCache.Add(RangeKey, MoveTemp(NewBufferRange));
+	Blob.Data = BufferRange.Data.GetData();
+	Blob.Num = BufferRange.Data.Num();
+	return true;
+}
+
+TSharedPtr<FglTFRuntimeDataSource> FglTFRuntimeParser::GetLazyBufferSource(const int32 Index)
+{
+	if (const TSharedPtr<FglTFRuntimeDataSource>* LazySource = LazyBuffersSources.Find(Index))
+	{
+		return *LazySource;
+	}
+
+	// the binary chunk of a FArchive is never loaded as a whole
+	if (Index == 0 && BinaryChunkSource)
+	{
+		LazyBuffersSources.Add(Index, BinaryChunkSource);
+		return BinaryChunkSource;
+	}
+
+	TSharedPtr<FglTFRuntimeDataSource> LazySource = nullptr;
+
+	// only external files not already in memory (binary chunk, data uris and archives are always loaded as a whole)
+	const bool bHasBinaryChunk = Index == 0 && (MappedBinaryBuffer.Num > 0 || (BinaryBuffer && BinaryBuffer->Num() > 0) || StreamingBinaryBuffer);
+	if (!bHasBinaryChunk && !BuffersCache.Contains(Index) && !BaseDirectory.IsEmpty())
+	{
+		TSharedPtr<FJsonObject> JsonBufferObject = GetJsonObjectFromRootIndex("buffers", Index);
+		FString Uri;
+		if (JsonBufferObject && JsonBufferObject->TryGetStringField(TEXT("uri"), Uri) && !Uri.StartsWith("data:") && !(Archive && Archive->FileExists(Uri)))
+		{
+			LazySource = FglTFRuntimeFileDataSource::Open(FPaths::Combine(BaseDirectory, Uri));
+		}
+	}
+
+	LazyBuffersSources.Add(Index, LazySource);
+	return LazySource;
+}
+
+void FglTFRuntimeParser::PrefetchBufferRanges(const TArray<int32>& AccessorIndices)
+{
+	if (!bLoadExternalBuffersLazily && !BinaryChunkSource)
+	{
+		return;
+	}
+
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_PrefetchBufferRanges, FColor::Magenta);
+
+	struct FBufferRangeRead
+	{
+		FglTFRuntimeBufferRangeKey RangeKey;
+		TSharedPtr<FglTFRuntimeDataSource> LazySource;
+		FglTFRuntimeBufferRange BufferRange;
+		bool bSuccess;
+	};
+
+	TArray<FBufferRangeRead> Reads;
+	for (const int32 AccessorIndex : AccessorIndices)
+	{
+		FglTFRuntimeAccessorEntry AccessorEntry;
+		if (!GetAccessorEntry(AccessorIndex, AccessorEntry) || AccessorEntry.BufferView == INDEX_NONE)
+		{
+			continue;
+		}
+
+		// compressed bufferViews are read by the meshopt path
+		FglTFRuntimeBufferViewEntry BufferViewEntry;
+		if (!GetBufferViewEntry(AccessorEntry.BufferView, BufferViewEntry) || BufferViewEntry.bHasExtensions || BufferViewEntry.Buffer < 0 || BufferViewEntry.ByteLength <= 0)
+		{
+			continue;
+		}
+
+		const FglTFRuntimeBufferRangeKey RangeKey(BufferViewEntry.Buffer, BufferViewEntry.ByteOffset, BufferViewEntry.ByteLength);
+		if (Reads.ContainsByPredicate([&RangeKey](const FBufferRangeRead& Read) { return Read.RangeKey == RangeKey; }))
+		{
+			continue;
+		}
+
+		TSharedPtr<FglTFRuntimeDataSource> LazySource = nullptr;
+		{
+			FScopeLock Lock(&BufferRangesLock);
+			if (BufferRangesCache.Contains(RangeKey) || !IsLazyBuffer(BufferViewEntry.Buffer))
+			{
+				continue;
+			}
+			LazySource = GetLazyBufferSource(BufferViewEntry.Buffer);
+		}
+
+		if (!LazySource)
+		{
+			continue;
+		}
+
+		FBufferRangeRead Read;
+		Read.RangeKey = RangeKey;
+		Read.LazySource = LazySource;
+		Read.bSuccess = false;
+		Reads.Add(MoveTemp(Read));
+	}
+
+	// file data sources use a handle per call, so the ranges can be read concurrently
+	ParallelFor(Reads.Num(), [&](const int32 ReadIndex)
+		{
+			FBufferRangeRead& Read = Reads[ReadIndex];
+			Read.bSuccess = Read.LazySource->CopyRange(Read.RangeKey.Get<1>(), Read.RangeKey.Get<2>(), Read.BufferRange.Data);
+		}, Reads.Num() < 2);
+
+	// failed reads will be retried (and reported) by GetBufferRange()
+	FScopeLock Lock(&BufferRangesLock);
+	for (FBufferRangeRead& Read : Reads)
+	{
+		// ranges added by concurrent loads are kept, as their blobs may be in use
+		if (Read.bSuccess && !BufferRangesCache.Contains(Read.RangeKey))
+		{
+			BuffersIOStats.RangesCacheMisses++;
+			BuffersIOStats.BytesRead += Read.BufferRange.Data.Num();
+			BufferRangesCacheSize += Read.BufferRange.Data.Num();
+			Read.BufferRange.LastUse = ++BufferRangesCacheTick;
+			BufferRangesCache.Add(Read.RangeKey, MoveTemp(Read.BufferRange));
+		}
+	}
+}
+
+FString FglTFRuntimeParser::GetExternalFilePath(const FString& Uri) const
+{
+	FString DecodedUri = Uri;
+	// this is a bit annoying (and very hacky) but we need to support % in filesystem names...
+	if (DecodedUri.Contains("%") && !FPaths::FileExists(FPaths::Combine(BaseDirectory, DecodedUri)))
 	{
-		return false;
+		DecodedUri = FGenericPlatformHttp::UrlDecode(DecodedUri);
 	}
+	return FPaths::Combine(BaseDirectory, DecodedUri);
+}
 
-	TSharedPtr<FJsonObject> JsonBufferObject = (*JsonBuffers)[Index]->AsObject();
-	if (!JsonBufferObject)
+void FglTFRuntimeParser::PrefetchExternalFiles(const int32 MaxReadsInFlight, const int64 MaxResidentBytes)
+{
+	if (Archive || BaseDirectory.IsEmpty() || AsyncFileReader)
 	{
-		return false;
+		return;
 	}
 
-	int64 ByteLength;
-	if (!JsonBufferObject->TryGetNumberField(TEXT("byteLength"), ByteLength))
+	// files are enqueued by LoadPrimitives(), only for the meshes actually loaded
+	AsyncFileReader = MakeShared<FglTFRuntimeAsyncFileReader, ESPMode::ThreadSafe>(MaxReadsInFlight, MaxResidentBytes);
+}
+
+void FglTFRuntimeParser::PrefetchPrimitivesExternalFiles(const TArray<TSharedPtr<FJsonValue>>& JsonPrimitives, const TArray<int32>& AccessorIndices)
+{
+	if (!AsyncFileReader)
 	{
-		return false;
+		return;
 	}
 
-	FString Uri;
-	if (!JsonBufferObject->TryGetStringField(TEXT("uri"), Uri))
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_PrefetchPrimitivesExternalFiles, FColor::Magenta);
+
+	auto IsExternalFile = [](const FString& Uri)
+		{
+			return !Uri.IsEmpty() && !Uri.StartsWith("data:") && !Uri.StartsWith("http://") && !Uri.StartsWith("https://");
+		};
+
+	int32 NumFiles = 0;
+
+	// buffers already loaded (or loaded lazily) are skipped
+	const TArray<TSharedPtr<FJsonValue>>* JsonBuffers;
+	if (!bLoadExternalBuffersLazily && Root->TryGetArrayField(TEXT("buffers"), JsonBuffers))
 	{
-		return false;
+		TSet<int64> BufferIndices;
+		for (const int32 AccessorIndex : AccessorIndices)
+		{
+			FglTFRuntimeAccessorEntry AccessorEntry;
+			FglTFRuntimeBufferViewEntry BufferViewEntry;
+			if (GetAccessorEntry(AccessorIndex, AccessorEntry) && AccessorEntry.BufferView != INDEX_NONE && GetBufferViewEntry(AccessorEntry.BufferView, BufferViewEntry))
+			{
+				BufferIndices.Add(BufferViewEntry.Buffer);
+			}
+		}
+
+		for (const int64 BufferIndex : BufferIndices)
+		{
+			if (!JsonBuffers->IsValidIndex(BufferIndex) || BuffersCache.Contains(BufferIndex))
+			{
+				continue;
+			}
+
+			TSharedPtr<FJsonObject> JsonBufferObject = (*JsonBuffers)[BufferIndex] ? (*JsonBuffers)[BufferIndex]->AsObject() : nullptr;
+			FString Uri;
+			if (JsonBufferObject && JsonBufferObject->TryGetStringField(TEXT("uri"), Uri) && IsExternalFile(Uri))
+			{
+				// GetBuffer() does not decode the uri
+				AsyncFileReader->Enqueue(FPaths::Combine(BaseDirectory, Uri));
+				NumFiles++;
+			}
+		}
 	}
 
-	// check it is a valid base64 data uri
-	if (Uri.StartsWith("data:"))
+	// images of the materials that are going to be built
+	TSet<int64> TextureIndices;
+	TFunction<void(const TSharedPtr<FJsonObject>&)> AddTextures = [&](const TSharedPtr<FJsonObject>& JsonObject)
+		{
+			for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : JsonObject->Values)
+			{
+				const TSharedPtr<FJsonObject>* JsonChildObject;
+				if (!Pair.Value || !Pair.Value->TryGetObject(JsonChildObject))
+				{
+					continue;
+				}
+
+				int64 TextureIndex;
+				if (Pair.Key.EndsWith("Texture") && (*JsonChildObject)->TryGetNumberField(TEXT("index"), TextureIndex) && !TexturesCache.Contains(TextureIndex))
+				{
+					TextureIndices.Add(TextureIndex);
+				}
+				AddTextures(*JsonChildObject);
+			}
+		};
+
+	for (const TSharedPtr<FJsonValue>& JsonPrimitive : JsonPrimitives)
 	{
-		TArray64<uint8> Base64Data;
-		if (ParseBase64Uri(Uri, Base64Data))
+		TSharedPtr<FJsonObject> JsonPrimitiveObject = JsonPrimitive ? JsonPrimitive->AsObject() : nullptr;
+		int64 MaterialIndex;
+		if (!JsonPrimitiveObject || !JsonPrimitiveObject->TryGetNumberField(TEXT("material"), MaterialIndex) || MaterialsCache.Contains(MaterialIndex))
 		{
-			BuffersCache.Add(Index, Base64Data);
-			Blob.Data = BuffersCache[Index].GetData();
-			Blob.Num = BuffersCache[Index].Num();
-			return true;
+			continue;
+		}
+
+		TSharedPtr<FJsonObject> JsonMaterialObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Materials, MaterialIndex);
+		if (JsonMaterialObject)
+		{
+			AddTextures(JsonMaterialObject);
 		}
-		return false;
 	}
 
-	if (Archive)
+	TSet<int64> ImageIndices;
+	for (const int64 TextureIndex : TextureIndices)
 	{
-		TArray64<uint8> ArchiveItemData;
-		if (Archive->GetFileContent(Uri, ArchiveItemData))
+		TSharedPtr<FJsonObject> JsonTextureObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Textures, TextureIndex);
+		if (!JsonTextureObject)
 		{
-			BuffersCache.Add(Index, ArchiveItemData);
-			Blob.Data = BuffersCache[Index].GetData();
-			Blob.Num = BuffersCache[Index].Num();
-			return true;
+			continue;
+		}
+
+		int64 ImageIndex;
+		if (JsonTextureObject->TryGetNumberField(TEXT("source"), ImageIndex))
+		{
+			ImageIndices.Add(ImageIndex);
+		}
+
+		// KHR_texture_basisu, EXT_texture_webp...
+		const TSharedPtr<FJsonObject>* JsonExtensionsObject;
+		if (JsonTextureObject->TryGetObjectField(TEXT("extensions"), JsonExtensionsObject))
+		{
+			for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*JsonExtensionsObject)->Values)
+			{
+				const TSharedPtr<FJsonObject>* JsonExtensionObject;
+				if (Pair.Value && Pair.Value->TryGetObject(JsonExtensionObject) && (*JsonExtensionObject)->TryGetNumberField(TEXT("source"), ImageIndex))
+				{
+					ImageIndices.Add(ImageIndex);
+				}
+			}
 		}
 	}
 
-	// fallback
-	if (!BaseDirectory.IsEmpty())
+	for (const int64 ImageIndex : ImageIndices)
 	{
-		TArray64<uint8> FileData;
-		if (FFileHelper::LoadFileToArray(FileData, *FPaths::Combine(BaseDirectory, Uri)))
+		TSharedPtr<FJsonObject> JsonImageObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Images, ImageIndex);
+		FString Uri;
+		if (JsonImageObject && JsonImageObject->TryGetStringField(TEXT("uri"), Uri) && IsExternalFile(Uri))
 		{
-			BuffersCache.Add(Index, FileData);
-			Blob.Data = BuffersCache[Index].GetData();
-			Blob.Num = BuffersCache[Index].Num();
-			return true;
+			AsyncFileReader->Enqueue(GetExternalFilePath(Uri));
+			NumFiles++;
 		}
 	}
 
-	AddError("GetBuffer()", FString::Printf(TEXT("Unable to load buffer %d from Uri %s (you may want to enable external files loading...)"), Index, *Uri));
-	return false;
+	if (NumFiles > 0)
+	{
+		AsyncFileReader->StartPending();
+	}
 }
 
-bool FglTFRuntimeParser::ParseBase64Uri(const FString& Uri, TArray64<uint8>& Bytes)
+void FglTFRuntimeParser::TrimBufferRangesCache()
 {
-	const FString Base64Signature = ";base64,";
-
-	int32 StringIndex = Uri.Find(Base64Signature, ESearchCase::IgnoreCase, ESearchDir::FromStart, 5);
-
-	if (StringIndex < 5)
-		return false;
+	FScopeLock Lock(&BufferRangesLock);
 
-	StringIndex += Base64Signature.Len();
+	if (BufferRangesCacheSize <= BufferRangesCacheMaxSize)
+	{
+		return;
+	}
 
-	TArray<uint8> BytesBase64;
+	// least recently used first
+	BufferRangesCache.ValueSort([](const FglTFRuntimeBufferRange& A, const FglTFRuntimeBufferRange& B)
+		{
+			return A.LastUse < B.LastUse;
+		});
 
-	bool bSuccess = FBase64::Decode(Uri.Mid(StringIndex), BytesBase64);
-	if (bSuccess)
+	for (auto It = BufferRangesCache.CreateIterator(); It && BufferRangesCacheSize > BufferRangesCacheMaxSize; ++It)
 	{
-		Bytes.Append(BytesBase64);
+		BufferRangesCacheSize -= It.Value().Data.Num();
+		BuffersIOStats.RangesCacheEvictedBytes += It.Value().Data.Num();
+		It.RemoveCurrent();
 	}
-	return bSuccess;
 }
 
 bool FglTFRuntimeParser::GetBufferView(const int32 Index, FglTFRuntimeBlob& Blob, int64& Stride)
 {
-	TSharedPtr<FJsonObject> JsonBufferViewObject = GetJsonObjectFromRootIndex("bufferViews", Index);
+	FglTFRuntimeBufferViewEntry BufferViewEntry;
+	if (!GetBufferViewEntry(Index, BufferViewEntry))
+	{
+		return false;
+	}
+
+	// extensions (like EXT_meshopt_compression) require the full json object
+	if (!BufferViewEntry.bHasExtensions)
+	{
+		if (BufferViewEntry.Buffer < 0 || BufferViewEntry.ByteLength < 0)
+		{
+			return false;
+		}
+
+		if (!GetBufferRange(BufferViewEntry.Buffer, BufferViewEntry.ByteOffset, BufferViewEntry.ByteLength, Blob))
+		{
+			return false;
+		}
+
+		Stride = BufferViewEntry.ByteStride;
+		return true;
+	}
+
+	TSharedPtr<FJsonObject> JsonBufferViewObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::BufferViews, Index);
 	if (!JsonBufferViewObject)
 	{
 		return false;
@@ -4520,10 +5827,11 @@ bool FglTFRuntimeParser::GetBufferView(const int32 Index, FglTFRuntimeBlob& Blob
 	if (JsonBufferViewCompressedObject)
 	{
 		JsonBufferViewObject = JsonBufferViewCompressedObject;
-		if (CompressedBufferViewsCache.Contains(Index))
+		FScopeLock Lock(&CompressedBufferViewsLock);
+		if (const TArray64<uint8>* UncompressedBytes = CompressedBufferViewsCache.Find(Index))
 		{
-			Blob.Data = CompressedBufferViewsCache[Index].GetData();
-			Blob.Num = CompressedBufferViewsCache[Index].Num();
+			Blob.Data = UncompressedBytes->GetData();
+			Blob.Num = UncompressedBytes->Num();
 			Stride = CompressedBufferViewsStridesCache[Index];
 			return true;
 		}
@@ -4535,12 +5843,6 @@ bool FglTFRuntimeParser::GetBufferView(const int32 Index, FglTFRuntimeBlob& Blob
 		return false;
 	}
 
-	FglTFRuntimeBlob BufferBlob;
-	if (!GetBuffer(BufferIndex, BufferBlob))
-	{
-		return false;
-	}
-
 	int64 ByteLength;
 	if (!JsonBufferViewObject->TryGetNumberField(TEXT("byteLength"), ByteLength))
 	{
@@ -4558,14 +5860,11 @@ bool FglTFRuntimeParser::GetBufferView(const int32 Index, FglTFRuntimeBlob& Blob
 		Stride = 0;
 	}
 
-	if (ByteOffset + ByteLength > BufferBlob.Num)
+	if (!GetBufferRange(BufferIndex, ByteOffset, ByteLength, Blob))
 	{
 		return false;
 	}
 
-	Blob.Data = BufferBlob.Data + ByteOffset;
-	Blob.Num = ByteLength;
-
 	if (JsonBufferViewCompressedObject)
 	{
 		// decompress bitstream
@@ -4589,15 +5888,22 @@ bool FglTFRuntimeParser::GetBufferView(const int32 Index, FglTFRuntimeBlob& Blob
 			MeshOptFilter = "NONE";
 		}
 
-		CompressedBufferViewsCache.Add(Index);
-		if (!DecompressMeshOptimizer(Blob, Stride, Elements, MeshOptMode, MeshOptFilter, CompressedBufferViewsCache[Index]))
+		// decoded outside of the lock, the first copy wins if another load decoded it in the meantime
+		TArray64<uint8> UncompressedBytes;
+		if (!DecompressMeshOptimizer(Blob, Stride, Elements, MeshOptMode, MeshOptFilter, UncompressedBytes))
 		{
-			CompressedBufferViewsCache.Remove(Index);
 			return false;
 		}
+
+		FScopeLock Lock(&CompressedBufferViewsLock);
+		if (!CompressedBufferViewsCache.Contains(Index))
+		{
+			CompressedBufferViewsCache.Add(Index, MoveTemp(UncompressedBytes));
+			CompressedBufferViewsStridesCache.Add(Index, Stride);
+		}
 		Blob.Data = CompressedBufferViewsCache[Index].GetData();
 		Blob.Num = CompressedBufferViewsCache[Index].Num();
-		CompressedBufferViewsStridesCache.Add(Index, Stride);
+		Stride = CompressedBufferViewsStridesCache[Index];
 	}
 
 	return true;
@@ -4606,57 +5912,42 @@ bool FglTFRuntimeParser::GetBufferView(const int32 Index, FglTFRuntimeBlob& Blob
 bool FglTFRuntimeParser::GetAccessor(const int32 Index, int64& ComponentType, int64& Stride, int64& Elements, int64& ElementSize, int64& Count, bool& bNormalized, FglTFRuntimeBlob& Blob, const FglTFRuntimeBlob* AdditionalBufferView)
 {
 
-	TSharedPtr<FJsonObject> JsonAccessorObject = GetJsonObjectFromRootIndex("accessors", Index);
-	if (!JsonAccessorObject)
+	FglTFRuntimeAccessorEntry AccessorEntry;
+	if (!GetAccessorEntry(Index, AccessorEntry))
 	{
 		return false;
 	}
 
 	bool bInitWithZeros = false;
-	bool bHasSparse = false;
+	const bool bHasSparse = AccessorEntry.bHasSparse;
 
 	int64 BufferViewIndex = INDEX_NONE;
 	int64 ByteOffset = 0;
 
 	if (!AdditionalBufferView)
 	{
-		if (!JsonAccessorObject->TryGetNumberField(TEXT("bufferView"), BufferViewIndex))
+		BufferViewIndex = AccessorEntry.BufferView;
+		if (BufferViewIndex == INDEX_NONE)
 		{
 			bInitWithZeros = true;
 		}
 
-
-		if (!JsonAccessorObject->TryGetNumberField(TEXT("byteOffset"), ByteOffset))
-		{
-			ByteOffset = 0;
-		}
-	}
-
-	const TSharedPtr<FJsonObject>* JsonSparseObject = nullptr;
-	if (JsonAccessorObject->TryGetObjectField(TEXT("sparse"), JsonSparseObject))
-	{
-		bHasSparse = true;
-	}
-
-	const bool bOriginalNormalized = bNormalized;
-
-	if (!JsonAccessorObject->TryGetBoolField(TEXT("normalized"), bNormalized))
-	{
-		bNormalized = bOriginalNormalized;
+		ByteOffset = AccessorEntry.ByteOffset;
 	}
 
-	if (!JsonAccessorObject->TryGetNumberField(TEXT("componentType"), ComponentType))
+	if (AccessorEntry.bHasNormalized)
 	{
-		return false;
+		bNormalized = AccessorEntry.bNormalized;
 	}
 
-	if (!JsonAccessorObject->TryGetNumberField(TEXT("count"), Count))
+	ComponentType = AccessorEntry.ComponentType;
+	if (ComponentType == INDEX_NONE)
 	{
 		return false;
 	}
 
-	FString Type;
-	if (!JsonAccessorObject->TryGetStringField(TEXT("type"), Type))
+	Count = AccessorEntry.Count;
+	if (Count == INDEX_NONE)
 	{
 		return false;
 	}
@@ -4667,7 +5958,7 @@ bool FglTFRuntimeParser::GetAccessor(const int32 Index, int64& ComponentType, in
 		return false;
 	}
 
-	Elements = GetTypeSize(Type);
+	Elements = AccessorEntry.Elements;
 	if (Elements == 0)
 	{
 		return false;
@@ -4713,6 +6004,15 @@ bool FglTFRuntimeParser::GetAccessor(const int32 Index, int64& ComponentType, in
 	}
 	else
 	{
+		const TArray64<uint8>* DeinterleavedData = bHasSparse ? nullptr : glTFRuntime::FDeinterleavedAccessorsScope::Find(this, Index);
+		if (DeinterleavedData)
+		{
+			Blob.Data = const_cast<uint8*>(DeinterleavedData->GetData());
+			Blob.Num = DeinterleavedData->Num();
+			Stride = ElementSize * Elements;
+			return true;
+		}
+
 		if (!GetBufferView(BufferViewIndex, Blob, Stride))
 		{
 			return false;
@@ -4757,6 +6057,18 @@ bool FglTFRuntimeParser::GetAccessor(const int32 Index, int64& ComponentType, in
 		return true;
 	}
 
+	TSharedPtr<FJsonObject> JsonAccessorObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Accessors, Index);
+	if (!JsonAccessorObject)
+	{
+		return false;
+	}
+
+	const TSharedPtr<FJsonObject>* JsonSparseObject = nullptr;
+	if (!JsonAccessorObject->TryGetObjectField(TEXT("sparse"), JsonSparseObject))
+	{
+		return false;
+	}
+
 	int64 SparseCount;
 	if (!(*JsonSparseObject)->TryGetNumberField(TEXT("count"), SparseCount))
 	{
@@ -4952,19 +6264,212 @@ void FglTFRuntimeParser::AddReferencedObjects(FReferenceCollector& Collector)
 	Collector.AddReferencedObjects(ClearCoatMaterialsMap);
 }
 
-void FglTFRuntimeParser::ClearCache()
-{
-	StaticMeshesCache.Empty();
-	MaterialsCache.Empty();
-	SkeletonsCache.Empty();
-	SkeletalMeshesCache.Empty();
-	TexturesCache.Empty();
-	MaterialsNameCache.Empty();
-	MetallicRoughnessMaterialsMap.Empty();
-	SpecularGlossinessMaterialsMap.Empty();
-	UnlitMaterialsMap.Empty();
-	TransmissionMaterialsMap.Empty();
-	ClearCoatMaterialsMap.Empty();
+bool FglTFRuntimeParser::GetAccessorView(const int32 AccessorIndex, FglTFRuntimeAccessorView& AccessorView)
+{
+	int64 ComponentType = 0, Stride = 0, Elements = 0, ElementSize = 0, Count = 0;
+	bool bNormalized = false;
+	FglTFRuntimeBlob Blob;
+	if (!GetAccessor(AccessorIndex, ComponentType, Stride, Elements, ElementSize, Count, bNormalized, Blob, nullptr))
+	{
+		return false;
+	}
+
+	AccessorView.Count = Count;
+	AccessorView.Elements = Elements;
+	AccessorView.ComponentType = ComponentType;
+	AccessorView.ElementSize = ElementSize * Elements;
+	AccessorView.bNormalized = bNormalized;
+
+	auto IsInBuffer = [&Blob](const uint8* BufferData, const int64 BufferNum)
+		{
+			return BufferData && Blob.Data >= BufferData && Blob.Data + Blob.Num <= BufferData + BufferNum;
+		};
+
+	// the mapped file lives as long as the parser
+	if (IsInBuffer(MappedBinaryBuffer.Data, MappedBinaryBuffer.Num))
+	{
+		AccessorView.Data = Blob.Data;
+		AccessorView.Stride = Stride;
+		AccessorView.SetOwners(AsShared(), nullptr);
+		return true;
+	}
+
+	// the whole buffers are shared with the view, so TrimBuffers() can safely drop them
+	TSharedPtr<TArray64<uint8>, ESPMode::ThreadSafe> SharedBuffer = nullptr;
+	if (BinaryBuffer && IsInBuffer(BinaryBuffer->GetData(), BinaryBuffer->Num()))
+	{
+		SharedBuffer = BinaryBuffer;
+	}
+	else
+	{
+		for (const TPair<int32, TSharedRef<TArray64<uint8>, ESPMode::ThreadSafe>>& Pair : BuffersCache)
+		{
+			if (IsInBuffer(Pair.Value->GetData(), Pair.Value->Num()))
+			{
+				SharedBuffer = Pair.Value;
+				break;
+			}
+		}
+	}
+
+	if (SharedBuffer)
+	{
+		AccessorView.Data = Blob.Data;
+		AccessorView.Stride = Stride;
+		AccessorView.SetOwners(nullptr, SharedBuffer);
+		return true;
+	}
+
+	// sparse, compressed, deinterleaved and lazily loaded data live in caches that can be trimmed at any time
+	TSharedRef<TArray64<uint8>, ESPMode::ThreadSafe> OwnedData = MakeShared<TArray64<uint8>, ESPMode::ThreadSafe>();
+	OwnedData->AddUninitialized(AccessorView.ElementSize * Count);
+	for (int64 ElementIndex = 0; ElementIndex < Count; ElementIndex++)
+	{
+		FMemory::Memcpy(OwnedData->GetData() + ElementIndex * AccessorView.ElementSize, Blob.Data + ElementIndex * Stride, AccessorView.ElementSize);
+	}
+
+	AccessorView.Data = OwnedData->GetData();
+	AccessorView.Stride = AccessorView.ElementSize;
+	AccessorView.SetOwners(nullptr, OwnedData);
+	return true;
+}
+
+bool FglTFRuntimeParser::GetMeshPrimitiveAccessorView(const int32 MeshIndex, const int32 PrimitiveIndex, const FString& AttributeName, FglTFRuntimeAccessorView& AccessorView)
+{
+	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Meshes, MeshIndex);
+	if (!JsonMeshObject)
+	{
+		AddError("GetMeshPrimitiveAccessorView()", FString::Printf(TEXT("Unable to find mesh %d"), MeshIndex));
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> JsonPrimitiveObject = GetJsonObjectFromIndex(JsonMeshObject.ToSharedRef(), "primitives", PrimitiveIndex);
+	if (!JsonPrimitiveObject)
+	{
+		AddError("GetMeshPrimitiveAccessorView()", FString::Printf(TEXT("Unable to find primitive %d in mesh %d"), PrimitiveIndex, MeshIndex));
+		return false;
+	}
+
+	int32 AccessorIndex = INDEX_NONE;
+	if (AttributeName == "indices")
+	{
+		AccessorIndex = GetJsonObjectIndex(JsonPrimitiveObject.ToSharedRef(), "indices", INDEX_NONE);
+	}
+	else
+	{
+		const TSharedPtr<FJsonObject>* JsonAttributesObject;
+		if (JsonPrimitiveObject->TryGetObjectField(TEXT("attributes"), JsonAttributesObject))
+		{
+			AccessorIndex = GetJsonObjectIndex(JsonAttributesObject->ToSharedRef(), AttributeName, INDEX_NONE);
+		}
+	}
+
+	if (AccessorIndex <= INDEX_NONE)
+	{
+		return false;
+	}
+
+	return GetAccessorView(AccessorIndex, AccessorView);
+}
+
+void FglTFRuntimeParser::ClearCache()
+{
+	StaticMeshesCache.Empty();
+	MaterialsCache.Empty();
+	SkeletonsCache.Empty();
+	SkeletalMeshesCache.Empty();
+	TexturesCache.Empty();
+	MaterialsNameCache.Empty();
+	MetallicRoughnessMaterialsMap.Empty();
+	SpecularGlossinessMaterialsMap.Empty();
+	UnlitMaterialsMap.Empty();
+	TransmissionMaterialsMap.Empty();
+	ClearCoatMaterialsMap.Empty();
+
+	// prefetched files not consumed yet would be kept forever
+	if (AsyncFileReader)
+	{
+		AsyncFileReader->Reset();
+	}
+}
+
+int64 FglTFRuntimeParser::TrimBuffers()
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_TrimBuffers, FColor::Magenta);
+
+	// async loaders access the buffers without locking
+	if (AsyncLoadsCounter.GetValue() > 0)
+	{
+		UE_LOG(LogGLTFRuntime, Warning, TEXT("Unable to trim buffers while %d async loads are running"), AsyncLoadsCounter.GetValue());
+		return 0;
+	}
+
+	int64 ReleasedBytes = 0;
+
+	// all of them are rebuilt on demand by GetBuffer(), GetBufferView() and GetAccessor()
+	auto EmptyCache = [&ReleasedBytes](TMap<int32, TArray64<uint8>>& Cache)
+		{
+			for (const TPair<int32, TArray64<uint8>>& Pair : Cache)
+			{
+				ReleasedBytes += Pair.Value.GetAllocatedSize();
+			}
+			Cache.Empty();
+		};
+
+	// buffers still referenced by accessor views are released with the last view
+	for (const TPair<int32, TSharedRef<TArray64<uint8>, ESPMode::ThreadSafe>>& Pair : BuffersCache)
+	{
+		if (Pair.Value.IsUnique())
+		{
+			ReleasedBytes += Pair.Value->GetAllocatedSize();
+		}
+	}
+	BuffersCache.Empty();
+
+	{
+		FScopeLock Lock(&CompressedBufferViewsLock);
+		EmptyCache(CompressedBufferViewsCache);
+		CompressedBufferViewsStridesCache.Empty();
+	}
+	EmptyCache(SparseAccessorsCache);
+
+	if (AsyncFileReader)
+	{
+		ReleasedBytes += AsyncFileReader->GetResidentBytes();
+		AsyncFileReader->Reset();
+	}
+
+	{
+		FScopeLock Lock(&BufferRangesLock);
+		ReleasedBytes += BufferRangesCacheSize;
+		BuffersIOStats.RangesCacheEvictedBytes += BufferRangesCacheSize;
+		BufferRangesCache.Empty();
+		BufferRangesCacheSize = 0;
+	}
+
+	// from now on the binary chunk is read on demand from its file
+	if (BinaryBuffer && BinaryBuffer->Num() > 0 && BinaryChunkReloadSource && BinaryChunkReloadSource->Num() == BinaryBuffer->Num())
+	{
+		if (BinaryBuffer.IsUnique())
+		{
+			ReleasedBytes += BinaryBuffer->GetAllocatedSize();
+		}
+		BinaryBuffer = nullptr;
+		SetBinaryChunkSource(BinaryChunkReloadSource.ToSharedRef());
+		{
+			FScopeLock Lock(&BufferRangesLock);
+			LazyBuffersSources.Remove(0);
+		}
+		BinaryChunkReloadSource = nullptr;
+	}
+
+	if (Archive && ArchiveReloadSource)
+	{
+		ReleasedBytes += Archive->ReplaceDataSource(ArchiveReloadSource.ToSharedRef());
+		ArchiveReloadSource = nullptr;
+	}
+
+	return ReleasedBytes;
 }
 
 float FglTFRuntimeParser::FindBestFrames(const TArray<float>& FramesTimes, float WantedTime, int32& FirstIndex, int32& SecondIndex)
@@ -5056,10 +6561,21 @@ bool FglTFRuntimeParser::MergePrimitives(TArray<FglTFRuntimePrimitive> SourcePri
 	}
 
 	uint32 BaseIndex = 0;
+	bool bHasPositionsBounds = true;
+	OutPrimitive.PositionsBounds.Init();
 	for (FglTFRuntimePrimitive& SourcePrimitive : SourcePrimitives)
 	{
 		OutPrimitive.Material = SourcePrimitive.Material;
 
+		if (SourcePrimitive.PositionsBounds.IsValid)
+		{
+			OutPrimitive.PositionsBounds += SourcePrimitive.PositionsBounds;
+		}
+		else
+		{
+			bHasPositionsBounds = false;
+		}
+
 		// TODO the logic here is available only for staticmeshes loaded as skeletal ones.
 		// It should be improved to support plain recursive loading of skeletalmeshes
 		if (SourcePrimitive.OverrideBoneMap.Num() == 1 && SourcePrimitive.OverrideBoneMap.Contains(0))
@@ -5112,12 +6628,17 @@ bool FglTFRuntimeParser::MergePrimitives(TArray<FglTFRuntimePrimitive> SourcePri
 		BaseIndex += SourcePrimitive.Positions.Num();
 	}
 
+	if (!bHasPositionsBounds)
+	{
+		OutPrimitive.PositionsBounds.Init();
+	}
+
 	return true;
 }
 
 bool FglTFRuntimeParser::MeshHasMorphTargets(const int32 MeshIndex) const
 {
-	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
+	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Meshes, MeshIndex);
 	if (!JsonMeshObject)
 	{
 		return false;
@@ -5155,7 +6676,7 @@ bool FglTFRuntimeParser::MeshHasMorphTargets(const int32 MeshIndex) const
 
 bool FglTFRuntimeParser::GetMorphTargetNames(const int32 MeshIndex, TArray<FString>& MorphTargetNames)
 {
-	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
+	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Meshes, MeshIndex);
 	if (!JsonMeshObject)
 	{
 		AddError("GetMorphTargetNames()", FString::Printf(TEXT("Unable to find Mesh with index %d"), MeshIndex));
@@ -5225,111 +6746,410 @@ bool FglTFRuntimeParser::GetMorphTargetNames(const int32 MeshIndex, TArray<FStri
 	return true;
 }
 
-void FglTFRuntimeArchiveZip::SetPassword(const FString& EncryptionKey)
+namespace glTFRuntime
 {
-	Password.Empty();
+	static TArray<uint8> ZipPasswordToBytes(const FString& EncryptionKey)
+	{
+		TArray<uint8> Bytes;
 #if ENGINE_MAJOR_VERSION >= 5
-	auto UTF8Conversion = StringCast<UTF8CHAR>(*EncryptionKey);
+		auto UTF8Conversion = StringCast<UTF8CHAR>(*EncryptionKey);
 #else
-	auto UTF8Conversion = StringCast<char>(*EncryptionKey);
+		auto UTF8Conversion = StringCast<char>(*EncryptionKey);
 #endif
-	Password.Append(reinterpret_cast<const uint8*>(UTF8Conversion.Get()), UTF8Conversion.Length());
+		Bytes.Append(reinterpret_cast<const uint8*>(UTF8Conversion.Get()), UTF8Conversion.Length());
+		return Bytes;
+	}
+}
+
+int64 FglTFRuntimeArchiveZip::ReplaceDataSource(TSharedRef<FglTFRuntimeDataSource> InDataSource)
+{
+	// the entries offsets must stay valid
+	if (!DataSource || DataSource->Num() != InDataSource->Num())
+	{
+		return 0;
+	}
+
+	const int64 ReleasedBytes = DataSource->GetAllocatedSize();
+	DataSource = InDataSource;
+	return ReleasedBytes;
+}
+
+void FglTFRuntimeArchiveZip::SetPassword(const FString& EncryptionKey)
+{
+	TArray<uint8> NewPassword = glTFRuntime::ZipPasswordToBytes(EncryptionKey);
+	FScopeLock Lock(&PasswordLock);
+	Password = MoveTemp(NewPassword);
+}
+
+TSharedPtr<FglTFRuntimeMappedFile> FglTFRuntimeMappedFile::Open(const FString& Filename)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeMappedFile_Open, FColor::Magenta);
+
+	TSharedPtr<FglTFRuntimeMappedFile> MappedFile = MakeShared<FglTFRuntimeMappedFile>();
+
+	MappedFile->Handle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*Filename));
+	if (!MappedFile->Handle || MappedFile->Handle->GetFileSize() <= 0)
+	{
+		return nullptr;
+	}
+
+	MappedFile->Region.Reset(MappedFile->Handle->MapRegion(0, MappedFile->Handle->GetFileSize()));
+	if (!MappedFile->Region || !MappedFile->Region->GetMappedPtr())
+	{
+		return nullptr;
+	}
+
+	return MappedFile;
+}
+
+FglTFRuntimeMemoryDataSource::FglTFRuntimeMemoryDataSource(const uint8* InDataPtr, const int64 InDataNum)
+{
+	Data.Append(InDataPtr, InDataNum);
+	DataPtr = Data.GetData();
+	DataNum = Data.Num();
+}
+
+FglTFRuntimeMemoryDataSource::FglTFRuntimeMemoryDataSource(TArray64<uint8>&& InData) : Data(MoveTemp(InData))
+{
+	DataPtr = Data.GetData();
+	DataNum = Data.Num();
+}
+
+FglTFRuntimeMemoryDataSource::FglTFRuntimeMemoryDataSource(TSharedRef<FglTFRuntimeMappedFile> InMappedFile, const uint8* InDataPtr, const int64 InDataNum) : MappedFile(InMappedFile), DataPtr(InDataPtr), DataNum(InDataNum)
+{
+}
+
+FglTFRuntimeStreamingBuffer::FglTFRuntimeStreamingBuffer(const int64 InDataNum)
+{
+	// the storage never moves, so readers can keep pointers to the available part
+	Data.SetNumUninitialized(InDataNum);
+}
+
+int64 FglTFRuntimeStreamingBuffer::Append(const uint8* InDataPtr, const int64 InDataNum)
+{
+	const int64 Offset = AvailableBytes.GetValue();
+	const int64 Consumed = FMath::Min<int64>(InDataNum, Data.Num() - Offset);
+	if (Consumed > 0)
+	{
+		FMemory::Memcpy(Data.GetData() + Offset, InDataPtr, Consumed);
+		// publish only after the bytes are written
+		AvailableBytes.Add(Consumed);
+	}
+	return FMath::Max<int64>(Consumed, 0);
+}
+
+bool FglTFRuntimeDataSource::CopyRange(const int64 Offset, const int64 Size, TArray64<uint8>& OutData) const
+{
+	TArray64<uint8> Scratch;
+	const uint8* RangeData = GetRange(Offset, Size, Scratch);
+	if (!RangeData)
+	{
+		return false;
+	}
+
+	if (RangeData == Scratch.GetData() && Scratch.Num() == Size)
+	{
+		OutData = MoveTemp(Scratch);
+	}
+	else
+	{
+		OutData.Empty(Size);
+		OutData.Append(RangeData, Size);
+	}
+
+	return true;
+}
+
+const uint8* FglTFRuntimeMemoryDataSource::GetRange(const int64 Offset, const int64 Size, TArray64<uint8>& Scratch) const
+{
+	if (Offset < 0 || Size < 0 || Offset > DataNum || Size > DataNum - Offset)
+	{
+		return nullptr;
+	}
+
+	return DataPtr + Offset;
+}
+
+TSharedPtr<FglTFRuntimeFileDataSource> FglTFRuntimeFileDataSource::Open(const FString& InFilename)
+{
+	const int64 FileSize = FPlatformFileManager::Get().GetPlatformFile().FileSize(*InFilename);
+	if (FileSize <= 0)
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FglTFRuntimeFileDataSource> FileDataSource = MakeShared<FglTFRuntimeFileDataSource>();
+	FileDataSource->Filename = InFilename;
+	FileDataSource->FileOffset = 0;
+	FileDataSource->FileSize = FileSize;
+	return FileDataSource;
+}
+
+TSharedPtr<FglTFRuntimeFileDataSource> FglTFRuntimeFileDataSource::Open(const FString& InFilename, const int64 InOffset, const int64 InNum)
+{
+	TSharedPtr<FglTFRuntimeFileDataSource> FileDataSource = Open(InFilename);
+	if (!FileDataSource || InOffset < 0 || InNum < 0 || InOffset > FileDataSource->FileSize || InNum > FileDataSource->FileSize - InOffset)
+	{
+		return nullptr;
+	}
+
+	FileDataSource->FileOffset = InOffset;
+	FileDataSource->FileSize = InNum;
+	return FileDataSource;
+}
+
+const uint8* FglTFRuntimeFileDataSource::GetRange(const int64 Offset, const int64 Size, TArray64<uint8>& Scratch) const
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeFileDataSource_GetRange, FColor::Magenta);
+
+	if (Offset < 0 || Size < 0 || Offset > FileSize || Size > FileSize - Offset)
+	{
+		return nullptr;
+	}
+
+	// each call gets its own handle, so concurrent readers never share a file position
+	TUniquePtr<IFileHandle> FileHandle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*Filename));
+	if (!FileHandle || !FileHandle->Seek(FileOffset + Offset))
+	{
+		return nullptr;
+	}
+
+	Scratch.SetNumUninitialized(Size);
+	if (!FileHandle->Read(Scratch.GetData(), Size))
+	{
+		return nullptr;
+	}
+
+	return Scratch.GetData();
+}
+
+FglTFRuntimeFArchiveDataSource::FglTFRuntimeFArchiveDataSource(TSharedRef<FArchive> InArchive) : Archive(InArchive), Lock(MakeShared<FCriticalSection, ESPMode::ThreadSafe>())
+{
+	DataOffset = 0;
+	// unknown sizes are reported as -1
+	DataNum = FMath::Max<int64>(Archive->TotalSize(), 0);
+}
+
+FglTFRuntimeFArchiveDataSource::FglTFRuntimeFArchiveDataSource(const FglTFRuntimeFArchiveDataSource& InParent, const int64 InOffset, const int64 InNum) : Archive(InParent.Archive), Lock(InParent.Lock)
+{
+	DataOffset = InParent.DataOffset + FMath::Clamp<int64>(InOffset, 0, InParent.DataNum);
+	DataNum = FMath::Clamp<int64>(InNum, 0, InParent.DataNum - (DataOffset - InParent.DataOffset));
+}
+
+const uint8* FglTFRuntimeFArchiveDataSource::GetRange(const int64 Offset, const int64 Size, TArray64<uint8>& Scratch) const
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeFArchiveDataSource_GetRange, FColor::Magenta);
+
+	if (Offset < 0 || Size < 0 || Offset > DataNum || Size > DataNum - Offset)
+	{
+		return nullptr;
+	}
+
+	Scratch.SetNumUninitialized(Size);
+
+	// the FArchive position is shared, so seek and read must be atomic
+	FScopeLock ScopeLock(&Lock.Get());
+	Archive->Seek(DataOffset + Offset);
+	Archive->Serialize(Scratch.GetData(), Size);
+	if (Archive->IsError())
+	{
+		Archive->ClearError();
+		return nullptr;
+	}
+
+	return Scratch.GetData();
+}
+
+namespace glTFRuntime
+{
+	FORCEINLINE uint16 ReadZipUInt16(const uint8* Ptr)
+	{
+		return static_cast<uint16>(Ptr[0]) | (static_cast<uint16>(Ptr[1]) << 8);
+	}
+
+	FORCEINLINE uint32 ReadZipUInt32(const uint8* Ptr)
+	{
+		return static_cast<uint32>(Ptr[0]) | (static_cast<uint32>(Ptr[1]) << 8) | (static_cast<uint32>(Ptr[2]) << 16) | (static_cast<uint32>(Ptr[3]) << 24);
+	}
+
+	FORCEINLINE uint64 ReadZipUInt64(const uint8* Ptr)
+	{
+		return static_cast<uint64>(ReadZipUInt32(Ptr)) | (static_cast<uint64>(ReadZipUInt32(Ptr + 4)) << 32);
+	}
 }
 
 bool FglTFRuntimeArchiveZip::FromData(const uint8* DataPtr, const int64 DataNum)
 {
-	Data.Append(DataPtr, DataNum);
+	return FromDataSource(MakeShared<FglTFRuntimeMemoryDataSource>(DataPtr, DataNum));
+}
+
+bool FglTFRuntimeArchiveZip::FromDataSource(TSharedRef<FglTFRuntimeDataSource> InDataSource)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeArchiveZip_FromDataSource, FColor::Magenta);
+
+	constexpr int64 TrailerMinSize = 22;
+	constexpr int64 CentralDirectoryMinSize = 46;
+	constexpr int64 Zip64LocatorSize = 20;
+	constexpr int64 Zip64TrailerMinSize = 56;
+
+	DataSource = InDataSource;
+	const int64 DataNum = DataSource->Num();
+
+	if (DataNum < TrailerMinSize)
+	{
+		return false;
+	}
+
+	// step0: retrieve the trailer magic (can only be in the last 64k of comment + trailer)
+	const int64 TailSize = FMath::Min<int64>(DataNum, TrailerMinSize + 0xFFFF);
+	const int64 TailOffset = DataNum - TailSize;
+	TArray64<uint8> TailScratch;
+	const uint8* Tail = DataSource->GetRange(TailOffset, TailSize, TailScratch);
+	if (!Tail)
+	{
+		return false;
+	}
 
-	// step0: retrieve the trailer magic
-	TArray<uint8> Magic;
-	bool bIndexFound = false;
-	uint64 Index = 0;
-	for (Index = Data.Num() - 1; Index >= 0; Index--)
+	int64 Index = INDEX_NONE;
+	for (int64 CandidateIndex = TailSize - TrailerMinSize; CandidateIndex >= 0; CandidateIndex--)
 	{
-		Magic.Insert(Data[Index], 0);
-		if (Magic.Num() == 4)
+		if (Tail[CandidateIndex] == 0x50 && Tail[CandidateIndex + 1] == 0x4b && Tail[CandidateIndex + 2] == 0x05 && Tail[CandidateIndex + 3] == 0x06)
 		{
-			if (Magic[0] == 0x50 && Magic[1] == 0x4b && Magic[2] == 0x05 && Magic[3] == 0x06)
-			{
-				bIndexFound = true;
-				break;
-			}
-			Magic.Pop();
+			Index = CandidateIndex;
+			break;
 		}
 	}
 
-	if (!bIndexFound)
+	if (Index == INDEX_NONE)
 	{
 		return false;
 	}
 
-	uint16 DiskEntries = 0;
-	uint16 TotalEntries = 0;
-	uint32 CentralDirectorySize = 0;
-	uint32 CentralDirectoryOffset = 0;
-	uint16 CommentLen = 0;
+	// skip signature and disk data
+	uint64 DiskEntries = glTFRuntime::ReadZipUInt16(Tail + Index + 8);
+	uint64 TotalEntries = glTFRuntime::ReadZipUInt16(Tail + Index + 10);
+	uint64 CentralDirectorySize = glTFRuntime::ReadZipUInt32(Tail + Index + 12);
+	uint64 CentralDirectoryOffset = glTFRuntime::ReadZipUInt32(Tail + Index + 16);
+
+	// zip64 ?
+	if (TailOffset + Index >= Zip64LocatorSize)
+	{
+		TArray64<uint8> LocatorScratch;
+		const uint8* Locator = DataSource->GetRange(TailOffset + Index - Zip64LocatorSize, Zip64LocatorSize, LocatorScratch);
+		if (Locator && glTFRuntime::ReadZipUInt32(Locator) == 0x07064b50)
+		{
+			const uint64 Zip64TrailerOffset = glTFRuntime::ReadZipUInt64(Locator + 8);
+			// archive-controlled values are checked without additions that could wrap
+			if (Zip64TrailerOffset > static_cast<uint64>(DataNum) || Zip64TrailerMinSize > static_cast<uint64>(DataNum) - Zip64TrailerOffset)
+			{
+				return false;
+			}
+
+			TArray64<uint8> Zip64TrailerScratch;
+			const uint8* Zip64Trailer = DataSource->GetRange(Zip64TrailerOffset, Zip64TrailerMinSize, Zip64TrailerScratch);
+			if (!Zip64Trailer || glTFRuntime::ReadZipUInt32(Zip64Trailer) != 0x06064b50)
+			{
+				return false;
+			}
 
-	constexpr uint64 TrailerMinSize = 22;
-	constexpr uint64 CentralDirectoryMinSize = 46;
+			DiskEntries = glTFRuntime::ReadZipUInt64(Zip64Trailer + 24);
+			TotalEntries = glTFRuntime::ReadZipUInt64(Zip64Trailer + 32);
+			CentralDirectorySize = glTFRuntime::ReadZipUInt64(Zip64Trailer + 40);
+			CentralDirectoryOffset = glTFRuntime::ReadZipUInt64(Zip64Trailer + 48);
+		}
+	}
 
-	if (Index + TrailerMinSize > Data.Num())
+	if (CentralDirectoryOffset > static_cast<uint64>(DataNum) || CentralDirectorySize > static_cast<uint64>(DataNum) - CentralDirectoryOffset)
 	{
 		return false;
 	}
 
-	// skip signature and disk data
-	Data.Seek(Index + 8);
-	Data << DiskEntries;
-	Data << TotalEntries;
-	Data << CentralDirectorySize;
-	Data << CentralDirectoryOffset;
-	Data << CommentLen;
+	// the whole central directory is fetched with a single read
+	TArray64<uint8> CentralDirectoryScratch;
+	const uint8* CentralDirectory = DataSource->GetRange(CentralDirectoryOffset, CentralDirectorySize, CentralDirectoryScratch);
+	if (!CentralDirectory)
+	{
+		return false;
+	}
 
-	uint16 DirectoryEntries = FMath::Min(DiskEntries, TotalEntries);
+	const uint64 DirectoryEntries = FMath::Min(DiskEntries, TotalEntries);
+	uint64 EntryStart = 0;
 
-	for (uint16 DirectoryIndex = 0; DirectoryIndex < DirectoryEntries; DirectoryIndex++)
+	for (uint64 DirectoryIndex = 0; DirectoryIndex < DirectoryEntries; DirectoryIndex++)
 	{
-		if (CentralDirectoryOffset + CentralDirectoryMinSize > Data.Num())
+		// EntryStart never exceeds CentralDirectorySize
+		if (CentralDirectoryMinSize > CentralDirectorySize - EntryStart)
 		{
 			return false;
 		}
 
-		uint32 GlobalCompressedSize = 0;
-		uint32 GlobalUncompressedSize = 0;
-		uint16 FilenameLen = 0;
-		uint16 ExtraFieldLen = 0;
-		uint16 EntryCommentLen = 0;
-		uint32 EntryOffset = 0;
+		const uint8* Entry = CentralDirectory + EntryStart;
 
-		// seek to CompressedSize
-		Data.Seek(CentralDirectoryOffset + 20);
-		Data << GlobalCompressedSize;
-		Data << GlobalUncompressedSize;
+		if (glTFRuntime::ReadZipUInt32(Entry) != 0x02014b50)
+		{
+			return false;
+		}
 
-		// seek to FilenameLen
-		Data.Seek(CentralDirectoryOffset + 28);
-		Data << FilenameLen;
-		Data << ExtraFieldLen;
-		Data << EntryCommentLen;
-		// seek to EntryOffset
-		Data.Seek(CentralDirectoryOffset + 42);
-		Data << EntryOffset;
+		uint64 GlobalCompressedSize = glTFRuntime::ReadZipUInt32(Entry + 20);
+		uint64 GlobalUncompressedSize = glTFRuntime::ReadZipUInt32(Entry + 24);
+		const uint16 FilenameLen = glTFRuntime::ReadZipUInt16(Entry + 28);
+		const uint16 ExtraFieldLen = glTFRuntime::ReadZipUInt16(Entry + 30);
+		const uint16 EntryCommentLen = glTFRuntime::ReadZipUInt16(Entry + 32);
+		uint64 EntryOffset = glTFRuntime::ReadZipUInt32(Entry + 42);
 
-		if (CentralDirectoryOffset + CentralDirectoryMinSize + FilenameLen + ExtraFieldLen + EntryCommentLen > Data.Num())
+		if (CentralDirectoryMinSize + FilenameLen + ExtraFieldLen + EntryCommentLen > CentralDirectorySize - EntryStart)
 		{
 			return false;
 		}
 
+		// zip64 extended information (only the fields marked as 0xFFFFFFFF are stored, in this order)
+		if (GlobalUncompressedSize == 0xFFFFFFFF || GlobalCompressedSize == 0xFFFFFFFF || EntryOffset == 0xFFFFFFFF)
+		{
+			const uint8* ExtraField = Entry + CentralDirectoryMinSize + FilenameLen;
+			uint32 ExtraFieldsOffset = 0;
+			while (ExtraFieldsOffset + 4 <= ExtraFieldLen)
+			{
+				const uint16 ExtraFieldType = glTFRuntime::ReadZipUInt16(ExtraField + ExtraFieldsOffset);
+				const uint16 ExtraFieldSize = glTFRuntime::ReadZipUInt16(ExtraField + ExtraFieldsOffset + 2);
+				ExtraFieldsOffset += 4;
+				if (ExtraFieldsOffset + ExtraFieldSize > ExtraFieldLen)
+				{
+					return false;
+				}
+
+				if (ExtraFieldType == 0x0001)
+				{
+					const uint8* Zip64Field = ExtraField + ExtraFieldsOffset;
+					const uint8* Zip64FieldEnd = Zip64Field + ExtraFieldSize;
+					for (uint64* Value : { &GlobalUncompressedSize, &GlobalCompressedSize, &EntryOffset })
+					{
+						if (*Value == 0xFFFFFFFF)
+						{
+							if (Zip64Field + 8 > Zip64FieldEnd)
+							{
+								return false;
+							}
+							*Value = glTFRuntime::ReadZipUInt64(Zip64Field);
+							Zip64Field += 8;
+						}
+					}
+					break;
+				}
+
+				ExtraFieldsOffset += ExtraFieldSize;
+			}
+		}
+
 		TArray64<uint8> FilenameBytes;
-		FilenameBytes.Append(Data.GetData() + CentralDirectoryOffset + CentralDirectoryMinSize, FilenameLen);
+		FilenameBytes.Append(Entry + CentralDirectoryMinSize, FilenameLen);
 		FilenameBytes.Add(0);
 
 		FString Filename = FString(UTF8_TO_TCHAR(FilenameBytes.GetData()));
 
 		OffsetsMap.Add(Filename, EntryOffset);
-		GlobalSizeMap.Add(Filename, TPair<uint32, uint32>(GlobalCompressedSize, GlobalUncompressedSize));
+		GlobalSizeMap.Add(Filename, TPair<uint64, uint64>(GlobalCompressedSize, GlobalUncompressedSize));
 
-		CentralDirectoryOffset += CentralDirectoryMinSize + FilenameLen + ExtraFieldLen + EntryCommentLen;
+		EntryStart += CentralDirectoryMinSize + FilenameLen + ExtraFieldLen + EntryCommentLen;
 	}
 
 	return true;
@@ -5337,96 +7157,148 @@ bool FglTFRuntimeArchiveZip::FromData(const uint8* DataPtr, const int64 DataNum)
 
 bool FglTFRuntimeArchiveZip::GetFileContent(const FString& Filename, TArray64<uint8>& OutData)
 {
-	uint32* Offset = OffsetsMap.Find(Filename);
-	if (!Offset)
+	const uint64* Offset = OffsetsMap.Find(Filename);
+	if (!Offset || !DataSource)
 	{
 		return false;
 	}
 
 	constexpr uint64 LocalEntryMinSize = 30;
 
-	if (*Offset + LocalEntryMinSize > Data.Num())
+	const uint64 DataNum = static_cast<uint64>(DataSource->Num());
+
+	// archive-controlled values are checked without additions that could wrap
+	if (*Offset > DataNum || LocalEntryMinSize > DataNum - *Offset)
+	{
+		return false;
+	}
+
+	TArray64<uint8> LocalEntryScratch;
+	const uint8* LocalEntry = DataSource->GetRange(*Offset, LocalEntryMinSize, LocalEntryScratch);
+	if (!LocalEntry)
 	{
 		return false;
 	}
 
-	uint16 Flags = 0;
-	uint16 Compression = 0;
-	uint32 CompressedSize;
-	uint32 UncompressedSize = 0;
-	uint16 FilenameLen = 0;
-	uint16 ExtraFieldLen = 0;
+	const uint16 Flags = glTFRuntime::ReadZipUInt16(LocalEntry + 6);
+	uint16 Compression = glTFRuntime::ReadZipUInt16(LocalEntry + 8);
+	uint64 CompressedSize = glTFRuntime::ReadZipUInt32(LocalEntry + 18);
+	uint64 UncompressedSize = glTFRuntime::ReadZipUInt32(LocalEntry + 22);
+	const uint16 FilenameLen = glTFRuntime::ReadZipUInt16(LocalEntry + 26);
+	const uint16 ExtraFieldLen = glTFRuntime::ReadZipUInt16(LocalEntry + 28);
+
+	// for streamed zips (sizes are 0) and zip64 (sizes are 0xFFFFFFFF)
+	const TPair<uint64, uint64>* GlobalSizes = GlobalSizeMap.Find(Filename);
 
-	// seek to Compression
-	Data.Seek(*Offset + 6);
-	Data << Flags;
-	Data << Compression;
-	// seek to CompressedSize
-	Data.Seek(*Offset + 18);
-	Data << CompressedSize;
-	Data << UncompressedSize;
-	Data << FilenameLen;
-	Data << ExtraFieldLen;
+	if ((CompressedSize == 0 || CompressedSize == 0xFFFFFFFF) && GlobalSizes)
+	{
+		CompressedSize = GlobalSizes->Key;
+	}
+
+	if ((UncompressedSize == 0 || UncompressedSize == 0xFFFFFFFF) && GlobalSizes)
+	{
+		UncompressedSize = GlobalSizes->Value;
+	}
 
-	if (*Offset + LocalEntryMinSize + FilenameLen + ExtraFieldLen + CompressedSize > Data.Num())
+	if (CompressedSize > DataNum)
 	{
 		return false;
 	}
 
-	const uint8* CompressedData = Data.GetData() + *Offset + LocalEntryMinSize + FilenameLen + ExtraFieldLen;
+	// ZipCrypto reads the 12 bytes encryption header too
+	const bool bZipCrypto = (Flags & 1) && Compression != 99;
+	const uint64 PayloadSize = FilenameLen + ExtraFieldLen + CompressedSize + (bZipCrypto ? 12 : 0);
 
-	// for streamed zips
+	if (LocalEntryMinSize + PayloadSize > DataNum - *Offset)
+	{
+		return false;
+	}
 
-	if (CompressedSize == 0 && GlobalSizeMap.Contains(Filename))
+	// plain stored entries are not decoded: file data sources fill the scratch (moved to the output), memory ones are copied once
+	if (Compression == 0 && !(Flags & 1) && CompressedSize == UncompressedSize)
 	{
-		CompressedSize = GlobalSizeMap[Filename].Key;
+		TArray64<uint8> StoredScratch;
+		const uint8* StoredData = DataSource->GetRange(*Offset + LocalEntryMinSize + FilenameLen + ExtraFieldLen, UncompressedSize, StoredScratch);
+		if (!StoredData)
+		{
+			return false;
+		}
+
+		if (StoredData == StoredScratch.GetData() && StoredScratch.Num() == static_cast<int64>(UncompressedSize))
+		{
+			OutData = MoveTemp(StoredScratch);
+		}
+		else
+		{
+			OutData.Empty(UncompressedSize);
+			OutData.Append(StoredData, UncompressedSize);
+		}
+		return true;
 	}
 
-	if (UncompressedSize == 0 && GlobalSizeMap.Contains(Filename))
+	TArray64<uint8> PayloadScratch;
+	const uint8* Payload = DataSource->GetRange(*Offset + LocalEntryMinSize, PayloadSize, PayloadScratch);
+	if (!Payload)
 	{
-		UncompressedSize = GlobalSizeMap[Filename].Value;
+		return false;
 	}
 
-	// encrypted ?
+	const uint8* CompressedData = Payload + FilenameLen + ExtraFieldLen;
 
-	// first check for password prompt
-	bool bClearPassword = false;
-	if (Flags & 1 && Password.Num() <= 0 && PromptHook.IsBound())
+	// encrypted ?
+	TArray<uint8> EntryPassword;
+	if (Flags & 1)
 	{
-		if (IsInGameThread())
 		{
-			if (PromptHook.Prompt.IsBound())
+			FScopeLock Lock(&PasswordLock);
+			EntryPassword = Password;
+		}
+
+		// first check for password prompt (the lock is not held, the game thread may need it)
+		if (EntryPassword.Num() <= 0 && PromptHook.IsBound())
+		{
+			FString PromptedPassword;
+			if (IsInGameThread())
+			{
+				if (PromptHook.Prompt.IsBound())
+				{
+					PromptedPassword = PromptHook.Prompt.Execute(Filename, PromptHook.Context);
+				}
+				else if (PromptHook.NativePrompt.IsBound())
+				{
+					PromptedPassword = PromptHook.NativePrompt.Execute(Filename, PromptHook.Context);
+				}
+			}
+			else
 			{
-				SetPassword(PromptHook.Prompt.Execute(Filename, PromptHook.Context));
+				FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([&]()
+					{
+						if (PromptHook.Prompt.IsBound())
+						{
+							PromptedPassword = PromptHook.Prompt.Execute(Filename, PromptHook.Context);
+						}
+						else if (PromptHook.NativePrompt.IsBound())
+						{
+							PromptedPassword = PromptHook.NativePrompt.Execute(Filename, PromptHook.Context);
+						}
+					}, TStatId(), nullptr, ENamedThreads::GameThread);
+				FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
 			}
-			else if (PromptHook.NativePrompt.IsBound())
+
+			EntryPassword = glTFRuntime::ZipPasswordToBytes(PromptedPassword);
+
+			if (PromptHook.bReusePassword)
 			{
-				SetPassword(PromptHook.NativePrompt.Execute(Filename, PromptHook.Context));
+				FScopeLock Lock(&PasswordLock);
+				Password = EntryPassword;
 			}
 		}
-		else
-		{
-			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([&]()
-				{
-					if (PromptHook.Prompt.IsBound())
-					{
-						SetPassword(PromptHook.Prompt.Execute(Filename, PromptHook.Context));
-					}
-					else if (PromptHook.NativePrompt.IsBound())
-					{
-						SetPassword(PromptHook.NativePrompt.Execute(Filename, PromptHook.Context));
-					}
-				}, TStatId(), nullptr, ENamedThreads::GameThread);
-			FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
-		}
-
-		bClearPassword = !PromptHook.bReusePassword;
 	}
 
 	TArray64<uint8> DecryptedData;
 	if (Flags & 1)
 	{
-		if (Password.Num() <= 0)
+		if (EntryPassword.Num() <= 0)
 		{
 			UE_LOG(LogGLTFRuntime, Error, TEXT("No ZIP Decryption key provided"));
 			return false;
@@ -5441,7 +7313,7 @@ bool FglTFRuntimeArchiveZip::GetFileContent(const FString& Filename, TArray64<ui
 
 			// TODO, probably I should generalize it to allow custom fields to be managed by the user
 			TArray64<uint8> ExtraField;
-			ExtraField.Append(Data.GetData() + *Offset + LocalEntryMinSize + FilenameLen, ExtraFieldLen);
+			ExtraField.Append(Payload + FilenameLen, ExtraFieldLen);
 			uint32 ExtraFieldsOffset = 0;
 			// 0 is not a valid AES strength so it acts as a marker
 			uint8 AESEncryptionStrength = 0;
@@ -5492,11 +7364,11 @@ bool FglTFRuntimeArchiveZip::GetFileContent(const FString& Filename, TArray64<ui
 			{
 				if (AESDecrypterHook.AESDecrypter.IsBound())
 				{
-					DecryptedData = AESDecrypterHook.AESDecrypter.Execute(AESEncryptionStrength, EnryptedData, Password, AESDecrypterHook.Context);
+					DecryptedData = AESDecrypterHook.AESDecrypter.Execute(AESEncryptionStrength, EnryptedData, EntryPassword, AESDecrypterHook.Context);
 				}
 				else if (AESDecrypterHook.NativeAESDecrypter.IsBound())
 				{
-					DecryptedData = AESDecrypterHook.NativeAESDecrypter.Execute(AESEncryptionStrength, EnryptedData, Password, AESDecrypterHook.Context);
+					DecryptedData = AESDecrypterHook.NativeAESDecrypter.Execute(AESEncryptionStrength, EnryptedData, EntryPassword, AESDecrypterHook.Context);
 				}
 			}
 			else
@@ -5505,11 +7377,11 @@ bool FglTFRuntimeArchiveZip::GetFileContent(const FString& Filename, TArray64<ui
 					{
 						if (AESDecrypterHook.AESDecrypter.IsBound())
 						{
-							DecryptedData = AESDecrypterHook.AESDecrypter.Execute(AESEncryptionStrength, EnryptedData, Password, AESDecrypterHook.Context);
+							DecryptedData = AESDecrypterHook.AESDecrypter.Execute(AESEncryptionStrength, EnryptedData, EntryPassword, AESDecrypterHook.Context);
 						}
 						else if (AESDecrypterHook.NativeAESDecrypter.IsBound())
 						{
-							DecryptedData = AESDecrypterHook.NativeAESDecrypter.Execute(AESEncryptionStrength, EnryptedData, Password, AESDecrypterHook.Context);
+							DecryptedData = AESDecrypterHook.NativeAESDecrypter.Execute(AESEncryptionStrength, EnryptedData, EntryPassword, AESDecrypterHook.Context);
 						}
 					}, TStatId(), nullptr, ENamedThreads::GameThread);
 				FTaskGraphInterface::Get().WaitUntilTaskCompletes(Task);
@@ -5520,10 +7392,6 @@ bool FglTFRuntimeArchiveZip::GetFileContent(const FString& Filename, TArray64<ui
 		}
 		else // ZipCrypto?
 		{
-			if (*Offset + LocalEntryMinSize + FilenameLen + ExtraFieldLen + CompressedSize + 12 > Data.Num())
-			{
-				return false;
-			}
 			DecryptedData.AddUninitialized(CompressedSize + 12);
 
 			uint32 Key0 = 305419896;
@@ -5543,7 +7411,7 @@ bool FglTFRuntimeArchiveZip::GetFileContent(const FString& Filename, TArray64<ui
 					Key2 = Crc32(Key1 >> 24, Key2);
 				};
 
-			for (const uint8& Byte : Password)
+			for (const uint8& Byte : EntryPassword)
 			{
 				UpdateKeys(Byte);
 			}
@@ -5560,16 +7428,17 @@ bool FglTFRuntimeArchiveZip::GetFileContent(const FString& Filename, TArray64<ui
 		}
 	}
 
-	if (bClearPassword)
-	{
-		SetPassword(TEXT(""));
-	}
-
 	if (Compression == 8)
 	{
-		OutData.AddUninitialized(UncompressedSize);
-		if (!FCompression::UncompressMemory(NAME_Zlib, OutData.GetData(), UncompressedSize, CompressedData, CompressedSize, COMPRESS_NoFlags, -15))
+		if (UncompressedSize / glTFRuntime::MaxDeflateRatio > CompressedSize)
+		{
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid ZIP entry %s: %llu bytes can not be inflated from %llu compressed bytes"), *Filename, UncompressedSize, CompressedSize);
+			return false;
+		}
+
+		if (!glTFRuntime::InflateRawDeflate(CompressedData, CompressedSize, OutData, UncompressedSize))
 		{
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to inflate ZIP entry %s"), *Filename);
 			return false;
 		}
 	}
@@ -5593,7 +7462,7 @@ bool FglTFRuntimeArchive::FileExists(const FString& Filename) const
 
 FString FglTFRuntimeArchive::GetFirstFilenameByExtension(const FString& Extension) const
 {
-	for (const TPair<FString, uint32>& Pair : OffsetsMap)
+	for (const TPair<FString, uint64>& Pair : OffsetsMap)
 	{
 		if (Pair.Key.EndsWith(Extension, ESearchCase::IgnoreCase))
 		{
@@ -5635,13 +7504,8 @@ bool FglTFRuntimeParser::GetJsonObjectBytes(TSharedRef<FJsonObject> JsonObject,
 
 			if (!bFound && !BaseDirectory.IsEmpty())
 			{
-				FString DecodedUri = Uri;
-				// this is a bit annoying (and very hacky) but we need to support % in filesystem names...
-				if (DecodedUri.Contains("%") && !FPaths::FileExists(FPaths::Combine(BaseDirectory, DecodedUri)))
-				{
-					DecodedUri = FGenericPlatformHttp::UrlDecode(DecodedUri);
-				}
-				if (!FFileHelper::LoadFileToArray(Bytes, *FPaths::Combine(BaseDirectory, DecodedUri)))
+				const FString FilePath = GetExternalFilePath(Uri);
+				if (!(AsyncFileReader && AsyncFileReader->Consume(FilePath, Bytes)) && !FFileHelper::LoadFileToArray(Bytes, *FilePath))
 				{
 					AddError("GetJsonObjectBytes()", FString::Printf(TEXT("Unable to load bytes from uri %s"), *Uri));
 					return false;
@@ -5948,7 +7812,7 @@ bool FglTFRuntimeParser::GetNumberArrayFromExtras(const FString& Key, TArray<flo
 
 TSharedPtr<FJsonObject> FglTFRuntimeParser::GetNodeExtensionObject(const int32 NodeIndex, const FString& ExtensionName)
 {
-	TSharedPtr<FJsonObject> JsonNodeObject = GetJsonObjectFromRootIndex("nodes", NodeIndex);
+	TSharedPtr<FJsonObject> JsonNodeObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Nodes, NodeIndex);
 	if (!JsonNodeObject)
 	{
 		return nullptr;
@@ -5959,11 +7823,141 @@ TSharedPtr<FJsonObject> FglTFRuntimeParser::GetNodeExtensionObject(const int32 N
 
 TSharedPtr<FJsonObject> FglTFRuntimeParser::GetNodeObject(const int32 NodeIndex)
 {
-	return GetJsonObjectFromRootIndex("nodes", NodeIndex);
+	return GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Nodes, NodeIndex);
+}
+
+namespace glTFRuntime
+{
+	template<int32 Bits>
+	FORCEINLINE bool DecodeMeshOptimizerGroup(const uint8* Data, int64& Offset, const int64 Limit, uint8* Deltas)
+	{
+		// 16 selectors of Bits bits (most significant first), followed by the escaped bytes
+		constexpr int64 SelectorBytes = Bits * 2;
+		constexpr uint8 Escape = (1 << Bits) - 1;
+
+		if (Offset + SelectorBytes > Limit)
+		{
+			return false;
+		}
+
+		const uint8* Selectors = Data + Offset;
+		int64 EscapeOffset = Offset + SelectorBytes;
+
+		// fast path, the escaped bytes cannot cross the limit
+		if (EscapeOffset + 16 <= Limit)
+		{
+			for (int32 Index = 0; Index < 16; Index++)
+			{
+				const uint8 Delta = (Selectors[(Index * Bits) >> 3] >> (8 - Bits - ((Index * Bits) & 7))) & Escape;
+				const bool bEscape = Delta == Escape;
+				Deltas[Index] = bEscape ? Data[EscapeOffset] : Delta;
+				EscapeOffset += bEscape;
+			}
+		}
+		else
+		{
+			for (int32 Index = 0; Index < 16; Index++)
+			{
+				const uint8 Delta = (Selectors[(Index * Bits) >> 3] >> (8 - Bits - ((Index * Bits) & 7))) & Escape;
+				if (Delta == Escape)
+				{
+					if (EscapeOffset + 1 > Limit)
+					{
+						return false;
+					}
+					Deltas[Index] = Data[EscapeOffset++];
+				}
+				else
+				{
+					Deltas[Index] = Delta;
+				}
+			}
+		}
+
+		Offset = EscapeOffset;
+		return true;
+	}
+
+	FORCEINLINE int32 RoundMeshOptimizerFilter(const float Value)
+	{
+		// matches the reference decoder (truncation after biasing)
+		return static_cast<int32>(Value + (Value >= 0.0f ? 0.5f : -0.5f));
+	}
+
+	template<typename T>
+	void DecodeMeshOptimizerOctahedralFilter(T* Data, const int64 First, const int64 Count)
+	{
+		const float MaxInt = static_cast<float>((1 << (sizeof(T) * 8 - 1)) - 1);
+		for (int64 Index = First * 4; Index < (First + Count) * 4; Index += 4)
+		{
+			float X = Data[Index];
+			float Y = Data[Index + 1];
+			const float Z = static_cast<float>(Data[Index + 2]) - FMath::Abs(X) - FMath::Abs(Y);
+			const float Fixup = Z < 0.0f ? Z : 0.0f;
+			X += (X >= 0.0f) ? Fixup : -Fixup;
+			Y += (Y >= 0.0f) ? Fixup : -Fixup;
+			const float H = MaxInt / FMath::Sqrt(X * X + Y * Y + Z * Z);
+			Data[Index + 0] = static_cast<T>(RoundMeshOptimizerFilter(X * H));
+			Data[Index + 1] = static_cast<T>(RoundMeshOptimizerFilter(Y * H));
+			Data[Index + 2] = static_cast<T>(RoundMeshOptimizerFilter(Z * H));
+		}
+	}
+
+	void DecodeMeshOptimizerQuaternionFilter(int16* Data, const int64 First, const int64 Count)
+	{
+		const float Range = 1.0f / FMath::Sqrt(2.0f);
+		for (int64 Index = First * 4; Index < (First + Count) * 4; Index += 4)
+		{
+			const float Scale = Range / static_cast<float>(Data[Index + 3] | 3);
+
+			const float X = Data[Index] * Scale;
+			const float Y = Data[Index + 1] * Scale;
+			const float Z = Data[Index + 2] * Scale;
+
+			const float WW = 1.0f - X * X - Y * Y - Z * Z;
+			const float W = FMath::Sqrt(WW >= 0.0f ? WW : 0.0f);
+
+			const int32 MaxComp = Data[Index + 3] & 3;
+
+			Data[Index + ((MaxComp + 1) & 3)] = static_cast<int16>(RoundMeshOptimizerFilter(X * 32767.0f));
+			Data[Index + ((MaxComp + 2) & 3)] = static_cast<int16>(RoundMeshOptimizerFilter(Y * 32767.0f));
+			Data[Index + ((MaxComp + 3) & 3)] = static_cast<int16>(RoundMeshOptimizerFilter(Z * 32767.0f));
+			Data[Index + ((MaxComp + 0) & 3)] = static_cast<int16>(static_cast<int32>(W * 32767.0f + 0.5f));
+		}
+	}
+
+	void DecodeMeshOptimizerExponentialFilter(uint32* Data, const int64 First, const int64 Count)
+	{
+		for (int64 Index = First; Index < First + Count; Index++)
+		{
+			const int32 Mantissa = static_cast<int32>(Data[Index] << 8) >> 8;
+			const int32 Exponent = static_cast<int32>(Data[Index]) >> 24;
+			// ldexp(Mantissa, Exponent) without going through pow()
+			const uint32 ScaleBits = static_cast<uint32>(Exponent + 127) << 23;
+			float Value;
+			FMemory::Memcpy(&Value, &ScaleBits, sizeof(float));
+			Value *= static_cast<float>(Mantissa);
+			FMemory::Memcpy(&Data[Index], &Value, sizeof(float));
+		}
+	}
+
+	template<typename T>
+	void ApplyMeshOptimizerFilter(T* Data, const int64 Count, void (*Filter)(T*, const int64, const int64))
+	{
+		constexpr int64 BatchSize = 4096;
+		const int64 NumBatches = (Count + BatchSize - 1) / BatchSize;
+		ParallelFor(NumBatches, [&](const int32 BatchIndex)
+			{
+				const int64 First = BatchIndex * BatchSize;
+				Filter(Data, First, FMath::Min(BatchSize, Count - First));
+			}, NumBatches < 2);
+	}
 }
 
 bool FglTFRuntimeParser::DecompressMeshOptimizer(const FglTFRuntimeBlob& Blob, const int64 Stride, const int64 Elements, const FString& Mode, const FString& Filter, TArray64<uint8>& UncompressedBytes)
 {
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_DecompressMeshOptimizer, FColor::Magenta);
+
 	auto DecodeZigZag = [](const uint8 V)
 		{
 			return ((V & 1) != 0) ? ~(V >> 1) : (V >> 1);
@@ -5973,17 +7967,24 @@ bool FglTFRuntimeParser::DecompressMeshOptimizer(const FglTFRuntimeBlob& Blob, c
 	if (Mode == "ATTRIBUTES" && Blob.Num > 32 && Blob.Data[0] == 0xa0)
 	{
 		const int64 MaxBlockElements = FMath::Min<int64>((8192 / Stride) & ~15, 256);
-		TArray<uint8, TInlineAllocator<16>> Deltas;
-		Deltas.AddZeroed(16);
+		if (MaxBlockElements <= 0)
+		{
+			return false;
+		}
 
-		TArray<uint8> TempData;
-		TempData.Append(Blob.Data + Blob.Num - Stride, Stride);
+		// each byte channel of a block is decoded in a contiguous buffer and then transposed
+		uint8 BlockBytes[256];
 
+		TArray<uint8, TInlineAllocator<256>> LastVertex;
+		LastVertex.Append(Blob.Data + Blob.Num - Stride, Stride);
+
+		const uint8* Data = Blob.Data;
 		int64 Offset = 1;
 		const int64 Limit = Blob.Num - Stride;
 
 		// preallocated output
 		UncompressedBytes.AddUninitialized(Elements * Stride);
+		uint8* Output = UncompressedBytes.GetData();
 
 		for (int64 ElementIndex = 0; ElementIndex < Elements; ElementIndex += MaxBlockElements)
 		{
@@ -6001,147 +8002,131 @@ bool FglTFRuntimeParser::DecompressMeshOptimizer(const FglTFRuntimeBlob& Blob, c
 					return false;
 				}
 
-				int64 HeaderOffset = Offset;
+				const uint8* Header = Data + Offset;
 				Offset += NumberOfHeaderBytes;
 
 				for (int64 GroupIndex = 0; GroupIndex < GroupCount; GroupIndex++)
 				{
-					const uint8 ModeValue = (Blob.Data[HeaderOffset] >> ((GroupIndex & 0x03) << 1)) & 0x03;
-					if ((GroupIndex & 0x03) == 0x03)
-					{
-						HeaderOffset++;
-					}
+					const uint8 ModeValue = (Header[GroupIndex >> 2] >> ((GroupIndex & 0x03) << 1)) & 0x03;
+					uint8* Deltas = BlockBytes + (GroupIndex << 4);
 
 					if (ModeValue == 0)
 					{
-						FMemory::Memset(Deltas.GetData(), 0, 16);
+						FMemory::Memzero(Deltas, 16);
 					}
 					else if (ModeValue == 1)
 					{
-						if (Offset + 4 > Limit)
+						if (!glTFRuntime::DecodeMeshOptimizerGroup<2>(Data, Offset, Limit, Deltas))
 						{
 							return false;
 						}
-
-						const int64 BaseOffset = Offset;
-						Offset += 4;
-
-						for (int64 Index = 0; Index < 16; Index++)
-						{
-							const int64 Shift = (6 - ((Index & 0x03) << 1));
-							uint8 Delta = (Blob.Data[BaseOffset + (Index >> 2)] >> Shift) & 0x03;
-							if (Delta == 3)
-							{
-								if (Offset + 1 > Limit)
-								{
-									return false;
-								}
-								Delta = Blob.Data[Offset++];
-							}
-							Deltas[Index] = Delta;
-						}
 					}
 					else if (ModeValue == 2)
 					{
-						if (Offset + 8 > Limit)
+						if (!glTFRuntime::DecodeMeshOptimizerGroup<4>(Data, Offset, Limit, Deltas))
 						{
 							return false;
 						}
-
-						const int64 BaseOffset = Offset;
-						Offset += 8;
-
-						for (int64 Index = 0; Index < 16; Index++)
-						{
-							const int64 Shift = (Index & 0x01) ? 0 : 4;
-							uint8 Delta = (Blob.Data[BaseOffset + (Index >> 1)] >> Shift) & 0x0f;
-							if (Delta == 0xf)
-							{
-								if (Offset + 1 > Limit)
-								{
-									return false;
-								}
-								Delta = Blob.Data[Offset++];
-							}
-							Deltas[Index] = Delta;
-						}
 					}
-					else if (ModeValue == 3)
+					else
 					{
 						if (Offset + 16 > Limit)
 						{
 							return false;
 						}
-						FMemory::Memcpy(Deltas.GetData(), Blob.Data + Offset, 16);
+						FMemory::Memcpy(Deltas, Data + Offset, 16);
 						Offset += 16;
 					}
+				}
 
-					const int64 DestinationElementGroup = ElementIndex + (GroupIndex << 4);
-
-					for (int64 Index = 0; Index < 16; Index++)
-					{
-						const int64 DestinationElementIndex = DestinationElementGroup + Index;
-						if (DestinationElementIndex >= Elements)
-						{
-							break;
-						}
-
-						const uint8 Delta = DecodeZigZag(Deltas[Index]);
-						TempData[ElementByteIndex] += Delta;
-						UncompressedBytes[DestinationElementIndex * Stride + ElementByteIndex] = TempData[ElementByteIndex];
-					}
-
+				uint8 Value = LastVertex[ElementByteIndex];
+				uint8* Destination = Output + ElementIndex * Stride + ElementByteIndex;
+				for (int64 Index = 0; Index < BlockElements; Index++)
+				{
+					Value += static_cast<uint8>(DecodeZigZag(BlockBytes[Index]));
+					*Destination = Value;
+					Destination += Stride;
 				}
+				LastVertex[ElementByteIndex] = Value;
 			}
 		}
 	}
 	else if (Mode == "TRIANGLES" && Blob.Num >= 17 && Blob.Data[0] == 0xe1 && (Stride == 2 || Stride == 4) && ((Elements % 3) == 0))
 	{
-		TArray<uint8> CodeAux;
 		const int64 Limit = Blob.Num - 16;
-		CodeAux.Append(Blob.Data + Limit, 16);
+		const uint8* CodeAux = Blob.Data + Limit;
 
 		uint32 Next = 0;
 		uint32 Last = 0;
-		TArray<TPair<uint32, uint32>> EdgeFifo;
-		TArray<uint32> VertexFifo;
+
+		// the encoder never references more than 16 edges/vertices, so fixed ring buffers are enough
+		uint32 EdgeFifo[16][2];
+		uint32 VertexFifo[16];
+		uint32 EdgeFifoOffset = 0;
+		uint32 VertexFifoOffset = 0;
+		uint32 EdgeFifoNum = 0;
+		uint32 VertexFifoNum = 0;
 
 		int64 Offset = 1;
 		const uint32 TrianglesNum = Elements / 3;
 		int64 DataOffset = Offset + TrianglesNum;
-		int64 TriangleOffset = 0;
 
 		UncompressedBytes.AddUninitialized(Elements * Stride);
+		uint16* Indices16 = reinterpret_cast<uint16*>(UncompressedBytes.GetData());
+		uint32* Indices32 = reinterpret_cast<uint32*>(UncompressedBytes.GetData());
 
-		auto EmitTriangle = [Stride, &TriangleOffset, &UncompressedBytes](const uint32 A, const uint32 B, const uint32 C)
+		auto EmitTriangle = [Stride, Indices16, Indices32](const uint32 TriangleIndex, const uint32 A, const uint32 B, const uint32 C)
 			{
 				if (Stride == 2)
 				{
-					const uint16 AShort = A;
-					const uint16 BShort = B;
-					const uint16 CShort = C;
-					UncompressedBytes[TriangleOffset++] = reinterpret_cast<const uint8*>(&AShort)[0];
-					UncompressedBytes[TriangleOffset++] = reinterpret_cast<const uint8*>(&AShort)[1];
-					UncompressedBytes[TriangleOffset++] = reinterpret_cast<const uint8*>(&BShort)[0];
-					UncompressedBytes[TriangleOffset++] = reinterpret_cast<const uint8*>(&BShort)[1];
-					UncompressedBytes[TriangleOffset++] = reinterpret_cast<const uint8*>(&CShort)[0];
-					UncompressedBytes[TriangleOffset++] = reinterpret_cast<const uint8*>(&CShort)[1];
+					Indices16[TriangleIndex * 3] = static_cast<uint16>(A);
+					Indices16[TriangleIndex * 3 + 1] = static_cast<uint16>(B);
+					Indices16[TriangleIndex * 3 + 2] = static_cast<uint16>(C);
 				}
 				else
 				{
-					UncompressedBytes[TriangleOffset++] = reinterpret_cast<const uint8*>(&A)[0];
-					UncompressedBytes[TriangleOffset++] = reinterpret_cast<const uint8*>(&A)[1];
-					UncompressedBytes[TriangleOffset++] = reinterpret_cast<const uint8*>(&A)[2];
-					UncompressedBytes[TriangleOffset++] = reinterpret_cast<const uint8*>(&A)[3];
-					UncompressedBytes[TriangleOffset++] = reinterpret_cast<const uint8*>(&B)[0];
-					UncompressedBytes[TriangleOffset++] = reinterpret_cast<const uint8*>(&B)[1];
-					UncompressedBytes[TriangleOffset++] = reinterpret_cast<const uint8*>(&B)[2];
-					UncompressedBytes[TriangleOffset++] = reinterpret_cast<const uint8*>(&B)[3];
-					UncompressedBytes[TriangleOffset++] = reinterpret_cast<const uint8*>(&C)[0];
-					UncompressedBytes[TriangleOffset++] = reinterpret_cast<const uint8*>(&C)[1];
-					UncompressedBytes[TriangleOffset++] = reinterpret_cast<const uint8*>(&C)[2];
-					UncompressedBytes[TriangleOffset++] = reinterpret_cast<const uint8*>(&C)[3];
+					Indices32[TriangleIndex * 3] = A;
+					Indices32[TriangleIndex * 3 + 1] = B;
+					Indices32[TriangleIndex * 3 + 2] = C;
+				}
+			};
+
+		auto PushEdge = [&EdgeFifo, &EdgeFifoOffset, &EdgeFifoNum](const uint32 A, const uint32 B)
+			{
+				EdgeFifo[EdgeFifoOffset][0] = A;
+				EdgeFifo[EdgeFifoOffset][1] = B;
+				EdgeFifoOffset = (EdgeFifoOffset + 1) & 15;
+				EdgeFifoNum = FMath::Min<uint32>(EdgeFifoNum + 1, 16);
+			};
+
+		auto PushVertex = [&VertexFifo, &VertexFifoOffset, &VertexFifoNum](const uint32 V)
+			{
+				VertexFifo[VertexFifoOffset] = V;
+				VertexFifoOffset = (VertexFifoOffset + 1) & 15;
+				VertexFifoNum = FMath::Min<uint32>(VertexFifoNum + 1, 16);
+			};
+
+		// 0 is the most recently pushed item
+		auto GetEdge = [&EdgeFifo, &EdgeFifoOffset, &EdgeFifoNum](const uint32 Index, uint32& A, uint32& B) -> bool
+			{
+				if (Index >= EdgeFifoNum)
+				{
+					return false;
+				}
+				const uint32* Edge = EdgeFifo[(EdgeFifoOffset - 1 - Index) & 15];
+				A = Edge[0];
+				B = Edge[1];
+				return true;
+			};
+
+		auto GetVertex = [&VertexFifo, &VertexFifoOffset, &VertexFifoNum](const uint32 Index, uint32& V) -> bool
+			{
+				if (Index >= VertexFifoNum)
+				{
+					return false;
 				}
+				V = VertexFifo[(VertexFifoOffset - 1 - Index) & 15];
+				return true;
 			};
 
 		auto DecodeIndex = [&Blob, &DataOffset, &Last, Limit]() -> bool
@@ -6169,106 +8154,63 @@ bool FglTFRuntimeParser::DecompressMeshOptimizer(const FglTFRuntimeBlob& Blob, c
 				return true;
 			};
 
-		for (uint32 TriangleIndex = 0; TriangleIndex < TrianglesNum; TriangleIndex++)
+		if (Offset + TrianglesNum > Limit)
 		{
-			if (Offset >= Limit)
-			{
-				return false;
-			}
-			uint8 Code = Blob.Data[Offset++];
-			uint8 NibbleLeft = Code >> 4;
-			uint8 NibbleRight = Code & 0x0f;
-
-			if (NibbleLeft < 0xf && NibbleRight == 0) // 0xX0
-			{
-				if (NibbleLeft >= EdgeFifo.Num())
-				{
-					return false;
-				}
-				const TPair<uint32, uint32> AB = EdgeFifo[NibbleLeft];
-				const uint32 C = Next++;
-
-				EdgeFifo.Insert(TPair<uint32, uint32>(C, AB.Value), 0); // push CB
-				EdgeFifo.Insert(TPair<uint32, uint32>(AB.Key, C), 0); // push AC
-				VertexFifo.Insert(C, 0);
-
-				EmitTriangle(AB.Key, AB.Value, C);
-			}
-			else if (NibbleLeft < 0xf && NibbleRight > 0 && NibbleRight < 0x0d) // 0xXY
-			{
-				if (NibbleLeft >= EdgeFifo.Num())
-				{
-					return false;
-				}
-				const TPair<uint32, uint32> AB = EdgeFifo[NibbleLeft];
-
-				if (NibbleRight >= VertexFifo.Num())
-				{
-					return false;
-				}
+			return false;
+		}
 
-				const uint32 C = VertexFifo[NibbleRight];
-				EdgeFifo.Insert(TPair<uint32, uint32>(C, AB.Value), 0); // push CB
-				EdgeFifo.Insert(TPair<uint32, uint32>(AB.Key, C), 0); // push AC
+		for (uint32 TriangleIndex = 0; TriangleIndex < TrianglesNum; TriangleIndex++)
+		{
+			const uint8 Code = Blob.Data[Offset++];
+			const uint8 NibbleLeft = Code >> 4;
+			const uint8 NibbleRight = Code & 0x0f;
 
-				EmitTriangle(AB.Key, AB.Value, C);
-			}
-			else if (NibbleLeft < 0xf && NibbleRight == 0x0d) // 0xXd
+			if (NibbleLeft < 0xf) // 0xXY
 			{
-				if (NibbleLeft >= EdgeFifo.Num())
+				uint32 A = 0;
+				uint32 B = 0;
+				if (!GetEdge(NibbleLeft, A, B))
 				{
 					return false;
 				}
-				const TPair<uint32, uint32> AB = EdgeFifo[NibbleLeft];
-
-				const uint32 C = Last - 1;
-				Last = C;
 
-				EdgeFifo.Insert(TPair<uint32, uint32>(C, AB.Value), 0); // push CB
-				EdgeFifo.Insert(TPair<uint32, uint32>(AB.Key, C), 0); // push AC
-				VertexFifo.Insert(C, 0);
-
-				EmitTriangle(AB.Key, AB.Value, C);
-			}
-			else if (NibbleLeft < 0xf && NibbleRight == 0x0e) // 0xXe
-			{
-				if (NibbleLeft >= EdgeFifo.Num())
+				uint32 C = 0;
+				if (NibbleRight == 0) // 0xX0
 				{
-					return false;
+					C = Next++;
+					PushVertex(C);
 				}
-				const TPair<uint32, uint32> AB = EdgeFifo[NibbleLeft];
-
-				const uint32 C = Last + 1;
-				Last = C;
-
-				EdgeFifo.Insert(TPair<uint32, uint32>(C, AB.Value), 0); // push CB
-				EdgeFifo.Insert(TPair<uint32, uint32>(AB.Key, C), 0); // push AC
-				VertexFifo.Insert(C, 0);
-
-				EmitTriangle(AB.Key, AB.Value, C);
-			}
-			else if (NibbleLeft < 0xf && NibbleRight == 0x0f) // 0xXf
-			{
-				if (NibbleLeft >= EdgeFifo.Num())
+				else if (NibbleRight < 0x0d) // 0xXY
 				{
-					return false;
+					if (!GetVertex(NibbleRight, C))
+					{
+						return false;
+					}
 				}
-				const TPair<uint32, uint32> AB = EdgeFifo[NibbleLeft];
-
-				if (!DecodeIndex())
+				else // 0xXd - 0xXf
 				{
-					return false;
+					if (NibbleRight == 0x0d)
+					{
+						Last--;
+					}
+					else if (NibbleRight == 0x0e)
+					{
+						Last++;
+					}
+					else if (!DecodeIndex())
+					{
+						return false;
+					}
+					C = Last;
+					PushVertex(C);
 				}
 
-				const uint32 C = Last;
-
-				EdgeFifo.Insert(TPair<uint32, uint32>(C, AB.Value), 0); // push CB
-				EdgeFifo.Insert(TPair<uint32, uint32>(AB.Key, C), 0); // push AC
-				VertexFifo.Insert(C, 0);
+				PushEdge(C, B); // push CB
+				PushEdge(A, C); // push AC
 
-				EmitTriangle(AB.Key, AB.Value, C);
+				EmitTriangle(TriangleIndex, A, B, C);
 			}
-			else if (NibbleLeft == 0xf && NibbleRight < 0xe) // 0xfY
+			else if (NibbleRight < 0xe) // 0xfY
 			{
 				const uint8 ZW = CodeAux[NibbleRight];
 				const uint8 Z = ZW >> 4;
@@ -6282,53 +8224,45 @@ bool FglTFRuntimeParser::DecompressMeshOptimizer(const FglTFRuntimeBlob& Blob, c
 				{
 					B = Next++;
 				}
-				else
+				else if (!GetVertex(Z - 1, B))
 				{
-					if (Z - 1 >= VertexFifo.Num())
-					{
-						return false;
-					}
-					B = VertexFifo[Z - 1];
+					return false;
 				}
 
 				if (W == 0)
 				{
 					C = Next++;
 				}
-				else
+				else if (!GetVertex(W - 1, C))
 				{
-					if (W - 1 >= VertexFifo.Num())
-					{
-						return false;
-					}
-					C = VertexFifo[W - 1];
+					return false;
 				}
 
-				EdgeFifo.Insert(TPair<uint32, uint32>(B, A), 0); // push BA
-				EdgeFifo.Insert(TPair<uint32, uint32>(C, B), 0); // push CB
-				EdgeFifo.Insert(TPair<uint32, uint32>(A, C), 0); // push AC
-				VertexFifo.Insert(A, 0);
+				PushEdge(B, A); // push BA
+				PushEdge(C, B); // push CB
+				PushEdge(A, C); // push AC
+				PushVertex(A);
 				if (Z == 0)
 				{
-					VertexFifo.Insert(B, 0);
+					PushVertex(B);
 				}
 				if (W == 0)
 				{
-					VertexFifo.Insert(C, 0);
+					PushVertex(C);
 				}
 
-				EmitTriangle(A, B, C);
+				EmitTriangle(TriangleIndex, A, B, C);
 			}
-			else if (Code == 0xfe || Code == 0xff) // 0xfe - 0xff
+			else // 0xfe - 0xff
 			{
 				if (DataOffset >= Limit)
 				{
 					return false;
 				}
 
-				uint8 ZW = Blob.Data[DataOffset++];
-				uint8 Z = ZW >> 4;
-				uint8 W = ZW & 0x0f;
+				const uint8 ZW = Blob.Data[DataOffset++];
+				const uint8 Z = ZW >> 4;
+				const uint8 W = ZW & 0x0f;
 				if (ZW == 0)
 				{
 					Next = 0;
@@ -6355,11 +8289,10 @@ bool FglTFRuntimeParser::DecompressMeshOptimizer(const FglTFRuntimeBlob& Blob, c
 				}
 				else if (Z < 0xf)
 				{
-					if (Z - 1 >= VertexFifo.Num())
+					if (!GetVertex(Z - 1, B))
 					{
 						return false;
 					}
-					B = VertexFifo[Z - 1];
 				}
 				else
 				{
@@ -6377,11 +8310,10 @@ bool FglTFRuntimeParser::DecompressMeshOptimizer(const FglTFRuntimeBlob& Blob, c
 				}
 				else if (W < 0xf)
 				{
-					if (W - 1 >= VertexFifo.Num())
+					if (!GetVertex(W - 1, C))
 					{
 						return false;
 					}
-					C = VertexFifo[W - 1];
 				}
 				else
 				{
@@ -6392,118 +8324,330 @@ bool FglTFRuntimeParser::DecompressMeshOptimizer(const FglTFRuntimeBlob& Blob, c
 					C = Last;
 				}
 
-				EdgeFifo.Insert(TPair<uint32, uint32>(B, A), 0); // push BA
-				EdgeFifo.Insert(TPair<uint32, uint32>(C, B), 0); // push CB
-				EdgeFifo.Insert(TPair<uint32, uint32>(A, C), 0); // push AC
-				VertexFifo.Insert(A, 0);
+				PushEdge(B, A); // push BA
+				PushEdge(C, B); // push CB
+				PushEdge(A, C); // push AC
+				PushVertex(A);
 				if (Z == 0 || Z == 0xf)
 				{
-					VertexFifo.Insert(B, 0);
+					PushVertex(B);
 				}
 				if (W == 0 || W == 0xf)
 				{
-					VertexFifo.Insert(C, 0);
+					PushVertex(C);
+				}
+
+				EmitTriangle(TriangleIndex, A, B, C);
+			}
+		}
+	}
+	else
+	{
+		return false;
+	}
+
+	if (UncompressedBytes.Num() > 0)
+	{
+		if (Filter == "OCTAHEDRAL" && (Stride == 4 || Stride == 8))
+		{
+			if (Stride == 4)
+			{
+				glTFRuntime::ApplyMeshOptimizerFilter<int8>(reinterpret_cast<int8*>(UncompressedBytes.GetData()), Elements, glTFRuntime::DecodeMeshOptimizerOctahedralFilter<int8>);
+			}
+			else
+			{
+				glTFRuntime::ApplyMeshOptimizerFilter<int16>(reinterpret_cast<int16*>(UncompressedBytes.GetData()), Elements, glTFRuntime::DecodeMeshOptimizerOctahedralFilter<int16>);
+			}
+		}
+		else if (Filter == "QUATERNION" && Stride == 8)
+		{
+			glTFRuntime::ApplyMeshOptimizerFilter<int16>(reinterpret_cast<int16*>(UncompressedBytes.GetData()), Elements, glTFRuntime::DecodeMeshOptimizerQuaternionFilter);
+		}
+		else if (Filter == "EXPONENTIAL" && (Stride % 4) == 0)
+		{
+			glTFRuntime::ApplyMeshOptimizerFilter<uint32>(reinterpret_cast<uint32*>(UncompressedBytes.GetData()), UncompressedBytes.Num() / 4, glTFRuntime::DecodeMeshOptimizerExponentialFilter);
+		}
+		else if (Filter != "" && Filter != "NONE")
+		{
+			AddError("DecompressMeshOptimizer()", "Unsupported Filter");
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void FglTFRuntimeParser::GetPrimitivesAccessors(const TArray<TSharedPtr<FJsonValue>>& JsonPrimitives, TArray<int32>& AccessorIndices)
+{
+	auto AddAccessors = [&AccessorIndices](const TSharedPtr<FJsonObject>& JsonAttributesObject)
+		{
+			for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : JsonAttributesObject->Values)
+			{
+				double AccessorIndex = 0;
+				if (Pair.Value && Pair.Value->TryGetNumber(AccessorIndex))
+				{
+					AccessorIndices.AddUnique(static_cast<int32>(AccessorIndex));
+				}
+			}
+		};
+
+	for (const TSharedPtr<FJsonValue>& JsonPrimitive : JsonPrimitives)
+	{
+		TSharedPtr<FJsonObject> JsonPrimitiveObject = JsonPrimitive ? JsonPrimitive->AsObject() : nullptr;
+		if (!JsonPrimitiveObject)
+		{
+			continue;
+		}
+
+		const TSharedPtr<FJsonObject>* JsonAttributesObject;
+		if (JsonPrimitiveObject->TryGetObjectField(TEXT("attributes"), JsonAttributesObject))
+		{
+			AddAccessors(*JsonAttributesObject);
+		}
+
+		int64 IndicesAccessorIndex;
+		if (JsonPrimitiveObject->TryGetNumberField(TEXT("indices"), IndicesAccessorIndex))
+		{
+			AccessorIndices.AddUnique(IndicesAccessorIndex);
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* JsonTargetsArray;
+		if (JsonPrimitiveObject->TryGetArrayField(TEXT("targets"), JsonTargetsArray))
+		{
+			for (const TSharedPtr<FJsonValue>& JsonTarget : *JsonTargetsArray)
+			{
+				TSharedPtr<FJsonObject> JsonTargetObject = JsonTarget ? JsonTarget->AsObject() : nullptr;
+				if (JsonTargetObject)
+				{
+					AddAccessors(JsonTargetObject);
 				}
-
-				EmitTriangle(A, B, C);
 			}
 		}
 	}
-	else
+}
+
+void FglTFRuntimeParser::DecompressMeshOptimizerBufferViews(const TArray<int32>& AccessorIndices)
+{
+	if (!ExtensionsUsed.Contains("EXT_meshopt_compression"))
 	{
-		return false;
+		return;
 	}
 
-	if (UncompressedBytes.Num() > 0)
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_DecompressMeshOptimizerBufferViews, FColor::Magenta);
+
+	struct FMeshOptimizerBufferView
 	{
-		if (Filter == "OCTAHEDRAL" && (Stride == 4 || Stride == 8))
+		int32 Index;
+		FglTFRuntimeBlob Blob;
+		int64 Stride;
+		int64 Elements;
+		FString Mode;
+		FString Filter;
+		TArray64<uint8> UncompressedBytes;
+		bool bSuccess;
+	};
+
+	// json and buffers are resolved here, only the decoding runs on the workers
+	TArray<FMeshOptimizerBufferView> BufferViews;
+	for (const int32 AccessorIndex : AccessorIndices)
+	{
+		FglTFRuntimeAccessorEntry AccessorEntry;
+		if (!GetAccessorEntry(AccessorIndex, AccessorEntry) || AccessorEntry.BufferView == INDEX_NONE)
 		{
-			if (Stride == 4)
-			{
-				int8* Data = reinterpret_cast<int8*>(UncompressedBytes.GetData());
-				const int64 MaxInt = 127;
-				for (int64 Index = 0; Index < 4 * Elements; Index += 4)
-				{
-					float X = Data[Index];
-					float Y = Data[Index + 1];
-					float One = Data[Index + 2];
-					X /= One;
-					Y /= One;
-					const float Z = 1.0 - FMath::Abs(X) - FMath::Abs(Y);
-					const float T = FMath::Max(-Z, 0.0f);
-					X -= (X >= 0) ? T : -T;
-					Y -= (Y >= 0) ? T : -T;
-					const float H = MaxInt / FMath::Sqrt(X * X + Y * Y + Z * Z);
-					Data[Index + 0] = FMath::RoundToInt(X * H);
-					Data[Index + 1] = FMath::RoundToInt(Y * H);
-					Data[Index + 2] = FMath::RoundToInt(Z * H);
-				}
-			}
-			else
-			{
-				int16* Data = reinterpret_cast<int16*>(UncompressedBytes.GetData());
-				const int64 MaxInt = 32767;
-				for (int64 Index = 0; Index < 4 * Elements; Index += 4)
-				{
-					float X = Data[Index];
-					float Y = Data[Index + 1];
-					float One = Data[Index + 2];
-					X /= One;
-					Y /= One;
-					const float Z = 1.0 - FMath::Abs(X) - FMath::Abs(Y);
-					const float T = FMath::Max(-Z, 0.0f);
-					X -= (X >= 0) ? T : -T;
-					Y -= (Y >= 0) ? T : -T;
-					const float H = MaxInt / FMath::Sqrt(X * X + Y * Y + Z * Z);
-					Data[Index + 0] = FMath::RoundToInt(X * H);
-					Data[Index + 1] = FMath::RoundToInt(Y * H);
-					Data[Index + 2] = FMath::RoundToInt(Z * H);
-				}
-			}
+			continue;
 		}
-		else if (Filter == "QUATERNION" && Stride == 8)
+
+		const int32 BufferViewIndex = AccessorEntry.BufferView;
+		bool bAlreadyDecoded = false;
+		{
+			FScopeLock Lock(&CompressedBufferViewsLock);
+			bAlreadyDecoded = CompressedBufferViewsCache.Contains(BufferViewIndex);
+		}
+		if (bAlreadyDecoded || BufferViews.ContainsByPredicate([BufferViewIndex](const FMeshOptimizerBufferView& BufferView) { return BufferView.Index == BufferViewIndex; }))
+		{
+			continue;
+		}
+
+		TSharedPtr<FJsonObject> JsonBufferViewObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::BufferViews, BufferViewIndex);
+		if (!JsonBufferViewObject)
+		{
+			continue;
+		}
+
+		TSharedPtr<FJsonObject> JsonBufferViewCompressedObject = GetJsonObjectExtension(JsonBufferViewObject.ToSharedRef(), "EXT_meshopt_compression");
+		if (!JsonBufferViewCompressedObject)
 		{
-			int16* Data = reinterpret_cast<int16*>(UncompressedBytes.GetData());
+			continue;
+		}
 
-			const float Range = 1.0f / FMath::Sqrt(2.0f);
+		FMeshOptimizerBufferView BufferView;
+		BufferView.Index = BufferViewIndex;
+		BufferView.bSuccess = false;
 
-			for (int64 Offset = 0; Offset < Elements * 4; Offset += 4)
-			{
-				float One = Data[Offset + 3] | 3;
+		int64 BufferIndex;
+		int64 ByteLength;
+		int64 ByteOffset = 0;
+		if (!JsonBufferViewCompressedObject->TryGetNumberField(TEXT("buffer"), BufferIndex) ||
+			!JsonBufferViewCompressedObject->TryGetNumberField(TEXT("byteLength"), ByteLength) ||
+			!JsonBufferViewCompressedObject->TryGetNumberField(TEXT("byteStride"), BufferView.Stride) ||
+			!JsonBufferViewCompressedObject->TryGetNumberField(TEXT("count"), BufferView.Elements) ||
+			!JsonBufferViewCompressedObject->TryGetStringField(TEXT("mode"), BufferView.Mode))
+		{
+			continue;
+		}
+		JsonBufferViewCompressedObject->TryGetNumberField(TEXT("byteOffset"), ByteOffset);
+		if (!JsonBufferViewCompressedObject->TryGetStringField(TEXT("filter"), BufferView.Filter))
+		{
+			BufferView.Filter = "NONE";
+		}
+
+		// unsupported filters are left to GetBufferView() for error reporting
+		const bool bValidFilter = BufferView.Filter == "NONE" ||
+			(BufferView.Filter == "OCTAHEDRAL" && (BufferView.Stride == 4 || BufferView.Stride == 8)) ||
+			(BufferView.Filter == "QUATERNION" && BufferView.Stride == 8) ||
+			(BufferView.Filter == "EXPONENTIAL" && (BufferView.Stride % 4) == 0);
+		if (!bValidFilter || BufferView.Stride <= 0)
+		{
+			continue;
+		}
+
+		if (!GetBufferRange(BufferIndex, ByteOffset, ByteLength, BufferView.Blob))
+		{
+			continue;
+		}
 
-				float X = Data[Offset] / One * Range;
-				float Y = Data[Offset + 1] / One * Range;
-				float Z = Data[Offset + 2] / One * Range;
+		BufferViews.Add(MoveTemp(BufferView));
+	}
 
-				float W = FMath::Sqrt(FMath::Max(0.0, 1.0 - X * X - Y * Y - Z * Z));
+	if (BufferViews.Num() < 2)
+	{
+		return;
+	}
 
-				int32 MaxComp = Data[Offset + 3] & 3;
+	ParallelFor(BufferViews.Num(), [&](const int32 BufferViewIndex)
+		{
+			FMeshOptimizerBufferView& BufferView = BufferViews[BufferViewIndex];
+			BufferView.bSuccess = DecompressMeshOptimizer(BufferView.Blob, BufferView.Stride, BufferView.Elements, BufferView.Mode, BufferView.Filter, BufferView.UncompressedBytes);
+		});
 
-				Data[Offset + ((MaxComp + 1) % 4)] = FMath::RoundToInt(X * 32767.0);
-				Data[Offset + ((MaxComp + 2) % 4)] = FMath::RoundToInt(Y * 32767.0);
-				Data[Offset + ((MaxComp + 3) % 4)] = FMath::RoundToInt(Z * 32767.0);
-				Data[Offset + ((MaxComp + 0) % 4)] = FMath::RoundToInt(W * 32767.0);
-			}
+	// failed bufferViews will be decoded again (and reported) by GetBufferView()
+	FScopeLock Lock(&CompressedBufferViewsLock);
+	for (FMeshOptimizerBufferView& BufferView : BufferViews)
+	{
+		// bufferViews decoded by concurrent loads are kept, as their blobs may be in use
+		if (BufferView.bSuccess && !CompressedBufferViewsCache.Contains(BufferView.Index))
+		{
+			CompressedBufferViewsCache.Add(BufferView.Index, MoveTemp(BufferView.UncompressedBytes));
+			CompressedBufferViewsStridesCache.Add(BufferView.Index, BufferView.Stride);
 		}
-		else if (Filter == "EXPONENTIAL" && (Stride % 4) == 0)
+	}
+}
+
+void FglTFRuntimeParser::DeinterleaveAccessors(const TArray<int32>& AccessorIndices, TMap<int32, TArray64<uint8>>& DeinterleavedAccessors)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_DeinterleaveAccessors, FColor::Magenta);
+
+	struct FInterleavedAccessor
+	{
+		int32 Index;
+		int64 ByteOffset;
+		int64 ElementBytes;
+		int64 Count;
+		uint8* Output;
+	};
+
+	struct FInterleavedBufferView
+	{
+		int32 Index;
+		FglTFRuntimeBlob Blob;
+		int64 Stride;
+		int64 Count;
+		TArray<FInterleavedAccessor> Accessors;
+	};
+
+	// group the accessors (attributes) reading from the same strided bufferView
+	TArray<FInterleavedBufferView> BufferViews;
+	for (const int32 AccessorIndex : AccessorIndices)
+	{
+		FglTFRuntimeAccessorEntry AccessorEntry;
+		if (!GetAccessorEntry(AccessorIndex, AccessorEntry) || AccessorEntry.BufferView == INDEX_NONE || AccessorEntry.bHasSparse || AccessorEntry.Count <= 0)
+		{
+			continue;
+		}
+
+		const int64 ElementBytes = GetComponentTypeSize(AccessorEntry.ComponentType) * AccessorEntry.Elements;
+		if (ElementBytes <= 0)
 		{
-			int32* Data = reinterpret_cast<int32*>(UncompressedBytes.GetData());
-			float* Dest = reinterpret_cast<float*>(UncompressedBytes.GetData());
-			for (int64 Offset = 0; Offset < UncompressedBytes.Num() / 4; Offset++)
+			continue;
+		}
+
+		const int32 BufferViewIndex = AccessorEntry.BufferView;
+		FInterleavedBufferView* BufferView = BufferViews.FindByPredicate([BufferViewIndex](const FInterleavedBufferView& Item) { return Item.Index == BufferViewIndex; });
+		if (!BufferView)
+		{
+			BufferView = &BufferViews.AddDefaulted_GetRef();
+			BufferView->Index = BufferViewIndex;
+			BufferView->Count = 0;
+			// an invalid bufferView will be reported by GetAccessor()
+			if (!GetBufferView(BufferViewIndex, BufferView->Blob, BufferView->Stride))
 			{
-				int32 E = Data[Offset] >> 24;
-				int32 M = (Data[Offset] << 8) >> 8;
-				Dest[Offset] = FMath::Pow(2.0f, E) * M;
+				BufferView->Stride = 0;
 			}
 		}
-		else if (Filter != "" && Filter != "NONE")
+
+		// planar data is already decoded in a single linear pass, out of bounds accessors are left to GetAccessor()
+		if (BufferView->Stride <= ElementBytes ||
+			BufferView->Stride * AccessorEntry.Count > BufferView->Blob.Num ||
+			AccessorEntry.ByteOffset + BufferView->Stride * (AccessorEntry.Count - 1) + ElementBytes > BufferView->Blob.Num)
 		{
-			AddError("DecompressMeshOptimizer()", "Unsupported Filter");
-			return false;
+			continue;
 		}
+
+		FInterleavedAccessor Accessor;
+		Accessor.Index = AccessorIndex;
+		Accessor.ByteOffset = AccessorEntry.ByteOffset;
+		Accessor.ElementBytes = ElementBytes;
+		Accessor.Count = AccessorEntry.Count;
+		Accessor.Output = nullptr;
+		BufferView->Accessors.Add(Accessor);
+		BufferView->Count = FMath::Max(BufferView->Count, Accessor.Count);
 	}
 
-	return true;
+	for (FInterleavedBufferView& BufferView : BufferViews)
+	{
+		// a single attribute does not gain anything from the additional copy
+		if (BufferView.Accessors.Num() < 2)
+		{
+			continue;
+		}
+
+		for (FInterleavedAccessor& Accessor : BufferView.Accessors)
+		{
+			TArray64<uint8>& DeinterleavedData = DeinterleavedAccessors.Add(Accessor.Index);
+			DeinterleavedData.AddUninitialized(Accessor.ElementBytes * Accessor.Count);
+			Accessor.Output = DeinterleavedData.GetData();
+		}
+
+		// each vertex is read once, writing every attribute to its own packed array
+		constexpr int64 BatchSize = 4096;
+		const int64 NumBatches = (BufferView.Count + BatchSize - 1) / BatchSize;
+		ParallelFor(NumBatches, [&](const int32 BatchIndex)
+			{
+				const int64 First = BatchIndex * BatchSize;
+				const int64 Last = FMath::Min(First + BatchSize, BufferView.Count);
+				for (int64 VertexIndex = First; VertexIndex < Last; VertexIndex++)
+				{
+					const uint8* Vertex = BufferView.Blob.Data + VertexIndex * BufferView.Stride;
+					for (const FInterleavedAccessor& Accessor : BufferView.Accessors)
+					{
+						if (VertexIndex < Accessor.Count)
+						{
+							FMemory::Memcpy(Accessor.Output + VertexIndex * Accessor.ElementBytes, Vertex + Accessor.ByteOffset, Accessor.ElementBytes);
+						}
+					}
+				}
+			});
+	}
 }
 
 FTransform FglTFRuntimeParser::GetParentNodeWorldTransform(const FglTFRuntimeNode& Node)
@@ -6615,16 +8759,19 @@ bool FglTFRuntimeParser::GetBlobByName(const FString& Name, TArray64<uint8>& Blo
 
 void FglTFRuntimeParser::LoadMeshAsRuntimeLODAsync(const int32 MeshIndex, const FglTFRuntimeMeshLODAsync& AsyncCallback, const FglTFRuntimeMaterialsConfig& MaterialsConfig)
 {
-	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
+	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Meshes, MeshIndex);
 	if (!JsonMeshObject)
 	{
 		AsyncCallback.ExecuteIfBound(false, FglTFRuntimeMeshLOD());
 	}
 
-	Async(EAsyncExecution::Thread, [this, JsonMeshObject, MaterialsConfig, AsyncCallback]()
+	TSharedRef<FglTFRuntimeAsyncLoad, ESPMode::ThreadSafe> AsyncLoad = BeginAsyncLoad();
+
+	Async(EAsyncExecution::Thread, [this, JsonMeshObject, MaterialsConfig, AsyncCallback, AsyncLoad]()
 		{
 			FglTFRuntimeMeshLOD* LOD;
 			bool bSuccess = LoadMeshIntoMeshLOD(JsonMeshObject.ToSharedRef(), LOD, MaterialsConfig);
+			AsyncLoad->End();
 			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([bSuccess, LOD, AsyncCallback]()
 				{
 					AsyncCallback.ExecuteIfBound(bSuccess, bSuccess ? *LOD : FglTFRuntimeMeshLOD());
@@ -6704,7 +8851,7 @@ TArray<FString> FglTFRuntimeParser::GetAnimationsNames(const bool bIncludeUnname
 	return Names;
 }
 
-void FglTFRuntimeArchiveMap::FromMap(const TMap<FString, TArray64<uint8>> InMap)
+void FglTFRuntimeArchiveMap::FromMap(const TMap<FString, TArray64<uint8>>& InMap)
 {
 	for (const TPair<FString, TArray64<uint8>>& Pair : InMap)
 	{
@@ -6713,6 +8860,16 @@ void FglTFRuntimeArchiveMap::FromMap(const TMap<FString, TArray64<uint8>> InMap)
 	}
 }
 
+void FglTFRuntimeArchiveMap::FromMap(TMap<FString, TArray64<uint8>>&& InMap)
+{
+	for (TPair<FString, TArray64<uint8>>& Pair : InMap)
+	{
+		const int32 NewOffset = MapItems.Add(MoveTemp(Pair.Value));
+		OffsetsMap.Add(Pair.Key, NewOffset);
+	}
+	InMap.Empty();
+}
+
 bool FglTFRuntimeArchiveMap::GetFileContent(const FString& Filename, TArray64<uint8>& OutData)
 {
 	if (!OffsetsMap.Contains(Filename))
@@ -6730,6 +8887,265 @@ bool FglTFRuntimeArchiveMap::GetFileContent(const FString& Filename, TArray64<ui
 	return true;
 }
 
+namespace glTFRuntime
+{
+	FString GetTarString(const uint8* StringDataPtr, const int32 StringLen)
+	{
+		TArray<uint8> StringData;
+		StringData.Reserve(StringLen + 1);
+		for (int32 StringByteIndex = 0; StringByteIndex < StringLen; StringByteIndex++)
+		{
+			if (StringDataPtr[StringByteIndex] == 0)
+			{
+				break;
+			}
+
+			StringData.Add(StringDataPtr[StringByteIndex]);
+		}
+
+		StringData.Add(0);
+
+		return FString(UTF8_TO_TCHAR(StringData.GetData()));
+	}
+
+	// sizes are octal, or big endian base-256 (GNU) for entries bigger than 8GB
+	int64 GetTarSize(const uint8* SizeDataPtr)
+	{
+		uint64 Size = 0;
+		if (SizeDataPtr[0] & 0x80)
+		{
+			for (int32 SizeByteIndex = 1; SizeByteIndex < 12; SizeByteIndex++)
+			{
+				if (Size >> 55)
+				{
+					return -1;
+				}
+				Size = (Size << 8) | SizeDataPtr[SizeByteIndex];
+			}
+		}
+		else
+		{
+			int32 SizeByteIndex = 0;
+			while (SizeByteIndex < 12 && SizeDataPtr[SizeByteIndex] == ' ')
+			{
+				SizeByteIndex++;
+			}
+			for (; SizeByteIndex < 12 && SizeDataPtr[SizeByteIndex] >= '0' && SizeDataPtr[SizeByteIndex] <= '7'; SizeByteIndex++)
+			{
+				Size = (Size << 3) | (SizeDataPtr[SizeByteIndex] - '0');
+			}
+		}
+		return Size > static_cast<uint64>(MAX_int64) ? -1 : static_cast<int64>(Size);
+	}
+}
+
+bool FglTFRuntimeArchiveTar::IsTarHeader(const uint8* HeaderPtr)
+{
+	return HeaderPtr[257] == 'u' && HeaderPtr[258] == 's' && HeaderPtr[259] == 't' && HeaderPtr[260] == 'a' && HeaderPtr[261] == 'r';
+}
+
+bool FglTFRuntimeArchiveTar::FromDataSource(TSharedRef<FglTFRuntimeDataSource> InDataSource)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeArchiveTar_FromDataSource, FColor::Magenta);
+
+	DataSource = InDataSource;
+
+	const int64 DataNum = DataSource->Num();
+
+	// meta entries payloads (pax records and long names) are small, anything bigger is considered broken
+	constexpr int64 MaxTarMetaSize = 1024 * 1024;
+
+	TArray64<uint8> HeaderScratch;
+	TArray64<uint8> MetaScratch;
+
+	int64 ByteIndex = 0;
+	bool bTarPrefixFound = false;
+	int64 TarPrefixLen = 0;
+	// set by pax extended headers ('x') and GNU long names ('L') for the following entry
+	FString NextTarFilename;
+	int64 NextFileSize = -1;
+	while (ByteIndex < DataNum)
+	{
+		const uint8* Block = DataSource->GetRange(ByteIndex, 512, HeaderScratch);
+		if (!Block)
+		{
+			return false;
+		}
+		ByteIndex += 512;
+
+		// end of archive ? (no entry is considered an error)
+		if (Block[0] == 0)
+		{
+			return OffsetsMap.Num() > 0;
+		}
+
+		if (!IsTarHeader(Block))
+		{
+			return false;
+		}
+
+		const uint8 TypeFlag = Block[156];
+		const int64 HeaderFileSize = glTFRuntime::GetTarSize(Block + 124);
+		if (HeaderFileSize < 0)
+		{
+			return false;
+		}
+
+		// the header size of meta entries is always the size of their own payload
+		const bool bMetaEntry = TypeFlag == 'x' || TypeFlag == 'g' || TypeFlag == 'L';
+		const int64 FileSize = (!bMetaEntry && NextFileSize >= 0) ? NextFileSize : HeaderFileSize;
+
+		const int64 BlockSize = Align(FileSize, 512);
+
+		if (BlockSize < FileSize || ByteIndex + BlockSize > DataNum)
+		{
+			return false;
+		}
+
+		if (TypeFlag == 'x' || TypeFlag == 'L')
+		{
+			if (FileSize > MaxTarMetaSize)
+			{
+				return false;
+			}
+
+			const uint8* MetaPtr = DataSource->GetRange(ByteIndex, FileSize, MetaScratch);
+			if (!MetaPtr)
+			{
+				return false;
+			}
+
+			if (TypeFlag == 'x')
+			{
+				// records are "<len> <key>=<value>\n"
+				int64 RecordIndex = 0;
+				while (RecordIndex < FileSize)
+				{
+					int64 RecordLen = 0;
+					int64 KeyIndex = RecordIndex;
+					// records can not be longer than the (already bounded) payload
+					while (KeyIndex < FileSize && MetaPtr[KeyIndex] >= '0' && MetaPtr[KeyIndex] <= '9' && RecordLen <= FileSize)
+					{
+						RecordLen = RecordLen * 10 + (MetaPtr[KeyIndex] - '0');
+						KeyIndex++;
+					}
+					if (RecordLen <= 0 || RecordIndex + RecordLen > FileSize || KeyIndex >= RecordIndex + RecordLen)
+					{
+						break;
+					}
+
+					const uint8* RecordPtr = MetaPtr + KeyIndex + 1;
+					const int64 RecordDataLen = RecordIndex + RecordLen - (KeyIndex + 1) - 1;
+					if (RecordDataLen > 5 && FMemory::Memcmp(RecordPtr, "size=", 5) == 0)
+					{
+						// more than 18 digits would overflow int64
+						constexpr int64 MaxSizeDigits = 18;
+						NextFileSize = 0;
+						for (int64 SizeIndex = 5; SizeIndex < RecordDataLen && RecordPtr[SizeIndex] >= '0' && RecordPtr[SizeIndex] <= '9'; SizeIndex++)
+						{
+							if (SizeIndex - 5 >= MaxSizeDigits)
+							{
+								return false;
+							}
+							NextFileSize = NextFileSize * 10 + (RecordPtr[SizeIndex] - '0');
+						}
+					}
+					else if (RecordDataLen > 5 && FMemory::Memcmp(RecordPtr, "path=", 5) == 0)
+					{
+						NextTarFilename = glTFRuntime::GetTarString(RecordPtr + 5, static_cast<int32>(RecordDataLen - 5));
+					}
+
+					RecordIndex += RecordLen;
+				}
+			}
+			else
+			{
+				NextTarFilename = glTFRuntime::GetTarString(MetaPtr, static_cast<int32>(FileSize));
+			}
+		}
+		else if (TypeFlag != 'g')
+		{
+			const FString TarFilename = NextTarFilename.IsEmpty() ? glTFRuntime::GetTarString(Block, 100) : NextTarFilename;
+			NextTarFilename.Empty();
+			NextFileSize = -1;
+
+			// first entry ?
+			if (!bTarPrefixFound)
+			{
+				bTarPrefixFound = true;
+				TarPrefixLen = TarFilename.Len();
+			}
+
+			if (TypeFlag == 0 || TypeFlag == '0' || TypeFlag == '7')
+			{
+				if (TarFilename.Len() <= TarPrefixLen)
+				{
+					return false;
+				}
+
+				// only the index is stored, content is read on demand
+				const FString EntryName = TarFilename.RightChop(TarPrefixLen);
+				OffsetsMap.Add(EntryName, ByteIndex);
+				GlobalSizeMap.Add(EntryName, TPair<uint64, uint64>(FileSize, FileSize));
+			}
+		}
+
+		ByteIndex += BlockSize;
+	}
+
+	return OffsetsMap.Num() > 0;
+}
+
+bool FglTFRuntimeArchiveTar::GetFileContent(const FString& Filename, TArray64<uint8>& OutData)
+{
+	const uint64* Offset = OffsetsMap.Find(Filename);
+	const TPair<uint64, uint64>* Sizes = GlobalSizeMap.Find(Filename);
+	if (!Offset || !Sizes || !DataSource)
+	{
+		return false;
+	}
+
+	const int64 FileSize = static_cast<int64>(Sizes->Value);
+	if (FileSize == 0)
+	{
+		OutData.Empty();
+		return true;
+	}
+
+	// file based sources fill the scratch (moved to the output), memory based ones are copied only here
+	TArray64<uint8> EntryScratch;
+	const uint8* EntryData = DataSource->GetRange(static_cast<int64>(*Offset), FileSize, EntryScratch);
+	if (!EntryData)
+	{
+		return false;
+	}
+
+	if (EntryData == EntryScratch.GetData() && EntryScratch.Num() == FileSize)
+	{
+		OutData = MoveTemp(EntryScratch);
+	}
+	else
+	{
+		OutData.Empty(FileSize);
+		OutData.Append(EntryData, FileSize);
+	}
+
+	return true;
+}
+
+int64 FglTFRuntimeArchiveTar::ReplaceDataSource(TSharedRef<FglTFRuntimeDataSource> InDataSource)
+{
+	// the entries offsets must stay valid
+	if (!DataSource || DataSource->Num() != InDataSource->Num())
+	{
+		return 0;
+	}
+
+	const int64 ReleasedBytes = DataSource->GetAllocatedSize();
+	DataSource = InDataSource;
+	return ReleasedBytes;
+}
+
 void FglTFRuntimeParser::FillAssetUserData(const int32 Index, IInterface_AssetUserData* InObject)
 {
 	for (TSubclassOf<UglTFRuntimeAssetUserData> AssetUserDataClass : AssetUserDataClasses)
@@ -0,0 +1,1254 @@
+// Copyright 2020-2023, Roberto De Ioris.
+
+#include "glTFRuntimeParser.h"
+#include <atomic>
+
+namespace glTFRuntime
+{
+	class FJsonSource
+	{
+	public:
+		virtual ~FJsonSource() {}
+
+		virtual TSharedPtr<FJsonObject> ParseObject(const int64 Start, const int64 End) const = 0;
+
+		FCriticalSection Lock;
+	};
+
+	/*
+	* FJsonValue exposing an object that is parsed from the source only when accessed.
+	* Once expanded the object is kept, so its identity is stable (required by LODsCache)
+	*/
+	class FJsonValueLazyObject : public FJsonValue
+	{
+	public:
+		FJsonValueLazyObject(TSharedRef<FJsonSource> InSource, const int64 InStart, const int64 InEnd) : Source(InSource), Start(InStart), End(InEnd), bExpanded(false)
+		{
+			Type = EJson::Object;
+		}
+
+		// no override specifiers here, the set of TryGetObject() overloads changes between engine versions
+		virtual bool TryGetObject(const TSharedPtr<FJsonObject>*& OutObject) const
+		{
+			OutObject = &Expand();
+			return true;
+		}
+
+		virtual bool TryGetObject(TSharedPtr<FJsonObject>*& OutObject)
+		{
+			OutObject = const_cast<TSharedPtr<FJsonObject>*>(&Expand());
+			return true;
+		}
+
+		virtual const TSharedPtr<FJsonObject>& AsObject() const
+		{
+			return Expand();
+		}
+
+	protected:
+		virtual FString GetType() const
+		{
+			return TEXT("Object");
+		}
+
+		const TSharedPtr<FJsonObject>& Expand() const
+		{
+			if (!bExpanded.load(std::memory_order_acquire))
+			{
+				FScopeLock ScopeLock(&Source->Lock);
+				if (!bExpanded.load(std::memory_order_relaxed))
+				{
+					Object = Source->ParseObject(Start, End);
+					if (!Object)
+					{
+						UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to parse json object at offset %lld"), Start);
+						Object = MakeShared<FJsonObject>();
+					}
+					bExpanded.store(true, std::memory_order_release);
+				}
+			}
+			return Object;
+		}
+
+		TSharedRef<FJsonSource> Source;
+		int64 Start;
+		int64 End;
+		mutable TSharedPtr<FJsonObject> Object;
+		mutable std::atomic<bool> bExpanded;
+	};
+
+	template<typename CharType>
+	struct TJsonChars
+	{
+	};
+
+	template<>
+	struct TJsonChars<TCHAR>
+	{
+		static void Append(FString& String, const TCHAR* Chars, const int64 Len)
+		{
+			String.AppendChars(Chars, static_cast<int32>(Len));
+		}
+
+		static double ToDouble(const TCHAR* Chars, const int32 Len)
+		{
+			TArray<TCHAR, TInlineAllocator<64>> Buffer;
+			Buffer.Append(Chars, Len);
+			Buffer.Add(0);
+			return FCString::Atod(Buffer.GetData());
+		}
+	};
+
+	// UTF-8 text is scanned as bytes, only the strings are converted
+	template<>
+	struct TJsonChars<ANSICHAR>
+	{
+		static void Append(FString& String, const ANSICHAR* Chars, const int64 Len)
+		{
+			FUTF8ToTCHAR Converted(Chars, static_cast<int32>(Len));
+			String.AppendChars(Converted.Get(), Converted.Length());
+		}
+
+		static double ToDouble(const ANSICHAR* Chars, const int32 Len)
+		{
+			TArray<ANSICHAR, TInlineAllocator<64>> Buffer;
+			Buffer.Append(Chars, Len);
+			Buffer.Add(0);
+			return FCStringAnsi::Atod(Buffer.GetData());
+		}
+	};
+
+	template<typename CharType>
+	class TJsonScanner
+	{
+	public:
+		TJsonScanner(const CharType* InData, const int64 InNum) : Data(InData), Num(InNum), Position(0), Depth(0)
+		{
+		}
+
+		bool SkipWhitespace()
+		{
+			while (Position < Num)
+			{
+				const CharType Char = Data[Position];
+				if (Char != ' ' && Char != '\t' && Char != '\n' && Char != '\r')
+				{
+					return true;
+				}
+				Position++;
+			}
+			return false;
+		}
+
+		bool Consume(const CharType Expected)
+		{
+			if (!SkipWhitespace() || Data[Position] != Expected)
+			{
+				return false;
+			}
+			Position++;
+			return true;
+		}
+
+		// allows only whitespaces and nulls (padding) after the root value
+		bool IsAtEnd()
+		{
+			while (SkipWhitespace())
+			{
+				if (Data[Position] != 0)
+				{
+					return false;
+				}
+				Position++;
+			}
+			return true;
+		}
+
+		bool ScanString(int64& OutStart, int64& OutEnd, bool& bOutEscaped)
+		{
+			if (Position >= Num || Data[Position] != '"')
+			{
+				return false;
+			}
+			Position++;
+			OutStart = Position;
+			bOutEscaped = false;
+			while (Position < Num)
+			{
+				const CharType Char = Data[Position];
+				if (Char == '"')
+				{
+					OutEnd = Position++;
+					return true;
+				}
+				if (Char == '\\')
+				{
+					bOutEscaped = true;
+					Position++;
+				}
+				Position++;
+			}
+			return false;
+		}
+
+		bool KeyEquals(const int64 KeyStart, const int64 KeyEnd, const ANSICHAR* Literal) const
+		{
+			int64 Index = KeyStart;
+			while (*Literal)
+			{
+				if (Index >= KeyEnd || Data[Index] != static_cast<CharType>(*Literal))
+				{
+					return false;
+				}
+				Index++;
+				Literal++;
+			}
+			return Index == KeyEnd;
+		}
+
+		bool ParseString(FString& OutString)
+		{
+			int64 Start;
+			int64 End;
+			bool bEscaped;
+			if (!ScanString(Start, End, bEscaped))
+			{
+				return false;
+			}
+
+			if (!bEscaped)
+			{
+				TJsonChars<CharType>::Append(OutString, Data + Start, End - Start);
+				return true;
+			}
+
+			int64 RunStart = Start;
+			int64 Index = Start;
+			while (Index < End)
+			{
+				if (Data[Index] != '\\')
+				{
+					Index++;
+					continue;
+				}
+
+				TJsonChars<CharType>::Append(OutString, Data + RunStart, Index - RunStart);
+				Index++;
+				if (Index >= End)
+				{
+					return false;
+				}
+
+				switch (Data[Index])
+				{
+				case '"':
+					OutString.AppendChar('"');
+					break;
+				case '\\':
+					OutString.AppendChar('\\');
+					break;
+				case '/':
+					OutString.AppendChar('/');
+					break;
+				case 'b':
+					OutString.AppendChar('\b');
+					break;
+				case 'f':
+					OutString.AppendChar('\f');
+					break;
+				case 'n':
+					OutString.AppendChar('\n');
+					break;
+				case 'r':
+					OutString.AppendChar('\r');
+					break;
+				case 't':
+					OutString.AppendChar('\t');
+					break;
+				case 'u':
+				{
+					if (Index + 4 >= End)
+					{
+						return false;
+					}
+					uint32 CodeUnit = 0;
+					for (int32 HexIndex = 1; HexIndex <= 4; HexIndex++)
+					{
+						const CharType Hex = Data[Index + HexIndex];
+						CodeUnit <<= 4;
+						if (Hex >= '0' && Hex <= '9')
+						{
+							CodeUnit |= Hex - '0';
+						}
+						else if (Hex >= 'a' && Hex <= 'f')
+						{
+							CodeUnit |= Hex - 'a' + 10;
+						}
+						else if (Hex >= 'A' && Hex <= 'F')
+						{
+							CodeUnit |= Hex - 'A' + 10;
+						}
+						else
+						{
+							return false;
+						}
+					}
+					// surrogate pairs are appended as two code units like TJsonReader does
+					OutString.AppendChar(static_cast<TCHAR>(CodeUnit));
+					Index += 4;
+					break;
+				}
+				default:
+					return false;
+				}
+				Index++;
+				RunStart = Index;
+			}
+
+			TJsonChars<CharType>::Append(OutString, Data + RunStart, End - RunStart);
+			return true;
+		}
+
+		static bool IsTokenChar(const CharType Char)
+		{
+			return (Char >= '0' && Char <= '9') || (Char >= 'a' && Char <= 'z') || (Char >= 'A' && Char <= 'Z') || Char == '-' || Char == '+' || Char == '.';
+		}
+
+		bool ParseNumber(double& OutNumber)
+		{
+			const int64 Start = Position;
+			while (Position < Num && IsTokenChar(Data[Position]))
+			{
+				Position++;
+			}
+
+			const int64 Len = Position - Start;
+			if (Len < 1 || Len > MAX_int32)
+			{
+				return false;
+			}
+
+			// fast path for integers (the vast majority of glTF numbers)
+			int64 Index = Start;
+			const bool bNegative = Data[Index] == '-';
+			if (bNegative)
+			{
+				Index++;
+			}
+
+			if (Index < Position && Position - Index <= 18)
+			{
+				int64 Value = 0;
+				bool bInteger = true;
+				for (int64 DigitIndex = Index; DigitIndex < Position; DigitIndex++)
+				{
+					const CharType Char = Data[DigitIndex];
+					if (Char < '0' || Char > '9')
+					{
+						bInteger = false;
+						break;
+					}
+					Value = Value * 10 + (Char - '0');
+				}
+
+				if (bInteger)
+				{
+					OutNumber = static_cast<double>(bNegative ? -Value : Value);
+					return true;
+				}
+			}
+
+			if (Index >= Position || Data[Index] < '0' || Data[Index] > '9')
+			{
+				return false;
+			}
+
+			OutNumber = TJsonChars<CharType>::ToDouble(Data + Start, static_cast<int32>(Len));
+			return true;
+		}
+
+		bool ParseLiteral(const ANSICHAR* Literal)
+		{
+			while (*Literal)
+			{
+				if (Position >= Num || Data[Position] != static_cast<CharType>(*Literal))
+				{
+					return false;
+				}
+				Position++;
+				Literal++;
+			}
+			return Position >= Num || !IsTokenChar(Data[Position]);
+		}
+
+		bool ParseValue(TSharedPtr<FJsonValue>& OutValue)
+		{
+			if (!SkipWhitespace())
+			{
+				return false;
+			}
+
+			const CharType Char = Data[Position];
+			if (Char == '{')
+			{
+				TSharedPtr<FJsonObject> Object;
+				if (!ParseObject(Object))
+				{
+					return false;
+				}
+				OutValue = MakeShared<FJsonValueObject>(Object);
+				return true;
+			}
+
+			if (Char == '[')
+			{
+				TArray<TSharedPtr<FJsonValue>> Array;
+				if (!ParseArray(Array))
+				{
+					return false;
+				}
+				OutValue = MakeShared<FJsonValueArray>(Array);
+				return true;
+			}
+
+			if (Char == '"')
+			{
+				FString String;
+				if (!ParseString(String))
+				{
+					return false;
+				}
+				OutValue = MakeShared<FJsonValueString>(String);
+				return true;
+			}
+
+			if (Char == 't' || Char == 'f')
+			{
+				const bool bValue = Char == 't';
+				if (!ParseLiteral(bValue ? "true" : "false"))
+				{
+					return false;
+				}
+				OutValue = MakeShared<FJsonValueBoolean>(bValue);
+				return true;
+			}
+
+			if (Char == 'n')
+			{
+				if (!ParseLiteral("null"))
+				{
+					return false;
+				}
+				OutValue = MakeShared<FJsonValueNull>();
+				return true;
+			}
+
+			double Number;
+			if (!ParseNumber(Number))
+			{
+				return false;
+			}
+			OutValue = MakeShared<FJsonValueNumber>(Number);
+			return true;
+		}
+
+		bool ParseObject(TSharedPtr<FJsonObject>& OutObject)
+		{
+			if (!SkipWhitespace() || Data[Position] != '{')
+			{
+				return false;
+			}
+
+			OutObject = MakeShared<FJsonObject>();
+			return ScanObject([this, &OutObject](const int64 KeyStart, const int64 KeyEnd, const bool bKeyEscaped)
+				{
+					FString Key;
+					if (bKeyEscaped)
+					{
+						Position = KeyStart - 1;
+						if (!ParseString(Key) || !Consume(':'))
+						{
+							return false;
+						}
+					}
+					else
+					{
+						TJsonChars<CharType>::Append(Key, Data + KeyStart, KeyEnd - KeyStart);
+					}
+
+					TSharedPtr<FJsonValue> Value;
+					if (!ParseValue(Value))
+					{
+						return false;
+					}
+					OutObject->SetField(Key, Value);
+					return true;
+				});
+		}
+
+		bool ParseArray(TArray<TSharedPtr<FJsonValue>>& OutArray)
+		{
+			return ScanArray([this, &OutArray]()
+				{
+					TSharedPtr<FJsonValue> Value;
+					if (!ParseValue(Value))
+					{
+						return false;
+					}
+					OutArray.Add(Value);
+					return true;
+				});
+		}
+
+		bool SkipValue()
+		{
+			if (!SkipWhitespace())
+			{
+				return false;
+			}
+
+			const CharType Char = Data[Position];
+			if (Char == '{')
+			{
+				return ScanObject([this](const int64 KeyStart, const int64 KeyEnd, const bool bKeyEscaped) { return SkipValue(); });
+			}
+
+			if (Char == '[')
+			{
+				return ScanArray([this]() { return SkipValue(); });
+			}
+
+			if (Char == '"')
+			{
+				int64 Start;
+				int64 End;
+				bool bEscaped;
+				return ScanString(Start, End, bEscaped);
+			}
+
+			const int64 Start = Position;
+			while (Position < Num && IsTokenChar(Data[Position]))
+			{
+				Position++;
+			}
+			return Position > Start;
+		}
+
+		bool ReadNumber(int64& OutNumber, bool& bValid)
+		{
+			if (!SkipWhitespace())
+			{
+				return false;
+			}
+
+			const CharType Char = Data[Position];
+			if (Char != '-' && (Char < '0' || Char > '9'))
+			{
+				bValid = false;
+				return SkipValue();
+			}
+
+			double Number;
+			if (!ParseNumber(Number))
+			{
+				return false;
+			}
+			OutNumber = static_cast<int64>(FMath::RoundHalfFromZero(Number));
+			return true;
+		}
+
+		bool ReadBool(bool& bOutValue, bool& bValid)
+		{
+			if (!SkipWhitespace())
+			{
+				return false;
+			}
+
+			if (Data[Position] == 't')
+			{
+				bOutValue = true;
+				return ParseLiteral("true");
+			}
+
+			if (Data[Position] == 'f')
+			{
+				bOutValue = false;
+				return ParseLiteral("false");
+			}
+
+			bValid = false;
+			return SkipValue();
+		}
+
+		bool ReadArrayNum(int32& OutNum, bool& bValid)
+		{
+			if (!SkipWhitespace())
+			{
+				return false;
+			}
+
+			if (Data[Position] != '[')
+			{
+				bValid = false;
+				return SkipValue();
+			}
+
+			OutNum = 0;
+			return ScanArray([this, &OutNum]()
+				{
+					OutNum++;
+					return SkipValue();
+				});
+		}
+
+		bool ReadTypeElements(int64& OutElements, bool& bValid)
+		{
+			if (!SkipWhitespace())
+			{
+				return false;
+			}
+
+			int64 Start;
+			int64 End;
+			bool bEscaped;
+			if (Data[Position] != '"')
+			{
+				bValid = false;
+				return SkipValue();
+			}
+
+			if (!ScanString(Start, End, bEscaped))
+			{
+				return false;
+			}
+
+			if (bEscaped)
+			{
+				bValid = false;
+			}
+			else if (KeyEquals(Start, End, "SCALAR"))
+			{
+				OutElements = 1;
+			}
+			else if (KeyEquals(Start, End, "VEC2"))
+			{
+				OutElements = 2;
+			}
+			else if (KeyEquals(Start, End, "VEC3"))
+			{
+				OutElements = 3;
+			}
+			else if (KeyEquals(Start, End, "VEC4") || KeyEquals(Start, End, "MAT2"))
+			{
+				OutElements = 4;
+			}
+			else if (KeyEquals(Start, End, "MAT3"))
+			{
+				OutElements = 9;
+			}
+			else if (KeyEquals(Start, End, "MAT4"))
+			{
+				OutElements = 16;
+			}
+			else
+			{
+				OutElements = 0;
+			}
+			return true;
+		}
+
+		// Position must be at '{', the handler is called after the colon of each key and must consume the value
+		template<typename HandlerType>
+		bool ScanObject(HandlerType Handler)
+		{
+			if (++Depth > MaxDepth)
+			{
+				return false;
+			}
+
+			Position++;
+			if (!SkipWhitespace())
+			{
+				return false;
+			}
+
+			if (Data[Position] == '}')
+			{
+				Position++;
+				Depth--;
+				return true;
+			}
+
+			for (;;)
+			{
+				int64 KeyStart;
+				int64 KeyEnd;
+				bool bKeyEscaped;
+				if (!SkipWhitespace() || !ScanString(KeyStart, KeyEnd, bKeyEscaped) || !Consume(':'))
+				{
+					return false;
+				}
+
+				if (!Handler(KeyStart, KeyEnd, bKeyEscaped) || !SkipWhitespace())
+				{
+					return false;
+				}
+
+				if (Data[Position] == ',')
+				{
+					Position++;
+					continue;
+				}
+
+				if (Data[Position] == '}')
+				{
+					Position++;
+					Depth--;
+					return true;
+				}
+
+				return false;
+			}
+		}
+
+		// Position must be at '[', the handler must consume each item
+		template<typename HandlerType>
+		bool ScanArray(HandlerType Handler)
+		{
+			if (++Depth > MaxDepth)
+			{
+				return false;
+			}
+
+			Position++;
+			if (!SkipWhitespace())
+			{
+				return false;
+			}
+
+			if (Data[Position] == ']')
+			{
+				Position++;
+				Depth--;
+				return true;
+			}
+
+			for (;;)
+			{
+				if (!Handler() || !SkipWhitespace())
+				{
+					return false;
+				}
+
+				if (Data[Position] == ',')
+				{
+					Position++;
+					continue;
+				}
+
+				if (Data[Position] == ']')
+				{
+					Position++;
+					Depth--;
+					return true;
+				}
+
+				return false;
+			}
+		}
+
+		template<typename EntryType, typename HandlerType>
+		bool StreamArray(TSharedRef<FJsonSource> Source, TArray<TSharedPtr<FJsonValue>>& OutItems, TArray<EntryType>& OutEntries, HandlerType Handler)
+		{
+			return ScanArray([this, Source, &OutItems, &OutEntries, &Handler]()
+				{
+					if (!SkipWhitespace())
+					{
+						return false;
+					}
+
+					EntryType& Entry = OutEntries.AddDefaulted_GetRef();
+
+					if (Data[Position] != '{')
+					{
+						Entry.bValid = false;
+						TSharedPtr<FJsonValue> Value;
+						if (!ParseValue(Value))
+						{
+							return false;
+						}
+						OutItems.Add(Value);
+						return true;
+					}
+
+					const int64 Start = Position;
+					if (!ScanObject([this, &Entry, &Handler](const int64 KeyStart, const int64 KeyEnd, const bool bKeyEscaped)
+						{
+							if (bKeyEscaped)
+							{
+								Entry.bValid = false;
+								return SkipValue();
+							}
+							return Handler(Entry, KeyStart, KeyEnd);
+						}))
+					{
+						return false;
+					}
+
+					OutItems.Add(MakeShared<FJsonValueLazyObject>(Source, Start, Position));
+					return true;
+				});
+		}
+
+		bool StreamRoot(TSharedRef<FJsonSource> Source, TSharedPtr<FJsonObject>& OutRoot, FglTFRuntimeJsonTables& JsonTables)
+		{
+			if (!SkipWhitespace() || Data[Position] != '{')
+			{
+				return false;
+			}
+
+			OutRoot = MakeShared<FJsonObject>();
+
+			auto StreamField = [this, Source, &OutRoot](const FString& Key, auto& Entries, auto Handler)
+				{
+					if (!SkipWhitespace())
+					{
+						return false;
+					}
+
+					if (Data[Position] != '[')
+					{
+						TSharedPtr<FJsonValue> Value;
+						if (!ParseValue(Value))
+						{
+							return false;
+						}
+						OutRoot->SetField(Key, Value);
+						return true;
+					}
+
+					Entries.Empty();
+					TArray<TSharedPtr<FJsonValue>> Items;
+					if (!StreamArray(Source, Items, Entries, Handler))
+					{
+						return false;
+					}
+					OutRoot->SetField(Key, MakeShared<FJsonValueArray>(Items));
+					return true;
+				};
+
+			if (!ScanObject([&](const int64 KeyStart, const int64 KeyEnd, const bool bKeyEscaped)
+				{
+					FString Key;
+					if (bKeyEscaped)
+					{
+						Position = KeyStart - 1;
+						if (!ParseString(Key) || !Consume(':'))
+						{
+							return false;
+						}
+					}
+					else
+					{
+						TJsonChars<CharType>::Append(Key, Data + KeyStart, KeyEnd - KeyStart);
+					}
+
+					if (Key == TEXT("accessors"))
+					{
+						return StreamField(Key, JsonTables.Accessors, [this](FglTFRuntimeAccessorEntry& Entry, const int64 FieldStart, const int64 FieldEnd)
+							{
+								if (KeyEquals(FieldStart, FieldEnd, "bufferView"))
+								{
+									return ReadNumber(Entry.BufferView, Entry.bValid);
+								}
+								if (KeyEquals(FieldStart, FieldEnd, "byteOffset"))
+								{
+									return ReadNumber(Entry.ByteOffset, Entry.bValid);
+								}
+								if (KeyEquals(FieldStart, FieldEnd, "componentType"))
+								{
+									return ReadNumber(Entry.ComponentType, Entry.bValid);
+								}
+								if (KeyEquals(FieldStart, FieldEnd, "count"))
+								{
+									return ReadNumber(Entry.Count, Entry.bValid);
+								}
+								if (KeyEquals(FieldStart, FieldEnd, "type"))
+								{
+									return ReadTypeElements(Entry.Elements, Entry.bValid);
+								}
+								if (KeyEquals(FieldStart, FieldEnd, "normalized"))
+								{
+									Entry.bHasNormalized = true;
+									return ReadBool(Entry.bNormalized, Entry.bValid);
+								}
+								if (KeyEquals(FieldStart, FieldEnd, "sparse"))
+								{
+									Entry.bHasSparse = SkipWhitespace() && Data[Position] == '{';
+								}
+								return SkipValue();
+							});
+					}
+
+					if (Key == TEXT("bufferViews"))
+					{
+						return StreamField(Key, JsonTables.BufferViews, [this](FglTFRuntimeBufferViewEntry& Entry, const int64 FieldStart, const int64 FieldEnd)
+							{
+								if (KeyEquals(FieldStart, FieldEnd, "buffer"))
+								{
+									return ReadNumber(Entry.Buffer, Entry.bValid);
+								}
+								if (KeyEquals(FieldStart, FieldEnd, "byteOffset"))
+								{
+									return ReadNumber(Entry.ByteOffset, Entry.bValid);
+								}
+								if (KeyEquals(FieldStart, FieldEnd, "byteLength"))
+								{
+									return ReadNumber(Entry.ByteLength, Entry.bValid);
+								}
+								if (KeyEquals(FieldStart, FieldEnd, "byteStride"))
+								{
+									return ReadNumber(Entry.ByteStride, Entry.bValid);
+								}
+								if (KeyEquals(FieldStart, FieldEnd, "extensions"))
+								{
+									Entry.bHasExtensions = true;
+								}
+								return SkipValue();
+							});
+					}
+
+					if (Key == TEXT("nodes"))
+					{
+						return StreamField(Key, JsonTables.Nodes, [this](FglTFRuntimeNodeEntry& Entry, const int64 FieldStart, const int64 FieldEnd)
+							{
+								if (KeyEquals(FieldStart, FieldEnd, "mesh"))
+								{
+									return ReadNumber(Entry.Mesh, Entry.bValid);
+								}
+								if (KeyEquals(FieldStart, FieldEnd, "skin"))
+								{
+									return ReadNumber(Entry.Skin, Entry.bValid);
+								}
+								if (KeyEquals(FieldStart, FieldEnd, "camera"))
+								{
+									return ReadNumber(Entry.Camera, Entry.bValid);
+								}
+								if (KeyEquals(FieldStart, FieldEnd, "children"))
+								{
+									return ReadArrayNum(Entry.NumChildren, Entry.bValid);
+								}
+								return SkipValue();
+							});
+					}
+
+					if (Key == TEXT("meshes"))
+					{
+						return StreamField(Key, JsonTables.Meshes, [this](FglTFRuntimeMeshEntry& Entry, const int64 FieldStart, const int64 FieldEnd)
+							{
+								if (KeyEquals(FieldStart, FieldEnd, "primitives"))
+								{
+									return ReadArrayNum(Entry.NumPrimitives, Entry.bValid);
+								}
+								return SkipValue();
+							});
+					}
+
+					if (Key == TEXT("materials"))
+					{
+						return StreamField(Key, JsonTables.Materials, [this](FglTFRuntimeMaterialEntry& Entry, const int64 FieldStart, const int64 FieldEnd)
+							{
+								if (KeyEquals(FieldStart, FieldEnd, "extensions"))
+								{
+									Entry.bHasExtensions = true;
+								}
+								return SkipValue();
+							});
+					}
+
+					TSharedPtr<FJsonValue> Value;
+					if (!ParseValue(Value))
+					{
+						return false;
+					}
+					OutRoot->SetField(Key, Value);
+					return true;
+				}))
+			{
+				return false;
+			}
+
+			return IsAtEnd();
+		}
+
+	protected:
+		// objects and arrays are parsed recursively, loaders run on threads with small stacks
+		static constexpr int32 MaxDepth = 64;
+
+		const CharType* Data;
+		int64 Num;
+		int64 Position;
+		int32 Depth;
+	};
+
+	template<typename CharType>
+	class TJsonSource : public FJsonSource
+	{
+	public:
+		TSharedPtr<FJsonObject> ParseObject(const int64 Start, const int64 End) const override
+		{
+			TJsonScanner<CharType> Scanner(Data + Start, End - Start);
+			TSharedPtr<FJsonObject> Object;
+			if (!Scanner.ParseObject(Object))
+			{
+				return nullptr;
+			}
+			return Object;
+		}
+
+		const CharType* GetData() const
+		{
+			return Data;
+		}
+
+		int64 Num() const
+		{
+			return DataNum;
+		}
+
+	protected:
+		const CharType* Data = nullptr;
+		int64 DataNum = 0;
+	};
+
+	class FJsonStringSource : public TJsonSource<TCHAR>
+	{
+	public:
+		FJsonStringSource(const FString& InString) : String(InString)
+		{
+			Data = *String;
+			DataNum = String.Len();
+		}
+
+	protected:
+		FString String;
+	};
+
+	class FJsonUTF8Source : public TJsonSource<ANSICHAR>
+	{
+	public:
+		FJsonUTF8Source(const uint8* InData, const int64 InDataNum, TSharedPtr<FglTFRuntimeMappedFile> InMappedFile)
+		{
+			// lazy objects are expanded later, so the bytes must outlive the parsing (the mapping already guarantees it)
+			if (InMappedFile && InMappedFile->Contains(InData, InDataNum))
+			{
+				MappedFile = InMappedFile;
+				Data = reinterpret_cast<const ANSICHAR*>(InData);
+			}
+			else
+			{
+				Bytes.Append(InData, InDataNum);
+				Data = reinterpret_cast<const ANSICHAR*>(Bytes.GetData());
+			}
+			DataNum = InDataNum;
+		}
+
+	protected:
+		TArray64<uint8> Bytes;
+		TSharedPtr<FglTFRuntimeMappedFile> MappedFile;
+	};
+
+	template<typename CharType>
+	TSharedPtr<FJsonObject> ParseJsonStreaming(TSharedRef<TJsonSource<CharType>> Source, FglTFRuntimeJsonTables& JsonTables)
+	{
+		SCOPED_NAMED_EVENT(FglTFRuntimeParser_ParseJsonStreaming, FColor::Magenta);
+
+		TJsonScanner<CharType> Scanner(Source->GetData(), Source->Num());
+		TSharedPtr<FJsonObject> Root;
+		if (!Scanner.StreamRoot(Source, Root, JsonTables))
+		{
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to parse json"));
+			return nullptr;
+		}
+		return Root;
+	}
+}
+
+TSharedPtr<FJsonObject> FglTFRuntimeParser::ParseJsonStreaming(const FString& JsonData, FglTFRuntimeJsonTables& JsonTables)
+{
+	return glTFRuntime::ParseJsonStreaming<TCHAR>(MakeShared<glTFRuntime::FJsonStringSource>(JsonData), JsonTables);
+}
+
+TSharedPtr<FJsonObject> FglTFRuntimeParser::ParseJsonUTF8(const uint8* DataPtr, int64 DataNum, const bool bStreaming, FglTFRuntimeJsonTables& JsonTables, TSharedPtr<FglTFRuntimeMappedFile> InMappedFile)
+{
+	// skip the BOM
+	if (DataNum >= 3 && DataPtr[0] == 0xEF && DataPtr[1] == 0xBB && DataPtr[2] == 0xBF)
+	{
+		DataPtr += 3;
+		DataNum -= 3;
+	}
+
+	if (bStreaming)
+	{
+		return glTFRuntime::ParseJsonStreaming<ANSICHAR>(MakeShared<glTFRuntime::FJsonUTF8Source>(DataPtr, DataNum, InMappedFile), JsonTables);
+	}
+
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_ParseJsonUTF8, FColor::Magenta);
+
+	// the whole DOM is built here, so the bytes are not referenced after parsing
+	glTFRuntime::TJsonScanner<ANSICHAR> Scanner(reinterpret_cast<const ANSICHAR*>(DataPtr), DataNum);
+	TSharedPtr<FJsonObject> Root;
+	if (!Scanner.ParseObject(Root) || !Scanner.IsAtEnd())
+	{
+		UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to parse json"));
+		return nullptr;
+	}
+	return Root;
+}
+
+bool FglTFRuntimeParser::GetAccessorEntry(const int32 AccessorIndex, FglTFRuntimeAccessorEntry& AccessorEntry) const
+{
+	if (JsonTables.Accessors.IsValidIndex(AccessorIndex) && JsonTables.Accessors[AccessorIndex].bValid)
+	{
+		AccessorEntry = JsonTables.Accessors[AccessorIndex];
+		return true;
+	}
+
+	TSharedPtr<FJsonObject> JsonAccessorObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Accessors, AccessorIndex);
+	if (!JsonAccessorObject)
+	{
+		return false;
+	}
+
+	AccessorEntry = FglTFRuntimeAccessorEntry();
+
+	JsonAccessorObject->TryGetNumberField(TEXT("bufferView"), AccessorEntry.BufferView);
+	JsonAccessorObject->TryGetNumberField(TEXT("byteOffset"), AccessorEntry.ByteOffset);
+	JsonAccessorObject->TryGetNumberField(TEXT("componentType"), AccessorEntry.ComponentType);
+	JsonAccessorObject->TryGetNumberField(TEXT("count"), AccessorEntry.Count);
+	AccessorEntry.bHasNormalized = JsonAccessorObject->TryGetBoolField(TEXT("normalized"), AccessorEntry.bNormalized);
+	AccessorEntry.bHasSparse = JsonAccessorObject->HasTypedField<EJson::Object>(TEXT("sparse"));
+
+	FString Type;
+	if (JsonAccessorObject->TryGetStringField(TEXT("type"), Type))
+	{
+		AccessorEntry.Elements = GetTypeSize(Type);
+	}
+
+	return true;
+}
+
+bool FglTFRuntimeParser::GetBufferViewEntry(const int32 BufferViewIndex, FglTFRuntimeBufferViewEntry& BufferViewEntry) const
+{
+	if (JsonTables.BufferViews.IsValidIndex(BufferViewIndex) && JsonTables.BufferViews[BufferViewIndex].bValid)
+	{
+		BufferViewEntry = JsonTables.BufferViews[BufferViewIndex];
+		return true;
+	}
+
+	TSharedPtr<FJsonObject> JsonBufferViewObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::BufferViews, BufferViewIndex);
+	if (!JsonBufferViewObject)
+	{
+		return false;
+	}
+
+	BufferViewEntry = FglTFRuntimeBufferViewEntry();
+
+	JsonBufferViewObject->TryGetNumberField(TEXT("buffer"), BufferViewEntry.Buffer);
+	JsonBufferViewObject->TryGetNumberField(TEXT("byteOffset"), BufferViewEntry.ByteOffset);
+	JsonBufferViewObject->TryGetNumberField(TEXT("byteLength"), BufferViewEntry.ByteLength);
+	JsonBufferViewObject->TryGetNumberField(TEXT("byteStride"), BufferViewEntry.ByteStride);
+	BufferViewEntry.bHasExtensions = JsonBufferViewObject->HasField(TEXT("extensions"));
+
+	return true;
+}
+
+void FglTFRuntimeParser::FillJsonTables()
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_FillJsonTables, FColor::Magenta);
+
+	// the streaming parser already filled the tables of the sections it found,
+	// the others are decoded once here instead of for every lookup
+	if (JsonTables.Accessors.Num() == 0)
+	{
+		TArray<FglTFRuntimeAccessorEntry> Accessors;
+		Accessors.SetNum(GetJsonSectionNum(EglTFRuntimeJsonSection::Accessors));
+		for (int32 AccessorIndex = 0; AccessorIndex < Accessors.Num(); AccessorIndex++)
+		{
+			Accessors[AccessorIndex].bValid = GetAccessorEntry(AccessorIndex, Accessors[AccessorIndex]);
+		}
+		JsonTables.Accessors = MoveTemp(Accessors);
+	}
+
+	if (JsonTables.BufferViews.Num() == 0)
+	{
+		TArray<FglTFRuntimeBufferViewEntry> BufferViews;
+		BufferViews.SetNum(GetJsonSectionNum(EglTFRuntimeJsonSection::BufferViews));
+		for (int32 BufferViewIndex = 0; BufferViewIndex < BufferViews.Num(); BufferViewIndex++)
+		{
+			BufferViews[BufferViewIndex].bValid = GetBufferViewEntry(BufferViewIndex, BufferViews[BufferViewIndex]);
+		}
+		JsonTables.BufferViews = MoveTemp(BufferViews);
+	}
+
+	if (JsonTables.Nodes.Num() == 0)
+	{
+		JsonTables.Nodes.SetNum(GetJsonSectionNum(EglTFRuntimeJsonSection::Nodes));
+		for (int32 NodeIndex = 0; NodeIndex < JsonTables.Nodes.Num(); NodeIndex++)
+		{
+			FglTFRuntimeNodeEntry& Entry = JsonTables.Nodes[NodeIndex];
+			TSharedPtr<FJsonObject> JsonNodeObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Nodes, NodeIndex);
+			if (!JsonNodeObject)
+			{
+				Entry.bValid = false;
+				continue;
+			}
+
+			JsonNodeObject->TryGetNumberField(TEXT("mesh"), Entry.Mesh);
+			JsonNodeObject->TryGetNumberField(TEXT("skin"), Entry.Skin);
+			JsonNodeObject->TryGetNumberField(TEXT("camera"), Entry.Camera);
+			const TArray<TSharedPtr<FJsonValue>>* JsonChildren;
+			if (JsonNodeObject->TryGetArrayField(TEXT("children"), JsonChildren))
+			{
+				Entry.NumChildren = JsonChildren->Num();
+			}
+		}
+	}
+
+	if (JsonTables.Meshes.Num() == 0)
+	{
+		JsonTables.Meshes.SetNum(GetJsonSectionNum(EglTFRuntimeJsonSection::Meshes));
+		for (int32 MeshIndex = 0; MeshIndex < JsonTables.Meshes.Num(); MeshIndex++)
+		{
+			FglTFRuntimeMeshEntry& Entry = JsonTables.Meshes[MeshIndex];
+			TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Meshes, MeshIndex);
+			if (!JsonMeshObject)
+			{
+				Entry.bValid = false;
+				continue;
+			}
+
+			const TArray<TSharedPtr<FJsonValue>>* JsonPrimitives;
+			if (JsonMeshObject->TryGetArrayField(TEXT("primitives"), JsonPrimitives))
+			{
+				Entry.NumPrimitives = JsonPrimitives->Num();
+			}
+		}
+	}
+
+	if (JsonTables.Materials.Num() == 0)
+	{
+		JsonTables.Materials.SetNum(GetJsonSectionNum(EglTFRuntimeJsonSection::Materials));
+		for (int32 MaterialIndex = 0; MaterialIndex < JsonTables.Materials.Num(); MaterialIndex++)
+		{
+			FglTFRuntimeMaterialEntry& Entry = JsonTables.Materials[MaterialIndex];
+			TSharedPtr<FJsonObject> JsonMaterialObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Materials, MaterialIndex);
+			if (!JsonMaterialObject)
+			{
+				Entry.bValid = false;
+				continue;
+			}
+			Entry.bHasExtensions = JsonMaterialObject->HasField(TEXT("extensions"));
+		}
+	}
+}
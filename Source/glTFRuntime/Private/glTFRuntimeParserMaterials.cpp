@@ -1064,7 +1064,7 @@ bool FglTFRuntimeParser::LoadImageFromBlob(const TArray64<uint8>& Blob, TSharedR
 bool FglTFRuntimeParser::LoadImageBytes(const int32 ImageIndex, TSharedPtr<FJsonObject>& JsonImageObject, TArray64<uint8>& Bytes)
 {
 
-	JsonImageObject = GetJsonObjectFromRootIndex("images", ImageIndex);
+	JsonImageObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Images, ImageIndex);
 	if (!JsonImageObject)
 	{
 		AddError("LoadImageBytes()", FString::Printf(TEXT("Unable to load image %d"), ImageIndex));
@@ -1113,19 +1113,7 @@ UTexture2D* FglTFRuntimeParser::LoadTexture(const int32 TextureIndex, TArray<Fgl
 		return TexturesCache[TextureIndex];
 	}
 
-	const TArray<TSharedPtr<FJsonValue>>* JsonTextures;
-	// no images ?
-	if (!Root->TryGetArrayField(TEXT("textures"), JsonTextures))
-	{
-		return nullptr;
-	}
-
-	if (TextureIndex >= JsonTextures->Num())
-	{
-		return nullptr;
-	}
-
-	TSharedPtr<FJsonObject> JsonTextureObject = (*JsonTextures)[TextureIndex]->AsObject();
+	TSharedPtr<FJsonObject> JsonTextureObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Textures, TextureIndex);
 	if (!JsonTextureObject)
 	{
 		return nullptr;
@@ -1367,20 +1355,7 @@ UMaterialInterface* FglTFRuntimeParser::LoadMaterial(const int32 Index, const Fg
 		return MaterialsCache[Index];
 	}
 
-	const TArray<TSharedPtr<FJsonValue>>* JsonMaterials;
-
-	// no materials ?
-	if (!Root->TryGetArrayField(TEXT("materials"), JsonMaterials))
-	{
-		return nullptr;
-	}
-
-	if (Index >= JsonMaterials->Num())
-	{
-		return nullptr;
-	}
-
-	TSharedPtr<FJsonObject> JsonMaterialObject = (*JsonMaterials)[Index]->AsObject();
+	TSharedPtr<FJsonObject> JsonMaterialObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Materials, Index);
 	if (!JsonMaterialObject)
 	{
 		return nullptr;
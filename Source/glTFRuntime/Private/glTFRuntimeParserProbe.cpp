@@ -0,0 +1,589 @@
+// Copyright 2020-2024, Roberto De Ioris.
+
+#include "glTFRuntimeParser.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
+#include "Misc/Paths.h"
+#include "StaticMeshResources.h"
+
+namespace glTFRuntime
+{
+	bool GetBinaryChunks(const uint8* DataPtr, const int64 DataNum, const uint8*& JsonChunkPtr, int64& JsonChunkNum, const uint8*& BinaryChunkPtr, int64& BinaryChunkNum);
+
+	// enough for the png/ktx2/dds/webp headers and for jpegs with big exif/icc segments
+	constexpr int64 ProbeImageHeaderSize = 64 * 1024;
+
+	FORCEINLINE uint32 ReadProbeUInt32LE(const uint8* Ptr)
+	{
+		return static_cast<uint32>(Ptr[0]) | (static_cast<uint32>(Ptr[1]) << 8) | (static_cast<uint32>(Ptr[2]) << 16) | (static_cast<uint32>(Ptr[3]) << 24);
+	}
+
+	FORCEINLINE uint32 ReadProbeUInt32BE(const uint8* Ptr)
+	{
+		return (static_cast<uint32>(Ptr[0]) << 24) | (static_cast<uint32>(Ptr[1]) << 16) | (static_cast<uint32>(Ptr[2]) << 8) | static_cast<uint32>(Ptr[3]);
+	}
+
+	FORCEINLINE uint16 ReadProbeUInt16BE(const uint8* Ptr)
+	{
+		return (static_cast<uint16>(Ptr[0]) << 8) | static_cast<uint16>(Ptr[1]);
+	}
+
+	// reads a range of a data uri (only the required base64 quads are decoded) or of an external file
+	bool ReadProbeUriRange(const FString& Uri, const FString& BaseDirectory, TSharedPtr<FglTFRuntimeArchive> Archive, const int64 ByteOffset, const int64 ByteLength, TArray64<uint8>& Bytes)
+	{
+		if (ByteOffset < 0 || ByteLength <= 0)
+		{
+			return false;
+		}
+
+		if (Uri.StartsWith("data:"))
+		{
+			const FString Base64Signature = ";base64,";
+			int32 StringIndex = Uri.Find(Base64Signature, ESearchCase::IgnoreCase, ESearchDir::FromStart, 5);
+			if (StringIndex < 5)
+			{
+				return false;
+			}
+			StringIndex += Base64Signature.Len();
+
+			const int64 CharsOffset = (ByteOffset / 3) * 4;
+			const int64 Skip = ByteOffset % 3;
+			const int64 CharsNum = FMath::Min<int64>(((Skip + ByteLength + 2) / 3) * 4, Uri.Len() - StringIndex - CharsOffset);
+			if (CharsNum <= 0)
+			{
+				return false;
+			}
+
+			TArray64<uint8> Decoded;
+			if (!FglTFRuntimeParser::DecodeBase64(*Uri + StringIndex + CharsOffset, CharsNum, Decoded) || Decoded.Num() <= Skip)
+			{
+				return false;
+			}
+
+			Bytes.Append(Decoded.GetData() + Skip, FMath::Min<int64>(ByteLength, Decoded.Num() - Skip));
+			return true;
+		}
+
+		// archives would need to extract the whole entry
+		if (BaseDirectory.IsEmpty() || (Archive && Archive->FileExists(Uri)))
+		{
+			return false;
+		}
+
+		FString DecodedUri = Uri;
+		if (DecodedUri.Contains("%") && !FPaths::FileExists(FPaths::Combine(BaseDirectory, DecodedUri)))
+		{
+			DecodedUri = FGenericPlatformHttp::UrlDecode(DecodedUri);
+		}
+
+		TSharedPtr<FglTFRuntimeFileDataSource> FileDataSource = FglTFRuntimeFileDataSource::Open(FPaths::Combine(BaseDirectory, DecodedUri));
+		if (!FileDataSource || ByteOffset >= FileDataSource->Num())
+		{
+			return false;
+		}
+
+		TArray64<uint8> Scratch;
+		const int64 AvailableBytes = FMath::Min<int64>(ByteLength, FileDataSource->Num() - ByteOffset);
+		const uint8* RangePtr = FileDataSource->GetRange(ByteOffset, AvailableBytes, Scratch);
+		if (!RangePtr)
+		{
+			return false;
+		}
+
+		Bytes.Append(RangePtr, AvailableBytes);
+		return true;
+	}
+}
+
+bool FglTFRuntimeParser::GetImageSize(const uint8* DataPtr, const int64 DataNum, FIntPoint& ImageSize)
+{
+	ImageSize = FIntPoint::ZeroValue;
+
+	// png (IHDR is always the first chunk)
+	if (DataNum >= 24 && DataPtr[0] == 0x89 && DataPtr[1] == 'P' && DataPtr[2] == 'N' && DataPtr[3] == 'G')
+	{
+		ImageSize.X = glTFRuntime::ReadProbeUInt32BE(DataPtr + 16);
+		ImageSize.Y = glTFRuntime::ReadProbeUInt32BE(DataPtr + 20);
+		return true;
+	}
+
+	// jpeg (walk the segments up to the first SOF)
+	if (DataNum >= 4 && DataPtr[0] == 0xFF && DataPtr[1] == 0xD8)
+	{
+		int64 Offset = 2;
+		while (Offset + 9 <= DataNum)
+		{
+			if (DataPtr[Offset] != 0xFF)
+			{
+				return false;
+			}
+
+			const uint8 Marker = DataPtr[Offset + 1];
+			// fill byte
+			if (Marker == 0xFF)
+			{
+				Offset++;
+				continue;
+			}
+
+			// standalone markers
+			if (Marker == 0x01 || (Marker >= 0xD0 && Marker <= 0xD8))
+			{
+				Offset += 2;
+				continue;
+			}
+
+			// end of image or start of scan
+			if (Marker == 0xD9 || Marker == 0xDA)
+			{
+				return false;
+			}
+
+			if (Marker >= 0xC0 && Marker <= 0xCF && Marker != 0xC4 && Marker != 0xC8 && Marker != 0xCC)
+			{
+				ImageSize.Y = glTFRuntime::ReadProbeUInt16BE(DataPtr + Offset + 5);
+				ImageSize.X = glTFRuntime::ReadProbeUInt16BE(DataPtr + Offset + 7);
+				return true;
+			}
+
+			Offset += 2 + glTFRuntime::ReadProbeUInt16BE(DataPtr + Offset + 2);
+		}
+		return false;
+	}
+
+	// ktx2
+	if (DataNum >= 28 && DataPtr[0] == 0xAB && DataPtr[1] == 'K' && DataPtr[2] == 'T' && DataPtr[3] == 'X' && DataPtr[4] == ' ' && DataPtr[5] == '2' && DataPtr[6] == '0')
+	{
+		ImageSize.X = glTFRuntime::ReadProbeUInt32LE(DataPtr + 20);
+		ImageSize.Y = FMath::Max<uint32>(glTFRuntime::ReadProbeUInt32LE(DataPtr + 24), 1);
+		return true;
+	}
+
+	// dds
+	if (DataNum >= 20 && DataPtr[0] == 'D' && DataPtr[1] == 'D' && DataPtr[2] == 'S' && DataPtr[3] == ' ')
+	{
+		ImageSize.Y = glTFRuntime::ReadProbeUInt32LE(DataPtr + 12);
+		ImageSize.X = glTFRuntime::ReadProbeUInt32LE(DataPtr + 16);
+		return true;
+	}
+
+	// webp
+	if (DataNum >= 30 && FMemory::Memcmp(DataPtr, "RIFF", 4) == 0 && FMemory::Memcmp(DataPtr + 8, "WEBP", 4) == 0)
+	{
+		if (FMemory::Memcmp(DataPtr + 12, "VP8 ", 4) == 0)
+		{
+			ImageSize.X = (DataPtr[26] | (DataPtr[27] << 8)) & 0x3FFF;
+			ImageSize.Y = (DataPtr[28] | (DataPtr[29] << 8)) & 0x3FFF;
+			return true;
+		}
+
+		if (FMemory::Memcmp(DataPtr + 12, "VP8L", 4) == 0)
+		{
+			const uint32 Bits = glTFRuntime::ReadProbeUInt32LE(DataPtr + 21);
+			ImageSize.X = (Bits & 0x3FFF) + 1;
+			ImageSize.Y = ((Bits >> 14) & 0x3FFF) + 1;
+			return true;
+		}
+
+		if (FMemory::Memcmp(DataPtr + 12, "VP8X", 4) == 0)
+		{
+			ImageSize.X = (DataPtr[24] | (DataPtr[25] << 8) | (DataPtr[26] << 16)) + 1;
+			ImageSize.Y = (DataPtr[27] | (DataPtr[28] << 8) | (DataPtr[29] << 16)) + 1;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool FglTFRuntimeParser::GetAccessorBounds(const int32 AccessorIndex, FBox& Bounds)
+{
+	TSharedPtr<FJsonObject> JsonAccessorObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Accessors, AccessorIndex);
+	if (!JsonAccessorObject)
+	{
+		return false;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* JsonMinValues;
+	const TArray<TSharedPtr<FJsonValue>>* JsonMaxValues;
+	if (!JsonAccessorObject->TryGetArrayField(TEXT("min"), JsonMinValues) || !JsonAccessorObject->TryGetArrayField(TEXT("max"), JsonMaxValues))
+	{
+		return false;
+	}
+
+	FVector Min;
+	FVector Max;
+	if (!GetJsonVector<3>(JsonMinValues, Min) || !GetJsonVector<3>(JsonMaxValues, Max))
+	{
+		return false;
+	}
+
+	// quantized positions (KHR_mesh_quantization) store min/max as integers
+	bool bNormalized = false;
+	if (JsonAccessorObject->TryGetBoolField(TEXT("normalized"), bNormalized) && bNormalized)
+	{
+		const int64 ComponentType = GetJsonObjectIndex(JsonAccessorObject.ToSharedRef(), "componentType", INDEX_NONE);
+		switch (ComponentType)
+		{
+		case 5120:
+			Min = (Min / 127.0).ComponentMax(FVector(-1));
+			Max = (Max / 127.0).ComponentMax(FVector(-1));
+			break;
+		case 5121:
+			Min /= 255.0;
+			Max /= 255.0;
+			break;
+		case 5122:
+			Min = (Min / 32767.0).ComponentMax(FVector(-1));
+			Max = (Max / 32767.0).ComponentMax(FVector(-1));
+			break;
+		case 5123:
+			Min /= 65535.0;
+			Max /= 65535.0;
+			break;
+		default:
+			break;
+		}
+	}
+
+	Bounds = FBox(Min, Max).TransformBy(SceneBasis * FScaleMatrix(SceneScale));
+	return true;
+}
+
+bool FglTFRuntimeParser::Probe(FglTFRuntimeProbeInfo& ProbeInfo)
+{
+	return Probe(ProbeInfo, [this](const int64 ByteOffset, const int64 ByteLength, TArray64<uint8>& Bytes) -> bool
+		{
+			// only the images headers are read from FArchive binary chunks
+			if (BinaryChunkSource)
+			{
+				TArray64<uint8> Scratch;
+				const int64 AvailableBytes = FMath::Min(ByteLength, BinaryChunkSource->Num() - ByteOffset);
+				const uint8* RangePtr = ByteOffset >= 0 ? BinaryChunkSource->GetRange(ByteOffset, AvailableBytes, Scratch) : nullptr;
+				if (!RangePtr || AvailableBytes <= 0)
+				{
+					return false;
+				}
+				Bytes.Append(RangePtr, AvailableBytes);
+				return true;
+			}
+
+			FglTFRuntimeBlob Blob;
+			if (MappedBinaryBuffer.Num > 0)
+			{
+				Blob = MappedBinaryBuffer;
+			}
+			else if (BinaryBuffer && BinaryBuffer->Num() > 0)
+			{
+				Blob.Data = BinaryBuffer->GetData();
+				Blob.Num = BinaryBuffer->Num();
+			}
+			else if (StreamingBinaryBuffer)
+			{
+				Blob.Data = const_cast<uint8*>(StreamingBinaryBuffer->GetData());
+				Blob.Num = StreamingBinaryBuffer->NumAvailable();
+			}
+
+			if (ByteOffset < 0 || ByteOffset >= Blob.Num)
+			{
+				return false;
+			}
+
+			Bytes.Append(Blob.Data + ByteOffset, FMath::Min(ByteLength, Blob.Num - ByteOffset));
+			return true;
+		});
+}
+
+bool FglTFRuntimeParser::Probe(FglTFRuntimeProbeInfo& ProbeInfo, TFunctionRef<bool(const int64 ByteOffset, const int64 ByteLength, TArray64<uint8>& Bytes)> ReadBinaryChunkRange)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_Probe, FColor::Magenta);
+
+	ProbeInfo = FglTFRuntimeProbeInfo();
+
+	auto GetRootArrayNum = [this](const TCHAR* FieldName) -> int32
+		{
+			const TArray<TSharedPtr<FJsonValue>>* JsonArray;
+			return Root->TryGetArrayField(FieldName, JsonArray) ? JsonArray->Num() : 0;
+		};
+
+	ProbeInfo.NumScenes = GetRootArrayNum(TEXT("scenes"));
+	ProbeInfo.NumNodes = GetRootArrayNum(TEXT("nodes"));
+	ProbeInfo.NumMeshes = GetRootArrayNum(TEXT("meshes"));
+	ProbeInfo.NumMaterials = GetRootArrayNum(TEXT("materials"));
+	ProbeInfo.NumTextures = GetRootArrayNum(TEXT("textures"));
+	ProbeInfo.NumImages = GetRootArrayNum(TEXT("images"));
+	ProbeInfo.NumSkins = GetRootArrayNum(TEXT("skins"));
+	ProbeInfo.NumAnimations = GetRootArrayNum(TEXT("animations"));
+
+	Root->TryGetStringArrayField(TEXT("extensionsUsed"), ProbeInfo.ExtensionsUsed);
+	Root->TryGetStringArrayField(TEXT("extensionsRequired"), ProbeInfo.ExtensionsRequired);
+
+	const int32 NumBuffers = GetRootArrayNum(TEXT("buffers"));
+	for (int32 BufferIndex = 0; BufferIndex < NumBuffers; BufferIndex++)
+	{
+		TSharedPtr<FJsonObject> JsonBufferObject = GetJsonObjectFromRootIndex("buffers", BufferIndex);
+		if (JsonBufferObject)
+		{
+			ProbeInfo.BuffersBytes += FMath::Max<int64>(static_cast<int64>(GetJsonObjectNumber(JsonBufferObject.ToSharedRef(), "byteLength", 0)), 0);
+		}
+	}
+
+	auto GetAccessorCount = [this](const int64 AccessorIndex) -> int64
+		{
+			TSharedPtr<FJsonObject> JsonAccessorObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Accessors, AccessorIndex);
+			if (!JsonAccessorObject)
+			{
+				return 0;
+			}
+			return FMath::Max<int64>(static_cast<int64>(GetJsonObjectNumber(JsonAccessorObject.ToSharedRef(), "count", 0)), 0);
+		};
+
+	TArray<FBox> MeshesBounds;
+	MeshesBounds.Init(FBox(ForceInit), ProbeInfo.NumMeshes);
+
+	for (int32 MeshIndex = 0; MeshIndex < ProbeInfo.NumMeshes; MeshIndex++)
+	{
+		TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Meshes, MeshIndex);
+		if (!JsonMeshObject)
+		{
+			continue;
+		}
+
+		for (TSharedRef<FJsonObject> JsonPrimitiveObject : GetMeshPrimitives(JsonMeshObject.ToSharedRef()))
+		{
+			ProbeInfo.NumPrimitives++;
+
+			int64 NumVertices = 0;
+			const TSharedPtr<FJsonObject>* JsonAttributesObject;
+			int64 PositionAccessorIndex = INDEX_NONE;
+			if (JsonPrimitiveObject->TryGetObjectField(TEXT("attributes"), JsonAttributesObject) && (*JsonAttributesObject)->TryGetNumberField(TEXT("POSITION"), PositionAccessorIndex))
+			{
+				NumVertices = GetAccessorCount(PositionAccessorIndex);
+
+				FBox AccessorBounds;
+				if (GetAccessorBounds(PositionAccessorIndex, AccessorBounds))
+				{
+					MeshesBounds[MeshIndex] += AccessorBounds;
+				}
+			}
+			ProbeInfo.NumVertices += NumVertices;
+
+			const int64 IndicesAccessorIndex = GetJsonObjectIndex(JsonPrimitiveObject, "indices", INDEX_NONE);
+			const int64 NumIndices = IndicesAccessorIndex > INDEX_NONE ? GetAccessorCount(IndicesAccessorIndex) : NumVertices;
+
+			const int64 Mode = GetJsonObjectIndex(JsonPrimitiveObject, "mode", 4);
+			if (Mode == 4)
+			{
+				ProbeInfo.NumTriangles += NumIndices / 3;
+			}
+			else if (Mode == 5 || Mode == 6)
+			{
+				ProbeInfo.NumTriangles += FMath::Max<int64>(NumIndices - 2, 0);
+			}
+		}
+	}
+
+	ProbeInfo.EstimatedMeshesBytes = ProbeInfo.NumVertices * sizeof(FStaticMeshBuildVertex) + ProbeInfo.NumTriangles * 3 * sizeof(uint32);
+
+	// nodes are json only, so their transforms can be safely computed
+	if (ProbeInfo.NumNodes > 0 && LoadNodes())
+	{
+		for (const FglTFRuntimeNode& Node : AllNodesCache)
+		{
+			if (MeshesBounds.IsValidIndex(Node.MeshIndex) && MeshesBounds[Node.MeshIndex].IsValid)
+			{
+				ProbeInfo.Bounds += MeshesBounds[Node.MeshIndex].TransformBy(GetNodeWorldTransform(Node));
+			}
+		}
+	}
+	else
+	{
+		for (const FBox& MeshBounds : MeshesBounds)
+		{
+			ProbeInfo.Bounds += MeshBounds;
+		}
+	}
+
+	for (int32 ImageIndex = 0; ImageIndex < ProbeInfo.NumImages; ImageIndex++)
+	{
+		FIntPoint ImageSize = FIntPoint::ZeroValue;
+		TArray64<uint8> HeaderBytes;
+		bool bHeaderRead = false;
+
+		TSharedPtr<FJsonObject> JsonImageObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Images, ImageIndex);
+		if (JsonImageObject)
+		{
+			FString Uri;
+			if (JsonImageObject->TryGetStringField(TEXT("uri"), Uri))
+			{
+				bHeaderRead = glTFRuntime::ReadProbeUriRange(Uri, BaseDirectory, Archive, 0, glTFRuntime::ProbeImageHeaderSize, HeaderBytes);
+			}
+			else
+			{
+				const int64 BufferViewIndex = GetJsonObjectIndex(JsonImageObject.ToSharedRef(), "bufferView", INDEX_NONE);
+				TSharedPtr<FJsonObject> JsonBufferViewObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::BufferViews, BufferViewIndex);
+				if (JsonBufferViewObject)
+				{
+					const int64 BufferIndex = GetJsonObjectIndex(JsonBufferViewObject.ToSharedRef(), "buffer", INDEX_NONE);
+					const int64 ByteOffset = static_cast<int64>(GetJsonObjectNumber(JsonBufferViewObject.ToSharedRef(), "byteOffset", 0));
+					const int64 ByteLength = FMath::Min<int64>(static_cast<int64>(GetJsonObjectNumber(JsonBufferViewObject.ToSharedRef(), "byteLength", 0)), glTFRuntime::ProbeImageHeaderSize);
+
+					TSharedPtr<FJsonObject> JsonBufferObject = GetJsonObjectFromRootIndex("buffers", BufferIndex);
+					FString BufferUri;
+					if (JsonBufferObject && JsonBufferObject->TryGetStringField(TEXT("uri"), BufferUri))
+					{
+						bHeaderRead = glTFRuntime::ReadProbeUriRange(BufferUri, BaseDirectory, Archive, ByteOffset, ByteLength, HeaderBytes);
+					}
+					else if (BufferIndex == 0 && ByteLength > 0)
+					{
+						bHeaderRead = ReadBinaryChunkRange(ByteOffset, ByteLength, HeaderBytes);
+					}
+				}
+			}
+		}
+
+		if (bHeaderRead)
+		{
+			GetImageSize(HeaderBytes.GetData(), HeaderBytes.Num(), ImageSize);
+		}
+
+		ProbeInfo.ImagesSizes.Add(ImageSize);
+		ProbeInfo.EstimatedTexturesBytes += static_cast<int64>(ImageSize.X) * ImageSize.Y * 4 * 4 / 3;
+	}
+
+	return true;
+}
+
+bool FglTFRuntimeParser::ProbeFromData(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, FglTFRuntimeProbeInfo& ProbeInfo)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_ProbeFromData, FColor::Magenta);
+
+	// binary glTF: the binary chunk is only accessed for the images headers
+	if (DataNum > 20 && DataPtr[0] == 0x67 && DataPtr[1] == 0x6C && DataPtr[2] == 0x54 && DataPtr[3] == 0x46)
+	{
+		const uint8* JsonChunkPtr = nullptr;
+		int64 JsonChunkNum = 0;
+		const uint8* BinaryChunkPtr = nullptr;
+		int64 BinaryChunkNum = 0;
+		if (!glTFRuntime::GetBinaryChunks(DataPtr, DataNum, JsonChunkPtr, JsonChunkNum, BinaryChunkPtr, BinaryChunkNum))
+		{
+			return false;
+		}
+
+		TSharedPtr<FglTFRuntimeParser> Parser = FromUTF8(JsonChunkPtr, JsonChunkNum, LoaderConfig);
+		if (!Parser)
+		{
+			return false;
+		}
+
+		return Parser->Probe(ProbeInfo, [BinaryChunkPtr, BinaryChunkNum](const int64 ByteOffset, const int64 ByteLength, TArray64<uint8>& Bytes) -> bool
+			{
+				if (ByteOffset < 0 || ByteOffset >= BinaryChunkNum)
+				{
+					return false;
+				}
+				Bytes.Append(BinaryChunkPtr + ByteOffset, FMath::Min(ByteLength, BinaryChunkNum - ByteOffset));
+				return true;
+			});
+	}
+
+	// json, archives and compressed data
+	TSharedPtr<FglTFRuntimeParser> Parser = FromData(DataPtr, DataNum, LoaderConfig);
+	if (!Parser)
+	{
+		return false;
+	}
+
+	return Parser->Probe(ProbeInfo);
+}
+
+bool FglTFRuntimeParser::ProbeFromFilename(const FString& Filename, const FglTFRuntimeConfig& LoaderConfig, FglTFRuntimeProbeInfo& ProbeInfo)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_ProbeFromFilename, FColor::Magenta);
+
+	const FString TruePath = LoaderConfig.bSearchContentDir ? FPaths::Combine(FPaths::ProjectContentDir(), Filename) : Filename;
+
+	TSharedPtr<FglTFRuntimeFileDataSource> FileDataSource = FglTFRuntimeFileDataSource::Open(TruePath);
+	if (!FileDataSource)
+	{
+		UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to open file %s"), *Filename);
+		return false;
+	}
+
+	// binary glTF: only the header and the json chunk are read from disk
+	TArray64<uint8> HeaderScratch;
+	const uint8* HeaderPtr = FileDataSource->Num() > 20 ? FileDataSource->GetRange(0, 20, HeaderScratch) : nullptr;
+	if (HeaderPtr && HeaderPtr[0] == 0x67 && HeaderPtr[1] == 0x6C && HeaderPtr[2] == 0x54 && HeaderPtr[3] == 0x46 && glTFRuntime::ReadProbeUInt32LE(HeaderPtr + 16) == 0x4E4F534A)
+	{
+		const int64 JsonChunkNum = glTFRuntime::ReadProbeUInt32LE(HeaderPtr + 12);
+		TArray64<uint8> JsonScratch;
+		const uint8* JsonChunkPtr = FileDataSource->GetRange(20, JsonChunkNum, JsonScratch);
+		if (!JsonChunkPtr)
+		{
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to read json chunk from %s"), *Filename);
+			return false;
+		}
+
+		TSharedPtr<FglTFRuntimeParser> Parser = FromUTF8(JsonChunkPtr, JsonChunkNum, LoaderConfig);
+		JsonScratch.Empty();
+		if (!Parser)
+		{
+			return false;
+		}
+
+		if (LoaderConfig.bAllowExternalFiles)
+		{
+			Parser->BaseDirectory = FPaths::GetPath(TruePath);
+		}
+		Parser->BaseFilename = FPaths::GetBaseFilename(TruePath);
+
+		int64 BinaryChunkOffset = 0;
+		int64 BinaryChunkNum = 0;
+		TArray64<uint8> BinaryHeaderScratch;
+		const uint8* BinaryHeaderPtr = FileDataSource->GetRange(20 + JsonChunkNum, 8, BinaryHeaderScratch);
+		if (BinaryHeaderPtr && glTFRuntime::ReadProbeUInt32LE(BinaryHeaderPtr + 4) == 0x004E4942)
+		{
+			BinaryChunkOffset = 28 + JsonChunkNum;
+			BinaryChunkNum = FMath::Min<int64>(glTFRuntime::ReadProbeUInt32LE(BinaryHeaderPtr), FileDataSource->Num() - BinaryChunkOffset);
+		}
+
+		return Parser->Probe(ProbeInfo, [FileDataSource, BinaryChunkOffset, BinaryChunkNum](const int64 ByteOffset, const int64 ByteLength, TArray64<uint8>& Bytes) -> bool
+			{
+				if (ByteOffset < 0 || ByteOffset >= BinaryChunkNum)
+				{
+					return false;
+				}
+
+				const int64 AvailableBytes = FMath::Min(ByteLength, BinaryChunkNum - ByteOffset);
+				TArray64<uint8> Scratch;
+				const uint8* RangePtr = FileDataSource->GetRange(BinaryChunkOffset + ByteOffset, AvailableBytes, Scratch);
+				if (!RangePtr)
+				{
+					return false;
+				}
+				Bytes.Append(RangePtr, AvailableBytes);
+				return true;
+			});
+	}
+
+	// json, archives (only the glTF entry is extracted) and compressed files
+	TSharedPtr<FglTFRuntimeParser> Parser = FromFilename(Filename, LoaderConfig);
+	if (!Parser)
+	{
+		return false;
+	}
+
+	return Parser->Probe(ProbeInfo);
+}
+
+bool FglTFRuntimeParser::ValidateAccessorsBounds(const FString& Context, const FBox& AccessorsBounds, const FBox& VerticesBounds) const
+{
+	// min/max are usually written with float precision
+	const FBox ToleratedBounds = AccessorsBounds.ExpandBy(FMath::Max<double>(AccessorsBounds.GetExtent().GetMax() * 0.0001, KINDA_SMALL_NUMBER));
+	if (!VerticesBounds.IsValid || ToleratedBounds.IsInside(VerticesBounds))
+	{
+		return true;
+	}
+
+	UE_LOG(LogGLTFRuntime, Warning, TEXT("%s: accessors bounds %s do not contain the vertices bounds %s"), *Context, *AccessorsBounds.ToString(), *VerticesBounds.ToString());
+	return false;
+}
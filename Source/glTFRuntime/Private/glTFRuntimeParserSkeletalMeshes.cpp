@@ -59,15 +59,20 @@ struct FglTFRuntimeSkeletalMeshContextFinalizer
 {
 	TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext;
 	FglTFRuntimeSkeletalMeshAsync AsyncCallback;
+	TSharedRef<FglTFRuntimeAsyncLoad, ESPMode::ThreadSafe> AsyncLoad;
 
-	FglTFRuntimeSkeletalMeshContextFinalizer(TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> InSkeletalMeshContext, FglTFRuntimeSkeletalMeshAsync InAsyncCallback) :
+	FglTFRuntimeSkeletalMeshContextFinalizer(TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> InSkeletalMeshContext, FglTFRuntimeSkeletalMeshAsync InAsyncCallback, TSharedRef<FglTFRuntimeAsyncLoad, ESPMode::ThreadSafe> InAsyncLoad) :
 		SkeletalMeshContext(InSkeletalMeshContext),
-		AsyncCallback(InAsyncCallback)
+		AsyncCallback(InAsyncCallback),
+		AsyncLoad(InAsyncLoad)
 	{
 	}
 
 	~FglTFRuntimeSkeletalMeshContextFinalizer()
 	{
+		// the callback is allowed to trim the buffers
+		AsyncLoad->End();
+
 		FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([this]()
 			{
 				if (SkeletalMeshContext->SkeletalMesh)
@@ -239,7 +244,7 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 	TMap<int32, FName> MainBoneMap;
 	if (!SkeletalMeshContext->SkeletalMeshConfig.bIgnoreSkin && SkeletalMeshContext->SkinIndex > INDEX_NONE)
 	{
-		TSharedPtr<FJsonObject>	JsonSkinObject = GetJsonObjectFromRootIndex("skins", SkeletalMeshContext->SkinIndex);
+		TSharedPtr<FJsonObject>	JsonSkinObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Skins, SkeletalMeshContext->SkinIndex);
 		if (!JsonSkinObject)
 		{
 			AddError("CreateSkeletalMeshFromLODs()", "Unable to fill RefSkeleton.");
@@ -447,6 +452,32 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 			TMap<int32, TArray<int32>> OverlappingVertices;
 			MeshSection.DuplicatedVerticesBuffer.Init(MeshSection.NumVertices, OverlappingVertices);
 
+			auto GetIndexedPosition = [&Primitive](const int32 VertexIndex) -> FVector
+				{
+					return Primitive.Positions[Primitive.Indices[VertexIndex]];
+				};
+
+			FBox PrimitiveBoundingBox;
+			if (SkeletalMeshContext->SkeletalMeshConfig.bTrustAccessorsBounds && Primitive.PositionsBounds.IsValid)
+			{
+				PrimitiveBoundingBox = Primitive.PositionsBounds;
+				if (SkeletalMeshContext->SkeletalMeshConfig.bValidateAccessorsBounds)
+				{
+					ValidateAccessorsBounds(FString::Printf(TEXT("LoadSkeletalMesh() LOD %d Primitive %d"), LODIndex, PrimitiveIndex), PrimitiveBoundingBox, GetPositionsBounds(Primitive.Indices.Num(), GetIndexedPosition));
+				}
+			}
+			else
+			{
+				PrimitiveBoundingBox = GetPositionsBounds(Primitive.Indices.Num(), GetIndexedPosition);
+			}
+
+			if (PrimitiveBoundingBox.IsValid)
+			{
+				// BoundsScale can have negative components
+				SkeletalMeshContext->BoundingBox += PrimitiveBoundingBox.Min * SkeletalMeshContext->SkeletalMeshConfig.BoundsScale;
+				SkeletalMeshContext->BoundingBox += PrimitiveBoundingBox.Max * SkeletalMeshContext->SkeletalMeshConfig.BoundsScale;
+			}
+
 			// this is used for non-skinned asset loaded as skinned ones
 			int32 OverrideIndexToCheck = 0;
 
@@ -459,12 +490,10 @@ USkeletalMesh* FglTFRuntimeParser::CreateSkeletalMeshFromLODs(TSharedRef<FglTFRu
 
 #if ENGINE_MAJOR_VERSION > 4
 				ModelVertex.Position = FVector3f(Primitive.Positions[Index]);
-				SkeletalMeshContext->BoundingBox += FVector(ModelVertex.Position) * SkeletalMeshContext->SkeletalMeshConfig.BoundsScale;
 				ModelVertex.TangentX = FVector3f::ZeroVector;
 				ModelVertex.TangentZ = FVector3f::ZeroVector;
 #else
 				ModelVertex.Position = Primitive.Positions[Index];
-				SkeletalMeshContext->BoundingBox += ModelVertex.Position * SkeletalMeshContext->SkeletalMeshConfig.BoundsScale;
 				ModelVertex.TangentX = FVector::ZeroVector;
 				ModelVertex.TangentZ = FVector::ZeroVector;
 #endif
@@ -1638,7 +1667,7 @@ USkeletalMesh* FglTFRuntimeParser::LoadSkeletalMesh(const int32 MeshIndex, const
 		return SkeletalMeshesCache[MeshIndex];
 	}
 
-	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
+	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Meshes, MeshIndex);
 	if (!JsonMeshObject)
 	{
 		AddError("LoadSkeletalMesh()", FString::Printf(TEXT("Unable to find Mesh with index %d"), MeshIndex));
@@ -1681,11 +1710,13 @@ void FglTFRuntimeParser::LoadSkeletalMeshAsync(const int32 MeshIndex, const int3
 	TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext = MakeShared<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe>(AsShared(), MeshIndex, SkeletalMeshConfig);
 	SkeletalMeshContext->SkinIndex = SkinIndex;
 
-	Async(EAsyncExecution::Thread, [this, SkeletalMeshContext, MeshIndex, AsyncCallback]()
+	TSharedRef<FglTFRuntimeAsyncLoad, ESPMode::ThreadSafe> AsyncLoad = BeginAsyncLoad();
+
+	Async(EAsyncExecution::Thread, [this, SkeletalMeshContext, MeshIndex, AsyncCallback, AsyncLoad]()
 		{
-			FglTFRuntimeSkeletalMeshContextFinalizer AsyncFinalizer(SkeletalMeshContext, AsyncCallback);
+			FglTFRuntimeSkeletalMeshContextFinalizer AsyncFinalizer(SkeletalMeshContext, AsyncCallback, AsyncLoad);
 
-			TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
+			TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Meshes, MeshIndex);
 			if (!JsonMeshObject)
 			{
 				AddError("LoadSkeletalMeshAsync()", FString::Printf(TEXT("Unable to find Mesh with index %d"), MeshIndex));
@@ -1711,7 +1742,7 @@ USkeletalMesh* FglTFRuntimeParser::LoadSkeletalMeshLODs(const TArray<int32>& Mes
 
 	for (const int32 MeshIndex : MeshIndices)
 	{
-		TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
+		TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Meshes, MeshIndex);
 		if (!JsonMeshObject)
 		{
 			AddError("LoadSkeletalMesh()", FString::Printf(TEXT("Unable to find Mesh with index %d"), MeshIndex));
@@ -1761,9 +1792,11 @@ void FglTFRuntimeParser::LoadSkeletalMeshRecursiveAsync(const FString& NodeName,
 {
 	TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext = MakeShared<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe>(AsShared(), -1, SkeletalMeshConfig);
 
-	Async(EAsyncExecution::Thread, [this, SkeletalMeshContext, ExcludeNodes, NodeName, SkinIndex, AsyncCallback, TransformApplyRecursiveMode]()
+	TSharedRef<FglTFRuntimeAsyncLoad, ESPMode::ThreadSafe> AsyncLoad = BeginAsyncLoad();
+
+	Async(EAsyncExecution::Thread, [this, SkeletalMeshContext, ExcludeNodes, NodeName, SkinIndex, AsyncCallback, TransformApplyRecursiveMode, AsyncLoad]()
 		{
-			FglTFRuntimeSkeletalMeshContextFinalizer AsyncFinalizer(SkeletalMeshContext, AsyncCallback);
+			FglTFRuntimeSkeletalMeshContextFinalizer AsyncFinalizer(SkeletalMeshContext, AsyncCallback, AsyncLoad);
 			// ensure to cache it as the finalizer requires LOD access
 			FglTFRuntimeMeshLOD& CombinedLOD = SkeletalMeshContext->CachedRuntimeMeshLODs.AddDefaulted_GetRef();
 			int32 NewSkinIndex = SkinIndex;
@@ -1880,7 +1913,7 @@ UAnimSequence* FglTFRuntimeParser::LoadNodeSkeletalAnimation(USkeletalMesh* Skel
 	// this could be a static mesh read as a skeletal one...
 	if (Node.SkinIndex > INDEX_NONE)
 	{
-		TSharedPtr<FJsonObject> JsonSkinObject = GetJsonObjectFromRootIndex("skins", Node.SkinIndex);
+		TSharedPtr<FJsonObject> JsonSkinObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Skins, Node.SkinIndex);
 		if (!JsonSkinObject)
 		{
 			AddError("LoadNodeSkeletalAnimation()", "No skins defined in the asset");
@@ -1964,7 +1997,7 @@ TMap<FString, UAnimSequence*> FglTFRuntimeParser::LoadNodeSkeletalAnimationsMap(
 	// this could be a static mesh read as a skeletal one...
 	if (Node.SkinIndex > INDEX_NONE)
 	{
-		TSharedPtr<FJsonObject> JsonSkinObject = GetJsonObjectFromRootIndex("skins", Node.SkinIndex);
+		TSharedPtr<FJsonObject> JsonSkinObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Skins, Node.SkinIndex);
 		if (!JsonSkinObject)
 		{
 			AddError("LoadNodeSkeletalAnimation()", "No skins defined in the asset");
@@ -2635,7 +2668,7 @@ UAnimSequence* FglTFRuntimeParser::CreateAnimationFromPose(USkeletalMesh* Skelet
 	TArray<int32> Joints;
 	if (SkinIndex > INDEX_NONE)
 	{
-		TSharedPtr<FJsonObject> SkinObject = GetJsonObjectFromRootIndex("skins", SkinIndex);
+		TSharedPtr<FJsonObject> SkinObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Skins, SkinIndex);
 		if (!SkinObject)
 		{
 			return nullptr;
@@ -3251,7 +3284,7 @@ bool FglTFRuntimeParser::LoadSkeletalAnimation_Internal(TSharedRef<FJsonObject>
 	{
 		if (SkeletalAnimationConfig.RetargetSkinIndex > INDEX_NONE)
 		{
-			TSharedPtr<FJsonObject>	JsonSkinObject = GetJsonObjectFromRootIndex("skins", SkeletalAnimationConfig.RetargetSkinIndex);
+			TSharedPtr<FJsonObject>	JsonSkinObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Skins, SkeletalAnimationConfig.RetargetSkinIndex);
 			if (!JsonSkinObject)
 			{
 				AddError("LoadSkeletalAnimation_Internal()", "Unable to find retarget skin.");
@@ -3740,12 +3773,16 @@ bool FglTFRuntimeParser::LoadSkeletalAnimation_Internal(TSharedRef<FJsonObject>
 
 void FglTFRuntimeParser::LoadSkinnedMeshRecursiveAsRuntimeLODAsync(const FString& NodeName, int32& SkinIndex, const TArray<FString>& ExcludeNodes, const FglTFRuntimeMeshLODAsync& AsyncCallback, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const FglTFRuntimeSkeletonConfig& SkeletonConfig, const EglTFRuntimeRecursiveMode TransformApplyRecursiveMode)
 {
-	Async(EAsyncExecution::Thread, [this, ExcludeNodes, NodeName, SkinIndex, AsyncCallback, MaterialsConfig, SkeletonConfig, TransformApplyRecursiveMode]()
+	TSharedRef<FglTFRuntimeAsyncLoad, ESPMode::ThreadSafe> AsyncLoad = BeginAsyncLoad();
+
+	Async(EAsyncExecution::Thread, [this, ExcludeNodes, NodeName, SkinIndex, AsyncCallback, MaterialsConfig, SkeletonConfig, TransformApplyRecursiveMode, AsyncLoad]()
 		{
 			FglTFRuntimeMeshLOD LOD;
 			int32 NewSkinIndex = SkinIndex;
 			const bool bSuccess = LoadSkinnedMeshRecursiveAsRuntimeLOD(NodeName, NewSkinIndex, ExcludeNodes, LOD, MaterialsConfig, SkeletonConfig, TransformApplyRecursiveMode);
 
+			AsyncLoad->End();
+
 			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([&]()
 				{
 					AsyncCallback.ExecuteIfBound(bSuccess, MoveTemp(LOD));
@@ -3836,7 +3873,7 @@ bool FglTFRuntimeParser::LoadSkinnedMeshRecursiveAsRuntimeLOD(const FString& Nod
 		}
 		if (ChildNode.MeshIndex > INDEX_NONE)
 		{
-			TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", ChildNode.MeshIndex);
+			TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Meshes, ChildNode.MeshIndex);
 			if (!JsonMeshObject)
 			{
 				AddError("LoadSkinnedMeshRecursiveAsRuntimeLOD()", FString::Printf(TEXT("Unable to find Mesh with index %d"), ChildNode.MeshIndex));
@@ -3861,7 +3898,7 @@ bool FglTFRuntimeParser::LoadSkinnedMeshRecursiveAsRuntimeLOD(const FString& Nod
 			{
 				FReferenceSkeleton FakeRefSkeleton;
 
-				TSharedPtr<FJsonObject> JsonSkinObject = GetJsonObjectFromRootIndex("skins", ChildNode.SkinIndex);
+				TSharedPtr<FJsonObject> JsonSkinObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Skins, ChildNode.SkinIndex);
 				if (!JsonSkinObject)
 				{
 					AddError("LoadSkinnedMeshRecursiveAsRuntimeLOD()", FString::Printf(TEXT("Unable to fill skin %d"), ChildNode.SkinIndex));
@@ -3899,6 +3936,8 @@ bool FglTFRuntimeParser::LoadSkinnedMeshRecursiveAsRuntimeLOD(const FString& Nod
 						{
 							Vector = AdditionalTransform.TransformPosition(Vector);
 						}
+						// the accessor bounds must follow the vertices in bone space
+						Primitive.PositionsBounds = Primitive.PositionsBounds.TransformBy(AdditionalTransform);
 						for (FVector& Normal : Primitive.Normals)
 						{
 							Normal = AdditionalTransform.TransformVectorNoScale(Normal);
@@ -3943,6 +3982,8 @@ bool FglTFRuntimeParser::LoadSkinnedMeshRecursiveAsRuntimeLOD(const FString& Nod
 					{
 						Vector = AdditionalTransform.TransformPosition(Vector);
 					}
+					// the accessor bounds must follow the vertices in bone space
+					Primitive.PositionsBounds = Primitive.PositionsBounds.TransformBy(AdditionalTransform);
 					for (FVector& Normal : Primitive.Normals)
 					{
 						Normal = AdditionalTransform.TransformVectorNoScale(Normal);
@@ -4142,9 +4183,11 @@ void FglTFRuntimeParser::LoadSkeletalMeshFromRuntimeLODsAsync(const TArray<FglTF
 	TSharedRef<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe> SkeletalMeshContext = MakeShared<FglTFRuntimeSkeletalMeshContext, ESPMode::ThreadSafe>(AsShared(), -1, SkeletalMeshConfig);
 	SkeletalMeshContext->SkinIndex = SkinIndex;
 
-	Async(EAsyncExecution::Thread, [this, SkeletalMeshContext, RuntimeLODs, AsyncCallback]()
+	TSharedRef<FglTFRuntimeAsyncLoad, ESPMode::ThreadSafe> AsyncLoad = BeginAsyncLoad();
+
+	Async(EAsyncExecution::Thread, [this, SkeletalMeshContext, RuntimeLODs, AsyncCallback, AsyncLoad]()
 		{
-			FglTFRuntimeSkeletalMeshContextFinalizer AsyncFinalizer(SkeletalMeshContext, AsyncCallback);
+			FglTFRuntimeSkeletalMeshContextFinalizer AsyncFinalizer(SkeletalMeshContext, AsyncCallback, AsyncLoad);
 
 			if (RuntimeLODs.Num() < 1)
 			{
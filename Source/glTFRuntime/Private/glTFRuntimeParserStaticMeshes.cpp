@@ -76,9 +76,11 @@ void FglTFRuntimeParser::LoadStaticMeshAsync(const int32 MeshIndex, const FglTFR
 
 	TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext = MakeShared<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe>(AsShared(), MeshIndex, StaticMeshConfig);
 
-	Async(EAsyncExecution::Thread, [this, StaticMeshContext, MeshIndex, AsyncCallback]()
+	TSharedRef<FglTFRuntimeAsyncLoad, ESPMode::ThreadSafe> AsyncLoad = BeginAsyncLoad();
+
+	Async(EAsyncExecution::Thread, [this, StaticMeshContext, MeshIndex, AsyncCallback, AsyncLoad]()
 		{
-			TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
+			TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Meshes, MeshIndex);
 			if (JsonMeshObject)
 			{
 				FglTFRuntimeMeshLOD* LOD = nullptr;
@@ -90,6 +92,8 @@ void FglTFRuntimeParser::LoadStaticMeshAsync(const int32 MeshIndex, const FglTFR
 				}
 			}
 
+			AsyncLoad->End();
+
 			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([MeshIndex, StaticMeshContext, AsyncCallback]()
 				{
 					if (StaticMeshContext->StaticMesh)
@@ -176,6 +180,10 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 		FBox BoundingBox;
 		BoundingBox.Init();
 
+		FBox AccessorsBoundingBox;
+		AccessorsBoundingBox.Init();
+		bool bHasAccessorsBounds = LOD->Primitives.Num() > 0;
+
 		bool bHighPrecisionUVs = false;
 
 		int32 VertexInstanceBaseIndex = 0;
@@ -187,6 +195,15 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 
 		for (const FglTFRuntimePrimitive& Primitive : LOD->Primitives)
 		{
+			if (Primitive.PositionsBounds.IsValid)
+			{
+				AccessorsBoundingBox += bApplyAdditionalTransforms ? Primitive.PositionsBounds.TransformBy(LOD->AdditionalTransforms[AdditionalTransformsPrimitiveIndex]) : Primitive.PositionsBounds;
+			}
+			else
+			{
+				bHasAccessorsBounds = false;
+			}
+
 			FName MaterialName = FName(FString::Printf(TEXT("LOD_%d_Section_%d_%s"), CurrentLODIndex, StaticMeshContext->StaticMaterials.Num(), *Primitive.MaterialName));
 			if (StaticMeshContext->StaticMeshConfig.MaterialsConfig.MaterialSlotRemapper.Remapper.IsBound())
 			{
@@ -651,14 +668,30 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 			VertexBaseIndex += Primitive.bHasIndices ? Primitive.Positions.Num() : Primitive.Indices.Num();
 		}
 
-		// this is way more fast than doing it in the ParalellFor with a lock
-		for (const FStaticMeshBuildVertex& StaticMeshVertex : StaticMeshBuildVertices)
+		auto GetBuildVertexPosition = [&StaticMeshBuildVertices](const int32 VertexIndex) -> FVector
+			{
+				return FVector(StaticMeshBuildVertices[VertexIndex].Position);
+			};
+
+		const bool bUseAccessorsBounds = StaticMeshConfig.bTrustAccessorsBounds && bHasAccessorsBounds;
+		if (bUseAccessorsBounds)
 		{
-#if ENGINE_MAJOR_VERSION > 4
-			BoundingBox += FVector(StaticMeshVertex.Position);
-#else
-			BoundingBox += StaticMeshVertex.Position;
-#endif
+			BoundingBox = AccessorsBoundingBox;
+			if (StaticMeshConfig.bValidateAccessorsBounds)
+			{
+				ValidateAccessorsBounds(FString::Printf(TEXT("LoadStaticMesh() LOD %d"), CurrentLODIndex), BoundingBox, GetPositionsBounds(StaticMeshBuildVertices.Num(), GetBuildVertexPosition));
+			}
+		}
+		else
+		{
+			BoundingBox = GetPositionsBounds(StaticMeshBuildVertices.Num(), GetBuildVertexPosition);
+		}
+
+		// the sphere must be computed before moving the pivot (the box is in the same space)
+		double SphereRadius = 0;
+		if (CurrentLODIndex == 0)
+		{
+			SphereRadius = bUseAccessorsBounds ? BoundingBox.GetExtent().Size() : GetPositionsRadius(StaticMeshBuildVertices.Num(), BoundingBox.GetCenter(), GetBuildVertexPosition);
 		}
 
 		// check for pivot repositioning
@@ -666,20 +699,21 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 		{
 			if (StaticMeshConfig.PivotPosition == EglTFRuntimePivotPosition::CustomTransform)
 			{
-				for (FStaticMeshBuildVertex& StaticMeshVertex : StaticMeshBuildVertices)
-				{
+				ParallelFor(StaticMeshBuildVertices.Num(), [&](const int32 VertexIndex)
+					{
+						FStaticMeshBuildVertex& StaticMeshVertex = StaticMeshBuildVertices[VertexIndex];
 #if ENGINE_MAJOR_VERSION > 4
-					StaticMeshVertex.Position = FVector3f(StaticMeshConfig.CustomPivotTransform.InverseTransformPosition(FVector(StaticMeshVertex.Position)));
-					StaticMeshVertex.TangentX = FVector3f(StaticMeshConfig.CustomPivotTransform.InverseTransformVector(FVector(StaticMeshVertex.TangentX)));
-					StaticMeshVertex.TangentY = FVector3f(StaticMeshConfig.CustomPivotTransform.InverseTransformVector(FVector(StaticMeshVertex.TangentY)));
-					StaticMeshVertex.TangentZ = FVector3f(StaticMeshConfig.CustomPivotTransform.InverseTransformVector(FVector(StaticMeshVertex.TangentZ)));
+						StaticMeshVertex.Position = FVector3f(StaticMeshConfig.CustomPivotTransform.InverseTransformPosition(FVector(StaticMeshVertex.Position)));
+						StaticMeshVertex.TangentX = FVector3f(StaticMeshConfig.CustomPivotTransform.InverseTransformVector(FVector(StaticMeshVertex.TangentX)));
+						StaticMeshVertex.TangentY = FVector3f(StaticMeshConfig.CustomPivotTransform.InverseTransformVector(FVector(StaticMeshVertex.TangentY)));
+						StaticMeshVertex.TangentZ = FVector3f(StaticMeshConfig.CustomPivotTransform.InverseTransformVector(FVector(StaticMeshVertex.TangentZ)));
 #else
-					StaticMeshVertex.Position = StaticMeshConfig.CustomPivotTransform.InverseTransformPosition(StaticMeshVertex.Position);
-					StaticMeshVertex.TangentX = StaticMeshConfig.CustomPivotTransform.InverseTransformVector(StaticMeshVertex.TangentX);
-					StaticMeshVertex.TangentY = StaticMeshConfig.CustomPivotTransform.InverseTransformVector(StaticMeshVertex.TangentY);
-					StaticMeshVertex.TangentZ = StaticMeshConfig.CustomPivotTransform.InverseTransformVector(StaticMeshVertex.TangentZ);
+						StaticMeshVertex.Position = StaticMeshConfig.CustomPivotTransform.InverseTransformPosition(StaticMeshVertex.Position);
+						StaticMeshVertex.TangentX = StaticMeshConfig.CustomPivotTransform.InverseTransformVector(StaticMeshVertex.TangentX);
+						StaticMeshVertex.TangentY = StaticMeshConfig.CustomPivotTransform.InverseTransformVector(StaticMeshVertex.TangentY);
+						StaticMeshVertex.TangentZ = StaticMeshConfig.CustomPivotTransform.InverseTransformVector(StaticMeshVertex.TangentZ);
 #endif
-				}
+					});
 			}
 			else
 			{
@@ -696,14 +730,14 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 					PivotDelta = BoundingBox.GetCenter() - FVector(0, 0, BoundingBox.GetExtent().Z);
 				}
 
-				for (FStaticMeshBuildVertex& StaticMeshVertex : StaticMeshBuildVertices)
-				{
+				ParallelFor(StaticMeshBuildVertices.Num(), [&](const int32 VertexIndex)
+					{
 #if ENGINE_MAJOR_VERSION > 4
-					StaticMeshVertex.Position -= FVector3f(PivotDelta);
+						StaticMeshBuildVertices[VertexIndex].Position -= FVector3f(PivotDelta);
 #else
-					StaticMeshVertex.Position -= PivotDelta;
+						StaticMeshBuildVertices[VertexIndex].Position -= PivotDelta;
 #endif
-				}
+					});
 
 				if (CurrentLODIndex == 0)
 				{
@@ -715,15 +749,7 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMesh_Internal(TSharedRef<FglTFRuntime
 		if (CurrentLODIndex == 0)
 		{
 			BoundingBox.GetCenterAndExtents(StaticMeshContext->BoundingBoxAndSphere.Origin, StaticMeshContext->BoundingBoxAndSphere.BoxExtent);
-			StaticMeshContext->BoundingBoxAndSphere.SphereRadius = 0.0f;
-			for (const FStaticMeshBuildVertex& StaticMeshVertex : StaticMeshBuildVertices)
-			{
-#if ENGINE_MAJOR_VERSION > 4
-				StaticMeshContext->BoundingBoxAndSphere.SphereRadius = FMath::Max((FVector(StaticMeshVertex.Position) - StaticMeshContext->BoundingBoxAndSphere.Origin).Size(), StaticMeshContext->BoundingBoxAndSphere.SphereRadius);
-#else
-				StaticMeshContext->BoundingBoxAndSphere.SphereRadius = FMath::Max((StaticMeshVertex.Position - StaticMeshContext->BoundingBoxAndSphere.Origin).Size(), StaticMeshContext->BoundingBoxAndSphere.SphereRadius);
-#endif
-			}
+			StaticMeshContext->BoundingBoxAndSphere.SphereRadius = SphereRadius;
 
 			StaticMeshContext->BoundingBoxAndSphere.Origin -= PivotDelta;
 
@@ -1138,7 +1164,7 @@ bool FglTFRuntimeParser::LoadMeshIntoMeshLOD(TSharedRef<FJsonObject> JsonMeshObj
 UStaticMesh* FglTFRuntimeParser::LoadStaticMesh(const int32 MeshIndex, const FglTFRuntimeStaticMeshConfig& StaticMeshConfig)
 {
 
-	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
+	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Meshes, MeshIndex);
 	if (!JsonMeshObject)
 	{
 		return nullptr;
@@ -1181,7 +1207,7 @@ TArray<UStaticMesh*> FglTFRuntimeParser::LoadStaticMeshesFromPrimitives(const in
 {
 	TArray<UStaticMesh*> StaticMeshes;
 
-	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
+	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Meshes, MeshIndex);
 	if (!JsonMeshObject)
 	{
 		return StaticMeshes;
@@ -1227,7 +1253,7 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMeshLODs(const TArray<int32>& MeshInd
 
 	for (const int32 MeshIndex : MeshIndices)
 	{
-		TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
+		TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Meshes, MeshIndex);
 		if (!JsonMeshObject)
 		{
 			return nullptr;
@@ -1255,12 +1281,14 @@ void FglTFRuntimeParser::LoadStaticMeshLODsAsync(const TArray<int32>& MeshIndice
 {
 	TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext = MakeShared<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe>(AsShared(), -1, StaticMeshConfig);
 
-	Async(EAsyncExecution::Thread, [this, StaticMeshContext, MeshIndices, AsyncCallback]()
+	TSharedRef<FglTFRuntimeAsyncLoad, ESPMode::ThreadSafe> AsyncLoad = BeginAsyncLoad();
+
+	Async(EAsyncExecution::Thread, [this, StaticMeshContext, MeshIndices, AsyncCallback, AsyncLoad]()
 		{
 			bool bSuccess = true;
 			for (const int32 MeshIndex : MeshIndices)
 			{
-				TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
+				TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Meshes, MeshIndex);
 				if (!JsonMeshObject)
 				{
 					bSuccess = false;
@@ -1283,6 +1311,8 @@ void FglTFRuntimeParser::LoadStaticMeshLODsAsync(const TArray<int32>& MeshIndice
 				StaticMeshContext->StaticMesh = LoadStaticMesh_Internal(StaticMeshContext);
 			}
 
+			AsyncLoad->End();
+
 			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([StaticMeshContext, AsyncCallback]()
 				{
 					if (StaticMeshContext->StaticMesh)
@@ -1307,7 +1337,7 @@ bool FglTFRuntimeParser::LoadStaticMeshIntoProceduralMeshComponent(const int32 M
 		return false;
 	}
 
-	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
+	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Meshes, MeshIndex);
 	if (!JsonMeshObject)
 	{
 		return false;
@@ -1435,7 +1465,7 @@ UStaticMesh* FglTFRuntimeParser::LoadStaticMeshRecursive(const FString& NodeName
 
 		if (ChildNode.MeshIndex != INDEX_NONE)
 		{
-			TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", ChildNode.MeshIndex);
+			TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Meshes, ChildNode.MeshIndex);
 			if (!JsonMeshObject)
 			{
 				return nullptr;
@@ -1488,7 +1518,9 @@ void FglTFRuntimeParser::LoadStaticMeshRecursiveAsync(const FString& NodeName, c
 	TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext = MakeShared<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe>(AsShared(), -1, StaticMeshConfig);
 
 
-	Async(EAsyncExecution::Thread, [this, StaticMeshContext, StaticMeshConfig, ExcludeNodes, NodeName, AsyncCallback]()
+	TSharedRef<FglTFRuntimeAsyncLoad, ESPMode::ThreadSafe> AsyncLoad = BeginAsyncLoad();
+
+	Async(EAsyncExecution::Thread, [this, StaticMeshContext, StaticMeshConfig, ExcludeNodes, NodeName, AsyncCallback, AsyncLoad]()
 		{
 
 			FglTFRuntimeNode Node;
@@ -1538,7 +1570,7 @@ void FglTFRuntimeParser::LoadStaticMeshRecursiveAsync(const FString& NodeName, c
 
 				if (ChildNode.MeshIndex != INDEX_NONE)
 				{
-					TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", ChildNode.MeshIndex);
+					TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Meshes, ChildNode.MeshIndex);
 					if (!JsonMeshObject)
 					{
 						return;
@@ -1578,6 +1610,8 @@ void FglTFRuntimeParser::LoadStaticMeshRecursiveAsync(const FString& NodeName, c
 
 			StaticMeshContext->StaticMesh = LoadStaticMesh_Internal(StaticMeshContext);
 
+			AsyncLoad->End();
+
 			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([StaticMeshContext, AsyncCallback]()
 				{
 					if (StaticMeshContext->StaticMesh)
@@ -1597,7 +1631,7 @@ void FglTFRuntimeParser::LoadStaticMeshRecursiveAsync(const FString& NodeName, c
 
 bool FglTFRuntimeParser::LoadMeshAsRuntimeLOD(const int32 MeshIndex, FglTFRuntimeMeshLOD& RuntimeLOD, const FglTFRuntimeMaterialsConfig& MaterialsConfig)
 {
-	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex("meshes", MeshIndex);
+	TSharedPtr<FJsonObject> JsonMeshObject = GetJsonObjectFromRootIndex(EglTFRuntimeJsonSection::Meshes, MeshIndex);
 	if (!JsonMeshObject)
 	{
 		return false;
@@ -1635,7 +1669,9 @@ void FglTFRuntimeParser::LoadStaticMeshFromRuntimeLODsAsync(const TArray<FglTFRu
 {
 	TSharedRef<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe> StaticMeshContext = MakeShared<FglTFRuntimeStaticMeshContext, ESPMode::ThreadSafe>(AsShared(), -1, StaticMeshConfig);
 
-	Async(EAsyncExecution::Thread, [this, StaticMeshContext, StaticMeshConfig, RuntimeLODs, AsyncCallback]()
+	TSharedRef<FglTFRuntimeAsyncLoad, ESPMode::ThreadSafe> AsyncLoad = BeginAsyncLoad();
+
+	Async(EAsyncExecution::Thread, [this, StaticMeshContext, StaticMeshConfig, RuntimeLODs, AsyncCallback, AsyncLoad]()
 		{
 			for (const FglTFRuntimeMeshLOD& RuntimeLOD : RuntimeLODs)
 			{
@@ -1644,6 +1680,8 @@ void FglTFRuntimeParser::LoadStaticMeshFromRuntimeLODsAsync(const TArray<FglTFRu
 
 			StaticMeshContext->StaticMesh = LoadStaticMesh_Internal(StaticMeshContext);
 
+			AsyncLoad->End();
+
 			FGraphEventRef Task = FFunctionGraphTask::CreateAndDispatchWhenReady([StaticMeshContext, AsyncCallback]()
 				{
 					if (StaticMeshContext->StaticMesh)
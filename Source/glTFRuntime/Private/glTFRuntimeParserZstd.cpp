@@ -0,0 +1,1088 @@
+// Copyright 2020-2024, Roberto De Ioris.
+
+#include "glTFRuntimeParser.h"
+
+// Zstandard (RFC 8878) decoder, like LZ4 it is implemented here instead of messing around with the build system
+namespace glTFRuntime
+{
+	constexpr int64 ZstdMaxBlockSize = 128 * 1024;
+	// initial output reservation relative to the frame size
+	constexpr int64 ZstdReserveRatio = 16;
+
+	struct FZstdFseEntry
+	{
+		uint16 BaseLine;
+		uint8 NumBits;
+		uint8 Symbol;
+	};
+
+	struct FZstdFseTable
+	{
+		TArray<FZstdFseEntry> Entries;
+		int32 AccuracyLog = 0;
+	};
+
+	struct FZstdHuffmanEntry
+	{
+		uint8 Symbol;
+		uint8 NumBits;
+	};
+
+	struct FZstdHuffmanTable
+	{
+		TArray<FZstdHuffmanEntry> Entries;
+		int32 MaxBits = 0;
+	};
+
+	// the state shared by the blocks of a frame
+	struct FZstdFrameContext
+	{
+		FZstdHuffmanTable Huffman;
+		FZstdFseTable LiteralsLengths;
+		FZstdFseTable Offsets;
+		FZstdFseTable MatchLengths;
+		uint64 RepeatedOffsets[3] = { 1, 4, 8 };
+		TArray<uint8> Literals;
+	};
+
+	static const uint32 ZstdLiteralsLengthBaselines[36] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 18, 20, 22, 24, 28, 32, 40, 48, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384, 32768, 65536 };
+	static const uint8 ZstdLiteralsLengthBits[36] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 3, 3, 4, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+	static const uint32 ZstdMatchLengthBaselines[53] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 37, 39, 41, 43, 47, 51, 59, 67, 83, 99, 131, 259, 515, 1027, 2051, 4099, 8195, 16387, 32771, 65539 };
+	static const uint8 ZstdMatchLengthBits[53] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 3, 3, 4, 4, 5, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+	static const int16 ZstdLiteralsLengthDefaultDistribution[36] = { 4, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 1, 1, 1, 1, 1, -1, -1, -1, -1 };
+	static const int16 ZstdMatchLengthDefaultDistribution[53] = { 1, 4, 3, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1, -1, -1 };
+	static const int16 ZstdOffsetDefaultDistribution[29] = { 1, 1, 1, 1, 1, 1, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1 };
+
+	FORCEINLINE uint32 ReadZstdUInt32(const uint8* Ptr)
+	{
+		return static_cast<uint32>(Ptr[0]) | (static_cast<uint32>(Ptr[1]) << 8) | (static_cast<uint32>(Ptr[2]) << 16) | (static_cast<uint32>(Ptr[3]) << 24);
+	}
+
+	// FSE and Huffman streams are read backward, starting from the highest set bit of the last byte
+	struct FZstdBackwardBitReader
+	{
+		const uint8* Data = nullptr;
+		int64 Size = 0;
+		int64 BitPosition = 0;
+
+		bool Init(const uint8* InData, const int64 InSize)
+		{
+			if (InSize <= 0 || InData[InSize - 1] == 0)
+			{
+				return false;
+			}
+
+			Data = InData;
+			Size = InSize;
+			BitPosition = (InSize - 1) * 8 + FPlatformMath::FloorLog2(InData[InSize - 1]);
+			return true;
+		}
+
+		// bits before the start of the stream are zeros
+		FORCEINLINE uint64 Peek(const int32 NumBits) const
+		{
+			if (NumBits == 0)
+			{
+				return 0;
+			}
+
+			int64 Start = BitPosition - NumBits;
+			int32 Shift = 0;
+			int32 Available = NumBits;
+			if (Start < 0)
+			{
+				Available += Start;
+				if (Available <= 0)
+				{
+					return 0;
+				}
+				Shift = -Start;
+				Start = 0;
+			}
+
+			const int64 ByteIndex = Start >> 3;
+			uint64 Word = 0;
+			if (ByteIndex + 8 <= Size)
+			{
+				FMemory::Memcpy(&Word, Data + ByteIndex, 8);
+			}
+			else
+			{
+				for (int64 WordByteIndex = 0; ByteIndex + WordByteIndex < Size; WordByteIndex++)
+				{
+					Word |= static_cast<uint64>(Data[ByteIndex + WordByteIndex]) << (WordByteIndex * 8);
+				}
+			}
+
+			return ((Word >> (Start & 7)) & ((1ULL << Available) - 1)) << Shift;
+		}
+
+		FORCEINLINE uint64 Read(const int32 NumBits)
+		{
+			const uint64 Value = Peek(NumBits);
+			BitPosition -= NumBits;
+			return Value;
+		}
+	};
+
+	static bool BuildZstdFseTable(const int16* Distribution, const int32 NumSymbols, const int32 AccuracyLog, FZstdFseTable& OutTable)
+	{
+		const int32 TableSize = 1 << AccuracyLog;
+		OutTable.AccuracyLog = AccuracyLog;
+		OutTable.Entries.SetNumUninitialized(TableSize);
+
+		uint32 SymbolNext[256];
+		int32 HighThreshold = TableSize - 1;
+		for (int32 Symbol = 0; Symbol < NumSymbols; Symbol++)
+		{
+			if (Distribution[Symbol] == -1)
+			{
+				// "less than 1" probabilities go to the end of the table
+				if (HighThreshold < 0)
+				{
+					return false;
+				}
+				OutTable.Entries[HighThreshold--].Symbol = static_cast<uint8>(Symbol);
+				SymbolNext[Symbol] = 1;
+			}
+			else
+			{
+				SymbolNext[Symbol] = Distribution[Symbol];
+			}
+		}
+
+		const int32 Step = (TableSize >> 1) + (TableSize >> 3) + 3;
+		const int32 Mask = TableSize - 1;
+		int32 Position = 0;
+		for (int32 Symbol = 0; Symbol < NumSymbols; Symbol++)
+		{
+			for (int32 Index = 0; Index < Distribution[Symbol]; Index++)
+			{
+				OutTable.Entries[Position].Symbol = static_cast<uint8>(Symbol);
+				do
+				{
+					Position = (Position + Step) & Mask;
+				} while (Position > HighThreshold);
+			}
+		}
+
+		if (Position != 0)
+		{
+			return false;
+		}
+
+		for (int32 State = 0; State < TableSize; State++)
+		{
+			FZstdFseEntry& Entry = OutTable.Entries[State];
+			const uint32 NextState = SymbolNext[Entry.Symbol]++;
+			Entry.NumBits = static_cast<uint8>(AccuracyLog - FPlatformMath::FloorLog2(NextState));
+			Entry.BaseLine = static_cast<uint16>((NextState << Entry.NumBits) - TableSize);
+		}
+
+		return true;
+	}
+
+	static bool ReadZstdFseTable(const uint8* DataPtr, const int64 DataNum, const int32 MaxSymbol, const int32 MaxAccuracyLog, FZstdFseTable& OutTable, int64& OutSize)
+	{
+		int64 BitOffset = 0;
+		auto PeekBits = [DataPtr, DataNum, &BitOffset](const int32 NumBits) -> uint32
+			{
+				uint32 Value = 0;
+				for (int32 BitIndex = 0; BitIndex < NumBits; BitIndex++)
+				{
+					const int64 ByteIndex = (BitOffset + BitIndex) >> 3;
+					if (ByteIndex < DataNum)
+					{
+						Value |= ((DataPtr[ByteIndex] >> ((BitOffset + BitIndex) & 7)) & 1) << BitIndex;
+					}
+				}
+				return Value;
+			};
+
+		const int32 AccuracyLog = PeekBits(4) + 5;
+		BitOffset += 4;
+		if (AccuracyLog > MaxAccuracyLog)
+		{
+			return false;
+		}
+
+		int16 Distribution[256] = {};
+		int32 Remaining = (1 << AccuracyLog) + 1;
+		int32 Threshold = 1 << AccuracyLog;
+		int32 NumBits = AccuracyLog + 1;
+		int32 Symbol = 0;
+
+		while (Remaining > 1 && Symbol <= MaxSymbol)
+		{
+			const int32 Max = (2 * Threshold - 1) - Remaining;
+			const int32 Bits = PeekBits(NumBits);
+			int32 Count = 0;
+			if ((Bits & (Threshold - 1)) < Max)
+			{
+				Count = Bits & (Threshold - 1);
+				BitOffset += NumBits - 1;
+			}
+			else
+			{
+				Count = Bits & (2 * Threshold - 1);
+				if (Count >= Threshold)
+				{
+					Count -= Max;
+				}
+				BitOffset += NumBits;
+			}
+
+			Count--;
+			Remaining -= Count < 0 ? -Count : Count;
+			Distribution[Symbol++] = static_cast<int16>(Count);
+
+			// zero probabilities are followed by 2 bits repeat flags
+			if (Count == 0)
+			{
+				for (;;)
+				{
+					const uint32 Repeat = PeekBits(2);
+					BitOffset += 2;
+					if (Symbol + static_cast<int32>(Repeat) > MaxSymbol + 1)
+					{
+						return false;
+					}
+					Symbol += Repeat;
+					if (Repeat != 3)
+					{
+						break;
+					}
+				}
+			}
+
+			while (Remaining < Threshold)
+			{
+				NumBits--;
+				Threshold >>= 1;
+			}
+		}
+
+		OutSize = (BitOffset + 7) / 8;
+		if (Remaining != 1 || OutSize > DataNum)
+		{
+			return false;
+		}
+
+		return BuildZstdFseTable(Distribution, Symbol, AccuracyLog, OutTable);
+	}
+
+	static bool ReadZstdHuffmanTable(const uint8* DataPtr, const int64 DataNum, FZstdHuffmanTable& OutTable, int64& OutSize)
+	{
+		if (DataNum < 1)
+		{
+			return false;
+		}
+
+		const uint8 Header = DataPtr[0];
+		uint8 Weights[256];
+		int32 NumWeights = 0;
+
+		// FSE compressed weights
+		if (Header < 128)
+		{
+			if (1 + Header > DataNum)
+			{
+				return false;
+			}
+
+			FZstdFseTable WeightsTable;
+			int64 WeightsTableSize = 0;
+			if (!ReadZstdFseTable(DataPtr + 1, Header, 255, 6, WeightsTable, WeightsTableSize))
+			{
+				return false;
+			}
+
+			FZstdBackwardBitReader Reader;
+			if (!Reader.Init(DataPtr + 1 + WeightsTableSize, Header - WeightsTableSize))
+			{
+				return false;
+			}
+
+			// two interleaved states
+			uint32 States[2];
+			States[0] = Reader.Read(WeightsTable.AccuracyLog);
+			States[1] = Reader.Read(WeightsTable.AccuracyLog);
+			for (int32 StateIndex = 0;; StateIndex ^= 1)
+			{
+				if (NumWeights >= 255)
+				{
+					return false;
+				}
+
+				const FZstdFseEntry& Entry = WeightsTable.Entries[States[StateIndex]];
+				Weights[NumWeights++] = Entry.Symbol;
+				States[StateIndex] = Entry.BaseLine + Reader.Read(Entry.NumBits);
+				if (Reader.BitPosition < 0)
+				{
+					if (NumWeights >= 255)
+					{
+						return false;
+					}
+					Weights[NumWeights++] = WeightsTable.Entries[States[StateIndex ^ 1]].Symbol;
+					break;
+				}
+			}
+
+			OutSize = 1 + Header;
+		}
+		// 4 bits weights
+		else
+		{
+			NumWeights = Header - 127;
+			const int64 WeightsSize = (NumWeights + 1) / 2;
+			if (1 + WeightsSize > DataNum)
+			{
+				return false;
+			}
+
+			for (int32 WeightIndex = 0; WeightIndex < NumWeights; WeightIndex++)
+			{
+				const uint8 Byte = DataPtr[1 + WeightIndex / 2];
+				Weights[WeightIndex] = (WeightIndex % 2) == 0 ? (Byte >> 4) : (Byte & 0x0F);
+			}
+
+			OutSize = 1 + WeightsSize;
+		}
+
+		// the last weight is implicit
+		uint32 WeightsSum = 0;
+		for (int32 WeightIndex = 0; WeightIndex < NumWeights; WeightIndex++)
+		{
+			if (Weights[WeightIndex] > 11)
+			{
+				return false;
+			}
+
+			if (Weights[WeightIndex] > 0)
+			{
+				WeightsSum += 1 << (Weights[WeightIndex] - 1);
+			}
+		}
+
+		if (WeightsSum == 0)
+		{
+			return false;
+		}
+
+		const int32 MaxBits = FPlatformMath::FloorLog2(WeightsSum) + 1;
+		const uint32 LeftOver = (1 << MaxBits) - WeightsSum;
+		if (MaxBits > 11 || (LeftOver & (LeftOver - 1)) != 0)
+		{
+			return false;
+		}
+
+		Weights[NumWeights++] = static_cast<uint8>(FPlatformMath::FloorLog2(LeftOver) + 1);
+
+		// prefix codes are assigned by increasing weight and then by symbol
+		uint32 RankCount[13] = {};
+		for (int32 Symbol = 0; Symbol < NumWeights; Symbol++)
+		{
+			if (Weights[Symbol] > 0)
+			{
+				RankCount[MaxBits + 1 - Weights[Symbol]]++;
+			}
+		}
+
+		uint32 RankIndex[13] = {};
+		for (int32 Bits = MaxBits; Bits > 0; Bits--)
+		{
+			RankIndex[Bits - 1] = RankIndex[Bits] + RankCount[Bits] * (1 << (MaxBits - Bits));
+		}
+
+		OutTable.MaxBits = MaxBits;
+		OutTable.Entries.SetNumZeroed(1 << MaxBits);
+		for (int32 Symbol = 0; Symbol < NumWeights; Symbol++)
+		{
+			if (Weights[Symbol] > 0)
+			{
+				const int32 Bits = MaxBits + 1 - Weights[Symbol];
+				const uint32 Length = 1 << (MaxBits - Bits);
+				for (uint32 Index = 0; Index < Length; Index++)
+				{
+					FZstdHuffmanEntry& Entry = OutTable.Entries[RankIndex[Bits] + Index];
+					Entry.Symbol = static_cast<uint8>(Symbol);
+					Entry.NumBits = static_cast<uint8>(Bits);
+				}
+				RankIndex[Bits] += Length;
+			}
+		}
+
+		return true;
+	}
+
+	static bool DecodeZstdHuffmanStream(const FZstdHuffmanTable& Table, const uint8* DataPtr, const int64 DataNum, uint8* Output, const int64 OutputNum)
+	{
+		FZstdBackwardBitReader Reader;
+		if (!Reader.Init(DataPtr, DataNum))
+		{
+			return false;
+		}
+
+		for (int64 Index = 0; Index < OutputNum; Index++)
+		{
+			const FZstdHuffmanEntry& Entry = Table.Entries[Reader.Peek(Table.MaxBits)];
+			Output[Index] = Entry.Symbol;
+			Reader.BitPosition -= Entry.NumBits;
+		}
+
+		return Reader.BitPosition == 0;
+	}
+
+	static bool DecodeZstdLiterals(FZstdFrameContext& Context, const uint8* DataPtr, const int64 DataNum, int64& OutSize)
+	{
+		if (DataNum < 1)
+		{
+			return false;
+		}
+
+		const uint8 Type = DataPtr[0] & 0x03;
+		const uint8 SizeFormat = (DataPtr[0] >> 2) & 0x03;
+
+		// raw or rle
+		if (Type <= 1)
+		{
+			int64 HeaderSize = 1;
+			int64 RegeneratedSize = DataPtr[0] >> 3;
+			if (SizeFormat == 1)
+			{
+				HeaderSize = 2;
+			}
+			else if (SizeFormat == 3)
+			{
+				HeaderSize = 3;
+			}
+
+			if (HeaderSize > DataNum)
+			{
+				return false;
+			}
+
+			if (SizeFormat == 1)
+			{
+				RegeneratedSize = (DataPtr[0] >> 4) + (DataPtr[1] << 4);
+			}
+			else if (SizeFormat == 3)
+			{
+				RegeneratedSize = (DataPtr[0] >> 4) + (DataPtr[1] << 4) + (DataPtr[2] << 12);
+			}
+
+			if (RegeneratedSize > ZstdMaxBlockSize)
+			{
+				return false;
+			}
+
+			Context.Literals.SetNumUninitialized(RegeneratedSize);
+
+			if (Type == 0)
+			{
+				if (HeaderSize + RegeneratedSize > DataNum)
+				{
+					return false;
+				}
+				FMemory::Memcpy(Context.Literals.GetData(), DataPtr + HeaderSize, RegeneratedSize);
+				OutSize = HeaderSize + RegeneratedSize;
+			}
+			else
+			{
+				if (HeaderSize + 1 > DataNum)
+				{
+					return false;
+				}
+				FMemory::Memset(Context.Literals.GetData(), DataPtr[HeaderSize], RegeneratedSize);
+				OutSize = HeaderSize + 1;
+			}
+
+			return true;
+		}
+
+		// huffman compressed (Type 3 reuses the previous table)
+		const int32 HeaderSize = SizeFormat <= 1 ? 3 : SizeFormat + 2;
+		const int32 SizeBits = SizeFormat <= 1 ? 10 : (SizeFormat == 2 ? 14 : 18);
+		if (HeaderSize > DataNum)
+		{
+			return false;
+		}
+
+		uint64 Header = 0;
+		for (int32 HeaderIndex = 0; HeaderIndex < HeaderSize; HeaderIndex++)
+		{
+			Header |= static_cast<uint64>(DataPtr[HeaderIndex]) << (HeaderIndex * 8);
+		}
+
+		const int64 RegeneratedSize = (Header >> 4) & ((1 << SizeBits) - 1);
+		const int64 CompressedSize = (Header >> (4 + SizeBits)) & ((1 << SizeBits) - 1);
+		if (RegeneratedSize > ZstdMaxBlockSize || HeaderSize + CompressedSize > DataNum)
+		{
+			return false;
+		}
+
+		const uint8* Streams = DataPtr + HeaderSize;
+		int64 StreamsSize = CompressedSize;
+
+		if (Type == 2)
+		{
+			int64 TableSize = 0;
+			if (!ReadZstdHuffmanTable(Streams, StreamsSize, Context.Huffman, TableSize))
+			{
+				return false;
+			}
+			Streams += TableSize;
+			StreamsSize -= TableSize;
+		}
+		else if (Context.Huffman.MaxBits == 0)
+		{
+			return false;
+		}
+
+		Context.Literals.SetNumUninitialized(RegeneratedSize);
+
+		if (SizeFormat == 0)
+		{
+			if (!DecodeZstdHuffmanStream(Context.Huffman, Streams, StreamsSize, Context.Literals.GetData(), RegeneratedSize))
+			{
+				return false;
+			}
+		}
+		else
+		{
+			if (StreamsSize < 6)
+			{
+				return false;
+			}
+
+			int64 StreamSizes[4];
+			StreamSizes[0] = Streams[0] | (Streams[1] << 8);
+			StreamSizes[1] = Streams[2] | (Streams[3] << 8);
+			StreamSizes[2] = Streams[4] | (Streams[5] << 8);
+			StreamSizes[3] = StreamsSize - 6 - StreamSizes[0] - StreamSizes[1] - StreamSizes[2];
+
+			const int64 SegmentSize = (RegeneratedSize + 3) / 4;
+			if (StreamSizes[3] <= 0 || SegmentSize * 3 > RegeneratedSize)
+			{
+				return false;
+			}
+
+			const uint8* Stream = Streams + 6;
+			for (int32 StreamIndex = 0; StreamIndex < 4; StreamIndex++)
+			{
+				const int64 SegmentOffset = SegmentSize * StreamIndex;
+				const int64 SegmentNum = StreamIndex < 3 ? SegmentSize : RegeneratedSize - SegmentOffset;
+				if (!DecodeZstdHuffmanStream(Context.Huffman, Stream, StreamSizes[StreamIndex], Context.Literals.GetData() + SegmentOffset, SegmentNum))
+				{
+					return false;
+				}
+				Stream += StreamSizes[StreamIndex];
+			}
+		}
+
+		OutSize = HeaderSize + CompressedSize;
+		return true;
+	}
+
+	static const FZstdFseTable& GetZstdDefaultTable(const int16* Distribution)
+	{
+		static const FZstdFseTable LiteralsLengths = []() { FZstdFseTable Table; BuildZstdFseTable(ZstdLiteralsLengthDefaultDistribution, 36, 6, Table); return Table; }();
+		static const FZstdFseTable MatchLengths = []() { FZstdFseTable Table; BuildZstdFseTable(ZstdMatchLengthDefaultDistribution, 53, 6, Table); return Table; }();
+		static const FZstdFseTable Offsets = []() { FZstdFseTable Table; BuildZstdFseTable(ZstdOffsetDefaultDistribution, 29, 5, Table); return Table; }();
+
+		if (Distribution == ZstdLiteralsLengthDefaultDistribution)
+		{
+			return LiteralsLengths;
+		}
+
+		if (Distribution == ZstdMatchLengthDefaultDistribution)
+		{
+			return MatchLengths;
+		}
+
+		return Offsets;
+	}
+
+	static bool ReadZstdSequenceTable(const uint8 Mode, const uint8*& Ptr, const uint8* End, const int16* DefaultDistribution, const int32 MaxSymbol, const int32 MaxAccuracyLog, FZstdFseTable& Table)
+	{
+		// predefined
+		if (Mode == 0)
+		{
+			Table = GetZstdDefaultTable(DefaultDistribution);
+			return true;
+		}
+
+		// rle
+		if (Mode == 1)
+		{
+			if (Ptr >= End || *Ptr > MaxSymbol)
+			{
+				return false;
+			}
+			Table.AccuracyLog = 0;
+			Table.Entries.SetNumUninitialized(1);
+			Table.Entries[0].Symbol = *Ptr++;
+			Table.Entries[0].NumBits = 0;
+			Table.Entries[0].BaseLine = 0;
+			return true;
+		}
+
+		// fse compressed
+		if (Mode == 2)
+		{
+			int64 TableSize = 0;
+			if (!ReadZstdFseTable(Ptr, End - Ptr, MaxSymbol, MaxAccuracyLog, Table, TableSize))
+			{
+				return false;
+			}
+			Ptr += TableSize;
+			return true;
+		}
+
+		// repeat the table of the previous block
+		return Table.Entries.Num() > 0;
+	}
+
+	static bool DecodeZstdCompressedBlock(FZstdFrameContext& Context, const uint8* DataPtr, const int64 DataNum, TArray64<uint8>& Output)
+	{
+		int64 LiteralsSize = 0;
+		if (!DecodeZstdLiterals(Context, DataPtr, DataNum, LiteralsSize))
+		{
+			return false;
+		}
+
+		const uint8* Ptr = DataPtr + LiteralsSize;
+		const uint8* End = DataPtr + DataNum;
+		if (Ptr >= End)
+		{
+			return false;
+		}
+
+		int32 NumSequences = *Ptr++;
+		if (NumSequences == 255)
+		{
+			if (Ptr + 2 > End)
+			{
+				return false;
+			}
+			NumSequences = Ptr[0] + (Ptr[1] << 8) + 0x7F00;
+			Ptr += 2;
+		}
+		else if (NumSequences >= 128)
+		{
+			if (Ptr + 1 > End)
+			{
+				return false;
+			}
+			NumSequences = ((NumSequences - 128) << 8) + *Ptr++;
+		}
+
+		int64 LiteralsOffset = 0;
+
+		if (NumSequences > 0)
+		{
+			if (Ptr >= End)
+			{
+				return false;
+			}
+
+			const uint8 Modes = *Ptr++;
+			if ((Modes & 0x03) != 0)
+			{
+				return false;
+			}
+
+			if (!ReadZstdSequenceTable(Modes >> 6, Ptr, End, ZstdLiteralsLengthDefaultDistribution, 35, 9, Context.LiteralsLengths) ||
+				!ReadZstdSequenceTable((Modes >> 4) & 0x03, Ptr, End, ZstdOffsetDefaultDistribution, 31, 8, Context.Offsets) ||
+				!ReadZstdSequenceTable((Modes >> 2) & 0x03, Ptr, End, ZstdMatchLengthDefaultDistribution, 52, 9, Context.MatchLengths))
+			{
+				return false;
+			}
+
+			FZstdBackwardBitReader Reader;
+			if (!Reader.Init(Ptr, End - Ptr))
+			{
+				return false;
+			}
+
+			uint32 LiteralsLengthState = Reader.Read(Context.LiteralsLengths.AccuracyLog);
+			uint32 OffsetState = Reader.Read(Context.Offsets.AccuracyLog);
+			uint32 MatchLengthState = Reader.Read(Context.MatchLengths.AccuracyLog);
+
+			for (int32 SequenceIndex = 0; SequenceIndex < NumSequences; SequenceIndex++)
+			{
+				const FZstdFseEntry& LiteralsLengthEntry = Context.LiteralsLengths.Entries[LiteralsLengthState];
+				const FZstdFseEntry& OffsetEntry = Context.Offsets.Entries[OffsetState];
+				const FZstdFseEntry& MatchLengthEntry = Context.MatchLengths.Entries[MatchLengthState];
+
+				// offset, match length and literals length, in this order
+				const uint64 OffsetValue = (1ULL << OffsetEntry.Symbol) + Reader.Read(OffsetEntry.Symbol);
+				const int64 MatchLength = ZstdMatchLengthBaselines[MatchLengthEntry.Symbol] + Reader.Read(ZstdMatchLengthBits[MatchLengthEntry.Symbol]);
+				const int64 LiteralsLength = ZstdLiteralsLengthBaselines[LiteralsLengthEntry.Symbol] + Reader.Read(ZstdLiteralsLengthBits[LiteralsLengthEntry.Symbol]);
+
+				uint64 Offset = 0;
+				if (OffsetValue > 3)
+				{
+					Offset = OffsetValue - 3;
+					Context.RepeatedOffsets[2] = Context.RepeatedOffsets[1];
+					Context.RepeatedOffsets[1] = Context.RepeatedOffsets[0];
+					Context.RepeatedOffsets[0] = Offset;
+				}
+				else
+				{
+					const uint64 RepeatIndex = OffsetValue - 1 + (LiteralsLength == 0 ? 1 : 0);
+					if (RepeatIndex == 0)
+					{
+						Offset = Context.RepeatedOffsets[0];
+					}
+					else
+					{
+						Offset = RepeatIndex < 3 ? Context.RepeatedOffsets[RepeatIndex] : Context.RepeatedOffsets[0] - 1;
+						if (RepeatIndex > 1)
+						{
+							Context.RepeatedOffsets[2] = Context.RepeatedOffsets[1];
+						}
+						Context.RepeatedOffsets[1] = Context.RepeatedOffsets[0];
+						Context.RepeatedOffsets[0] = Offset;
+					}
+				}
+
+				// states are updated as literals length, match length and offset
+				if (SequenceIndex + 1 < NumSequences)
+				{
+					LiteralsLengthState = LiteralsLengthEntry.BaseLine + Reader.Read(LiteralsLengthEntry.NumBits);
+					MatchLengthState = MatchLengthEntry.BaseLine + Reader.Read(MatchLengthEntry.NumBits);
+					OffsetState = OffsetEntry.BaseLine + Reader.Read(OffsetEntry.NumBits);
+				}
+
+				if (LiteralsOffset + LiteralsLength > Context.Literals.Num())
+				{
+					return false;
+				}
+
+				Output.Append(Context.Literals.GetData() + LiteralsOffset, LiteralsLength);
+				LiteralsOffset += LiteralsLength;
+
+				if (Offset == 0 || Offset > static_cast<uint64>(Output.Num()))
+				{
+					return false;
+				}
+
+				const int64 MatchOffset = Output.Num() - Offset;
+				Output.AddUninitialized(MatchLength);
+				uint8* MatchDestination = Output.GetData() + Output.Num() - MatchLength;
+				const uint8* MatchSource = Output.GetData() + MatchOffset;
+				if (static_cast<int64>(Offset) >= MatchLength)
+				{
+					FMemory::Memcpy(MatchDestination, MatchSource, MatchLength);
+				}
+				else
+				{
+					// overlapping copy
+					for (int64 Index = 0; Index < MatchLength; Index++)
+					{
+						MatchDestination[Index] = MatchSource[Index];
+					}
+				}
+			}
+
+			if (Reader.BitPosition != 0)
+			{
+				return false;
+			}
+		}
+		else if (Ptr != End)
+		{
+			return false;
+		}
+
+		Output.Append(Context.Literals.GetData() + LiteralsOffset, Context.Literals.Num() - LiteralsOffset);
+
+		return true;
+	}
+
+	static bool ParseZstdFrameHeader(const uint8* DataPtr, const int64 DataNum, int64& OutHeaderSize, int64& OutContentSize, bool& bOutHasChecksum)
+	{
+		if (DataNum < 5 || ReadZstdUInt32(DataPtr) != 0xFD2FB528)
+		{
+			return false;
+		}
+
+		const uint8 Descriptor = DataPtr[4];
+		const uint8 ContentSizeFlag = Descriptor >> 6;
+		const bool bSingleSegment = ((Descriptor >> 5) & 0x01) != 0;
+		const uint8 DictionaryIdFlag = Descriptor & 0x03;
+		bOutHasChecksum = ((Descriptor >> 2) & 0x01) != 0;
+
+		// reserved bit
+		if (Descriptor & 0x08)
+		{
+			return false;
+		}
+
+		int64 Offset = 5 + (bSingleSegment ? 0 : 1);
+
+		const int32 DictionaryIdSize = DictionaryIdFlag == 3 ? 4 : DictionaryIdFlag;
+		if (Offset + DictionaryIdSize > DataNum)
+		{
+			return false;
+		}
+
+		uint32 DictionaryId = 0;
+		for (int32 Index = 0; Index < DictionaryIdSize; Index++)
+		{
+			DictionaryId |= static_cast<uint32>(DataPtr[Offset + Index]) << (Index * 8);
+		}
+
+		if (DictionaryId != 0)
+		{
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Zstd dictionaries are not supported."));
+			return false;
+		}
+
+		Offset += DictionaryIdSize;
+
+		const int32 ContentSizeSize = ContentSizeFlag == 0 ? (bSingleSegment ? 1 : 0) : (1 << ContentSizeFlag);
+		if (Offset + ContentSizeSize > DataNum)
+		{
+			return false;
+		}
+
+		OutContentSize = -1;
+		if (ContentSizeSize > 0)
+		{
+			uint64 ContentSize = 0;
+			for (int32 Index = 0; Index < ContentSizeSize; Index++)
+			{
+				ContentSize |= static_cast<uint64>(DataPtr[Offset + Index]) << (Index * 8);
+			}
+			OutContentSize = ContentSizeSize == 2 ? ContentSize + 256 : ContentSize;
+		}
+
+		OutHeaderSize = Offset + ContentSizeSize;
+		return true;
+	}
+
+	// MaxOutputNum bounds frames without a content size (like the expected size of inflated zip entries)
+	static bool DecodeZstdFrame(const uint8* DataPtr, const int64 DataNum, TArray64<uint8>& Output, const int64 MaxOutputNum)
+	{
+		int64 HeaderSize = 0;
+		int64 ContentSize = 0;
+		bool bHasChecksum = false;
+		if (!ParseZstdFrameHeader(DataPtr, DataNum, HeaderSize, ContentSize, bHasChecksum))
+		{
+			return false;
+		}
+
+		if (ContentSize > MaxOutputNum)
+		{
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Zstd frame content size %lld exceeds the limit of %lld bytes."), ContentSize, MaxOutputNum);
+			return false;
+		}
+
+		if (ContentSize > 0)
+		{
+			// every block takes at least 4 bytes (header + rle byte) and generates at most 128k
+			if (ContentSize / ZstdMaxBlockSize > DataNum / 4 + 1)
+			{
+				return false;
+			}
+
+			// the header is just an hint, reserve for a common ratio and let the output grow from there
+			Output.Reserve(Output.Num() + FMath::Min<int64>(ContentSize, DataNum * ZstdReserveRatio));
+		}
+		const int64 OutputBase = Output.Num();
+
+		FZstdFrameContext Context;
+
+		const uint8* Ptr = DataPtr + HeaderSize;
+		const uint8* End = DataPtr + DataNum;
+		bool bLastBlock = false;
+		while (!bLastBlock)
+		{
+			if (Ptr + 3 > End)
+			{
+				return false;
+			}
+
+			const uint32 BlockHeader = Ptr[0] | (Ptr[1] << 8) | (Ptr[2] << 16);
+			Ptr += 3;
+
+			bLastBlock = (BlockHeader & 0x01) != 0;
+			const uint8 BlockType = (BlockHeader >> 1) & 0x03;
+			const int64 BlockSize = BlockHeader >> 3;
+
+			if (BlockSize > ZstdMaxBlockSize)
+			{
+				return false;
+			}
+
+			// raw and rle sizes are known upfront, compressed blocks are checked after decoding (they overshoot by at most a block)
+			if (BlockType != 2 && BlockSize > MaxOutputNum - (Output.Num() - OutputBase))
+			{
+				UE_LOG(LogGLTFRuntime, Error, TEXT("Zstd frame exceeds the limit of %lld bytes."), MaxOutputNum);
+				return false;
+			}
+
+			// raw
+			if (BlockType == 0)
+			{
+				if (BlockSize > End - Ptr)
+				{
+					return false;
+				}
+				Output.Append(Ptr, BlockSize);
+				Ptr += BlockSize;
+			}
+			// rle
+			else if (BlockType == 1)
+			{
+				if (Ptr >= End)
+				{
+					return false;
+				}
+				const int64 OutputOffset = Output.Num();
+				Output.AddUninitialized(BlockSize);
+				FMemory::Memset(Output.GetData() + OutputOffset, *Ptr, BlockSize);
+				Ptr++;
+			}
+			else if (BlockType == 2)
+			{
+				if (BlockSize > End - Ptr || !DecodeZstdCompressedBlock(Context, Ptr, BlockSize, Output))
+				{
+					return false;
+				}
+				if (Output.Num() - OutputBase > MaxOutputNum)
+				{
+					UE_LOG(LogGLTFRuntime, Error, TEXT("Zstd frame exceeds the limit of %lld bytes."), MaxOutputNum);
+					return false;
+				}
+				Ptr += BlockSize;
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+		return ContentSize < 0 || Output.Num() - OutputBase == ContentSize;
+	}
+
+	// frames (and skippable frames) can be located by just walking the block headers
+	static bool GetZstdFrames(const uint8* DataPtr, const int64 DataNum, TArray<TPair<int64, int64>>& OutFrames)
+	{
+		int64 Offset = 0;
+		while (Offset < DataNum)
+		{
+			if (DataNum - Offset < 8)
+			{
+				return false;
+			}
+
+			const uint32 Magic = ReadZstdUInt32(DataPtr + Offset);
+			if ((Magic & 0xFFFFFFF0) == 0x184D2A50)
+			{
+				const int64 SkippableSize = ReadZstdUInt32(DataPtr + Offset + 4);
+				if (SkippableSize > DataNum - Offset - 8)
+				{
+					return false;
+				}
+				Offset += 8 + SkippableSize;
+				continue;
+			}
+
+			int64 HeaderSize = 0;
+			int64 ContentSize = 0;
+			bool bHasChecksum = false;
+			if (!ParseZstdFrameHeader(DataPtr + Offset, DataNum - Offset, HeaderSize, ContentSize, bHasChecksum))
+			{
+				return false;
+			}
+
+			int64 FrameEnd = Offset + HeaderSize;
+			bool bLastBlock = false;
+			while (!bLastBlock)
+			{
+				if (FrameEnd + 3 > DataNum)
+				{
+					return false;
+				}
+
+				const uint32 BlockHeader = DataPtr[FrameEnd] | (DataPtr[FrameEnd + 1] << 8) | (DataPtr[FrameEnd + 2] << 16);
+				bLastBlock = (BlockHeader & 0x01) != 0;
+				FrameEnd += 3 + (((BlockHeader >> 1) & 0x03) == 1 ? 1 : (BlockHeader >> 3));
+			}
+
+			// the content checksum is not verified (like gzip crc and LZ4 checksums)
+			FrameEnd += bHasChecksum ? 4 : 0;
+			if (FrameEnd > DataNum)
+			{
+				return false;
+			}
+
+			OutFrames.Add(TPair<int64, int64>(Offset, FrameEnd - Offset));
+			Offset = FrameEnd;
+		}
+
+		return OutFrames.Num() > 0;
+	}
+}
+
+bool FglTFRuntimeParser::DecompressZstd(const uint8* DataPtr, const int64 DataNum, TArray64<uint8>& UncompressedData, const int64 MaxUncompressedSize)
+{
+	SCOPED_NAMED_EVENT(FglTFRuntimeParser_DecompressZstd, FColor::Magenta);
+
+	TArray<TPair<int64, int64>> ZstdFrames;
+	if (!glTFRuntime::GetZstdFrames(DataPtr, DataNum, ZstdFrames))
+	{
+		UE_LOG(LogGLTFRuntime, Error, TEXT("Invalid Zstd frames."));
+		return false;
+	}
+
+	if (ZstdFrames.Num() == 1)
+	{
+		if (!glTFRuntime::DecodeZstdFrame(DataPtr + ZstdFrames[0].Key, ZstdFrames[0].Value, UncompressedData, MaxUncompressedSize))
+		{
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Zstd decompression error."));
+			return false;
+		}
+		return true;
+	}
+
+	// blocks share history and entropy tables, but frames are independent so they can be decompressed in parallel
+	TArray<TPair<TArray64<uint8>, bool>> FramesStates;
+	FramesStates.AddDefaulted(ZstdFrames.Num());
+
+	ParallelFor(ZstdFrames.Num(), [&](const int32 FrameIndex)
+		{
+			TPair<TArray64<uint8>, bool>& FrameState = FramesStates[FrameIndex];
+			FrameState.Value = glTFRuntime::DecodeZstdFrame(DataPtr + ZstdFrames[FrameIndex].Key, ZstdFrames[FrameIndex].Value, FrameState.Key, MaxUncompressedSize);
+		});
+
+	int64 UncompressedSize = 0;
+	for (int32 FrameIndex = 0; FrameIndex < FramesStates.Num(); FrameIndex++)
+	{
+		if (!FramesStates[FrameIndex].Value)
+		{
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Zstd parallel decompression error @Frame %d"), FrameIndex);
+			return false;
+		}
+		UncompressedSize += FramesStates[FrameIndex].Key.Num();
+	}
+
+	// every frame is bounded on its own, the limit applies to the whole output too
+	if (UncompressedSize > MaxUncompressedSize)
+	{
+		UE_LOG(LogGLTFRuntime, Error, TEXT("Zstd frames exceed the limit of %lld bytes."), MaxUncompressedSize);
+		return false;
+	}
+
+	UncompressedData.Reserve(UncompressedData.Num() + UncompressedSize);
+	for (const TPair<TArray64<uint8>, bool>& FrameState : FramesStates)
+	{
+		UncompressedData.Append(FrameState.Key);
+	}
+
+	return true;
+}
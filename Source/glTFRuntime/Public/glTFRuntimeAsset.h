@@ -197,6 +197,8 @@ public:
 	FORCEINLINE bool LoadFromData(const TArray<uint8>& Data, const FglTFRuntimeConfig& LoaderConfig) { return LoadFromData(Data.GetData(), Data.Num(), LoaderConfig); }
 	FORCEINLINE bool LoadFromData(const TArray64<uint8>& Data, const FglTFRuntimeConfig& LoaderConfig) { return LoadFromData(Data.GetData(), Data.Num(), LoaderConfig); }
 
+	bool LoadFromFArchive(TSharedRef<FArchive> Archive, const FglTFRuntimeConfig& LoaderConfig);
+
 	bool SetParser(TSharedRef<FglTFRuntimeParser> InParser);
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
@@ -366,6 +368,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "glTFRuntime")
 	void ClearCache();
 
+	// releases the raw and decoded binary data (reloaded when required), returns the released bytes
+	UFUNCTION(BlueprintCallable, Category = "glTFRuntime")
+	int64 TrimBuffers();
+
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "glTFRuntime")
 	bool IsArchive() const;
 
@@ -378,6 +384,17 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "glTFRuntime")
 	TArray<FString> GetErrors() const;
 
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "glTFRuntime")
+	FglTFRuntimeBuffersIOStats GetBuffersIOStats() const;
+
+	// the view references the asset buffers without copying them (see FglTFRuntimeAccessorView)
+	UFUNCTION(BlueprintCallable, Category = "glTFRuntime")
+	bool GetAccessorView(const int32 AccessorIndex, FglTFRuntimeAccessorView& AccessorView);
+
+	// AttributeName is the glTF attribute (POSITION, NORMAL, TEXCOORD_0...) or "indices"
+	UFUNCTION(BlueprintCallable, Category = "glTFRuntime")
+	bool GetMeshPrimitiveAccessorView(const int32 MeshIndex, const int32 PrimitiveIndex, const FString& AttributeName, FglTFRuntimeAccessorView& AccessorView);
+
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "glTFRuntime")
 	bool MeshHasMorphTargets(const int32 MeshIndex) const;
 
@@ -0,0 +1,70 @@
+// Copyright 2020-2024, Roberto De Ioris.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IAsyncReadFileHandle;
+class IAsyncReadRequest;
+
+/*
+* Reads whole files with the platform async I/O, keeping at most MaxInFlight requests alive
+* and at most MaxResidentBytes of started but not yet consumed files in memory.
+* Each file can be consumed (waiting for it if required) as soon as its read completes,
+* so the decoding of the first files overlaps with the reading of the others.
+* All of the methods are thread safe.
+*/
+class GLTFRUNTIME_API FglTFRuntimeAsyncFileReader : public TSharedFromThis<FglTFRuntimeAsyncFileReader, ESPMode::ThreadSafe>
+{
+public:
+	FglTFRuntimeAsyncFileReader(const int32 InMaxInFlight, const int64 InMaxResidentBytes);
+	~FglTFRuntimeAsyncFileReader();
+
+	void Enqueue(const FString& Filename);
+
+	// issue the queued reads up to the in-flight and resident bytes limits
+	void StartPending();
+
+	// drop the queued and the not yet consumed reads (waiting for the in-flight ones)
+	void Reset();
+
+	// returns false if the file was not enqueued (or already consumed) or the read failed, the caller is expected to fallback to a sync read
+	bool Consume(const FString& Filename, TArray64<uint8>& OutData);
+
+	int64 GetBytesRead() const;
+	int64 GetResidentBytes() const;
+
+protected:
+	struct FFileRead
+	{
+		FString Filename;
+		IAsyncReadFileHandle* Handle;
+		IAsyncReadRequest* Request;
+		TArray64<uint8> Data;
+		int64 FileSize;
+		bool bStarted;
+		bool bSuccess;
+
+		FFileRead()
+		{
+			Handle = nullptr;
+			Request = nullptr;
+			FileSize = -1;
+			bStarted = false;
+			bSuccess = false;
+		}
+	};
+
+	void StartRead(TSharedRef<FFileRead, ESPMode::ThreadSafe> FileRead);
+	void OnReadCompleted(TSharedRef<FFileRead, ESPMode::ThreadSafe> FileRead, const bool bSuccess);
+	static void ReleaseRead(FFileRead& FileRead);
+
+	mutable FCriticalSection Lock;
+	TMap<FString, TSharedRef<FFileRead, ESPMode::ThreadSafe>> Reads;
+	TArray<TSharedRef<FFileRead, ESPMode::ThreadSafe>> Queue;
+	int32 MaxInFlight;
+	int32 InFlight;
+	int64 MaxResidentBytes;
+	int64 ResidentBytes;
+	int64 BytesRead;
+};
@@ -0,0 +1,108 @@
+// Copyright 2020-2024, Roberto De Ioris.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "glTFRuntimeDownloadCache.generated.h"
+
+USTRUCT(BlueprintType)
+struct FglTFRuntimeDownloadCacheStats
+{
+	GENERATED_BODY()
+
+	// requests served by the cache (revalidated or used on error)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	int64 Hits;
+
+	// requests that required a full download
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	int64 Misses;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	int64 EvictedBytes;
+
+	// entries discarded because their content did not match the hash
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	int64 CorruptedEntries;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	int64 TotalBytes;
+
+	FglTFRuntimeDownloadCacheStats()
+	{
+		Hits = 0;
+		Misses = 0;
+		EvictedBytes = 0;
+		CorruptedEntries = 0;
+		TotalBytes = 0;
+	}
+};
+
+/*
+* Downloads cache keyed by content hash: identical content reached by different urls is stored once.
+* Files are written atomically (temporary file + rename) and verified against their SHA1 when read.
+* The least recently used contents are evicted when the cache exceeds its size.
+* All of the methods are thread safe.
+*/
+class GLTFRUNTIME_API FglTFRuntimeDownloadCache
+{
+public:
+	// one instance per directory
+	static TSharedRef<FglTFRuntimeDownloadCache, ESPMode::ThreadSafe> Get(const FString& CacheDirectory);
+
+	// called at module shutdown
+	static void FlushAll();
+
+	void SetMaxSize(const int64 InMaxSize);
+
+	// validators for revalidating a cached url (If-None-Match/If-Modified-Since)
+	bool GetValidators(const FString& Url, FString& ETag, FString& LastModified) const;
+
+	// returns false if the url is not cached or its content is corrupted (the entry is dropped)
+	bool Load(const FString& Url, TArray64<uint8>& OutData);
+
+	void Store(const FString& Url, const uint8* DataPtr, const int64 DataNum, const FString& ETag, const FString& LastModified);
+
+	// writes the pending access order changes to the index
+	void Flush();
+
+	FglTFRuntimeDownloadCacheStats GetStats() const;
+
+	FglTFRuntimeDownloadCache(const FString& InCacheDirectory);
+
+protected:
+	struct FUrlEntry
+	{
+		FString Hash;
+		FString ETag;
+		FString LastModified;
+	};
+
+	struct FContentEntry
+	{
+		int64 Size;
+		int64 LastAccess;
+	};
+
+	static FString HashContent(const uint8* DataPtr, const int64 DataNum);
+	FString GetContentFilename(const FString& Hash) const;
+
+	// access order changes are written at most once every IndexSaveInterval seconds
+	static constexpr double IndexSaveInterval = 30.0;
+
+	void LoadIndex();
+	void SaveIndex(const bool bForce);
+	void RemoveContent(const FString& Hash);
+	// returns true if some content has been evicted
+	bool Evict(const FString& KeepHash);
+
+	mutable FCriticalSection Lock;
+	FString CacheDirectory;
+	int64 MaxSize;
+	int64 AccessTick;
+	bool bIndexDirty;
+	double LastIndexSaveTime;
+	TMap<FString, FUrlEntry> Urls;
+	TMap<FString, FContentEntry> Contents;
+	FglTFRuntimeDownloadCacheStats Stats;
+};
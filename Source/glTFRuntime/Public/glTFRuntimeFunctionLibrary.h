@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "glTFRuntimeAsset.h"
+#include "glTFRuntimeDownloadCache.h"
 #include "Animation/BlendSpace1D.h"
 #include "glTFRuntimeFunctionLibrary.generated.h"
 
@@ -45,12 +46,30 @@ public:
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "glTF Load Asset from Url with Cache", AutoCreateRefTerm = "LoaderConfig, Headers"), Category = "glTFRuntime")
 	static void glTFLoadAssetFromUrlWithCache(const FString& Url, const FString& CacheFilename, const TMap<FString, FString>& Headers, const bool bUseCacheOnError, const FglTFRuntimeHttpResponse& Completed, const FglTFRuntimeConfig& LoaderConfig);
 
+	// cached contents are keyed by their hash and revalidated with ETag/Last-Modified, the least recently used ones are evicted when the cache exceeds CacheSizeMB
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "glTF Load Asset from Url with Content Cache", AutoCreateRefTerm = "LoaderConfig, Headers"), Category = "glTFRuntime")
+	static void glTFLoadAssetFromUrlWithContentCache(const FString& Url, const FString& CacheDirectory, const int32 CacheSizeMB, const TMap<FString, FString>& Headers, const bool bUseCacheOnError, const FglTFRuntimeHttpResponse& Completed, const FglTFRuntimeConfig& LoaderConfig);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "glTF Get Content Cache Stats"), Category = "glTFRuntime")
+	static FglTFRuntimeDownloadCacheStats glTFGetContentCacheStats(const FString& CacheDirectory);
+
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "glTF Load Asset from Url with Progress", AutoCreateRefTerm = "LoaderConfig, Headers"), Category = "glTFRuntime")
 	static void glTFLoadAssetFromUrlWithProgress(const FString& Url, const TMap<FString, FString>& Headers, FglTFRuntimeHttpResponse Completed, FglTFRuntimeHttpProgress Progress, const FglTFRuntimeConfig& LoaderConfig);
 
+	// Ready is triggered as soon as the glb json chunk is parsed, accessors can be loaded once their bytes are received
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "glTF Load Asset from Url Progressive", AutoCreateRefTerm = "LoaderConfig, Headers"), Category = "glTFRuntime")
+	static void glTFLoadAssetFromUrlProgressive(const FString& Url, const TMap<FString, FString>& Headers, FglTFRuntimeHttpResponse Ready, FglTFRuntimeHttpResponse Completed, FglTFRuntimeHttpProgress Progress, const FglTFRuntimeConfig& LoaderConfig);
+
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "glTF Load Asset from Data", AutoCreateRefTerm = "LoaderConfig"), Category = "glTFRuntime")
 	static UglTFRuntimeAsset* glTFLoadAssetFromData(const TArray<uint8>& Data, const FglTFRuntimeConfig& LoaderConfig);
 
+	// only the json (and the images headers) are read, for glb files just the json chunk is loaded from disk
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "glTF Probe Asset from Filename", AutoCreateRefTerm = "LoaderConfig"), Category = "glTFRuntime")
+	static bool glTFProbeAssetFromFilename(const FString& Filename, const bool bPathRelativeToContent, const FglTFRuntimeConfig& LoaderConfig, FglTFRuntimeProbeInfo& ProbeInfo);
+
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "glTF Probe Asset from Data", AutoCreateRefTerm = "LoaderConfig"), Category = "glTFRuntime")
+	static bool glTFProbeAssetFromData(const TArray<uint8>& Data, const FglTFRuntimeConfig& LoaderConfig, FglTFRuntimeProbeInfo& ProbeInfo);
+
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "glTF Load Asset from Clipboard", AutoCreateRefTerm = "LoaderConfig"), Category = "glTFRuntime")
 	static bool glTFLoadAssetFromClipboard(FglTFRuntimeHttpResponse Completed, FString& ClipboardContent, const FglTFRuntimeConfig& LoaderConfig);
 
@@ -8,6 +8,7 @@
 #include "Animation/PoseAsset.h"
 #include "Animation/Skeleton.h"
 #include "Async/Async.h"
+#include "Async/MappedFileHandle.h"
 #include "Async/ParallelFor.h"
 #include "Dom/JsonValue.h"
 #include "Dom/JsonObject.h"
@@ -20,10 +21,13 @@
 #include "Engine/TextureCube.h"
 #include "Engine/TextureMipDataProviderFactory.h"
 #include "Engine/VolumeTexture.h"
+#include "HAL/ThreadSafeCounter64.h"
+#include "Misc/ScopeLock.h"
 #include "Camera/CameraComponent.h"
 #include "Components/AudioComponent.h"
 #include "Components/LightComponent.h"
 #include "glTFRuntimeAnimationCurve.h"
+#include "glTFRuntimeAsyncFileReader.h"
 #include "ProceduralMeshComponent.h"
 #if WITH_EDITOR
 #include "Rendering/SkeletalMeshLODImporterData.h"
@@ -60,6 +64,123 @@ struct FglTFRuntimeBlob
 	}
 };
 
+/*
+* Compact per-section tables filled by the streaming json parser
+* (or decoded once from the json objects when the streaming parser is not used).
+* Each entry contains the hot fields of the related json object,
+* bValid is false when the entry requires the full json object.
+*/
+struct FglTFRuntimeAccessorEntry
+{
+	int64 BufferView;
+	int64 ByteOffset;
+	int64 ComponentType;
+	int64 Count;
+	int64 Elements;
+	bool bNormalized;
+	bool bHasNormalized;
+	bool bHasSparse;
+	bool bValid;
+
+	FglTFRuntimeAccessorEntry()
+	{
+		BufferView = INDEX_NONE;
+		ByteOffset = 0;
+		ComponentType = INDEX_NONE;
+		Count = INDEX_NONE;
+		Elements = 0;
+		bNormalized = false;
+		bHasNormalized = false;
+		bHasSparse = false;
+		bValid = true;
+	}
+};
+
+struct FglTFRuntimeBufferViewEntry
+{
+	int64 Buffer;
+	int64 ByteOffset;
+	int64 ByteLength;
+	int64 ByteStride;
+	bool bHasExtensions;
+	bool bValid;
+
+	FglTFRuntimeBufferViewEntry()
+	{
+		Buffer = INDEX_NONE;
+		ByteOffset = 0;
+		ByteLength = INDEX_NONE;
+		ByteStride = 0;
+		bHasExtensions = false;
+		bValid = true;
+	}
+};
+
+struct FglTFRuntimeNodeEntry
+{
+	int64 Mesh;
+	int64 Skin;
+	int64 Camera;
+	int32 NumChildren;
+	bool bValid;
+
+	FglTFRuntimeNodeEntry()
+	{
+		Mesh = INDEX_NONE;
+		Skin = INDEX_NONE;
+		Camera = INDEX_NONE;
+		NumChildren = 0;
+		bValid = true;
+	}
+};
+
+struct FglTFRuntimeMeshEntry
+{
+	int32 NumPrimitives;
+	bool bValid;
+
+	FglTFRuntimeMeshEntry()
+	{
+		NumPrimitives = 0;
+		bValid = true;
+	}
+};
+
+struct FglTFRuntimeMaterialEntry
+{
+	bool bHasExtensions;
+	bool bValid;
+
+	FglTFRuntimeMaterialEntry()
+	{
+		bHasExtensions = false;
+		bValid = true;
+	}
+};
+
+struct FglTFRuntimeJsonTables
+{
+	TArray<FglTFRuntimeAccessorEntry> Accessors;
+	TArray<FglTFRuntimeBufferViewEntry> BufferViews;
+	TArray<FglTFRuntimeNodeEntry> Nodes;
+	TArray<FglTFRuntimeMeshEntry> Meshes;
+	TArray<FglTFRuntimeMaterialEntry> Materials;
+};
+
+// root arrays indexed once by the parser
+enum class EglTFRuntimeJsonSection : uint8
+{
+	Accessors,
+	BufferViews,
+	Nodes,
+	Meshes,
+	Materials,
+	Textures,
+	Images,
+	Skins,
+	Num
+};
+
 UENUM()
 enum class EglTFRuntimeTransformBaseType : uint8
 {
@@ -193,6 +314,210 @@ struct FglTFRuntimeAESDecrypterHook
 	}
 };
 
+USTRUCT(BlueprintType)
+struct FglTFRuntimeBuffersIOStats
+{
+	GENERATED_BODY()
+
+	// bytes read from external buffer files (whole files, or ranges when loading lazily)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	int64 BytesRead;
+
+	// bytes of the distinct bufferViews ranges requested so far
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	int64 BytesReferenced;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	int64 RangesCacheHits;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	int64 RangesCacheMisses;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	int64 RangesCacheEvictedBytes;
+
+	FglTFRuntimeBuffersIOStats()
+	{
+		BytesRead = 0;
+		BytesReferenced = 0;
+		RangesCacheHits = 0;
+		RangesCacheMisses = 0;
+		RangesCacheEvictedBytes = 0;
+	}
+};
+
+USTRUCT(BlueprintType)
+struct FglTFRuntimeProbeInfo
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	int32 NumScenes;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	int32 NumNodes;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	int32 NumMeshes;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	int32 NumPrimitives;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	int32 NumMaterials;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	int32 NumTextures;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	int32 NumImages;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	int32 NumSkins;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	int32 NumAnimations;
+
+	// vertices and triangles of every mesh (instances are not counted)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	int64 NumVertices;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	int64 NumTriangles;
+
+	// built from the POSITION accessors min/max and the nodes transforms
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	FBox Bounds;
+
+	// zero for images whose header cannot be reached without loading an archive or for unknown formats
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	TArray<FIntPoint> ImagesSizes;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	TArray<FString> ExtensionsUsed;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	TArray<FString> ExtensionsRequired;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	int64 BuffersBytes;
+
+	// uncompressed RGBA8 textures with their mips
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	int64 EstimatedTexturesBytes;
+
+	// build vertices and 32bit indices
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	int64 EstimatedMeshesBytes;
+
+	FglTFRuntimeProbeInfo()
+	{
+		NumScenes = 0;
+		NumNodes = 0;
+		NumMeshes = 0;
+		NumPrimitives = 0;
+		NumMaterials = 0;
+		NumTextures = 0;
+		NumImages = 0;
+		NumSkins = 0;
+		NumAnimations = 0;
+		NumVertices = 0;
+		NumTriangles = 0;
+		Bounds = FBox(ForceInit);
+		BuffersBytes = 0;
+		EstimatedTexturesBytes = 0;
+		EstimatedMeshesBytes = 0;
+	}
+};
+
+class FglTFRuntimeParser;
+
+/*
+* Typed strided view of the raw (not normalized, not rebased) components of an accessor.
+* Plain accessors point directly to the parser buffers (the view co-owns the buffer, or the parser
+* for mapped files), decoded ones (sparse, compressed, lazily loaded) are packed in a buffer owned by the view.
+* Views survive both ClearCache() and TrimBuffers(), the released memory is reclaimed with the last view.
+*/
+USTRUCT(BlueprintType)
+struct FglTFRuntimeAccessorView
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	int64 Count;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	int64 Stride;
+
+	// components per element (1 for SCALAR, 3 for VEC3, 16 for MAT4...)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	int64 Elements;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	int64 ComponentType;
+
+	// bytes of a single element
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	int64 ElementSize;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime")
+	bool bNormalized;
+
+	const uint8* Data;
+
+	FglTFRuntimeAccessorView()
+	{
+		Count = 0;
+		Stride = 0;
+		Elements = 0;
+		ComponentType = 0;
+		ElementSize = 0;
+		bNormalized = false;
+		Data = nullptr;
+	}
+
+	bool IsValid() const
+	{
+		return Data != nullptr || Count == 0;
+	}
+
+	bool IsPacked() const
+	{
+		return Stride == ElementSize;
+	}
+
+	// T must match the storage type (like FVector3f for float VEC3 or uint16 for UNSIGNED_SHORT SCALAR)
+	template<typename T>
+	T GetValue(const int64 Index) const
+	{
+		check(sizeof(T) <= ElementSize && Index >= 0 && Index < Count);
+		T Value;
+		FMemory::Memcpy(&Value, Data + Index * Stride, sizeof(T));
+		return Value;
+	}
+
+	// empty if the elements are not packed or T has a different size
+	template<typename T>
+	TArrayView64<const T> GetArrayView() const
+	{
+		if (!IsPacked() || sizeof(T) != ElementSize)
+		{
+			return TArrayView64<const T>();
+		}
+		return TArrayView64<const T>(reinterpret_cast<const T*>(Data), Count);
+	}
+
+	void SetOwners(TSharedPtr<FglTFRuntimeParser> InParser, TSharedPtr<TArray64<uint8>, ESPMode::ThreadSafe> InOwnedData)
+	{
+		Parser = InParser;
+		OwnedData = InOwnedData;
+	}
+
+protected:
+	TSharedPtr<FglTFRuntimeParser> Parser;
+	TSharedPtr<TArray64<uint8>, ESPMode::ThreadSafe> OwnedData;
+};
+
 USTRUCT(BlueprintType)
 struct FglTFRuntimeConfig
 {
@@ -260,6 +585,45 @@ struct FglTFRuntimeConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	FglTFRuntimeAESDecrypterHook AESDecrypterHook;
 
+	// map the file in memory instead of reading it (binary chunk and accessors are read directly from the mapping)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bUseMappedFile;
+
+	// parse the json without building the whole DOM (accessors, bufferViews, nodes, meshes and materials are expanded on demand)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bUseStreamingJsonParser;
+
+	// parse the json directly from its UTF-8 bytes with the plugin scanner instead of converting it to a string for FJsonSerializer
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bUseUTF8JsonParser;
+
+	// external buffer files are not loaded as a whole, only the bufferViews ranges actually used are read
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bLoadExternalBuffersLazily;
+
+	// soft limit (in megabytes) of the ranges cache used by bLoadExternalBuffersLazily, enforced before loading each mesh
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int32 ExternalBuffersCacheSizeMB;
+
+	// url loaders decode and parse the http response in a background thread, only the completion callback runs in the game thread
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bParseHttpResponseAsync;
+
+	// external buffers and images of the meshes being loaded from .gltf files are read with async I/O (not for archives)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bPrefetchExternalFiles;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int32 MaxExternalFilesReadsInFlight;
+
+	// soft limit (in megabytes) of the prefetched files read but not yet consumed
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int32 MaxExternalFilesResidentMB;
+
+	// upper bound (in megabytes) of zstd compressed assets, 0 disables the check
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	int32 MaxZstdUncompressedSizeMB;
+
 	FglTFRuntimeConfig()
 	{
 		TransformBaseType = EglTFRuntimeTransformBaseType::Default;
@@ -274,6 +638,16 @@ struct FglTFRuntimeConfig
 		bAsBlob = false;
 		PrefixForUnnamedNodes = "node";
 		bNoArchive = false;
+		bUseMappedFile = false;
+		bUseStreamingJsonParser = false;
+		bUseUTF8JsonParser = false;
+		bLoadExternalBuffersLazily = false;
+		ExternalBuffersCacheSizeMB = 256;
+		bParseHttpResponseAsync = false;
+		bPrefetchExternalFiles = false;
+		MaxExternalFilesReadsInFlight = 8;
+		MaxExternalFilesResidentMB = 256;
+		MaxZstdUncompressedSizeMB = 4096;
 	}
 
 	FMatrix GetMatrix() const
@@ -842,6 +1216,14 @@ struct FglTFRuntimeStaticMeshConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	bool bUseHighPrecisionTangentBasis;
 
+	// build the bounds from the POSITION accessors min/max instead of scanning every vertex
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bTrustAccessorsBounds;
+
+	// compare the accessors bounds with the vertices (for debugging broken exporters)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bValidateAccessorsBounds;
+
 	FglTFRuntimeStaticMeshConfig()
 	{
 		CacheMode = EglTFRuntimeCacheMode::ReadWrite;
@@ -861,6 +1243,8 @@ struct FglTFRuntimeStaticMeshConfig
 		LODScreenSizeMultiplier = 2;
 		bBuildLumenCards = false;
 		bUseHighPrecisionTangentBasis = false;
+		bTrustAccessorsBounds = false;
+		bValidateAccessorsBounds = false;
 	}
 };
 
@@ -1320,6 +1704,14 @@ struct FglTFRuntimeSkeletalMeshConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
 	FglTFRuntimeMorphTargetRemapperHook MorphTargetRemapper;
 
+	// build the bounds from the POSITION accessors min/max instead of scanning every vertex
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bTrustAccessorsBounds;
+
+	// compare the accessors bounds with the vertices (for debugging broken exporters)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime")
+	bool bValidateAccessorsBounds;
+
 	FglTFRuntimeSkeletalMeshConfig()
 	{
 		CacheMode = EglTFRuntimeCacheMode::ReadWrite;
@@ -1347,6 +1739,8 @@ struct FglTFRuntimeSkeletalMeshConfig
 		bAutoGeneratePhysicsAssetConstraints = false;
 		bAllowCPUAccess = false;
 		bUseHighPrecisionTangentBasis = false;
+		bTrustAccessorsBounds = false;
+		bValidateAccessorsBounds = false;
 	}
 };
 
@@ -1580,6 +1974,8 @@ struct FglTFRuntimePrimitive
 	TMap<int32, FName> OverrideBoneMap;
 	TMap<int32, int32> BonesCache;
 	FString MaterialName;
+	// rebased POSITION accessor min/max, invalid when not available (code rewriting Positions must transform or Init() it)
+	FBox PositionsBounds;
 	int64 AdditionalBufferView;
 	int32 Mode;
 	bool bHasMaterial;
@@ -1592,6 +1988,7 @@ struct FglTFRuntimePrimitive
 	FglTFRuntimePrimitive()
 	{
 		AdditionalBufferView = INDEX_NONE;
+		PositionsBounds.Init();
 		bHasMaterial = false;
 		bHighPrecisionUVs = false;
 		bHighPrecisionWeights = false;
@@ -2181,6 +2578,158 @@ struct FglTFRuntimeMaterial
 	}
 };
 
+class GLTFRUNTIME_API FglTFRuntimeMappedFile
+{
+public:
+	static TSharedPtr<FglTFRuntimeMappedFile> Open(const FString& Filename);
+
+	const uint8* GetData() const
+	{
+		return Region ? Region->GetMappedPtr() : nullptr;
+	}
+
+	int64 Num() const
+	{
+		return Region ? Region->GetMappedSize() : 0;
+	}
+
+	bool Contains(const uint8* DataPtr, const int64 DataNum) const
+	{
+		return DataPtr >= GetData() && DataNum >= 0 && DataPtr + DataNum <= GetData() + Num();
+	}
+
+protected:
+	TUniquePtr<IMappedFileHandle> Handle;
+	TUniquePtr<IMappedFileRegion> Region;
+};
+
+/*
+* Random access to a block of bytes, GetRange() is thread safe.
+* Scratch is used as storage when the bytes are not directly addressable.
+*/
+class GLTFRUNTIME_API FglTFRuntimeDataSource
+{
+public:
+	virtual ~FglTFRuntimeDataSource() {}
+
+	virtual int64 Num() const = 0;
+
+	virtual const uint8* GetRange(const int64 Offset, const int64 Size, TArray64<uint8>& Scratch) const = 0;
+
+	// like GetRange(), but the bytes always end in OutData (copied when the source returned its own memory)
+	bool CopyRange(const int64 Offset, const int64 Size, TArray64<uint8>& OutData) const;
+
+	// heap memory owned by the data source
+	virtual int64 GetAllocatedSize() const { return 0; }
+};
+
+class GLTFRUNTIME_API FglTFRuntimeMemoryDataSource : public FglTFRuntimeDataSource
+{
+public:
+	FglTFRuntimeMemoryDataSource(const uint8* InDataPtr, const int64 InDataNum);
+	FglTFRuntimeMemoryDataSource(TArray64<uint8>&& InData);
+	FglTFRuntimeMemoryDataSource(TSharedRef<FglTFRuntimeMappedFile> InMappedFile, const uint8* InDataPtr, const int64 InDataNum);
+
+	int64 Num() const override
+	{
+		return DataNum;
+	}
+
+	const uint8* GetRange(const int64 Offset, const int64 Size, TArray64<uint8>& Scratch) const override;
+
+	int64 GetAllocatedSize() const override
+	{
+		return Data.GetAllocatedSize();
+	}
+
+protected:
+	TArray64<uint8> Data;
+	TSharedPtr<FglTFRuntimeMappedFile> MappedFile;
+	const uint8* DataPtr;
+	int64 DataNum;
+};
+
+class GLTFRUNTIME_API FglTFRuntimeFileDataSource : public FglTFRuntimeDataSource
+{
+public:
+	static TSharedPtr<FglTFRuntimeFileDataSource> Open(const FString& InFilename);
+	// only a range of the file (like the binary chunk of a glb)
+	static TSharedPtr<FglTFRuntimeFileDataSource> Open(const FString& InFilename, const int64 InOffset, const int64 InNum);
+
+	int64 Num() const override
+	{
+		return FileSize;
+	}
+
+	const uint8* GetRange(const int64 Offset, const int64 Size, TArray64<uint8>& Scratch) const override;
+
+protected:
+	FString Filename;
+	int64 FileOffset;
+	int64 FileSize;
+};
+
+/*
+* Random access to a seekable loading FArchive (custom pak readers, sockets, procedural generators...).
+* Reads are serialized by a lock shared with the sub ranges of the same FArchive.
+*/
+class GLTFRUNTIME_API FglTFRuntimeFArchiveDataSource : public FglTFRuntimeDataSource
+{
+public:
+	FglTFRuntimeFArchiveDataSource(TSharedRef<FArchive> InArchive);
+	FglTFRuntimeFArchiveDataSource(const FglTFRuntimeFArchiveDataSource& InParent, const int64 InOffset, const int64 InNum);
+
+	int64 Num() const override
+	{
+		return DataNum;
+	}
+
+	const uint8* GetRange(const int64 Offset, const int64 Size, TArray64<uint8>& Scratch) const override;
+
+protected:
+	TSharedRef<FArchive> Archive;
+	TSharedRef<FCriticalSection, ESPMode::ThreadSafe> Lock;
+	int64 DataOffset;
+	int64 DataNum;
+};
+
+/*
+* Fixed size buffer progressively filled by a single producer (like an http stream).
+* The first NumAvailable() bytes can be safely read while the buffer is being filled.
+*/
+class GLTFRUNTIME_API FglTFRuntimeStreamingBuffer
+{
+public:
+	FglTFRuntimeStreamingBuffer(const int64 InDataNum);
+
+	int64 Num() const
+	{
+		return Data.Num();
+	}
+
+	int64 NumAvailable() const
+	{
+		return AvailableBytes.GetValue();
+	}
+
+	bool IsComplete() const
+	{
+		return NumAvailable() == Num();
+	}
+
+	const uint8* GetData() const
+	{
+		return Data.GetData();
+	}
+
+	// returns the number of consumed bytes, data exceeding the buffer size is ignored
+	int64 Append(const uint8* InDataPtr, const int64 InDataNum);
+
+protected:
+	TArray64<uint8> Data;
+	FThreadSafeCounter64 AvailableBytes;
+};
+
 class GLTFRUNTIME_API FglTFRuntimeArchive
 {
 public:
@@ -2188,6 +2737,9 @@ public:
 
 	virtual bool GetFileContent(const FString& Filename, TArray64<uint8>& OutData) = 0;
 
+	// switches to an equivalent data source (like the file the archive was loaded from), returns the released bytes
+	virtual int64 ReplaceDataSource(TSharedRef<FglTFRuntimeDataSource> InDataSource) { return 0; }
+
 	bool FileExists(const FString& Filename) const;
 
 	FString GetFirstFilenameByExtension(const FString& Extension) const;
@@ -2198,31 +2750,56 @@ public:
 	}
 
 protected:
-	TMap<FString, uint32> OffsetsMap;
-	TMap<FString, TPair<uint32, uint32>> GlobalSizeMap;
+	TMap<FString, uint64> OffsetsMap;
+	TMap<FString, TPair<uint64, uint64>> GlobalSizeMap;
 };
 
 class GLTFRUNTIME_API FglTFRuntimeArchiveZip : public FglTFRuntimeArchive
 {
 public:
 	bool FromData(const uint8* DataPtr, const int64 DataNum);
+	bool FromDataSource(TSharedRef<FglTFRuntimeDataSource> InDataSource);
 
+	// can be called concurrently from multiple threads
 	bool GetFileContent(const FString& Filename, TArray64<uint8>& OutData) override;
 
+	int64 ReplaceDataSource(TSharedRef<FglTFRuntimeDataSource> InDataSource) override;
+
 	void SetPassword(const FString& EncryptionKey);
 
 	FglTFRuntimePasswordPromptHook PromptHook;
 	FglTFRuntimeAESDecrypterHook AESDecrypterHook;
 
 protected:
-	FArrayReader Data;
+	TSharedPtr<FglTFRuntimeDataSource> DataSource;
 	TArray<uint8> Password;
+	FCriticalSection PasswordLock;
+};
+
+/*
+* Only the entries index is built, content is read from the data source on demand.
+*/
+class GLTFRUNTIME_API FglTFRuntimeArchiveTar : public FglTFRuntimeArchive
+{
+public:
+	static bool IsTarHeader(const uint8* HeaderPtr);
+
+	bool FromDataSource(TSharedRef<FglTFRuntimeDataSource> InDataSource);
+
+	// can be called concurrently from multiple threads
+	bool GetFileContent(const FString& Filename, TArray64<uint8>& OutData) override;
+
+	int64 ReplaceDataSource(TSharedRef<FglTFRuntimeDataSource> InDataSource) override;
+
+protected:
+	TSharedPtr<FglTFRuntimeDataSource> DataSource;
 };
 
 class FglTFRuntimeArchiveMap : public FglTFRuntimeArchive
 {
 public:
-	void FromMap(const TMap<FString, TArray64<uint8>> InMap);
+	void FromMap(const TMap<FString, TArray64<uint8>>& InMap);
+	void FromMap(TMap<FString, TArray64<uint8>>&& InMap);
 
 	bool GetFileContent(const FString& Filename, TArray64<uint8>& OutData) override;
 
@@ -2340,6 +2917,37 @@ DECLARE_MULTICAST_DELEGATE_OneParam(FglTFRuntimeOnPreCreatedSkeletalMesh, FglTFR
 DECLARE_MULTICAST_DELEGATE_ThreeParams(FglTFRuntimeOnFinalizedStaticMesh, TSharedRef<FglTFRuntimeParser>, UStaticMesh*, const FglTFRuntimeStaticMeshConfig&);
 #endif
 
+/*
+* Marks an async load as running (TrimBuffers() refuses to release the buffers until it ends).
+* End() must be called before waiting for game thread callbacks, the destructor ends it otherwise.
+*/
+class FglTFRuntimeAsyncLoad
+{
+public:
+	FglTFRuntimeAsyncLoad(FThreadSafeCounter& InCounter) : Counter(InCounter)
+	{
+		bRunning = 1;
+		Counter.Increment();
+	}
+
+	~FglTFRuntimeAsyncLoad()
+	{
+		End();
+	}
+
+	void End()
+	{
+		if (FPlatformAtomics::InterlockedExchange(&bRunning, 0) == 1)
+		{
+			Counter.Decrement();
+		}
+	}
+
+protected:
+	FThreadSafeCounter& Counter;
+	int32 bRunning;
+};
+
 /**
  *
  */
@@ -2349,10 +2957,31 @@ public:
 	FglTFRuntimeParser(TSharedRef<FJsonObject> JsonObject, const FMatrix& InSceneBasis, float InSceneScale);
 
 	static TSharedPtr<FglTFRuntimeParser> FromFilename(const FString& Filename, const FglTFRuntimeConfig& LoaderConfig);
-	static TSharedPtr<FglTFRuntimeParser> FromBinary(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive = nullptr);
+	static TSharedPtr<FglTFRuntimeParser> FromBinary(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive = nullptr, TSharedPtr<FglTFRuntimeMappedFile> InMappedFile = nullptr);
 	static TSharedPtr<FglTFRuntimeParser> FromString(const FString& JsonData, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive = nullptr);
-	static TSharedPtr<FglTFRuntimeParser> FromData(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig);
-	static TSharedPtr<FglTFRuntimeParser> FromMap(const TMap<FString, TArray64<uint8>> Map, const FglTFRuntimeConfig& LoaderConfig);
+	// json text (or glb json chunk) encoded as UTF-8, parsed without converting it to a string
+	static TSharedPtr<FglTFRuntimeParser> FromUTF8(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive = nullptr, TSharedPtr<FglTFRuntimeMappedFile> InMappedFile = nullptr);
+	static TSharedPtr<FglTFRuntimeParser> FromJsonObject(TSharedRef<FJsonObject> JsonObject, FglTFRuntimeJsonTables&& JsonTables, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeArchive> InArchive);
+	static TSharedPtr<FglTFRuntimeParser> FromData(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, TSharedPtr<FglTFRuntimeMappedFile> InMappedFile = nullptr);
+	// binary glTF bufferViews are read on demand from the FArchive, everything else is fully read
+	static TSharedPtr<FglTFRuntimeParser> FromFArchive(TSharedRef<FArchive> InArchive, const FglTFRuntimeConfig& LoaderConfig);
+	static TSharedPtr<FglTFRuntimeArchiveZip> CreateZipArchive(TSharedRef<FglTFRuntimeDataSource> DataSource, const FglTFRuntimeConfig& LoaderConfig);
+	static TSharedPtr<FglTFRuntimeArchive> CreateArchive(TSharedRef<FglTFRuntimeDataSource> DataSource, const FglTFRuntimeConfig& LoaderConfig, bool& bIsArchive);
+	static TSharedPtr<FglTFRuntimeParser> FromMap(const TMap<FString, TArray64<uint8>>& Map, const FglTFRuntimeConfig& LoaderConfig);
+
+	// probes only read the json (and a few bytes for each image header), buffers and images are never loaded
+	static bool ProbeFromFilename(const FString& Filename, const FglTFRuntimeConfig& LoaderConfig, FglTFRuntimeProbeInfo& ProbeInfo);
+	static bool ProbeFromData(const uint8* DataPtr, int64 DataNum, const FglTFRuntimeConfig& LoaderConfig, FglTFRuntimeProbeInfo& ProbeInfo);
+	static bool GetImageSize(const uint8* DataPtr, const int64 DataNum, FIntPoint& ImageSize);
+
+	// frames without a content size can generate any amount of data, MaxUncompressedSize bounds the whole output
+	static bool DecompressZstd(const uint8* DataPtr, const int64 DataNum, TArray64<uint8>& UncompressedData, const int64 MaxUncompressedSize = MAX_int64);
+
+	static bool DecodeBase64(const TCHAR* Chars, int64 Len, TArray64<uint8>& Bytes);
+
+	static TSharedPtr<FJsonObject> ParseJsonStreaming(const FString& JsonData, FglTFRuntimeJsonTables& JsonTables);
+	// the scanner works on the UTF-8 bytes, only strings are converted to TCHAR
+	static TSharedPtr<FJsonObject> ParseJsonUTF8(const uint8* DataPtr, int64 DataNum, const bool bStreaming, FglTFRuntimeJsonTables& JsonTables, TSharedPtr<FglTFRuntimeMappedFile> InMappedFile = nullptr);
 
 	static TSharedPtr<FglTFRuntimeParser> FromRawDataAndArchive(const uint8* DataPtr, int64 DataNum, TSharedPtr<FglTFRuntimeArchive> InArchive, const FglTFRuntimeConfig& LoaderConfig);
 
@@ -2438,8 +3067,36 @@ public:
 
 	bool GetBuffer(const int32 BufferIndex, FglTFRuntimeBlob& Blob);
 	bool GetBufferView(const int32 BufferViewIndex, FglTFRuntimeBlob& Blob, int64& Stride);
+	bool GetBufferRange(const int32 BufferIndex, const int64 ByteOffset, const int64 ByteLength, FglTFRuntimeBlob& Blob);
 	bool GetAccessor(const int32 AccessorIndex, int64& ComponentType, int64& Stride, int64& Elements, int64& ElementSize, int64& Count, bool& bNormalized, FglTFRuntimeBlob& Blob, const FglTFRuntimeBlob* AdditionalBufferView);
 
+	// rebased box from the accessor min/max (dequantized when normalized)
+	bool GetAccessorBounds(const int32 AccessorIndex, FBox& Bounds);
+
+	bool GetAccessorView(const int32 AccessorIndex, FglTFRuntimeAccessorView& AccessorView);
+	// AttributeName can be "indices" for getting the indices accessor
+	bool GetMeshPrimitiveAccessorView(const int32 MeshIndex, const int32 PrimitiveIndex, const FString& AttributeName, FglTFRuntimeAccessorView& AccessorView);
+
+	bool Probe(FglTFRuntimeProbeInfo& ProbeInfo);
+	bool Probe(FglTFRuntimeProbeInfo& ProbeInfo, TFunctionRef<bool(const int64 ByteOffset, const int64 ByteLength, TArray64<uint8>& Bytes)> ReadBinaryChunkRange);
+
+	bool GetAccessorEntry(const int32 AccessorIndex, FglTFRuntimeAccessorEntry& AccessorEntry) const;
+	bool GetBufferViewEntry(const int32 BufferViewIndex, FglTFRuntimeBufferViewEntry& BufferViewEntry) const;
+
+	// decodes the hot fields of the sections not covered by the streaming parser
+	void FillJsonTables();
+
+	void SetJsonTables(FglTFRuntimeJsonTables&& InJsonTables)
+	{
+		JsonTables = MoveTemp(InJsonTables);
+		FillJsonTables();
+	}
+
+	const FglTFRuntimeJsonTables& GetJsonTables() const
+	{
+		return JsonTables;
+	}
+
 	bool GetAllNodes(TArray<FglTFRuntimeNode>& Nodes);
 
 	TArray<FString> GetCamerasNames();
@@ -2486,7 +3143,33 @@ public:
 
 	void SetBinaryBuffer(const TArray64<uint8>& InBinaryBuffer)
 	{
-		BinaryBuffer = InBinaryBuffer;
+		BinaryBuffer = MakeShared<TArray64<uint8>, ESPMode::ThreadSafe>(InBinaryBuffer);
+	}
+
+	void SetBinaryBuffer(const uint8* DataPtr, const int64 DataNum)
+	{
+		BinaryBuffer = MakeShared<TArray64<uint8>, ESPMode::ThreadSafe>();
+		BinaryBuffer->Append(DataPtr, DataNum);
+	}
+
+	// the binary chunk lives in the mapped file (no copies)
+	void SetMappedBinaryBuffer(TSharedRef<FglTFRuntimeMappedFile> InMappedFile, const uint8* DataPtr, const int64 DataNum)
+	{
+		MappedFile = InMappedFile;
+		MappedBinaryBuffer.Data = const_cast<uint8*>(DataPtr);
+		MappedBinaryBuffer.Num = DataNum;
+	}
+
+	// the binary chunk is read on demand (and cached like the lazy external buffers)
+	void SetBinaryChunkSource(TSharedRef<FglTFRuntimeDataSource> InBinaryChunkSource)
+	{
+		BinaryChunkSource = InBinaryChunkSource;
+	}
+
+	// the binary chunk is still being received, only the ranges already available can be accessed
+	void SetStreamingBinaryBuffer(TSharedRef<FglTFRuntimeStreamingBuffer> InStreamingBinaryBuffer)
+	{
+		StreamingBinaryBuffer = InStreamingBinaryBuffer;
 	}
 
 	bool LoadStaticMeshIntoProceduralMeshComponent(const int32 MeshIndex, UProceduralMeshComponent* ProceduralMeshComponent, const FglTFRuntimeProceduralMeshConfig& ProceduralMeshConfig);
@@ -2638,6 +3321,21 @@ public:
 
 	void ClearCache();
 
+	/*
+	* Releases the raw and decoded binary data (buffers, decompressed/sparse/de-interleaved accessors,
+	* lazily loaded ranges, in-memory archives loaded from files), returning the released bytes.
+	* Everything is transparently reloaded when required. Binary chunks that cannot be read again
+	* (like the ones from memory or from network) are kept.
+	* Nothing is released (and 0 is returned) while async loads are running.
+	*/
+	int64 TrimBuffers();
+
+	// to be captured by the async loaders lambdas
+	TSharedRef<FglTFRuntimeAsyncLoad, ESPMode::ThreadSafe> BeginAsyncLoad()
+	{
+		return MakeShared<FglTFRuntimeAsyncLoad, ESPMode::ThreadSafe>(AsyncLoadsCounter);
+	}
+
 	void MergePrimitivesByMaterial(TArray<FglTFRuntimePrimitive>& Primitives);
 
 	bool MeshHasMorphTargets(const int32 MeshIndex) const;
@@ -2665,10 +3363,45 @@ protected:
 	TMap<int32, UTexture2D*> TexturesCache;
 #endif
 
-	TMap<int32, TArray64<uint8>> BuffersCache;
+	// shared with the accessor views referencing them
+	TMap<int32, TSharedRef<TArray64<uint8>, ESPMode::ThreadSafe>> BuffersCache;
+	// decoded bufferViews are shared by concurrent async loads, entries are never replaced once added
+	FCriticalSection CompressedBufferViewsLock;
 	TMap<int32, TArray64<uint8>> CompressedBufferViewsCache;
 	TMap<int32, int64> CompressedBufferViewsStridesCache;
 
+	struct FglTFRuntimeBufferRange
+	{
+		TArray64<uint8> Data;
+		uint64 LastUse;
+	};
+
+	// (buffer, byteOffset, byteLength)
+	using FglTFRuntimeBufferRangeKey = TTuple<int32, int64, int64>;
+
+	bool bLoadExternalBuffersLazily;
+	int64 BufferRangesCacheMaxSize;
+	// nullptr for buffers that are not loaded lazily
+	TMap<int32, TSharedPtr<FglTFRuntimeDataSource>> LazyBuffersSources;
+	TSharedPtr<FglTFRuntimeDataSource> BinaryChunkSource;
+	// the original file ranges used by TrimBuffers()
+	TSharedPtr<FglTFRuntimeDataSource> BinaryChunkReloadSource;
+	TSharedPtr<FglTFRuntimeDataSource> ArchiveReloadSource;
+	FThreadSafeCounter AsyncLoadsCounter;
+	// guards the ranges cache, the lazy sources and the IO stats (async loads share them)
+	mutable FCriticalSection BufferRangesLock;
+	TMap<FglTFRuntimeBufferRangeKey, FglTFRuntimeBufferRange> BufferRangesCache;
+	int64 BufferRangesCacheSize;
+	uint64 BufferRangesCacheTick;
+	TSet<FglTFRuntimeBufferRangeKey> ReferencedBufferRanges;
+	FglTFRuntimeBuffersIOStats BuffersIOStats;
+
+	// external files read in the background, consumed by GetBuffer() and GetJsonObjectBytes()
+	TSharedPtr<FglTFRuntimeAsyncFileReader, ESPMode::ThreadSafe> AsyncFileReader;
+	void PrefetchExternalFiles(const int32 MaxReadsInFlight, const int64 MaxResidentBytes);
+	void PrefetchPrimitivesExternalFiles(const TArray<TSharedPtr<FJsonValue>>& JsonPrimitives, const TArray<int32>& AccessorIndices);
+	FString GetExternalFilePath(const FString& Uri) const;
+
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 4
 	TMap<TObjectPtr<UMaterialInterface>, FString> MaterialsNameCache;
 #else
@@ -2680,7 +3413,15 @@ protected:
 
 	TMap<TSharedRef<FJsonObject>, FglTFRuntimeMeshLOD> LODsCache;
 
-	TArray64<uint8> BinaryBuffer;
+	TSharedPtr<TArray64<uint8>, ESPMode::ThreadSafe> BinaryBuffer;
+	TSharedPtr<FglTFRuntimeMappedFile> MappedFile;
+	FglTFRuntimeBlob MappedBinaryBuffer;
+	TSharedPtr<FglTFRuntimeStreamingBuffer> StreamingBinaryBuffer;
+
+	FglTFRuntimeJsonTables JsonTables;
+	TArray<TSharedPtr<FJsonValue>> JsonSections[static_cast<int32>(EglTFRuntimeJsonSection::Num)];
+
+	void BuildJsonSections();
 
 	bool LoadMeshIntoMeshLOD(TSharedRef<FJsonObject> JsonMeshObject, FglTFRuntimeMeshLOD*& LOD, const FglTFRuntimeMaterialsConfig& MaterialsConfig);
 
@@ -2720,6 +3461,8 @@ public:
 	bool CheckJsonRootIndex(const FString FieldName, const int32 Index, TArray<TSharedRef<FJsonValue>>& JsonItems) const { return CheckJsonIndex(Root, FieldName, Index, JsonItems); }
 	TSharedPtr<FJsonObject> GetJsonObjectFromIndex(TSharedRef<FJsonObject> JsonObject, const FString& FieldName, const int32 Index) const;
 	TSharedPtr<FJsonObject> GetJsonObjectFromRootIndex(const FString& FieldName, const int32 Index) const { return GetJsonObjectFromIndex(Root, FieldName, Index); }
+	TSharedPtr<FJsonObject> GetJsonObjectFromRootIndex(const EglTFRuntimeJsonSection Section, const int32 Index) const;
+	int32 GetJsonSectionNum(const EglTFRuntimeJsonSection Section) const { return JsonSections[static_cast<int32>(Section)].Num(); }
 	TSharedPtr<FJsonObject> GetJsonObjectFromExtensionIndex(TSharedRef<FJsonObject> JsonObject, const FString& ExtensionName, const FString& FieldName, const int32 Index);
 	TSharedPtr<FJsonObject> GetJsonObjectFromRootExtensionIndex(const FString& ExtensionName, const FString& FieldName, const int32 Index) { return GetJsonObjectFromExtensionIndex(Root, ExtensionName, FieldName, Index); }
 	TArray<TSharedRef<FJsonObject>> GetJsonObjectArrayFromExtension(TSharedRef<FJsonObject> JsonObject, const FString& ExtensionName, const FString& FieldName);
@@ -2767,6 +3510,18 @@ protected:
 	bool CanWriteToCache(const EglTFRuntimeCacheMode CacheMode) { return CacheMode == EglTFRuntimeCacheMode::Write || CacheMode == EglTFRuntimeCacheMode::ReadWrite; }
 
 	bool DecompressMeshOptimizer(const FglTFRuntimeBlob& Blob, const int64 Stride, const int64 Elements, const FString& Mode, const FString& Filter, TArray64<uint8>& UncompressedBytes);
+	void DecompressMeshOptimizerBufferViews(const TArray<int32>& AccessorIndices);
+	void DeinterleaveAccessors(const TArray<int32>& AccessorIndices, TMap<int32, TArray64<uint8>>& DeinterleavedAccessors);
+
+	void GetPrimitivesAccessors(const TArray<TSharedPtr<FJsonValue>>& JsonPrimitives, TArray<int32>& AccessorIndices);
+
+	bool IsLazyBuffer(const int32 Index) const
+	{
+		return bLoadExternalBuffersLazily || (Index == 0 && BinaryChunkSource);
+	}
+	TSharedPtr<FglTFRuntimeDataSource> GetLazyBufferSource(const int32 Index);
+	void PrefetchBufferRanges(const TArray<int32>& AccessorIndices);
+	void TrimBufferRangesCache();
 
 	FMatrix SceneBasis;
 	float SceneScale;
@@ -2811,6 +3566,77 @@ public:
 		return FTransform(SceneBasis.Inverse() * M * SceneBasis);
 	}
 
+	static FORCEINLINE float NormalizeAccessorComponent(const float Value) { return Value; }
+	static FORCEINLINE float NormalizeAccessorComponent(const int8 Value) { return FMath::Max(((float)Value) / 127.f, -1.f); }
+	static FORCEINLINE float NormalizeAccessorComponent(const uint8 Value) { return ((float)Value) / 255.f; }
+	static FORCEINLINE float NormalizeAccessorComponent(const int16 Value) { return FMath::Max(((float)Value) / 32767.f, -1.f); }
+	static FORCEINLINE float NormalizeAccessorComponent(const uint16 Value) { return ((float)Value) / 65535.f; }
+
+	// decodes a contiguous range of elements, everything is known at compile time except the stride (NumElements == 0 means runtime Elements)
+	template<typename T, typename ComponentType, bool bNormalized, int32 NumElements, bool bScalar, typename Callback>
+	static void DecodeAccessorBatch(const uint8* Ptr, const int64 Stride, const int64 Elements, const int64 Count, T* Output, Callback& Filter)
+	{
+		const int64 NumComponents = NumElements > 0 ? NumElements : Elements;
+		for (int64 ElementIndex = 0; ElementIndex < Count; ElementIndex++)
+		{
+			const ComponentType* Components = reinterpret_cast<const ComponentType*>(Ptr + ElementIndex * Stride);
+			T Value;
+			if constexpr (bScalar)
+			{
+				Value = bNormalized ? NormalizeAccessorComponent(Components[0]) : (float)Components[0];
+			}
+			else
+			{
+				for (int64 ComponentIndex = 0; ComponentIndex < NumComponents; ComponentIndex++)
+				{
+					Value[ComponentIndex] = bNormalized ? NormalizeAccessorComponent(Components[ComponentIndex]) : (float)Components[ComponentIndex];
+				}
+			}
+			Output[ElementIndex] = Filter(Value);
+		}
+	}
+
+	template<typename T, typename ComponentType, int32 NumElements, bool bScalar, typename Callback>
+	static void DecodeAccessor(const FglTFRuntimeBlob& Blob, const int64 Stride, const int64 Elements, const int64 Count, const bool bNormalized, T* Output, Callback& Filter)
+	{
+		// batches amortize the scheduling cost and keep the inner loops free of indirect calls
+		constexpr int64 BatchSize = 4096;
+		const int64 NumBatches = (Count + BatchSize - 1) / BatchSize;
+		ParallelFor(NumBatches, [&](const int32 BatchIndex)
+			{
+				const int64 First = BatchIndex * BatchSize;
+				const int64 BatchCount = FMath::Min(BatchSize, Count - First);
+				if (bNormalized)
+				{
+					DecodeAccessorBatch<T, ComponentType, true, NumElements, bScalar>(Blob.Data + First * Stride, Stride, Elements, BatchCount, Output + First, Filter);
+				}
+				else
+				{
+					DecodeAccessorBatch<T, ComponentType, false, NumElements, bScalar>(Blob.Data + First * Stride, Stride, Elements, BatchCount, Output + First, Filter);
+				}
+			});
+	}
+
+	template<typename T, typename ComponentType, typename Callback>
+	static void DecodeAccessorElements(const FglTFRuntimeBlob& Blob, const int64 Stride, const int64 Elements, const int64 Count, const bool bNormalized, T* Output, Callback& Filter)
+	{
+		switch (Elements)
+		{
+		case(2):
+			DecodeAccessor<T, ComponentType, 2, false>(Blob, Stride, Elements, Count, bNormalized, Output, Filter);
+			break;
+		case(3):
+			DecodeAccessor<T, ComponentType, 3, false>(Blob, Stride, Elements, Count, bNormalized, Output, Filter);
+			break;
+		case(4):
+			DecodeAccessor<T, ComponentType, 4, false>(Blob, Stride, Elements, Count, bNormalized, Output, Filter);
+			break;
+		default:
+			DecodeAccessor<T, ComponentType, 0, false>(Blob, Stride, Elements, Count, bNormalized, Output, Filter);
+			break;
+		}
+	}
+
 	template<typename T, typename Callback>
 	bool BuildFromAccessorField(TSharedRef<FJsonObject> JsonObject, const FString& Name, TArray<T>& Data, const TArray<int64>& SupportedElements, const TArray<int64>& SupportedTypes, Callback Filter, const int64 AdditionalBufferView, const bool bDefaultNormalized, int64* ComponentTypePtr)
 	{
@@ -2844,69 +3670,24 @@ public:
 			*ComponentTypePtr = ComponentType;
 		}
 
-		auto ComponentFloat = [](const int64 Elements, const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				float* Ptr = (float*)&(Blob.Data[Index]);
-				for (int32 i = 0; i < Elements; i++)
-				{
-					Value[i] = Ptr[i];
-				}
-			};
-
-		auto ComponentByte = [](const int64 Elements, const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				int8* Ptr = (int8*)&(Blob.Data[Index]);
-				for (int32 i = 0; i < Elements; i++)
-				{
-					Value[i] = bNormalized ? FMath::Max(((float)Ptr[i]) / 127.f, -1.f) : Ptr[i];
-				}
-			};
-
-		auto ComponentUnsignedByte = [](const int64 Elements, const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				uint8* Ptr = (uint8*)&(Blob.Data[Index]);
-				for (int32 i = 0; i < Elements; i++)
-				{
-					Value[i] = bNormalized ? ((float)Ptr[i]) / 255.f : Ptr[i];
-				}
-			};
-
-		auto ComponentShort = [](const int64 Elements, const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				int16* Ptr = (int16*)&(Blob.Data[Index]);
-				for (int32 i = 0; i < Elements; i++)
-				{
-					Value[i] = bNormalized ? FMath::Max(((float)Ptr[i]) / 32767.f, -1.f) : Ptr[i];
-				}
-			};
-
-		auto ComponentUnsignedShort = [](const int64 Elements, const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				uint16* Ptr = (uint16*)&(Blob.Data[Index]);
-				for (int32 i = 0; i < Elements; i++)
-				{
-					Value[i] = bNormalized ? ((float)Ptr[i]) / 65535.f : Ptr[i];
-				}
-			};
-
-		TFunction<void(const int64 Elements, const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)> ComponentFunction = nullptr;
+		void (*DecodeFunction)(const FglTFRuntimeBlob& Blob, const int64 Stride, const int64 Elements, const int64 Count, const bool bNormalized, T* Output, Callback& Filter) = nullptr;
 
 		switch (ComponentType)
 		{
 		case(5126):// FLOAT
-			ComponentFunction = ComponentFloat;
+			DecodeFunction = &DecodeAccessorElements<T, float, Callback>;
 			break;
 		case(5120):// BYTE
-			ComponentFunction = ComponentByte;
+			DecodeFunction = &DecodeAccessorElements<T, int8, Callback>;
 			break;
 		case(5121):// UNSIGNED_BYTE
-			ComponentFunction = ComponentUnsignedByte;
+			DecodeFunction = &DecodeAccessorElements<T, uint8, Callback>;
 			break;
 		case(5122):// SHORT
-			ComponentFunction = ComponentShort;
+			DecodeFunction = &DecodeAccessorElements<T, int16, Callback>;
 			break;
 		case(5123):// UNSIGNED_SHORT
-			ComponentFunction = ComponentUnsignedShort;
+			DecodeFunction = &DecodeAccessorElements<T, uint16, Callback>;
 			break;
 		default:
 			UE_LOG(LogGLTFRuntime, Error, TEXT("Unsupported type %d"), ComponentType);
@@ -2914,13 +3695,7 @@ public:
 		}
 
 		Data.AddUninitialized(Count);
-		ParallelFor(Count, [&](const int64 ElementIndex)
-			{
-				int64 Index = ElementIndex * Stride;
-				T Value;
-				ComponentFunction(Elements, Index, Blob, Value, bNormalized);
-				Data[ElementIndex] = Filter(Value);
-			});
+		DecodeFunction(Blob, Stride, Elements, Count, bNormalized, Data.GetData(), Filter);
 
 		return true;
 	}
@@ -2958,54 +3733,24 @@ public:
 			*ComponentTypePtr = ComponentType;
 		}
 
-		auto ComponentFloat = [](const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				float* Ptr = (float*)&(Blob.Data[Index]);
-				Value = *Ptr;
-			};
-
-		auto ComponentByte = [](const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				int8* Ptr = (int8*)&(Blob.Data[Index]);
-				Value = bNormalized ? FMath::Max(((float)(*Ptr)) / 127.f, -1.f) : *Ptr;
-			};
-
-		auto ComponentUnsignedByte = [](const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				uint8* Ptr = (uint8*)&(Blob.Data[Index]);
-				Value = bNormalized ? ((float)(*Ptr)) / 255.f : *Ptr;
-			};
-
-		auto ComponentShort = [](const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				int16* Ptr = (int16*)&(Blob.Data[Index]);
-				Value = bNormalized ? FMath::Max(((float)(*Ptr)) / 32767.f, -1.f) : *Ptr;
-			};
-
-		auto ComponentUnsignedShort = [](const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)
-			{
-				uint16* Ptr = (uint16*)&(Blob.Data[Index]);
-				Value = bNormalized ? ((float)(*Ptr)) / 65535.f : *Ptr;
-			};
-
-		TFunction<void(const int64 Index, const FglTFRuntimeBlob& Blob, T& Value, const bool bNormalized)> ComponentFunction = nullptr;
+		void (*DecodeFunction)(const FglTFRuntimeBlob& Blob, const int64 Stride, const int64 Elements, const int64 Count, const bool bNormalized, T* Output, Callback& Filter) = nullptr;
 
 		switch (ComponentType)
 		{
 		case(5126):// FLOAT
-			ComponentFunction = ComponentFloat;
+			DecodeFunction = &DecodeAccessor<T, float, 0, true, Callback>;
 			break;
 		case(5120):// BYTE
-			ComponentFunction = ComponentByte;
+			DecodeFunction = &DecodeAccessor<T, int8, 0, true, Callback>;
 			break;
 		case(5121):// UNSIGNED_BYTE
-			ComponentFunction = ComponentUnsignedByte;
+			DecodeFunction = &DecodeAccessor<T, uint8, 0, true, Callback>;
 			break;
 		case(5122):// SHORT
-			ComponentFunction = ComponentShort;
+			DecodeFunction = &DecodeAccessor<T, int16, 0, true, Callback>;
 			break;
 		case(5123):// UNSIGNED_SHORT
-			ComponentFunction = ComponentUnsignedShort;
+			DecodeFunction = &DecodeAccessor<T, uint16, 0, true, Callback>;
 			break;
 		default:
 			UE_LOG(LogGLTFRuntime, Error, TEXT("Unsupported type %d"), ComponentType);
@@ -3013,13 +3758,7 @@ public:
 		}
 
 		Data.AddUninitialized(Count);
-		ParallelFor(Count, [&](const int64 ElementIndex)
-			{
-				int64 Index = ElementIndex * Stride;
-				T Value;
-				ComponentFunction(Index, Blob, Value, bNormalized);
-				Data[ElementIndex] = Filter(Value);
-			});
+		DecodeFunction(Blob, Stride, 1, Count, bNormalized, Data.GetData(), Filter);
 
 		return true;
 	}
@@ -3055,6 +3794,65 @@ public:
 		return true;
 	}
 
+	// parallel reduction of the bounds of NumPositions positions (GetPosition is called concurrently)
+	template<typename T>
+	static FBox GetPositionsBounds(const int32 NumPositions, T GetPosition)
+	{
+		constexpr int32 ChunkSize = 16384;
+		const int32 NumChunks = FMath::DivideAndRoundUp(NumPositions, ChunkSize);
+
+		TArray<FBox> ChunksBounds;
+		ChunksBounds.Init(FBox(ForceInit), NumChunks);
+
+		ParallelFor(NumChunks, [&](const int32 ChunkIndex)
+			{
+				const int32 End = FMath::Min(ChunkIndex * ChunkSize + ChunkSize, NumPositions);
+				FBox& ChunkBounds = ChunksBounds[ChunkIndex];
+				for (int32 PositionIndex = ChunkIndex * ChunkSize; PositionIndex < End; PositionIndex++)
+				{
+					ChunkBounds += GetPosition(PositionIndex);
+				}
+			});
+
+		FBox Bounds(ForceInit);
+		for (const FBox& ChunkBounds : ChunksBounds)
+		{
+			Bounds += ChunkBounds;
+		}
+		return Bounds;
+	}
+
+	// parallel reduction of the max distance from Origin
+	template<typename T>
+	static double GetPositionsRadius(const int32 NumPositions, const FVector& Origin, T GetPosition)
+	{
+		constexpr int32 ChunkSize = 16384;
+		const int32 NumChunks = FMath::DivideAndRoundUp(NumPositions, ChunkSize);
+
+		TArray<double> ChunksRadiusSquared;
+		ChunksRadiusSquared.AddZeroed(NumChunks);
+
+		ParallelFor(NumChunks, [&](const int32 ChunkIndex)
+			{
+				const int32 End = FMath::Min(ChunkIndex * ChunkSize + ChunkSize, NumPositions);
+				double& ChunkRadiusSquared = ChunksRadiusSquared[ChunkIndex];
+				for (int32 PositionIndex = ChunkIndex * ChunkSize; PositionIndex < End; PositionIndex++)
+				{
+					ChunkRadiusSquared = FMath::Max<double>(ChunkRadiusSquared, (GetPosition(PositionIndex) - Origin).SizeSquared());
+				}
+			});
+
+		double RadiusSquared = 0;
+		for (const double ChunkRadiusSquared : ChunksRadiusSquared)
+		{
+			RadiusSquared = FMath::Max(RadiusSquared, ChunkRadiusSquared);
+		}
+		return FMath::Sqrt(RadiusSquared);
+	}
+
+	// logs a warning when the vertices are not contained by the accessors bounds
+	bool ValidateAccessorsBounds(const FString& Context, const FBox& AccessorsBounds, const FBox& VerticesBounds) const;
+
 protected:
 
 	bool MergePrimitives(TArray<FglTFRuntimePrimitive> SourcePrimitives, FglTFRuntimePrimitive& OutPrimitive);
@@ -3124,4 +3922,10 @@ public:
 	void SetDownloadTime(const float Value);
 	float GetDownloadTime() const;
 
+	FglTFRuntimeBuffersIOStats GetBuffersIOStats() const
+	{
+		FScopeLock Lock(&BufferRangesLock);
+		return BuffersIOStats;
+	}
+
 };
@@ -48,11 +48,15 @@ public class glTFRuntime : ModuleRules
             }
             );
 
+        AddEngineThirdPartyPrivateStaticDependencies(Target, "zlib");
+
         if (Target.Type == TargetType.Editor)
         {
             PrivateDependencyModuleNames.Add("SkeletalMeshUtilitiesCommon");
             PrivateDependencyModuleNames.Add("UnrealEd");
             PrivateDependencyModuleNames.Add("AssetRegistry");
+            // loopback server for the http automation tests
+            PrivateDependencyModuleNames.Add("HTTPServer");
         }
 
 